@@ -0,0 +1,281 @@
+//------------------------------------------------------------------------------
+// slang_c.cpp
+// Stable C API for embedding slang without C++ ABI coupling
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang_c.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "slang/ast/Compilation.h"
+#include "slang/ast/Symbol.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/types/Type.h"
+#include "slang/diagnostics/DiagnosticClient.h"
+#include "slang/diagnostics/DiagnosticEngine.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+
+using namespace slang;
+using namespace slang::ast;
+using namespace slang::syntax;
+
+namespace {
+
+slang_string toCStr(std::string_view str) {
+    return {str.data(), str.size()};
+}
+
+std::string_view fromCStr(slang_string str) {
+    return std::string_view(str.data, str.length);
+}
+
+const Symbol* fromHandle(const slang_symbol* symbol) {
+    return reinterpret_cast<const Symbol*>(symbol);
+}
+
+const slang_symbol* toHandle(const Symbol* symbol) {
+    return reinterpret_cast<const slang_symbol*>(symbol);
+}
+
+/// Forwards each reported diagnostic to a caller-provided C callback.
+/// The strings handed out are views into the engine's formatting buffers
+/// and are only valid for the duration of the callback, which is exactly
+/// the contract the C header documents.
+class CallbackDiagnosticClient : public DiagnosticClient {
+public:
+    CallbackDiagnosticClient(slang_diagnostic_callback callback, void* user) :
+        callback(callback), user(user) {}
+
+    void report(const ReportedDiagnostic& diag) override {
+        slang_diagnostic result{};
+        result.code = toCStr(toString(diag.originalDiagnostic.code));
+        result.message = toCStr(diag.formattedMessage);
+        result.severity = static_cast<slang_severity>(diag.severity);
+
+        if (diag.location != SourceLocation::NoLocation) {
+            result.file = toCStr(sourceManager->getFileName(diag.location));
+            result.line = uint32_t(sourceManager->getLineNumber(diag.location));
+            result.column = uint32_t(sourceManager->getColumnNumber(diag.location));
+        }
+
+        callback(&result, user);
+    }
+
+private:
+    slang_diagnostic_callback callback;
+    void* user;
+};
+
+// Symbol handles are raw Symbol pointers, so accessors that need per-handle
+// backing storage look the owning wrapper up here. Embedders may drive
+// several compilations from separate threads; the registry itself is the
+// only shared state.
+std::mutex registryMutex;
+flat_hash_map<const Compilation*, slang_compilation*>& getRegistry() {
+    static flat_hash_map<const Compilation*, slang_compilation*> registry;
+    return registry;
+}
+
+slang_compilation* findWrapper(const Symbol& symbol) {
+    auto scope = symbol.getParentScope();
+    if (!scope)
+        return nullptr;
+
+    std::lock_guard lock(registryMutex);
+    auto& registry = getRegistry();
+    if (auto it = registry.find(&scope->getCompilation()); it != registry.end())
+        return it->second;
+    return nullptr;
+}
+
+} // namespace
+
+struct slang_session {
+    SourceManager sourceManager;
+    Bag options;
+    std::vector<SourceBuffer> buffers;
+    bool compiled = false;
+};
+
+struct slang_compilation {
+    explicit slang_compilation(slang_session& session) :
+        session(session), compilation(session.options) {}
+
+    slang_session& session;
+    Compilation compilation;
+
+    // Backing storage for strings that have to be materialized on demand;
+    // a deque so that handed-out views survive later insertions.
+    std::deque<std::string> ownedStrings;
+
+    // Member lists are flattened once per scope so that the C side can
+    // index them in constant time.
+    flat_hash_map<const Symbol*, std::vector<const Symbol*>> memberCache;
+
+    const std::vector<const Symbol*>& getMembers(const Symbol& symbol) {
+        auto [it, inserted] = memberCache.emplace(&symbol, std::vector<const Symbol*>());
+        if (inserted) {
+            if (auto scope = symbol.as_if<Scope>()) {
+                for (auto& member : scope->members())
+                    it->second.push_back(&member);
+            }
+        }
+        return it->second;
+    }
+};
+
+slang_session* slang_session_create(void) {
+    try {
+        return new slang_session();
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void slang_session_destroy(slang_session* session) {
+    delete session;
+}
+
+int slang_session_add_source(slang_session* session, slang_string path, slang_string text) {
+    if (!session || session->compiled)
+        return 0;
+
+    try {
+        auto buffer = session->sourceManager.assignText(fromCStr(path), fromCStr(text));
+        session->buffers.push_back(buffer);
+        return 1;
+    }
+    catch (...) {
+        // The source manager throws if the path has already been assigned.
+        return 0;
+    }
+}
+
+slang_compilation* slang_session_compile(slang_session* session) {
+    if (!session || session->compiled)
+        return nullptr;
+
+    try {
+        auto result = std::make_unique<slang_compilation>(*session);
+        for (auto& buffer : session->buffers) {
+            result->compilation.addSyntaxTree(
+                SyntaxTree::fromBuffer(buffer, session->sourceManager, session->options));
+        }
+
+        session->compiled = true;
+
+        std::lock_guard lock(registryMutex);
+        getRegistry().emplace(&result->compilation, result.get());
+        return result.release();
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void slang_compilation_destroy(slang_compilation* compilation) {
+    if (!compilation)
+        return;
+
+    {
+        std::lock_guard lock(registryMutex);
+        getRegistry().erase(&compilation->compilation);
+    }
+    delete compilation;
+}
+
+size_t slang_compilation_report_diagnostics(slang_compilation* compilation,
+                                            slang_diagnostic_callback callback, void* user) {
+    if (!compilation || !callback)
+        return 0;
+
+    try {
+        DiagnosticEngine engine(compilation->session.sourceManager);
+        engine.addClient(std::make_shared<CallbackDiagnosticClient>(callback, user));
+
+        for (auto& diag : compilation->compilation.getAllDiagnostics())
+            engine.issue(diag);
+
+        return size_t(engine.getNumErrors());
+    }
+    catch (...) {
+        return 0;
+    }
+}
+
+const slang_symbol* slang_compilation_find_symbol(slang_compilation* compilation,
+                                                  slang_string hierarchical_path) {
+    if (!compilation)
+        return nullptr;
+
+    try {
+        auto& root = compilation->compilation.getRoot();
+        return toHandle(root.lookupName(fromCStr(hierarchical_path)));
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+slang_string slang_symbol_name(const slang_symbol* symbol) {
+    if (!symbol)
+        return {};
+    return toCStr(fromHandle(symbol)->name);
+}
+
+slang_string slang_symbol_kind(const slang_symbol* symbol) {
+    if (!symbol)
+        return {};
+    return toCStr(toString(fromHandle(symbol)->kind));
+}
+
+slang_string slang_symbol_type(const slang_symbol* symbol) {
+    if (!symbol)
+        return {};
+
+    auto sym = fromHandle(symbol);
+    auto declaredType = sym->getDeclaredType();
+    if (!declaredType)
+        return {};
+
+    auto compilation = findWrapper(*sym);
+    if (!compilation)
+        return {};
+
+    return toCStr(compilation->ownedStrings.emplace_back(declaredType->getType().toString()));
+}
+
+size_t slang_symbol_member_count(const slang_symbol* symbol) {
+    if (!symbol)
+        return 0;
+
+    auto sym = fromHandle(symbol);
+    auto compilation = findWrapper(*sym);
+    if (!compilation)
+        return 0;
+
+    return compilation->getMembers(*sym).size();
+}
+
+const slang_symbol* slang_symbol_member(const slang_symbol* symbol, size_t index) {
+    if (!symbol)
+        return nullptr;
+
+    auto sym = fromHandle(symbol);
+    auto compilation = findWrapper(*sym);
+    if (!compilation)
+        return nullptr;
+
+    auto& members = compilation->getMembers(*sym);
+    if (index >= members.size())
+        return nullptr;
+
+    return toHandle(members[index]);
+}
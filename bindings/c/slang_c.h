@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+// slang_c.h
+// Stable C API for embedding slang without C++ ABI coupling
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#ifndef SLANG_C_H
+#define SLANG_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A non-owning, length-delimited string. Strings returned by the library are
+ * zero-copy views into library-owned storage; they are NOT nul-terminated and
+ * remain valid for the lifetime of the object they were queried from (or, for
+ * diagnostics, for the duration of the reporting callback). Strings passed
+ * into the library only need to be valid for the duration of the call. */
+typedef struct slang_string {
+    const char* data;
+    size_t length;
+} slang_string;
+
+/* A session owns the source text and compilation options. Source buffers are
+ * registered up front from caller-provided memory; the text is copied exactly
+ * once into the session (it must be nul-terminated internally) and never
+ * re-read from disk. */
+typedef struct slang_session slang_session;
+
+/* An immutable compiled design. Multiple compilations may be created from
+ * separate sessions in the same process; a compilation must be destroyed
+ * before its owning session. */
+typedef struct slang_compilation slang_compilation;
+
+/* An opaque symbol handle, borrowed from a compilation. Handles are valid
+ * until the compilation is destroyed and never need to be freed. */
+typedef struct slang_symbol slang_symbol;
+
+/* Mirrors slang::DiagnosticSeverity. */
+typedef enum slang_severity {
+    SLANG_SEVERITY_IGNORED = 0,
+    SLANG_SEVERITY_NOTE,
+    SLANG_SEVERITY_WARNING,
+    SLANG_SEVERITY_ERROR,
+    SLANG_SEVERITY_FATAL
+} slang_severity;
+
+/* One reported diagnostic. All strings are views that are only valid for the
+ * duration of the reporting callback; copy them if they need to outlive it. */
+typedef struct slang_diagnostic {
+    slang_string code;    /* symbolic name, e.g. "UndeclaredIdentifier" */
+    slang_string message; /* formatted message text */
+    slang_string file;    /* buffer path; empty if there is no location */
+    uint32_t line;        /* 1-based; 0 if there is no location */
+    uint32_t column;      /* 1-based; 0 if there is no location */
+    slang_severity severity;
+} slang_diagnostic;
+
+typedef void (*slang_diagnostic_callback)(const slang_diagnostic* diag, void* user);
+
+/* Creates a new session with default compilation options.
+ * Returns NULL on failure. */
+slang_session* slang_session_create(void);
+
+/* Destroys a session. All compilations created from it must already have
+ * been destroyed. Passing NULL is a no-op. */
+void slang_session_destroy(slang_session* session);
+
+/* Registers a source buffer with the session under the given path. The path
+ * is used for include resolution and diagnostic locations; it does not need
+ * to exist on disk. Returns nonzero on success, zero if the path has already
+ * been registered or the session has already been compiled. */
+int slang_session_add_source(slang_session* session, slang_string path, slang_string text);
+
+/* Parses all registered buffers and creates a compilation. Elaboration is
+ * performed lazily as diagnostics and symbols are queried.
+ * Returns NULL on failure. */
+slang_compilation* slang_session_compile(slang_session* session);
+
+/* Destroys a compilation and all symbol handles borrowed from it.
+ * Passing NULL is a no-op. */
+void slang_compilation_destroy(slang_compilation* compilation);
+
+/* Elaborates the design (on first call) and streams every diagnostic to the
+ * given callback in source order. Returns the number of errors reported. */
+size_t slang_compilation_report_diagnostics(slang_compilation* compilation,
+                                            slang_diagnostic_callback callback, void* user);
+
+/* Looks up a symbol by hierarchical path (e.g. "top.block.sig").
+ * Returns NULL if no such symbol exists. */
+const slang_symbol* slang_compilation_find_symbol(slang_compilation* compilation,
+                                                  slang_string hierarchical_path);
+
+/* Returns the symbol's declared name; empty for anonymous symbols. */
+slang_string slang_symbol_name(const slang_symbol* symbol);
+
+/* Returns the symbol's kind as a string, e.g. "Instance" or "Variable". */
+slang_string slang_symbol_kind(const slang_symbol* symbol);
+
+/* Returns the declared type of a value symbol as a formatted string,
+ * e.g. "logic[7:0]". Returns an empty string for non-value symbols. */
+slang_string slang_symbol_type(const slang_symbol* symbol);
+
+/* Returns the number of member symbols if this symbol is a scope,
+ * otherwise zero. */
+size_t slang_symbol_member_count(const slang_symbol* symbol);
+
+/* Returns the member at the given index, in declaration order.
+ * Returns NULL if the symbol is not a scope or the index is out of range. */
+const slang_symbol* slang_symbol_member(const slang_symbol* symbol, size_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SLANG_C_H */
@@ -6,6 +6,7 @@
 #include "pyslang.h"
 
 void registerAST(py::module_& m);
+void registerBulk(py::module_& m);
 void registerCompilation(py::module_& m);
 void registerNumeric(py::module_& m);
 void registerUtil(py::module_& m);
@@ -24,6 +25,7 @@ PYBIND11_MODULE(pyslang, m) {
 #endif
 
     registerAST(m);
+    registerBulk(m);
     registerCompilation(m);
     registerNumeric(m);
     registerUtil(m);
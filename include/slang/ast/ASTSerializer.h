@@ -30,12 +30,30 @@ class Symbol;
 class Type;
 class TimingControl;
 
+/// Serializes an AST to JSON for debugging and downstream inspection.
+///
+/// JSON is the only supported output format. The elaborated AST is a dense
+/// pointer graph allocated out of the Compilation's arena, with lazily
+/// resolved members and many deduplicated / interned objects (types,
+/// constants); there is no position-independent representation of it that
+/// could be written out and memory-mapped back in without rebuilding the
+/// graph, which is what elaboration already does. Tools that want to avoid
+/// repeated elaboration should share a Compilation in-process instead.
 class SLANG_EXPORT ASTSerializer {
 public:
     ASTSerializer(Compilation& compilation, JsonWriter& writer);
 
     void setIncludeAddresses(bool set) { includeAddrs = set; }
 
+    /// Serializes the entire design rooted at the given compilation, splitting
+    /// the work across up to @a threadCount threads partitioned by top-level
+    /// member. The whole design is forced through elaboration first so that
+    /// workers never trigger lazy binding, and per-member chunks are stitched
+    /// back together in member order, so the output is byte-identical to a
+    /// single-threaded serialize() of the root symbol.
+    static std::string serializeParallel(Compilation& compilation, uint32_t threadCount,
+                                         bool prettyPrint = false, bool includeAddresses = true);
+
     void serialize(const Symbol& symbol, bool inMembersArray = false);
     void serialize(const Expression& expr);
     void serialize(const Statement& statement);
@@ -111,6 +129,11 @@ private:
     Compilation& compilation;
     JsonWriter& writer;
     bool includeAddrs = true;
+
+    // Cleared for serializers running on parallel workers; caching results
+    // on expression nodes and in the compilation's constant arena is not
+    // thread safe.
+    bool cacheEvalResults = true;
 };
 
 } // namespace slang::ast
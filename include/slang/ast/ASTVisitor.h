@@ -121,13 +121,41 @@ auto makeVisitor(Functions... funcs) {
 
 template<typename TVisitor, typename... Args>
 decltype(auto) Symbol::visit(TVisitor&& visitor, Args&&... args) const {
+    // Dispatch goes through a table of function pointers built at compile time
+    // and indexed by kind, so resolving the handler for a node is a single
+    // indexed load. The table is validated at compile time to have an entry
+    // for every symbol kind.
+    using ReturnType = decltype(visitor.visit(*this, std::forward<Args>(args)...));
+    using Dispatch = ReturnType (*)(const Symbol&, TVisitor&, Args&&...);
+
     // clang-format off
-#define SYMBOL(k) case SymbolKind::k: return visitor.visit(*static_cast<const k##Symbol*>(this), std::forward<Args>(args)...)
-#define TYPE(k) case SymbolKind::k: return visitor.visit(*static_cast<const k*>(this), std::forward<Args>(args)...)
-    switch (kind) {
-        case SymbolKind::Unknown: return visitor.visit(*this, std::forward<Args>(args)...);
-        case SymbolKind::DeferredMember: return visitor.visit(*this, std::forward<Args>(args)...);
-        case SymbolKind::TypeAlias: return visitor.visit(*static_cast<const TypeAliasType*>(this), std::forward<Args>(args)...);
+#define SYMBOL(k) entries[size_t(SymbolKind::k)] =                                   \
+        [](const Symbol& sym, TVisitor& visitor, Args&&... args) -> ReturnType {     \
+            return visitor.visit(*static_cast<const k##Symbol*>(&sym),               \
+                                 std::forward<Args>(args)...);                       \
+        }
+#define TYPE(k) entries[size_t(SymbolKind::k)] =                                     \
+        [](const Symbol& sym, TVisitor& visitor, Args&&... args) -> ReturnType {     \
+            return visitor.visit(*static_cast<const k*>(&sym),                       \
+                                 std::forward<Args>(args)...);                       \
+        }
+    struct Table {
+        Dispatch entries[SymbolKind_traits::values.size()] = {};
+
+        constexpr Table() {
+        entries[size_t(SymbolKind::Unknown)] =
+            [](const Symbol& sym, TVisitor& visitor, Args&&... args) -> ReturnType {
+                return visitor.visit(sym, std::forward<Args>(args)...);
+            };
+        entries[size_t(SymbolKind::DeferredMember)] =
+            [](const Symbol& sym, TVisitor& visitor, Args&&... args) -> ReturnType {
+                return visitor.visit(sym, std::forward<Args>(args)...);
+            };
+        entries[size_t(SymbolKind::TypeAlias)] =
+            [](const Symbol& sym, TVisitor& visitor, Args&&... args) -> ReturnType {
+                return visitor.visit(*static_cast<const TypeAliasType*>(&sym),
+                                     std::forward<Args>(args)...);
+            };
         SYMBOL(Root);
         SYMBOL(CompilationUnit);
         SYMBOL(Attribute);
@@ -220,11 +248,23 @@ decltype(auto) Symbol::visit(TVisitor&& visitor, Args&&... args) const {
         TYPE(VirtualInterfaceType);
         TYPE(ErrorType);
         TYPE(NetType);
-    }
+        }
+
+        constexpr bool isComplete() const {
+            for (auto entry : entries) {
+                if (!entry)
+                    return false;
+            }
+            return true;
+        }
+    };
 #undef TYPE
 #undef SYMBOL
     // clang-format on
-    ASSUME_UNREACHABLE;
+
+    static constexpr Table table;
+    static_assert(table.isComplete(), "not every symbol kind has a dispatch entry");
+    return table.entries[size_t(kind)](*this, visitor, std::forward<Args>(args)...);
 }
 
 template<typename TVisitor, typename... Args>
@@ -293,13 +333,27 @@ decltype(auto) TimingControl::visit(TVisitor& visitor, Args&&... args) const {
 template<typename TExpression, typename TVisitor, typename... Args>
 decltype(auto) Expression::visitExpression(TExpression* expr, TVisitor&& visitor,
                                            Args&&... args) const {
+    // As with Symbol::visit above, dispatch is a single indexed load from a
+    // compile-time function pointer table validated to cover every kind.
+    using ReturnType = decltype(visitor.visitInvalid(*expr, std::forward<Args>(args)...));
+    using Dispatch = ReturnType (*)(TExpression&, TVisitor&, Args&&...);
+
     // clang-format off
-#define CASE(k, n) case ExpressionKind::k: return visitor.visit(\
-                        *static_cast<std::conditional_t<std::is_const_v<TExpression>, const n*, n*>>(expr),\
-                            std::forward<Args>(args)...)
+#define CASE(k, n) entries[size_t(ExpressionKind::k)] =                                       \
+        [](TExpression& expr, TVisitor& visitor, Args&&... args) -> ReturnType {              \
+            return visitor.visit(                                                             \
+                *static_cast<std::conditional_t<std::is_const_v<TExpression>, const n*, n*>>( \
+                    &expr),                                                                   \
+                std::forward<Args>(args)...);                                                 \
+        }
+    struct Table {
+        Dispatch entries[ExpressionKind_traits::values.size()] = {};
 
-    switch (expr->kind) {
-        case ExpressionKind::Invalid: return visitor.visitInvalid(*expr, std::forward<Args>(args)...);
+        constexpr Table() {
+        entries[size_t(ExpressionKind::Invalid)] =
+            [](TExpression& expr, TVisitor& visitor, Args&&... args) -> ReturnType {
+                return visitor.visitInvalid(expr, std::forward<Args>(args)...);
+            };
         CASE(IntegerLiteral, IntegerLiteral);
         CASE(RealLiteral, RealLiteral);
         CASE(TimeLiteral, TimeLiteral);
@@ -340,10 +394,22 @@ decltype(auto) Expression::visitExpression(TExpression* expr, TVisitor&& visitor
         CASE(ClockingEvent, ClockingEventExpression);
         CASE(AssertionInstance, AssertionInstanceExpression);
         CASE(TaggedUnion, TaggedUnionExpression);
-    }
+        }
+
+        constexpr bool isComplete() const {
+            for (auto entry : entries) {
+                if (!entry)
+                    return false;
+            }
+            return true;
+        }
+    };
 #undef CASE
     // clang-format on
-    ASSUME_UNREACHABLE;
+
+    static constexpr Table table;
+    static_assert(table.isComplete(), "not every expression kind has a dispatch entry");
+    return table.entries[size_t(expr->kind)](*expr, visitor, std::forward<Args>(args)...);
 }
 
 template<typename TVisitor, typename... Args>
@@ -7,17 +7,24 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <array>
+#include <deque>
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
 
 #include "slang/ast/InstancePath.h"
 #include "slang/ast/Scope.h"
 #include "slang/ast/Symbol.h"
+#include "slang/ast/symbols/ValueSymbol.h"
 #include "slang/diagnostics/Diagnostics.h"
 #include "slang/numeric/Time.h"
 #include "slang/syntax/SyntaxFwd.h"
 #include "slang/syntax/SyntaxNode.h"
 #include "slang/util/Bag.h"
 #include "slang/util/BumpAllocator.h"
+#include "slang/util/Cancellation.h"
 #include "slang/util/IntervalMap.h"
 #include "slang/util/SafeIndexedVector.h"
 
@@ -31,23 +38,26 @@ namespace slang::ast {
 
 class AttributeSymbol;
 class ASTContext;
+class ClassType;
 class CompilationUnitSymbol;
 class Definition;
+class ElabCache;
+class EvalBytecode;
 class Expression;
 class GenericClassDefSymbol;
+class InstanceSymbol;
 class InterfacePortSymbol;
 class MethodPrototypeSymbol;
 class ModportSymbol;
 class PackageSymbol;
 class PrimitiveSymbol;
 class PortConnection;
+struct PortConnectionShape;
 class RootSymbol;
 class Statement;
+struct NormalizedConstraintSet;
 class SubroutineSymbol;
 class SystemSubroutine;
-class ValueDriver;
-
-using DriverIntervalMap = IntervalMap<uint32_t, const ValueDriver*>;
 using UnrollIntervalMap = IntervalMap<uint32_t, std::monostate>;
 
 enum class IntegralFlags : uint8_t;
@@ -66,6 +76,21 @@ enum class SLANG_EXPORT MinTypMax {
     Max
 };
 
+/// A snapshot of how far a compilation has progressed, passed to
+/// @a CompilationOptions::progressCallback.
+struct SLANG_EXPORT CompilationProgress {
+    /// The number of syntax trees that have been added to the compilation.
+    size_t filesAdded = 0;
+
+    /// The number of instance bodies created so far. Instances are discovered
+    /// lazily while elaboration runs, so this keeps growing alongside
+    /// @a instancesChecked and the two only converge near the end.
+    size_t instancesCreated = 0;
+
+    /// The number of instances the design-wide checking pass has reached.
+    size_t instancesChecked = 0;
+};
+
 /// Contains various options that can control compilation behavior.
 struct SLANG_EXPORT CompilationOptions {
     /// The maximum depth of nested module instances (and interfaces/programs),
@@ -127,6 +152,35 @@ struct SLANG_EXPORT CompilationOptions {
     /// means not taking into account procedural for loop unrolling.
     bool strictDriverChecking = false;
 
+    /// Elements of an instance array normally share one full checking pass:
+    /// the first element's body is elaborated and checked, and identical
+    /// siblings (same parameter values, no per-element defparam or bind)
+    /// skip the body walk. If true, every element is checked individually
+    /// instead, at significant cost for large arrays.
+    bool disableInstanceArrayDedup = false;
+
+    /// Entries of a loop generate whose body never references the genvar
+    /// elaborate identically, so they normally share one full checking pass
+    /// in the same way as instance arrays. If true, every entry is checked
+    /// individually instead.
+    bool disableGenerateArrayDedup = false;
+
+    /// If true, the design-wide checking pass doesn't descend into covergroup
+    /// bodies, which skips binding every coverpoint expression, bin list, and
+    /// cross in the design. Testbenches with large covergroup farms can spend
+    /// significant time building coverage models that lint-style runs never
+    /// read; covergroup contents are still resolved lazily if referenced.
+    bool skipCoverageChecks = false;
+
+    /// If true, the design-wide checking pass visits only the signatures of
+    /// class methods that nothing has referenced: return and argument types
+    /// are checked but body statements are left unbound. Bodies still bind
+    /// on demand when a call is actually evaluated. Diagnostics inside
+    /// skipped bodies are not reported, which trades checking coverage for
+    /// elaboration time in runs that touch a small slice of a large class
+    /// library.
+    bool deferClassMethodBodies = false;
+
     /// If true, compile in "linting" mode where we suppress errors that could
     /// be caused by not having an elaborated design.
     bool lintMode = false;
@@ -155,6 +209,25 @@ struct SLANG_EXPORT CompilationOptions {
     /// A list of parameters to override, of the form &lt;name>=&lt;value> -- note that
     /// for now at least this only applies to parameters in top-level modules.
     std::vector<std::string> paramOverrides;
+
+    /// A token that allows long-running elaboration and constant evaluation
+    /// to be cancelled from another thread. It's checked at scope elaboration
+    /// boundaries, per-instance during the final diagnostic pass, and at
+    /// constant evaluation steps; when signaled, the work in progress unwinds
+    /// by throwing CancellationException out of the calling API.
+    CancellationToken cancellationToken;
+
+    /// If set, invoked periodically as compilation proceeds so that callers
+    /// can distinguish a long elaboration from a hung one and estimate how
+    /// much work remains. The callback runs on the thread doing the work, is
+    /// rate limited so it stays cheap enough to leave permanently enabled,
+    /// and must not re-enter the compilation object.
+    std::function<void(const CompilationProgress&)> progressCallback;
+
+    /// If set, a persistent cache of elaboration results consulted and
+    /// updated by the diagnostic pass, so that bodies that elaborated
+    /// cleanly in a previous run can skip re-checking. See ElabCache.
+    std::shared_ptr<ElabCache> elabCache;
 };
 
 /// A node in a tree representing an instance in the design
@@ -197,6 +270,27 @@ public:
     /// Gets the set of syntax trees that have been added to the compilation.
     std::span<const std::shared_ptr<syntax::SyntaxTree>> getSyntaxTrees() const;
 
+    /// Writes a checkpoint of this compilation's post-parse state to @a path.
+    /// The checkpoint embeds the contents of every source file the compilation
+    /// has consulted -- top files and included headers alike -- along with the
+    /// list of syntax trees, so a later process can resume from it without
+    /// repeating file loading even if the original tree has changed underneath
+    /// it. Elaborated state is not serialized: the AST is a pointer-rich arena
+    /// graph, so a restored compilation re-elaborates lazily on demand, the
+    /// same way the defparam fixpoint loop internally rebuilds clones from
+    /// shared syntax. Returns false if the checkpoint could not be written.
+    bool saveCheckpoint(const std::filesystem::path& path) const;
+
+    /// Reconstructs a compilation from a checkpoint previously written by
+    /// @a saveCheckpoint. Source contents come from the checkpoint and are
+    /// registered into @a sourceManager under their original paths (so stale
+    /// on-disk copies are never read); @a optionBag supplies both compilation
+    /// and parsing options since option bags are not serializable. Returns
+    /// nullptr if the checkpoint is missing or malformed.
+    static std::unique_ptr<Compilation> restoreCheckpoint(const std::filesystem::path& path,
+                                                          SourceManager& sourceManager,
+                                                          const Bag& optionBag = {});
+
     /// Gets the compilation unit for the given syntax node. The compilation unit must have
     /// already been added to the compilation previously via a call to @a addSyntaxTree
     const CompilationUnitSymbol* getCompilationUnit(
@@ -232,6 +326,10 @@ public:
     /// Gets the built-in 'std' package.
     const PackageSymbol& getStdPackage() const { return *stdPkg; }
 
+    /// Gets all packages that have been created in the design so far,
+    /// sorted by name.
+    std::vector<const PackageSymbol*> getPackages() const;
+
     /// Creates a new package in the given scope based on the given syntax.
     const PackageSymbol& createPackage(const Scope& scope,
                                        const syntax::ModuleDeclarationSyntax& syntax);
@@ -274,6 +372,14 @@ public:
     /// Sets the attributes associated with the given symbol.
     void setAttributes(const Symbol& symbol, std::span<const AttributeSymbol* const> attributes);
 
+    /// Associates the given attribute syntax with the given symbol. The
+    /// attributes are bound lazily, on the first getAttributes query for the
+    /// symbol, using @a scope; until then elaboration pays only for this
+    /// bookkeeping entry.
+    void setAttributes(const Symbol& symbol,
+                       std::span<const syntax::AttributeInstanceSyntax* const> syntax,
+                       const Scope& scope);
+
     /// Sets the attributes associated with the given statement.
     void setAttributes(const Statement& stmt, std::span<const AttributeSymbol* const> attributes);
 
@@ -334,6 +440,12 @@ public:
     /// elaborated by the compilation to hook up connections to their interface prototypes.
     void addExternInterfaceMethod(const SubroutineSymbol& method);
 
+    /// Gets the compiled bytecode form of the given subroutine's body for use
+    /// during constant evaluation, compiling it on first request. Returns
+    /// nullptr if the body can't be compiled, in which case callers should
+    /// evaluate it by walking the AST instead.
+    const EvalBytecode* getBytecode(const SubroutineSymbol& subroutine);
+
     /// Notes that there is a default clocking block associated with the specified scope.
     void noteDefaultClocking(const Scope& scope, const Symbol& clocking, SourceRange range);
 
@@ -379,6 +491,13 @@ public:
     /// This will cause appropriate errors to be issued.
     void noteNameConflict(const Symbol& symbol);
 
+    /// Notes that an instance body has been created, for progress reporting.
+    void noteInstanceCreated();
+
+    /// Notes that the design-wide checking pass has reached another instance,
+    /// for progress reporting.
+    void noteInstanceChecked();
+
     /// A convenience method for parsing a name string and turning it into a set
     /// of syntax nodes. This is mostly for testing and API purposes; normal
     /// compilation never does this.
@@ -409,12 +528,27 @@ public:
     /// for lazy evaluation.
     const Diagnostics& getSemanticDiagnostics();
 
+    /// Gets the semantic diagnostics produced by just the subtree rooted at
+    /// the given symbol, elaborating it on demand without forcing the rest of
+    /// the design. Results are memoized per root: an elaborated subtree can't
+    /// change within one compilation, so repeated queries for the same symbol
+    /// (an IDE asking again for an unchanged scope) return the cached set
+    /// without re-running the checking visitor. The design-wide cross checks
+    /// (DPI methods, extern interface methods, bind targets) only run in the
+    /// full @a getSemanticDiagnostics pass.
+    const Diagnostics& getSemanticDiagnostics(const Symbol& subtreeRoot);
+
     /// Gets all of the diagnostics produced during compilation.
     const Diagnostics& getAllDiagnostics();
 
     /// Adds a set of diagnostics to the compilation's list of semantic diagnostics.
     void addDiagnostics(const Diagnostics& diagnostics);
 
+    /// Gets the number of distinct diagnostics recorded so far, not counting
+    /// coalesced repeats. The checking pass compares this before and after
+    /// walking a body to decide whether the body elaborated cleanly.
+    size_t getDistinctDiagnosticCount() const { return diagMap.size(); }
+
     /// Gets the default time scale to use when none is specified in the source code.
     std::optional<TimeScale> getDefaultTimeScale() const { return options.defaultTimeScale; }
 
@@ -426,9 +560,39 @@ public:
                         const ASTContext& context);
 
     const Type& getType(bitwidth_t width, bitmask<IntegralFlags> flags);
+    const Type& getPackedArrayType(const Type& elementType, ConstantRange range,
+                                   bitwidth_t fullWidth);
+
+    /// Gets a virtual interface type targeting the given interface instance
+    /// with an optional modport restriction. These are interned, so repeated
+    /// connections to the same interface share one type object (and type
+    /// matching between them short circuits on identity); the location of the
+    /// first request is kept.
+    const Type& getVirtualInterfaceType(const InstanceSymbol& iface, const ModportSymbol* modport,
+                                        bool isRealIface, SourceLocation loc);
     const Type& getScalarType(bitmask<IntegralFlags> flags);
     const NetType& getNetType(parsing::TokenKind kind) const;
 
+    /// Cached verdicts about implicitly converting a value of one type to
+    /// another. Compatibility is a pure function of the two canonical types,
+    /// so assignment binding computes these once per type pair instead of
+    /// re-walking the type structures at every assignment site.
+    struct TypeCompat {
+        bool isEquivalent;
+        bool isAssignmentCompatible;
+    };
+
+    /// Gets the conversion verdicts for assigning a value of type
+    /// @a sourceType to something of type @a targetType, computing and
+    /// caching them on first use for the type pair.
+    TypeCompat getTypeCompat(const Type& targetType, const Type& sourceType);
+
+    /// Gets the flattened, normalized form of the constraint blocks visible
+    /// on the given class, computing it on first request and caching it for
+    /// the lifetime of the compilation. Intended for randomization engines
+    /// that would otherwise re-walk the constraint AST on every analysis.
+    const NormalizedConstraintSet& getNormalizedConstraints(const ClassType& classType);
+
     /// Various built-in type symbols for easy access.
     const Type& getBitType() const { return *bitType; }
     const Type& getLogicType() const { return *logicType; }
@@ -454,6 +618,51 @@ public:
         return constantAllocator.emplace(std::move(value));
     }
 
+    /// Gets a shared preallocated constant for commonly occurring values
+    /// (small 32-bit signed two-state integers), or nullptr if the given
+    /// value is not one that is interned. A non-null result can be used
+    /// instead of pooling a per-site copy via @a allocConstant.
+    const ConstantValue* getCommonConstant(const ConstantValue& value);
+
+    /// Interns the given constant value in a per-compilation pool and returns
+    /// a pointer to a shared immutable copy, allocating one only the first
+    /// time a given value is seen. Used for evaluated parameter values so
+    /// that thousands of instances sharing the same overrides reference one
+    /// stored value instead of each holding their own copy.
+    const ConstantValue* internConstant(ConstantValue&& value);
+
+    /// Gets the shared source-less integer literal expression previously
+    /// cached for the given small value, or nullptr if none has been
+    /// created yet. These flyweights back the compiler-generated selects
+    /// built during unrolling and driver tracking.
+    Expression* getCachedIntLiteral(int32_t value) const;
+
+    /// Caches a shared source-less integer literal expression for reuse
+    /// by later requests for the same value.
+    void cacheIntLiteral(int32_t value, Expression& expr);
+
+    /// Gets a previously cached array of resolved port connection shapes
+    /// (one per port in the target definition's port list) for the given
+    /// instantiating scope and instance syntax, or nullptr if none has been
+    /// cached yet. See PortConnectionShape.
+    const PortConnectionShape* getCachedPortConnectionShapes(
+        const Scope& scope, const syntax::SyntaxNode& syntax) const;
+
+    /// Caches an array of resolved port connection shapes, one per port of
+    /// the instantiated definition, so that later rows of the same instance
+    /// array can stamp their connections from it instead of re-resolving.
+    void cachePortConnectionShapes(const Scope& scope, const syntax::SyntaxNode& syntax,
+                                   const PortConnectionShape* shapes);
+
+    /// Gets a previously cached bound instance for the given argument-less
+    /// sequence or property symbol, or nullptr if none has been cached yet.
+    const Expression* getCachedAssertionInstance(const Symbol& symbol) const;
+
+    /// Caches the bound instance of an argument-less sequence or property so
+    /// that later instantiation sites can share the bound body instead of
+    /// re-binding it from scratch.
+    void cacheAssertionInstance(const Symbol& symbol, const Expression& expr);
+
     /// Allocates a symbol map.
     SymbolMap* allocSymbolMap() { return symbolMapAllocator.emplace(); }
 
@@ -466,6 +675,18 @@ public:
         return genericClassAllocator.emplace(std::forward<Args>(args)...);
     }
 
+    /// Adds a driver to the compilation-wide driver pool and returns its index.
+    /// Drivers are packed contiguously because large designs can create many
+    /// millions of them; the per-symbol driver maps store these 32-bit indices
+    /// instead of full pointers.
+    uint32_t addDriver(ValueDriver&& driver) {
+        driverPool.emplace_back(std::move(driver));
+        return uint32_t(driverPool.size() - 1);
+    }
+
+    /// Gets a driver previously registered via @a addDriver.
+    const ValueDriver& getDriver(uint32_t index) const { return driverPool[index]; }
+
     DriverIntervalMap::allocator_type& getDriverMapAllocator() { return driverMapAllocator; }
     UnrollIntervalMap::allocator_type& getUnrollIntervalMapAllocator() {
         return unrollIntervalMapAllocator;
@@ -477,6 +698,39 @@ public:
     /// be elaborated and any relevant diagnostics to be issued.
     void forceElaborate(const Symbol& symbol);
 
+    /// Gets the lock that serializes lazy binding work (declared types,
+    /// initializers, subroutine bodies) when multiple threads force bindings
+    /// on a finished AST. Readers that find an already-published result
+    /// never take this lock.
+    std::recursive_mutex& getBindLock() const { return bindLock; }
+
+    /// A breakdown of the memory held alive by a compilation, grouped by the
+    /// arena that owns it. Useful for seeing what dominates in large builds.
+    struct MemoryStats {
+        /// Symbols, types, expressions, and everything else allocated
+        /// directly from the compilation's own arena.
+        BumpAllocator::MemoryStats ast;
+
+        /// Scope name maps.
+        BumpAllocator::MemoryStats symbolMaps;
+
+        /// Maps used for caching pointer-to-pointer relationships.
+        BumpAllocator::MemoryStats pointerMaps;
+
+        /// Evaluated constant values.
+        BumpAllocator::MemoryStats constants;
+
+        /// Specializations of generic class types.
+        BumpAllocator::MemoryStats genericClasses;
+
+        /// Tokens and syntax nodes of all syntax trees added to the compilation.
+        BumpAllocator::MemoryStats syntax;
+    };
+
+    /// Gathers memory statistics for this compilation and all of the
+    /// syntax trees that have been added to it.
+    MemoryStats getMemoryStats() const;
+
     int getNextEnumSystemId() { return nextEnumSystemId++; }
     int getNextStructSystemId() { return nextStructSystemId++; }
     int getNextUnionSystemId() { return nextUnionSystemId++; }
@@ -484,6 +738,7 @@ public:
 private:
     friend class Lookup;
     friend class Scope;
+    friend class Symbol;
 
     // These functions are called by Scopes to create and track various members.
     Scope::DeferredMemberData& getOrAddDeferredData(Scope::DeferredMemberIndex& index);
@@ -493,8 +748,6 @@ private:
     bool doTypoCorrection() const { return typoCorrections < options.typoCorrectionLimit; }
     void didTypoCorrection() { typoCorrections++; }
 
-    std::span<const AttributeSymbol* const> getAttributes(const void* ptr) const;
-
     Diagnostic& addDiag(Diagnostic diag);
 
     const RootSymbol& getRoot(bool skipDefParamsAndBinds);
@@ -504,16 +757,43 @@ private:
     void checkModportExports(
         std::span<const std::pair<const InterfacePortSymbol*, const ModportSymbol*>> modports);
     void checkElemTimeScale(std::optional<TimeScale> timeScale, SourceRange sourceRange);
+    void collectDefinitionMetadata(const syntax::SyntaxTree& tree);
+    bool resolveDeferredDefinitions(std::string_view name);
     void resolveDefParamsAndBinds();
     void resolveBindTargets(const syntax::BindDirectiveSyntax& syntax, const Scope& scope,
                             SmallVector<const Symbol*>& instTargets, const Definition** defTarget);
     void checkBindTargetParams(const syntax::BindDirectiveSyntax& syntax, const Scope& scope,
                                std::span<const Symbol* const> instTargets,
                                const Definition* defTarget);
+    void reportProgress();
 
     // Stored options object.
     CompilationOptions options;
 
+    // Counters reported through options.progressCallback, plus a running
+    // event count used to rate limit the callback itself.
+    CompilationProgress progress;
+    size_t progressEvents = 0;
+
+    // Shared flyweights for common small constant values and the source-less
+    // integer literals that reference them; slot 0 holds the value -1.
+    std::array<const ConstantValue*, 66> commonConstants{};
+    std::array<Expression*, 66> cachedIntLiterals{};
+
+    // Deduplication table for interned constant values; entries point into
+    // the constant allocator. See internConstant. Equality here is strict
+    // representational identity, not ConstantValue::operator== -- the latter
+    // goes through exactlyEqual for integers, which is width- and
+    // sign-insensitive and would let one parameter receive another's storage
+    // with a different bit width.
+    struct ConstantDerefHasher {
+        size_t operator()(const ConstantValue* cv) const;
+    };
+    struct ConstantDerefEq {
+        bool operator()(const ConstantValue* a, const ConstantValue* b) const;
+    };
+    flat_hash_set<const ConstantValue*, ConstantDerefHasher, ConstantDerefEq> internedConstants;
+
     // Specialized allocators for types that are not trivially destructible.
     TypedBumpAllocator<SymbolMap> symbolMapAllocator;
     TypedBumpAllocator<PointerMap> pointerMapAllocator;
@@ -522,6 +802,12 @@ private:
     DriverIntervalMap::allocator_type driverMapAllocator;
     UnrollIntervalMap::allocator_type unrollIntervalMapAllocator;
 
+    // Backing storage for all value drivers in the compilation, looked up
+    // by the indices stored in each symbol's driver map. A deque gives
+    // stable addresses so callers can hold ValueDriver pointers across
+    // later insertions.
+    std::deque<ValueDriver> driverPool;
+
     // A table to look up scalar types based on combinations of the three flags: signed, fourstate,
     // reg. Two of the entries are not valid and will be nullptr (!fourstate & reg).
     Type* scalarTypeTable[8]{nullptr};
@@ -559,6 +845,24 @@ private:
     // A cache of vector types, keyed on various properties such as bit width.
     flat_hash_map<uint32_t, const Type*> vectorTypeCache;
 
+    // A cache of packed array types, keyed on element type and range, so that
+    // structurally identical arrays are uniquified and compare by pointer.
+    flat_hash_map<std::tuple<const Type*, int32_t, int32_t>, const Type*> packedArrayCache;
+
+    // A cache of virtual interface types, keyed on the target instance and
+    // modport, so that thousands of connections to the same interface all
+    // share a single type object.
+    flat_hash_map<std::tuple<const InstanceSymbol*, const ModportSymbol*, bool>, const Type*>
+        virtualIfaceTypeCache;
+
+    // Cached assignment conversion verdicts between canonical type pairs,
+    // keyed as (target, source). Accessed by getTypeCompat.
+    flat_hash_map<std::tuple<const Type*, const Type*>, TypeCompat> typeCompatCache;
+
+    // Cached normalized constraint sets, one per class type. Accessed by
+    // getNormalizedConstraints.
+    flat_hash_map<const ClassType*, const NormalizedConstraintSet*> normalizedConstraintCache;
+
     // Map from syntax kinds to the built-in types.
     flat_hash_map<syntax::SyntaxKind, const Type*> knownTypes;
 
@@ -575,8 +879,20 @@ private:
     // The name map for system methods.
     flat_hash_map<std::tuple<std::string_view, SymbolKind>, const SystemSubroutine*> methodMap;
 
-    // Map from pointers (to symbols, statements, expressions) to their associated attributes.
-    flat_hash_map<const void*, std::span<const AttributeSymbol* const>> attributeMap;
+    // Maps from owners to their associated attributes, sharded by owner kind
+    // so that the symbol shard -- by far the largest in attribute-heavy gate
+    // netlists -- stays dense and the others aren't polluted by it. Symbol
+    // attributes are recorded as raw syntax at elaboration time and only
+    // materialized into bound AttributeSymbols on first query.
+    struct SymbolAttributeEntry {
+        std::span<const AttributeSymbol* const> attributes;
+        std::span<const syntax::AttributeInstanceSyntax* const> syntax;
+        const Scope* bindScope = nullptr; // non-null until materialized
+    };
+    mutable flat_hash_map<const Symbol*, SymbolAttributeEntry> symbolAttributes;
+    flat_hash_map<const Statement*, std::span<const AttributeSymbol* const>> stmtAttributes;
+    flat_hash_map<const Expression*, std::span<const AttributeSymbol* const>> exprAttributes;
+    flat_hash_map<const PortConnection*, std::span<const AttributeSymbol* const>> connAttributes;
 
     // A set of all instantiated names in the design; used for determining whether a given
     // module has ever been instantiated to know whether it should be considered top-level.
@@ -596,14 +912,70 @@ private:
     // The key is a combination of definition name + the scope in which it was declared.
     flat_hash_map<std::tuple<std::string_view, const Scope*>, Definition*> definitionMap;
 
+    // A one-entry MRU for definition lookups; instantiations tend to come in
+    // runs of the same definition, and this skips the name hashing for those.
+    // Cleared whenever a new definition is added.
+    mutable std::string_view lastDefinitionName;
+    mutable const Scope* lastDefinitionScope = nullptr;
+    mutable const Definition* lastFoundDefinition = nullptr;
+
     // A list of all created definitions, as storage for their memory.
     std::vector<std::unique_ptr<Definition>> definitionMemory;
 
+    // Module declarations whose body parsing was deferred (see
+    // ParserOptions::deferModuleBodies), keyed by definition name. The actual
+    // Definition object is created on the first name lookup that would
+    // otherwise miss, at which point the owning syntax tree expands the body.
+    struct DeferredDefinition {
+        const Scope* scope;
+        LookupLocation location;
+        const syntax::ModuleDeclarationSyntax* syntax;
+    };
+    flat_hash_map<std::string_view, std::vector<DeferredDefinition>> deferredDefinitions;
+
     // A map from diag code + location to the diagnostics that have occurred at that location.
     // This is used to collapse duplicate diagnostics across instantiations into a single report.
-    using DiagMap = flat_hash_map<std::tuple<DiagCode, SourceLocation>, std::vector<Diagnostic>>;
+    // Repeated instantiations produce many copies that differ only in instance path, so instead
+    // of materializing each copy we store every distinct diagnostic (by logical equality) once,
+    // plus a small record per copy of the originating symbol and which distinct diagnostic it
+    // matched. The most recently added diagnostic is kept unmerged in @a pending because the
+    // caller may still be streaming arguments into it.
+    struct CoalescedDiags {
+        std::vector<Diagnostic> distinct;
+        std::vector<std::pair<const Symbol*, uint32_t>> copies;
+        Diagnostic pending;
+    };
+    using DiagMap = flat_hash_map<std::tuple<DiagCode, SourceLocation>, CoalescedDiags>;
     DiagMap diagMap;
 
+    // Folds the pending diagnostic of the given entry into its deduplicated storage.
+    // Idempotent; folding clears the pending slot.
+    void mergePendingDiag(CoalescedDiags& entry);
+
+    // Memoized per-subtree diagnostic queries, keyed by the subtree root.
+    // Entries are never invalidated since an elaborated subtree can't change.
+    flat_hash_map<const Symbol*, std::unique_ptr<Diagnostics>> subtreeDiagCache;
+
+    // A cache of compiled bytecode for constant function bodies, filled in
+    // lazily by getBytecode. A null entry records that compilation was
+    // attempted and failed so it isn't retried on every call.
+    flat_hash_map<const SubroutineSymbol*, std::unique_ptr<const EvalBytecode>> bytecodeCache;
+
+    // A cache of resolved port connection shapes keyed on the instantiating
+    // scope and instance syntax, so that repeated rows of an instance array
+    // stamp out their connections instead of re-resolving each one.
+    flat_hash_map<std::tuple<const Scope*, const syntax::SyntaxNode*>, const PortConnectionShape*>
+        portConnShapeCache;
+
+    // A cache of bound argument-less sequence / property instances, so that
+    // designs instantiating the same declaration many times share one body.
+    flat_hash_map<const Symbol*, const Expression*> assertionInstanceCache;
+
+    // A cache of formatted hierarchical path prefixes, used to avoid rebuilding
+    // the same ancestor chains when many diagnostics or serialized symbols share
+    // a deep hierarchy. Accessed by Symbol::getHierarchicalPath.
+    flat_hash_map<const Symbol*, std::string> hierPathCache;
+
     // A map of packages to the set of names that are candidates for being
     // exported from those packages.
     flat_hash_map<const PackageSymbol*, flat_hash_map<std::string_view, const Symbol*>>
@@ -620,6 +992,7 @@ private:
 
     std::unique_ptr<RootSymbol> root;
     const SourceManager* sourceManager = nullptr;
+    mutable std::recursive_mutex bindLock;
     size_t numErrors = 0;    // total number of errors inserted into the diagMap
     bool finalized = false;
     bool finalizing = false; // to prevent reentrant calls to getRoot()
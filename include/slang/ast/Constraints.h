@@ -285,4 +285,82 @@ public:
     }
 };
 
+class ClassPropertySymbol;
+class ClassType;
+
+/// Canonical relational operators for normalized constraint terms.
+/// The greater-than forms are rewritten into these by swapping operands.
+enum class SLANG_EXPORT NormalizedRelOp { Equal, NotEqual, LessThan, LessThanEqual };
+
+/// A single flattened term of a class's normalized constraint set.
+/// @see NormalizedConstraintSet
+struct SLANG_EXPORT NormalizedConstraint {
+    enum Kind {
+        /// `left relOp right` must hold.
+        Relation,
+
+        /// `left` must fall within one of `intervals`.
+        Membership,
+
+        /// `items` must take pairwise distinct values.
+        Unique,
+
+        /// The boolean expression `left` must be true.
+        Truth,
+
+        /// A constraint with no flattened form (e.g. foreach);
+        /// `opaque` points at the original AST node.
+        Opaque
+    } kind;
+
+    /// A guard from an enclosing implication or conditional constraint;
+    /// the term only applies when all of its guards hold. Guards from
+    /// else branches are negated.
+    struct Guard {
+        not_null<const Expression*> condition;
+        bool negated;
+    };
+
+    /// A closed integer interval; single values have low == high.
+    struct Interval {
+        not_null<const ConstantValue*> low;
+        not_null<const ConstantValue*> high;
+    };
+
+    NormalizedRelOp relOp = NormalizedRelOp::Equal;
+    const Expression* left = nullptr;
+    const Expression* right = nullptr;
+    std::span<const Interval> intervals;
+    std::span<const Expression* const> items;
+    const Constraint* opaque = nullptr;
+
+    /// Guards that must hold for the term to apply, outermost first.
+    std::span<const Guard> guards;
+
+    /// The random class properties this term constrains.
+    std::span<const ClassPropertySymbol* const> support;
+
+    /// Index of the independent partition this term belongs to. Terms in
+    /// different partitions share no random variables and can be solved
+    /// separately.
+    uint32_t partition = 0;
+
+    /// True if this term came from a `soft` constraint.
+    bool isSoft = false;
+};
+
+/// The flattened, normalized form of every constraint block visible on a
+/// class, including inherited blocks (honoring overrides by name). Computed
+/// once per class; get it from Compilation::getNormalizedConstraints rather
+/// than calling compute directly.
+struct SLANG_EXPORT NormalizedConstraintSet {
+    std::span<const NormalizedConstraint> terms;
+    uint32_t partitionCount = 0;
+    std::span<const SolveBeforeConstraint* const> solveBefore;
+    std::span<const DisableSoftConstraint* const> disableSoft;
+
+    static const NormalizedConstraintSet& compute(Compilation& compilation,
+                                                  const ClassType& classType);
+};
+
 } // namespace slang::ast
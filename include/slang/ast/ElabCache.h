@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+//! @file ElabCache.h
+//! @brief Cross-run cache of elaboration results for canonical instance bodies
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <filesystem>
+#include <memory>
+
+#include "slang/util/Hash.h"
+#include "slang/util/Util.h"
+
+namespace slang::ast {
+
+class Compilation;
+class Definition;
+class InstanceBodySymbol;
+
+/// A persistent cache of elaboration results, so that repeated compiles of a
+/// mostly frozen design can skip re-checking module bodies that are provably
+/// identical to bodies that elaborated cleanly in a previous run.
+///
+/// Elaborated bodies themselves can't be serialized -- they are pointer-rich
+/// arena graphs -- so what the cache stores is a set of fingerprints of bodies
+/// that produced no diagnostics. A body's fingerprint folds together the
+/// printed source text of its definition and, transitively, of every
+/// definition it names (instantiations and interface ports), its evaluated
+/// parameter values, and the text of all packages in the design. On a later
+/// run, a body whose fingerprint is already in the set skips the checking
+/// walk entirely; its ports and connections are still checked at each
+/// instantiation site, and hierarchical references into it still elaborate
+/// it on demand.
+///
+/// The diagnostic visitor only consults the cache when the design contains no
+/// defparams or bind directives, and never for bodies with interface ports or
+/// per-instance hierarchy overrides. Bodies whose syntax (or the syntax of
+/// anything they transitively instantiate) contains scoped or hierarchical
+/// names are also never cached: they can register drivers on symbols outside
+/// the body, which the fingerprint doesn't cover, and a stale "clean" entry
+/// must never hide an error introduced by an edit elsewhere. The same holds
+/// for definitions nested inside other definitions and for definitions whose
+/// compilation unit contains $unit declarations, since plain unqualified
+/// names can then resolve outside the body as well.
+///
+/// The cache is attached to a compilation via CompilationOptions::elabCache.
+/// It is not thread-safe; an instance must not be shared between concurrently
+/// elaborating compilations.
+class SLANG_EXPORT ElabCache {
+public:
+    /// Opens a cache backed by the given file. A missing or malformed file
+    /// just means a cold start; it will be (re)created by @a save.
+    static std::shared_ptr<ElabCache> open(const std::filesystem::path& path);
+
+    /// Computes the fingerprint of the given instance body.
+    uint64_t fingerprint(const InstanceBodySymbol& body);
+
+    /// @return true if a body with the given fingerprint elaborated
+    /// without diagnostics in a previous run (or earlier in this one).
+    bool isKnownClean(uint64_t fingerprint) const;
+
+    /// Records that a body with the given fingerprint elaborated
+    /// without producing any diagnostics.
+    void noteClean(uint64_t fingerprint);
+
+    /// Writes all recorded fingerprints back to the backing file.
+    /// @return true on success.
+    bool save() const;
+
+    /// @return the number of cache queries that hit a stored fingerprint.
+    size_t hits() const { return numHits; }
+
+    /// @return the number of fingerprints currently recorded.
+    size_t entryCount() const { return entries.size(); }
+
+private:
+    explicit ElabCache(std::filesystem::path path) : path(std::move(path)) {}
+
+    uint64_t getDefinitionHash(const Definition& definition);
+    uint64_t getSalt(const Compilation& compilation);
+
+    std::filesystem::path path;
+    flat_hash_set<uint64_t> entries;
+    mutable size_t numHits = 0;
+
+    // Memoized inputs to fingerprint computation. Definitions are unique per
+    // process; the package salt depends on the compilation being queried.
+    flat_hash_map<const Definition*, uint64_t> definitionHashes;
+    flat_hash_map<const Compilation*, uint64_t> saltCache;
+};
+
+} // namespace slang::ast
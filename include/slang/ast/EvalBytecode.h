@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+//! @file EvalBytecode.h
+//! @brief Compiled bytecode form of constant function bodies
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "slang/numeric/ConstantValue.h"
+#include "slang/util/Util.h"
+
+namespace slang::ast {
+
+class BytecodeCompiler;
+class EvalContext;
+class SubroutineSymbol;
+
+/// A function body lowered to a flat instruction stream for constant evaluation.
+///
+/// Constant evaluation normally walks the AST recursively, re-dispatching on
+/// node kind and re-resolving local variables through the frame's temporary
+/// map on every visit. For functions that are called many times during
+/// elaboration (or that loop many times internally) that overhead dominates,
+/// so the body can instead be compiled once into a small register machine:
+/// locals and formal arguments live in a flat register file and control flow
+/// becomes explicit jumps.
+///
+/// Compilation is strictly best-effort. Only a subset of statements and
+/// expressions is supported; anything outside it (or any function whose
+/// evaluation could produce diagnostics that depend on walking the tree,
+/// such as static variable initializers) makes compile() return nullptr and
+/// the caller falls back to the regular AST walker. Within the subset the
+/// observable behavior matches the walker exactly, including step counting
+/// against maxConstexprSteps, evaluation order of side effects, and the
+/// diagnostics issued on failure.
+class SLANG_EXPORT EvalBytecode {
+public:
+    ~EvalBytecode();
+
+    /// Tries to compile the body of the given subroutine. Returns nullptr if
+    /// the body uses any construct outside the supported subset, in which
+    /// case callers should evaluate the body via the AST walker instead.
+    static std::unique_ptr<EvalBytecode> compile(const SubroutineSymbol& subroutine);
+
+    /// Executes the compiled body. @a args holds the already evaluated input
+    /// argument values, in declaration order. The caller must have pushed a
+    /// stack frame for the subroutine onto @a context. Returns std::nullopt
+    /// if evaluation fails, with diagnostics recorded in the context.
+    std::optional<ConstantValue> execute(EvalContext& context,
+                                         std::span<const ConstantValue> args) const;
+
+private:
+    friend class BytecodeCompiler;
+    struct Instr;
+
+    EvalBytecode() = default;
+
+    static void evalIncDec(const Instr& in, std::span<ConstantValue> regs);
+    static SVInt evalBinaryTwoState(const Instr& in, const SVInt& l, const SVInt& r);
+
+    std::vector<Instr> instrs;
+    std::vector<ConstantValue> constants;
+    uint32_t numRegisters = 0;
+    uint32_t returnReg = 0;
+};
+
+} // namespace slang::ast
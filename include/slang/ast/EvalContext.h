@@ -7,7 +7,7 @@
 //------------------------------------------------------------------------------
 #pragma once
 
-#include <map>
+#include <deque>
 
 #include "slang/ast/Scope.h"
 #include "slang/numeric/ConstantValue.h"
@@ -57,9 +57,13 @@ public:
 
     /// Represents a single frame in the call stack.
     struct Frame {
-        /// A set of temporary values materialized within the stack frame.
-        /// Uses a map so that the values don't move around in memory.
-        std::map<const ValueSymbol*, ConstantValue> temporaries;
+        /// The index of the first local variable slot belonging to this
+        /// frame in the context's backing storage.
+        size_t localsStart = 0;
+
+        /// One past the index of the last local variable slot belonging
+        /// to this frame.
+        size_t localsEnd = 0;
 
         /// The function that is being executed in this frame, if any.
         const SubroutineSymbol* subroutine = nullptr;
@@ -112,8 +116,14 @@ public:
 
     /// Records the fact that we are executing another statement. This is used to count
     /// the number of statements executed so far to detect if we've been evaluating
-    /// a single constant function for too long.
-    [[nodiscard]] bool step(SourceLocation loc);
+    /// a single constant function for too long. The limit is prepaid in coarse
+    /// chunks so that the hot path is a single decrement and test against zero;
+    /// chunk boundaries also recheck cancellation.
+    [[nodiscard]] bool step(SourceLocation loc) {
+        if (--chunkRemaining != 0)
+            return true;
+        return refillStepBudget(loc);
+    }
 
     /// Returns true if the context is currently within a function call, and false if
     /// this is a top-level expression.
@@ -191,11 +201,34 @@ public:
     void reportStack(Diagnostic& diag) const;
 
 private:
-    uint32_t steps = 0;
+    // A storage slot for one local variable. Slots live in a deque, separate
+    // from the frame stack, so that pointers handed out by createLocal remain
+    // stable no matter how many locals are created afterward or how the frame
+    // stack reallocates. When a frame pops its slots release their values but
+    // stay in the deque for reuse, since constant evaluation of recursive
+    // functions churns through frames rapidly.
+    struct Local {
+        const ValueSymbol* symbol = nullptr;
+        ConstantValue value;
+    };
+
+    const Local* findFrameLocal(const Frame& frame, const ValueSymbol* symbol) const;
+    void reportFrame(Diagnostic& diag, const Frame& frame) const;
+    bool refillStepBudget(SourceLocation loc);
+
+    // The step limit is enforced in chunks of this many steps.
+    static constexpr uint32_t StepChunkSize = 512;
+
+    // The first step triggers a refill so that a freshly constructed or reset
+    // context picks up the configured limit and observes cancellation promptly.
+    uint32_t chunkRemaining = 1;
+    uint32_t stepsUsed = 0;
     const Symbol* disableTarget = nullptr;
     const ConstantValue* queueTarget = nullptr;
     SmallVector<Frame> stack;
     SmallVector<LValue*> lvalStack;
+    std::deque<Local> localStorage;
+    size_t localCount = 0;
     Diagnostics diags;
     SourceRange disableRange;
 };
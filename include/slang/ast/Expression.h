@@ -266,6 +266,20 @@ public:
     /// std::nullopt will be returned.
     std::optional<ConstantRange> evalSelector(EvalContext& context) const;
 
+    /// Applies the given unary operator to an already evaluated operand value.
+    /// The operator must not be one that requires an lvalue (increment / decrement).
+    static ConstantValue evalUnaryOperator(UnaryOperator op, const ConstantValue& cv);
+
+    /// Applies the given binary operator to already evaluated operand values.
+    static ConstantValue evalBinaryOperator(BinaryOperator op, const ConstantValue& cvl,
+                                            const ConstantValue& cvr);
+
+    /// A variant of evalBinaryOperator that takes ownership of the left operand
+    /// and reuses its storage for the result where the operation allows it,
+    /// avoiding a temporary for each step of a folded expression chain.
+    static ConstantValue evalBinaryOperator(BinaryOperator op, ConstantValue&& cvl,
+                                            const ConstantValue& cvr);
+
     /// Verifies that this expression is a valid lvalue and that each element
     /// of that lvalue can be assigned to. If it's not, appropriate diagnostics
     /// will be issued. Information about the source expression driving the lvalue
@@ -349,9 +363,6 @@ protected:
     static const Type* binaryOperatorType(Compilation& compilation, const Type* lt, const Type* rt,
                                           bool forceFourState, bool signednessFromRt = false);
 
-    static ConstantValue evalBinaryOperator(BinaryOperator op, const ConstantValue& cvl,
-                                            const ConstantValue& cvr);
-
     static Expression& create(Compilation& compilation, const ExpressionSyntax& syntax,
                               const ASTContext& context,
                               bitmask<ASTFlags> extraFlags = ASTFlags::None,
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include "slang/util/BumpAllocator.h"
+#include "slang/util/Hash.h"
 #include "slang/util/SmallVector.h"
 
 namespace slang::syntax {
@@ -43,6 +45,45 @@ private:
     void buildPath(const Symbol& symbol);
 };
 
+/// A trie that interns instance paths so that common ancestor prefixes are
+/// stored only once. Interning the same path twice yields the same node, so
+/// path equality and prefix tests become pointer walks instead of
+/// entry-by-entry comparisons, and holding many deep paths costs memory
+/// proportional to the number of distinct prefixes rather than the sum of
+/// all path lengths.
+class SLANG_EXPORT InstancePathTrie {
+public:
+    /// A handle to an interned path; one node exists per distinct prefix.
+    /// Nodes are stable for the lifetime of the trie.
+    struct Node {
+        /// The node for the enclosing prefix, or nullptr for the root.
+        const Node* parent = nullptr;
+
+        /// The path entry this node appends to its parent's prefix.
+        InstancePath::Entry entry;
+
+        /// The number of entries in the prefix this node represents.
+        uint32_t depth = 0;
+
+    private:
+        friend class InstancePathTrie;
+        flat_hash_map<InstancePath::Entry, Node*> children;
+    };
+
+    /// Interns the given path and returns a handle to its final node.
+    /// Equal paths always return the same handle.
+    const Node* insert(const InstancePath& path);
+
+    /// @return true if the path interned as @a prefix is an ancestor of
+    /// (or the same as) the path interned as @a node. Both handles must
+    /// come from the same trie.
+    static bool isPrefixOf(const Node& prefix, const Node& node);
+
+private:
+    Node root;
+    TypedBumpAllocator<Node> alloc;
+};
+
 } // namespace slang::ast
 
 namespace std {
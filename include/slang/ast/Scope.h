@@ -46,6 +46,11 @@ public:
     /// Creates and adds one or more member symbols to the scope from the given syntax node.
     void addMembers(const syntax::SyntaxNode& syntax);
 
+    /// Hints that roughly @a count members are about to be added, presizing the
+    /// name map so that large scopes (packages with thousands of declarations,
+    /// big gate-level module bodies) don't rehash repeatedly as they grow.
+    void reserveMembers(size_t count);
+
     const Symbol& asSymbol() const { return *thisSym; }
 
     /// Gets the compilation that contains this scope.
@@ -317,6 +322,14 @@ private:
     // If this scope has any wildcard import directives we'll keep track of them
     // in a sideband list in the compilation object.
     ImportDataIndex importDataIndex{0};
+
+    // The effective time scale of this scope, resolved on first query by
+    // walking parent scopes and cached here. Delay-heavy netlists ask for
+    // the time scale on every delay expression, so the walk shouldn't be
+    // repeated per query. Scopes that carry their own time scale (units,
+    // packages, instance bodies) answer directly and don't use the cache.
+    mutable std::optional<TimeScale> cachedTimeScale;
+    mutable bool timeScaleCached = false;
 };
 
 } // namespace slang::ast
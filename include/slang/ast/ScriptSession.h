@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <span>
+
 #include "slang/ast/Compilation.h"
 #include "slang/ast/EvalContext.h"
 #include "slang/syntax/SyntaxFwd.h"
@@ -27,9 +29,19 @@ public:
     ConstantValue evalExpression(const syntax::ExpressionSyntax& expr);
     void evalStatement(const syntax::StatementSyntax& expr);
 
+    /// Evaluates a batch of snippets, in order, against the shared session scope
+    /// and returns one result per snippet. Equivalent to calling eval() on each
+    /// snippet individually but amortizes per-snippet setup costs: snippets are
+    /// lexed without trivia, expressions are bound through a single shared
+    /// context, and constant function calls hit the compilation's bytecode
+    /// cache, which stays warm across the whole batch.
+    std::vector<ConstantValue> evalBatch(std::span<const std::string_view> snippets);
+
     Diagnostics getDiagnostics();
 
 private:
+    ConstantValue evalRoot(const syntax::SyntaxNode& node);
+
     std::vector<std::shared_ptr<syntax::SyntaxTree>> syntaxTrees;
     EvalContext evalContext;
 };
@@ -21,6 +21,13 @@ class SLANG_EXPORT SemanticModel {
 public:
     explicit SemanticModel(Compilation& compilation);
 
+    /// Walks the entire design once and seeds the syntax-to-symbol cache from
+    /// every symbol encountered, so that subsequent queries are single hash
+    /// lookups instead of walking up the syntax tree and scanning scope members.
+    /// Intended for interactive tooling that issues many queries against one
+    /// compilation; one-off queries are cheaper without it.
+    void preload();
+
     void withContext(const syntax::SyntaxNode& node, const Symbol& symbol);
 
     const Symbol* getDeclaredSymbol(const syntax::SyntaxNode& syntax);
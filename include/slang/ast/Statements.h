@@ -465,8 +465,22 @@ public:
         not_null<const Statement*> stmt;
     };
 
+    /// An entry in the optional precomputed dispatch table; see @a dispatchTable.
+    struct DispatchEntry {
+        uint64_t label;
+        const Statement* stmt;
+    };
+
     const Expression& expr;
     std::span<ItemGroup const> items;
+
+    /// If non-empty, every item expression folds to a two-state machine-word
+    /// constant and this table maps each label to the statement of the first
+    /// group containing it, sorted by label for binary search. Constant
+    /// evaluation uses it to dispatch large case statements directly instead
+    /// of comparing the selector against every item in order.
+    std::span<const DispatchEntry> dispatchTable;
+
     const Statement* defaultCase = nullptr;
     CaseStatementCondition condition;
     UniquePriorityCheck check;
@@ -519,6 +533,12 @@ public:
     CaseStatementCondition condition;
     UniquePriorityCheck check;
 
+    /// Bind-time dispatch table for matches over a tagged union: for each
+    /// possible active member of the union, the indices (in declaration
+    /// order) of the items whose patterns can match it. Empty when the
+    /// statement doesn't have the right shape for indexed dispatch.
+    std::span<const std::span<const uint32_t>> tagDispatch;
+
     PatternCaseStatement(CaseStatementCondition condition, UniquePriorityCheck check,
                          const Expression& expr, std::span<ItemGroup const> items,
                          const Statement* defaultCase, SourceRange sourceRange) :
@@ -555,12 +575,39 @@ public:
 
 class SLANG_EXPORT ForLoopStatement : public Statement {
 public:
+    /// Describes a loop that matches the canonical affine shape
+    /// `for (i = <start>; i < <constant>; i++)` (or the <=, >, >=, i--
+    /// variants) over a simple integral local. Detected at bind time so
+    /// that constant evaluation can bump a machine integer per iteration
+    /// instead of re-evaluating the condition and step expression trees.
+    struct AffineLoopInfo {
+        /// The loop variable.
+        const ValueSymbol* var = nullptr;
+
+        /// The constant stop bound.
+        int64_t bound = 0;
+
+        /// True if the comparison is inclusive (<= or >=).
+        bool inclusive = false;
+
+        /// True if the step increments the variable, false if it decrements.
+        bool increment = false;
+
+        /// True if the body references the loop variable, in which case
+        /// its value must be materialized in frame storage around each
+        /// iteration of the body.
+        bool bodyUsesVar = false;
+    };
+
     std::span<const Expression* const> initializers;
     std::span<const VariableSymbol* const> loopVars;
     const Expression* stopExpr;
     std::span<const Expression* const> steps;
     const Statement& body;
 
+    /// Set if the loop matches the affine shape described by AffineLoopInfo.
+    std::optional<AffineLoopInfo> affineInfo;
+
     ForLoopStatement(std::span<const Expression* const> initializers, const Expression* stopExpr,
                      std::span<const Expression* const> steps, const Statement& body,
                      SourceRange sourceRange) :
@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+//! @file SymbolNameIndex.h
+//! @brief Compact on-disk index of symbol names for cross-run queries
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "slang/util/OS.h"
+#include "slang/util/Util.h"
+
+namespace slang::ast {
+
+class Compilation;
+
+/// A compact, queryable on-disk index of every named symbol in an elaborated
+/// design: for each symbol its name, hierarchical path, kind, and source
+/// location. Once written, "where is signal X" style queries from external
+/// tooling can be answered from the index alone, without re-elaborating the
+/// design.
+///
+/// The file layout is a fixed header, a table of fixed-size entries sorted by
+/// symbol name, and a deduplicated blob of null-terminated strings; a lookup
+/// memory maps the file and binary searches the entry table. Like other
+/// compilation artifacts this is a cache format rather than an interchange
+/// format: integers are host-endian and the version number is bumped on any
+/// layout change, so readers should treat an unrecognized header as a cache
+/// miss and rebuild.
+///
+/// Symbols inside a multiply-instantiated module are indexed once, under the
+/// hierarchical path of the canonical instance of that module.
+class SLANG_EXPORT SymbolNameIndex {
+public:
+    /// A single match returned by @a lookup. The string views point into the
+    /// index's backing memory and remain valid for the lifetime of the index.
+    struct Entry {
+        /// The symbol's name.
+        std::string_view name;
+
+        /// The symbol's full hierarchical path.
+        std::string_view path;
+
+        /// The name of the symbol's kind, e.g. "Variable".
+        std::string_view kind;
+
+        /// The file the symbol was declared in, empty if unknown.
+        std::string_view file;
+
+        /// The one-based line and column of the declaration, zero if unknown.
+        uint32_t line = 0;
+        uint32_t column = 0;
+    };
+
+    /// Builds an index of all named symbols in the given elaborated
+    /// compilation and returns it in serialized form, ready to be
+    /// written to a file.
+    static std::string serialize(Compilation& compilation);
+
+    /// Opens a previously serialized index file, memory mapping it when
+    /// possible. Returns std::nullopt if the file can't be read or isn't
+    /// a valid index.
+    static std::optional<SymbolNameIndex> open(const std::filesystem::path& path);
+
+    /// Opens an index from an in-memory image of a serialized index; the
+    /// data is copied. Returns std::nullopt if it isn't a valid index.
+    static std::optional<SymbolNameIndex> fromMemory(std::string_view data);
+
+    /// Finds all symbols with the given name, in hierarchical path order.
+    std::vector<Entry> lookup(std::string_view name) const;
+
+    /// @return the total number of symbols in the index.
+    size_t size() const { return entryCount; }
+
+private:
+    SymbolNameIndex() = default;
+    bool init(std::string_view data);
+    uint32_t word(size_t index) const;
+    std::string_view str(uint32_t offset) const;
+    Entry entryAt(size_t index) const;
+
+    // Exactly one of these backs the index data, depending on how it
+    // was opened; the pointers below point into it either way.
+    MappedFile mapped;
+    std::vector<char> buffer;
+
+    const char* base = nullptr;
+    const char* strings = nullptr;
+    size_t stringsLen = 0;
+    size_t entryCount = 0;
+};
+
+} // namespace slang::ast
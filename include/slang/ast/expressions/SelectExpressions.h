@@ -14,6 +14,24 @@ namespace slang::ast {
 
 class FieldSymbol;
 
+/// Precomputed information about a select of a value with a fixed index
+/// range, normalized at bind time so that constant evaluation and driver
+/// tracking don't re-derive bounds, direction, and element stride from the
+/// type system on every use.
+struct SelectInfo {
+    /// The valid index bounds of the value being selected.
+    ConstantRange valueRange;
+
+    /// The bit stride of each selected element; 1 for plain bit selects,
+    /// wider for selects of packed element types. Unused for unpacked
+    /// arrays, which are selected by slot.
+    int32_t elementWidth = 1;
+
+    /// True if the value is an unpacked array, which is selected by slot
+    /// (with storage reversed in memory) rather than by bit range.
+    bool unpacked = false;
+};
+
 /// Represents a single element selection expression.
 class SLANG_EXPORT ElementSelectExpression : public Expression {
 public:
@@ -61,6 +79,7 @@ public:
 private:
     Expression* value_;
     const Expression* selector_;
+    std::optional<SelectInfo> selectInfo;
     bool warnedAboutIndex = false;
 };
 
@@ -117,6 +136,7 @@ private:
     const Expression* left_;
     const Expression* right_;
     RangeSelectionKind selectionKind;
+    std::optional<SelectInfo> selectInfo;
     bool warnedAboutRange = false;
 };
 
@@ -142,6 +142,10 @@ public:
     uint32_t constructIndex;
     bool valid = false;
 
+    /// True if the loop body never references the genvar, which means all
+    /// instantiated entries elaborate identically.
+    bool genvarIndependent = false;
+
     GenerateBlockArraySymbol(Compilation& compilation, std::string_view name, SourceLocation loc,
                              uint32_t constructIndex) :
         Symbol(SymbolKind::GenerateBlockArray, name, loc),
@@ -203,6 +203,8 @@ private:
 
     using SpecMap = flat_hash_map<SpecializationKey, const Type*, Hasher>;
     mutable SpecMap specMap;
+    mutable flat_hash_map<std::tuple<const syntax::SyntaxNode*, const Scope*>, const Type*>
+        specSiteMap;
     mutable std::optional<const Type*> defaultSpecialization;
     mutable const ForwardingTypedefSymbol* firstForward = nullptr;
     function_ref<void(Compilation&, ClassType&)> specializeFunc;
@@ -65,6 +65,10 @@ public:
     static bool isKind(SymbolKind kind) { return kind == SymbolKind::Package; }
 
 private:
+    // A small bloom filter over the package's member names, built lazily on
+    // first import lookup; empty until then. Most wildcard import probes are
+    // misses and this rejects them with a single hash check.
+    mutable std::span<const uint64_t> importNameFilter;
     mutable bool hasForceElaborated = false;
 };
 
@@ -152,6 +152,44 @@ private:
     mutable std::optional<std::span<const ConstantRange>> range;
 };
 
+/// A cached resolution of one entry in an instance's port connection list.
+/// All rows of an instance array share the same connection syntax and
+/// instantiating scope, so once the first element has resolved its connections
+/// the resulting shapes are cached on the compilation and later elements stamp
+/// their connections from them instead of redoing name lookup, attribute
+/// creation, and connection checking per element. Connection expressions are
+/// not part of the shape; they always bind lazily per instance, which is also
+/// what slices array connections across elements.
+struct PortConnectionShape {
+    /// How the port is connected.
+    enum Kind {
+        /// No connection was provided for the port.
+        Unconnected,
+
+        /// The port uses its default value.
+        UseDefault,
+
+        /// The port is connected to an expression.
+        Expr,
+
+        /// The port is connected implicitly (by name or wildcard)
+        /// to an already looked-up symbol.
+        Implicit
+    } kind = Unconnected;
+
+    /// The connection expression syntax, if @a kind is Expr.
+    const syntax::ExpressionSyntax* expr = nullptr;
+
+    /// The connected symbol, if @a kind is Implicit.
+    const Symbol* symbol = nullptr;
+
+    /// The name range of an implicit connection.
+    SourceRange implicitNameRange;
+
+    /// Attributes on the connection, if any.
+    std::span<const AttributeSymbol* const> attributes;
+};
+
 class SLANG_EXPORT PortConnection {
 public:
     const Symbol& port;
@@ -29,9 +29,23 @@ public:
                                   const Scope& specifyParent, bool isSource, bool allowAnyNet,
                                   SourceRange sourceRange);
 
+    /// Same as @a checkPathTerminal except that successful checks are memoized
+    /// on this specify block, so gate-level netlists with huge numbers of timing
+    /// arcs referencing the same module ports only pay for the port direction
+    /// walk once per terminal. Failed checks are never cached, so each offending
+    /// arc still gets its own diagnostic.
+    bool checkPathTerminalCached(const ValueSymbol& terminal, const Type& type,
+                                 const Scope& specifyParent, bool isSource, bool allowAnyNet,
+                                 SourceRange sourceRange) const;
+
     void serializeTo(ASTSerializer&) const {}
 
     static bool isKind(SymbolKind kind) { return kind == SymbolKind::SpecifyBlock; }
+
+private:
+    // A map from terminal symbols to a bitmask of direction flag combinations
+    // that have already passed checking, so that repeated arcs don't redo it.
+    mutable PointerMap* goodTerminals = nullptr;
 };
 
 using TimingPathMap =
@@ -107,6 +107,9 @@ public:
     const Statement& getBody() const;
     const Type& getReturnType() const { return declaredReturnType.getType(); }
 
+    /// Returns true if the body has already been bound, without forcing it.
+    bool isBodyBound() const;
+
     void setOverride(const SubroutineSymbol& parentMethod) const;
     const SubroutineSymbol* getOverride() const { return overrides; }
 
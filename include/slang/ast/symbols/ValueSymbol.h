@@ -21,7 +21,46 @@ class PortSymbol;
 class ProceduralBlockSymbol;
 class ValueDriver;
 
-using DriverIntervalMap = IntervalMap<uint32_t, const ValueDriver*>;
+using DriverIntervalMap = IntervalMap<uint32_t, uint32_t>;
+
+/// An iterator over the drivers of a value symbol. Drivers are packed into a
+/// compilation-wide pool and the per-symbol interval maps store 32-bit pool
+/// indices; this iterator translates those indices back into pointers.
+class SLANG_EXPORT DriverIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = ptrdiff_t;
+    using value_type = const ValueDriver*;
+    using pointer = const value_type*;
+    using reference = value_type;
+
+    DriverIterator() = default;
+    DriverIterator(DriverIntervalMap::const_iterator it, const Compilation* compilation) :
+        it(it), compilation(compilation) {}
+
+    const ValueDriver* operator*() const;
+
+    /// Gets the bounds of the range driven by the current driver.
+    std::pair<uint32_t, uint32_t> bounds() const { return it.bounds(); }
+
+    DriverIterator& operator++() {
+        ++it;
+        return *this;
+    }
+
+    DriverIterator operator++(int) {
+        DriverIterator tmp(*this);
+        ++(*this);
+        return tmp;
+    }
+
+    bool operator==(const DriverIterator& rhs) const { return it == rhs.it; }
+    bool operator!=(const DriverIterator& rhs) const { return !(*this == rhs); }
+
+private:
+    DriverIntervalMap::const_iterator it;
+    const Compilation* compilation = nullptr;
+};
 
 /// A base class for symbols that represent a value (for example a variable or a parameter).
 /// The common functionality is that they all have a type.
@@ -70,11 +109,9 @@ public:
                    const Expression& longestStaticPrefix, const Symbol& containingSymbol,
                    const Expression& procCallExpression) const;
 
-    void addDriver(std::pair<uint32_t, uint32_t> bounds, const ValueDriver& driver) const;
+    void addDriver(std::pair<uint32_t, uint32_t> bounds, uint32_t driverIndex) const;
 
-    iterator_range<DriverIntervalMap::const_iterator> drivers() const {
-        return {driverMap.begin(), driverMap.end()};
-    }
+    iterator_range<DriverIterator> drivers() const;
 
     class PortBackref {
     public:
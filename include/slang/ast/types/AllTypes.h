@@ -10,6 +10,7 @@
 #include "slang/ast/Scope.h"
 #include "slang/ast/symbols/ValueSymbol.h"
 #include "slang/ast/types/Type.h"
+#include "slang/numeric/SVInt.h"
 #include "slang/syntax/SyntaxFwd.h"
 
 namespace slang::ast {
@@ -115,6 +116,32 @@ public:
     iterator_range<specific_symbol_iterator<EnumValueSymbol>> values() const {
         return membersOfType<EnumValueSymbol>();
     }
+
+    /// A flat view of the enum's values, in declaration order.
+    std::span<const EnumValueSymbol* const> valueList() const { return flatValues; }
+
+    /// Finds the declaration-order index of the enumerand with the given value,
+    /// or std::nullopt if there is none. Queries binary search a sorted table
+    /// built when the type is created instead of scanning the member list, so
+    /// they stay cheap for very large enums. A value that failed to resolve is
+    /// not in the table; duplicate values map to their first declaration.
+    std::optional<uint32_t> findValueIndex(const SVInt& value) const;
+
+    /// Finds the enumerand with the given value, or nullptr if there is none.
+    const EnumValueSymbol* findValue(const SVInt& value) const;
+
+private:
+    // The value table is a flat sorted array (rather than a hash map) so that
+    // it can live in the compilation's bump allocator alongside the type.
+    // Values wider than 64 bits or containing unknown bits aren't in it;
+    // findValueIndex falls back to a scan for those.
+    struct ValueTableEntry {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    std::span<const EnumValueSymbol* const> flatValues;
+    std::span<const ValueTableEntry> sortedValues;
 };
 
 /// Represents an enumerated value / member.
@@ -236,6 +263,9 @@ public:
 /// Represents a packed structure of members.
 class SLANG_EXPORT PackedStructType : public IntegralType, public Scope {
 public:
+    /// The fields in declaration order, with bit offsets and widths already
+    /// computed, so that accesses don't need to walk the member list.
+    std::span<const FieldSymbol* const> fields;
     int systemId;
 
     PackedStructType(Compilation& compilation, bool isSigned, SourceLocation loc,
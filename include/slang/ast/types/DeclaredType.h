@@ -102,6 +102,11 @@ BITMASK(DeclaredTypeFlags, InterfaceVariable)
 /// along with the logic necessary to resolve that type. Optionally includes an
 /// initializer expression as well, which can be necessary when resolving types that
 /// are implicitly inferred from the initializer.
+///
+/// Resolved results are published exactly once with release semantics and the
+/// getters start with a single acquire load, so any number of threads may read
+/// a fully constructed AST concurrently. If a binding has not been forced yet,
+/// resolution itself is serialized through the compilation's bind lock.
 class SLANG_EXPORT DeclaredType {
 public:
     /// Constructs a new instance of the class.
@@ -211,8 +216,8 @@ public:
 
 private:
     void resolveType(const ASTContext& typeContext, const ASTContext& initializerContext) const;
-    void checkType(const ASTContext& context) const;
-    void mergePortTypes(
+    const Type& checkType(const ASTContext& context, const Type& type) const;
+    const Type* mergePortTypes(
         const ASTContext& context, const ValueSymbol& sourceSymbol,
         const syntax::ImplicitTypeSyntax& implicit, SourceLocation location,
         std::span<const syntax::VariableDimensionSyntax* const> unpackedDimensions) const;
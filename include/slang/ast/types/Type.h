@@ -55,8 +55,13 @@ public:
     }
 
     /// Gets the declared width of the numeric type in bits. Returns zero if the type is not
-    /// numeric (i.e. integral or floating).
-    bitwidth_t getBitWidth() const;
+    /// numeric (i.e. integral or floating). The width is immutable so it's computed once
+    /// and cached; this is one of the hottest queries during expression binding.
+    bitwidth_t getBitWidth() const {
+        if (!cachedBitWidth)
+            cachedBitWidth = resolveBitWidth();
+        return *cachedBitWidth;
+    }
 
     /// Gets $bits of the type. Returns zero if the type does not have a statically known size.
     size_t bitstreamWidth() const;
@@ -341,6 +346,9 @@ protected:
 
 private:
     void resolveCanonical() const;
+    bitwidth_t resolveBitWidth() const;
+
+    mutable std::optional<bitwidth_t> cachedBitWidth;
 
     static const Type& lookupNamedType(Compilation& compilation, const syntax::NameSyntax& syntax,
                                        const ASTContext& context, bool isTypedefTarget);
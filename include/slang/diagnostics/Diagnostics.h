@@ -178,6 +178,10 @@ public:
 };
 
 /// A collection of diagnostics.
+///
+/// Not thread safe; concurrent work (like parallel parsing) should collect
+/// diagnostics into a per-thread instance and append the results into the
+/// main collection once the worker finishes.
 class SLANG_EXPORT Diagnostics : public SmallVector<Diagnostic> {
 public:
     /// Adds a new diagnostic to the collection, pointing to the given source location.
@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+//! @file JsonDiagnosticClient.h
+//! @brief Diagnostic client that serializes to machine-readable JSON
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "slang/diagnostics/DiagnosticClient.h"
+#include "slang/util/Hash.h"
+
+namespace slang {
+
+class JsonWriter;
+
+/// A diagnostic client that serializes diagnostics into a structured JSON
+/// document instead of human-friendly text, for consumption by downstream
+/// tooling. Each diagnostic becomes one record with its code, severity,
+/// location, and formatted message; file paths are stored once in a table
+/// and referenced by index from the records.
+class SLANG_EXPORT JsonDiagnosticClient : public DiagnosticClient {
+public:
+    JsonDiagnosticClient();
+    ~JsonDiagnosticClient();
+
+    void report(const ReportedDiagnostic& diagnostic) override;
+
+    /// Finishes the document and returns the serialized JSON text.
+    /// No further diagnostics should be reported once this has been called.
+    std::string getString();
+
+private:
+    uint64_t getFileIndex(BufferID buffer);
+
+    std::unique_ptr<JsonWriter> writer;
+    std::vector<std::string_view> fileNames;
+    flat_hash_map<BufferID, uint64_t> fileIndices;
+    bool finished = false;
+};
+
+} // namespace slang
@@ -13,6 +13,7 @@
 #include "slang/text/SourceManager.h"
 #include "slang/util/CommandLine.h"
 #include "slang/util/OS.h"
+#include "slang/util/StringTable.h"
 #include "slang/util/Util.h"
 
 namespace slang {
@@ -70,6 +71,12 @@ public:
         /// A list of extensions that will be used to search for library files.
         std::vector<std::string> libExts;
 
+        /// If true, build and use a persistent per-directory index mapping
+        /// design element names to the files declaring them when searching
+        /// library directories for missing modules, instead of probing for
+        /// files named after the missing module.
+        std::optional<bool> libraryIndex;
+
         /// A set of extensions that will be used to exclude files.
         flat_hash_set<std::string> excludeExts;
 
@@ -92,6 +99,10 @@ public:
         /// If true, library files will inherit macro definitions from primary source files.
         std::optional<bool> librariesInheritMacros;
 
+        /// If true, text inside inactive conditional directive branches is skipped
+        /// with a raw character scan instead of being fully tokenized.
+        std::optional<bool> rawDisabledTextScan;
+
         /// @}
         /// @name Parsing
         /// @{
@@ -102,6 +113,36 @@ public:
         /// The maximum number of lexer errors that can be encountered before giving up.
         std::optional<uint32_t> maxLexerErrors;
 
+        /// If true, whitespace and comment trivia are not recorded on tokens,
+        /// reducing memory usage for very large inputs.
+        std::optional<bool> minimalTrivia;
+
+        /// If true, runs of whitespace and comment trivia are collapsed into
+        /// single source spans, reducing memory usage for very large inputs
+        /// while still allowing the original source to be reproduced.
+        std::optional<bool> collapseTrivia;
+
+        /// If true, string literal values beyond a size threshold are
+        /// deduplicated into a shared interner instead of being stored
+        /// per occurrence, reducing memory usage when the same long
+        /// literals repeat across many files.
+        std::optional<bool> dedupStringLiterals;
+
+        /// If true, parsing of each file stops at its first syntax error
+        /// instead of recovering and continuing.
+        std::optional<bool> stopOnFirstError;
+
+        /// If true, the preprocessor runs ahead of the parser on a separate
+        /// worker thread for each compilation unit, overlapping macro
+        /// expansion with parsing.
+        std::optional<bool> pipelinedPreprocessing;
+
+        /// If true, the bodies of module, interface, and program declarations
+        /// in library files are not parsed up front; each body is recorded as
+        /// a token range and only parsed if the definition is actually
+        /// referenced by the design.
+        std::optional<bool> deferModuleBodies;
+
         /// @}
         /// @name Compilation
         /// @{
@@ -165,6 +206,11 @@ public:
         /// If true, only perform linting of code, don't try to elaborate a full hierarchy.
         std::optional<bool> onlyLint;
 
+        /// If set, the path of a file used to persist elaboration results
+        /// across runs, so that module bodies that are unchanged and were
+        /// previously clean skip re-checking. See ast::ElabCache.
+        std::optional<std::string> elabCacheFile;
+
         /// If non-empty, specifies the list of modules that should serve as the
         /// top modules in the design. If empty, this will be automatically determined
         /// based on which modules are unreferenced elsewhere.
@@ -219,6 +265,25 @@ public:
         /// compilation unit, meaning all of their text will be merged together.
         std::optional<bool> singleUnit;
 
+        /// The number of threads to use for parsing source files into syntax
+        /// trees. A value of 0 means one thread per hardware core. Has no
+        /// effect when @a singleUnit is set, since in that case all sources
+        /// form one serial token stream.
+        std::optional<uint32_t> numThreads;
+
+        /// If true, a background thread reads ahead through the source
+        /// buffers in filelist order while parsing runs, so that cold-cache
+        /// page faults for memory mapped files overlap with parsing instead
+        /// of blocking it.
+        std::optional<bool> prefetchSources;
+
+        /// If true, completed syntax trees are added to the compilation while
+        /// the remaining files are still being parsed, hiding per-tree
+        /// definition and metadata registration behind parsing. Only affects
+        /// @a parseAndCreateCompilation; elaboration itself still starts after
+        /// the last tree has been added.
+        std::optional<bool> pipelinedCompilation;
+
         /// A list of library files to include in the compilation.
         std::vector<std::string> libraryFiles;
 
@@ -282,6 +347,25 @@ public:
     /// Prints all macros from all loaded buffers to stdout.
     void reportMacros();
 
+    /// Prints a file-level dependency graph for all parsed syntax trees to stdout.
+    /// The graph is derived purely from parser metadata -- package imports, global
+    /// module instantiations, class scope references, and include edges -- without
+    /// performing elaboration, so build systems can use it to schedule minimal
+    /// recompiles. @a parseAllSources must have been called first.
+    /// @param json If true, emit the graph as a JSON object; otherwise emit a
+    ///             makefile-style fragment of one rule per file.
+    void reportDependencies(bool json);
+
+    /// Checks all previously loaded source files for changes on disk and re-parses
+    /// only the syntax trees affected by modified files, replacing their entries in
+    /// the @a syntaxTrees list. A change to an included file re-parses every tree
+    /// that included it; unchanged trees are left alone so that a subsequent
+    /// compilation skips their lexing and parsing work entirely. The first call
+    /// only records baseline timestamps and reports no changes. This is used to
+    /// implement the driver tool's watch mode.
+    /// @returns true if any file had changed and was re-parsed.
+    bool reparseChangedSources();
+
     /// Parses all loaded buffers into syntax trees and appends the resulting trees
     /// to the @a syntaxTrees list.
     /// @returns true on success and false if errors were encountered.
@@ -290,9 +374,30 @@ public:
     /// Creates an options bag from all of the currently set options.
     [[nodiscard]] Bag createOptionBag() const;
 
+    /// Parses all loaded buffers and creates the compilation object in one
+    /// pipelined step: as worker threads finish files, the resulting trees are
+    /// ingested into the compilation on this thread in buffer order, so
+    /// per-tree definition registration overlaps the parsing of later files.
+    /// Elaboration still begins only after every tree has been added, since a
+    /// compilation can't accept new syntax trees once symbol binding starts.
+    /// Falls back to @a parseAllSources followed by @a createCompilation when
+    /// pipelining doesn't apply (single-unit builds or one parse thread).
+    /// @param ok set to true on success and false if errors were encountered.
+    [[nodiscard]] std::unique_ptr<ast::Compilation> parseAndCreateCompilation(bool& ok);
+
     /// Creates a compilation object from all of the current loaded state of the driver.
     [[nodiscard]] std::unique_ptr<ast::Compilation> createCompilation() const;
 
+    /// Creates a compilation object like @a createCompilation, except that the
+    /// given module names replace any top modules specified in the driver options.
+    /// The returned compilation shares the already parsed syntax trees, so a
+    /// resident process can elaborate many design variants against a single
+    /// parsed universe -- including concurrently, since any deferred module
+    /// bodies are expanded eagerly here to keep the shared trees immutable.
+    /// The given name strings must outlive the returned compilation.
+    [[nodiscard]] std::unique_ptr<ast::Compilation> createCompilation(
+        std::span<const std::string> topModules) const;
+
     /// Reports all parsing diagnostics found in all of the @a syntaxTrees
     /// @returns true on success and false if errors were encountered.
     [[nodiscard]] bool reportParseDiags();
@@ -302,8 +407,29 @@ public:
     /// @returns true if compilation succeeded and false if errors were encountered.
     [[nodiscard]] bool reportCompilation(ast::Compilation& compilation, bool quiet);
 
+    /// Prints a statistics report for the given compilation to stdout: per-file
+    /// token, syntax node, and parse arena figures (sorted so the most expensive
+    /// files come first), followed by compilation-wide totals including macro
+    /// expansions, elaborated symbols, and arena memory. This is meant for
+    /// finding hot spots in large designs without bisecting file lists.
+    void reportStats(ast::Compilation& compilation);
+
 private:
+    // Loads and parses library files and library directory lookups after the
+    // main source files are in, then applies pragma diagnostic mappings.
+    bool finishParsing(const Bag& optionBag);
+
     bool anyFailedLoads = false;
+    flat_hash_map<std::string, std::filesystem::file_time_type> watchedFileTimes;
+
+    // Shared storage for deduplicated string literal values when the
+    // dedupStringLiterals option is enabled. Mutable because handing it
+    // to lexers happens while building the (otherwise const) option bag.
+    mutable StringInterner literalInterner;
+
+    // The persistent elaboration cache when the elabCacheFile option is set,
+    // loaded on first use. Mutable for the same reason as the interner above.
+    mutable std::shared_ptr<ast::ElabCache> elabCache;
 };
 
 } // namespace slang::driver
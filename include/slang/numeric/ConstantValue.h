@@ -8,13 +8,13 @@
 #pragma once
 
 #include <deque>
-#include <map>
 #include <string>
 #include <variant>
 #include <vector>
 
 #include "slang/numeric/SVInt.h"
 #include "slang/util/CopyPtr.h"
+#include "slang/util/Hash.h"
 #include "slang/util/Iterator.h"
 
 namespace slang {
@@ -184,10 +184,203 @@ private:
     Variant value;
 };
 
+} // namespace slang
+
+namespace std {
+
+// Note: these are specialized here, before AssociativeArray below, so that
+// the hash table member it declares can find them.
+template<>
+struct hash<slang::ConstantValue> {
+    size_t operator()(const slang::ConstantValue& cv) const { return cv.hash(); }
+};
+
+template<>
+struct equal_to<slang::ConstantValue> {
+    bool operator()(const slang::ConstantValue& lhs, const slang::ConstantValue& rhs) const {
+        // Integers are by far the most common cache and associative array
+        // keys; comparing them directly skips the variant visit dispatch.
+        if (lhs.isInteger() && rhs.isInteger())
+            return std::equal_to<slang::SVInt>()(lhs.integer(), rhs.integer());
+        return lhs == rhs;
+    }
+};
+
+} // namespace std
+
+namespace slang {
+
 /// Represents a SystemVerilog associative array, for use during constant evaluation.
-struct SLANG_EXPORT AssociativeArray : public std::map<ConstantValue, ConstantValue> {
-    using std::map<ConstantValue, ConstantValue>::map;
+///
+/// Lookups and insertions are backed by a flat hash table, so they don't pay for
+/// the key ordering that the language only requires during iteration. The sorted
+/// view is materialized lazily the first time the array is iterated and is
+/// discarded again by any mutation; iterators and element references therefore
+/// follow unordered container rules, where any insertion or erasure can
+/// invalidate them.
+struct SLANG_EXPORT AssociativeArray {
+    using key_type = ConstantValue;
+    using mapped_type = ConstantValue;
+    using value_type = std::pair<ConstantValue, ConstantValue>;
+
+    /// A user-specified default for elements that aren't otherwise present,
+    /// or the invalid value if no default has been set.
     ConstantValue defaultValue;
+
+    /// A bidirectional iterator over the entries of an associative array,
+    /// in ascending order of their keys.
+    template<typename TValue>
+    class iterator_impl {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = AssociativeArray::value_type;
+        using difference_type = ptrdiff_t;
+        using pointer = TValue*;
+        using reference = TValue&;
+
+        iterator_impl() = default;
+        iterator_impl(const iterator_impl<std::remove_const_t<TValue>>& other) :
+            array(other.array), item(other.item), index(other.index) {}
+
+        reference operator*() const { return *item; }
+        pointer operator->() const { return item; }
+
+        iterator_impl& operator++() {
+            advance(1);
+            return *this;
+        }
+
+        iterator_impl operator++(int) {
+            auto tmp(*this);
+            advance(1);
+            return tmp;
+        }
+
+        iterator_impl& operator--() {
+            advance(-1);
+            return *this;
+        }
+
+        iterator_impl operator--(int) {
+            auto tmp(*this);
+            advance(-1);
+            return tmp;
+        }
+
+        bool operator==(const iterator_impl& other) const { return item == other.item; }
+        bool operator!=(const iterator_impl& other) const { return item != other.item; }
+
+    private:
+        friend struct AssociativeArray;
+        template<typename>
+        friend class iterator_impl;
+
+        iterator_impl(const AssociativeArray* array, pointer item, size_t index) :
+            array(array), item(item), index(index) {}
+
+        void advance(ptrdiff_t amount) {
+            auto& sorted = array->sortedView();
+            if (index == NoSortedIndex)
+                index = item ? array->sortedIndexOf(item->first) : sorted.size();
+
+            index = size_t(ptrdiff_t(index) + amount);
+            item = index < sorted.size() ? pointer(sorted[index]) : nullptr;
+        }
+
+        const AssociativeArray* array = nullptr;
+        pointer item = nullptr;
+        size_t index = NoSortedIndex;
+    };
+
+    using iterator = iterator_impl<value_type>;
+    using const_iterator = iterator_impl<const value_type>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    AssociativeArray() = default;
+    AssociativeArray(const AssociativeArray& other) :
+        defaultValue(other.defaultValue), storage(other.storage) {}
+    AssociativeArray(AssociativeArray&& other) :
+        defaultValue(std::move(other.defaultValue)), storage(std::move(other.storage)) {}
+
+    AssociativeArray& operator=(const AssociativeArray& other) {
+        defaultValue = other.defaultValue;
+        storage = other.storage;
+        invalidateSorted();
+        return *this;
+    }
+
+    AssociativeArray& operator=(AssociativeArray&& other) {
+        defaultValue = std::move(other.defaultValue);
+        storage = std::move(other.storage);
+        invalidateSorted();
+        return *this;
+    }
+
+    iterator begin() {
+        auto& sorted = sortedView();
+        return iterator(this, sorted.empty() ? nullptr : sorted.front(), 0);
+    }
+
+    const_iterator begin() const {
+        auto& sorted = sortedView();
+        return const_iterator(this, sorted.empty() ? nullptr : sorted.front(), 0);
+    }
+
+    iterator end() { return iterator(this, nullptr, NoSortedIndex); }
+    const_iterator end() const { return const_iterator(this, nullptr, NoSortedIndex); }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    [[nodiscard]] bool empty() const { return storage.empty(); }
+    size_t size() const { return storage.size(); }
+
+    iterator find(const ConstantValue& key);
+    const_iterator find(const ConstantValue& key) const;
+    size_t count(const ConstantValue& key) const { return storage.count(key); }
+
+    /// Inserts the given key / value pair if the key is not already present.
+    /// Returns an iterator to the entry along with a flag indicating whether
+    /// an insertion actually took place.
+    template<typename TKey, typename... TArgs>
+    std::pair<iterator, bool> try_emplace(TKey&& key, TArgs&&... args) {
+        auto result = storage.emplace(std::forward<TKey>(key), std::forward<TArgs>(args)...);
+        if (result.second)
+            invalidateSorted();
+        return {iterator(this, &*result.first, NoSortedIndex), result.second};
+    }
+
+    size_t erase(const ConstantValue& key) {
+        auto count = storage.erase(key);
+        if (count)
+            invalidateSorted();
+        return count;
+    }
+
+    /// Equality compares entries only; the default value doesn't participate.
+    bool operator==(const AssociativeArray& rhs) const;
+    bool operator!=(const AssociativeArray& rhs) const { return !(*this == rhs); }
+
+    /// Orders lexicographically by sorted key / value pairs.
+    bool operator<(const AssociativeArray& rhs) const;
+
+private:
+    static constexpr size_t NoSortedIndex = ~size_t(0);
+
+    std::vector<value_type*>& sortedView() const;
+    size_t sortedIndexOf(const ConstantValue& key) const;
+
+    void invalidateSorted() {
+        sorted.clear();
+        sortedValid = false;
+    }
+
+    flat_hash_map<ConstantValue, ConstantValue> storage;
+    mutable std::vector<value_type*> sorted;
+    mutable bool sortedValid = false;
 };
 
 /// Represents a SystemVerilog queue, for use during constant evaluation.
@@ -340,12 +533,3 @@ struct SLANG_EXPORT ConstantRange {
 };
 
 } // namespace slang
-
-namespace std {
-
-template<>
-struct hash<slang::ConstantValue> {
-    size_t operator()(const slang::ConstantValue& cv) const { return cv.hash(); }
-};
-
-} // namespace std
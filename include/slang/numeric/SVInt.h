@@ -12,6 +12,7 @@
 #include <iosfwd>
 
 #include "slang/numeric/MathUtils.h"
+#include "slang/util/Hash.h"
 #include "slang/util/SmallVector.h"
 
 namespace slang {
@@ -689,6 +690,18 @@ inline logic_t SVInt::logicalEquiv(const SVInt& lhs, const SVInt& rhs) {
     return logicalImpl(lhs, rhs) && logicalImpl(rhs, lhs);
 }
 
+/// Hashes only the words that actually exist for the value: two-state
+/// numbers store no unknown plane so just their value words are read, and
+/// values that fit in a single word mix it directly instead of going
+/// through the byte-wise path. Inline so that hash table probes with SVInt
+/// keys don't pay a call per probe.
+inline size_t SVInt::hash() const {
+    if (isSingleWord())
+        return (size_t)ankerl::unordered_dense::detail::wyhash::hash(val);
+    return (size_t)ankerl::unordered_dense::detail::wyhash::hash(getRawData(),
+                                                                 getNumWords() * WORD_SIZE);
+}
+
 /// Returns the ceiling of the log_2 of the value. If value is zero, returns zero.
 inline SLANG_EXPORT uint32_t clog2(const SVInt& v) {
     if (v == 0)
@@ -716,6 +729,13 @@ struct hash<slang::SVInt> {
 template<>
 struct equal_to<slang::SVInt> {
     bool operator()(const slang::SVInt& lhs, const slang::SVInt& rhs) const {
+        // Cache keys are overwhelmingly same-width two-state values, which
+        // compare with a single word load. Mixed-width and four-state values
+        // take the full path, which handles extension and the unknown plane.
+        if (lhs.isSingleWord() && rhs.isSingleWord() &&
+            lhs.getBitWidth() == rhs.getBitWidth()) {
+            return *lhs.getRawPtr() == *rhs.getRawPtr();
+        }
         return exactlyEqual(lhs, rhs);
     }
 };
@@ -17,6 +17,7 @@
 namespace slang {
 
 class BumpAllocator;
+class StringInterner;
 
 }
 
@@ -27,6 +28,35 @@ struct SLANG_EXPORT LexerOptions {
     /// The maximum number of errors that can occur before the rest of the source
     /// buffer is skipped.
     uint32_t maxErrors = 16;
+
+    /// If set, whitespace and comment trivia are not recorded on tokens, which
+    /// substantially reduces memory usage when parsing very large inputs. Trivia
+    /// that affects how the source is interpreted (newlines, and comments that
+    /// contain a line break or line continuation) is always retained, but the
+    /// original source text can no longer be reproduced from the token stream.
+    bool minimalTrivia = false;
+
+    /// If set, each token's run of whitespace, end of line, and block comment
+    /// trivia is collapsed into a single trivia piece (of kind CollapsedText)
+    /// that references the original source text, reducing token memory when
+    /// parsing very large inputs. Unlike @a minimalTrivia the source can still
+    /// be reproduced from the token stream; use Lexer::expandTrivia to
+    /// materialize the individual pieces on demand. Line comments are always
+    /// recorded separately since they can carry a trailing line continuation.
+    bool collapseTrivia = false;
+
+    /// If non-null, string literal values at least @a literalInternThreshold bytes
+    /// long are deduplicated through this interner instead of being copied into
+    /// the token arena at each occurrence. This saves substantial memory when the
+    /// same long literals repeat across many files. The interner must outlive all
+    /// tokens produced from it; interning is internally synchronized, so a single
+    /// interner can be shared by lexers running on multiple threads.
+    StringInterner* literalInterner = nullptr;
+
+    /// The minimum size in bytes for a string literal value to be routed
+    /// through @a literalInterner. Short literals aren't worth the hash and
+    /// probe; they cost less to copy than to deduplicate.
+    uint32_t literalInternThreshold = 64;
 };
 
 /// Possible encodings for encrypted text used in a pragma protect region.
@@ -38,10 +68,19 @@ enum class SLANG_EXPORT ProtectEncoding { UUEncode, Base64, QuotedPrintable, Raw
 ///
 /// There are also helper methods on this class that handle token manipulation on the
 /// character level.
+///
+/// Plain ASCII input never pays for UTF-8 handling: validation is only
+/// invoked when a byte with the high bit set is actually encountered, and
+/// long runs of comment or disabled text are skipped in bulk. Line numbers
+/// are not tracked here at all; SourceManager indexes line offsets lazily,
+/// per buffer, the first time a diagnostic needs them.
 class SLANG_EXPORT Lexer {
 public:
+    /// Constructs a new lexer for the given buffer. If @a startOffset is non-zero,
+    /// lexing begins at that offset into the buffer instead of at the beginning;
+    /// token locations still reflect absolute buffer offsets.
     Lexer(SourceBuffer buffer, BumpAllocator& alloc, Diagnostics& diagnostics,
-          LexerOptions options = LexerOptions{});
+          LexerOptions options = LexerOptions{}, size_t startOffset = 0);
 
     // Not copyable
     Lexer(const Lexer&) = delete;
@@ -56,9 +95,20 @@ public:
     /// is on the same line as the previous token we've lexed.
     bool isNextTokenOnSameLine();
 
+    /// Returns the number of non-EOF tokens that have been lexed from the buffer so far.
+    size_t lexedTokenCount() const { return tokenCount; }
+
     /// Lexes a token that contains encoded text as part of a protected envelope.
     Token lexEncodedText(ProtectEncoding encoding, uint32_t expectedBytes, bool singleLine);
 
+    /// Scans past text inside an inactive conditional directive branch without
+    /// lexing it into tokens. The scan stops at the next backtick (which may start
+    /// a directive) or at the end of the buffer; comments, string literals, and
+    /// escaped identifiers are passed over so that backticks inside them don't
+    /// stop the scan. Returns a token of kind Unknown covering the skipped text,
+    /// or an empty token if nothing was skipped.
+    Token lexDisabledText();
+
     /// Concatenates two tokens together; used for macro pasting.
     static Token concatenateTokens(BumpAllocator& alloc, Token left, Token right);
 
@@ -72,6 +122,11 @@ public:
     /// The range of tokens to commentify is given by @a begin and @a end.
     static Trivia commentify(BumpAllocator& alloc, Token* begin, Token* end);
 
+    /// Materializes the individual pieces of a collapsed trivia node (see
+    /// LexerOptions::collapseTrivia) by re-lexing its source text, and appends
+    /// them to @a results. Trivia of any other kind is appended unchanged.
+    static void expandTrivia(Trivia trivia, SmallVectorBase<Trivia>& results);
+
     /// Splits the given token at the specified offset into its raw source text. The trailing
     /// portion of the split is lexed into new tokens and appened to @a results
     static void splitTokens(BumpAllocator& alloc, Diagnostics& diagnostics,
@@ -101,6 +156,7 @@ private:
     void scanIdentifier();
     bool scanUTF8Char(bool alreadyErrored, uint32_t* code);
     void scanEncodedText(ProtectEncoding encoding, uint32_t expectedBytes, bool singleLine);
+    void scanDisabledText();
 
     template<typename... Args>
     Token create(TokenKind kind, Args&&... args);
@@ -147,6 +203,9 @@ private:
     // the number of errors that have occurred while lexing the current buffer
     uint32_t errorCount = 0;
 
+    // the number of non-EOF tokens lexed from the buffer so far
+    size_t tokenCount = 0;
+
     // temporary storage for building arrays of trivia
     SmallVector<Trivia, 32> triviaBuffer;
 
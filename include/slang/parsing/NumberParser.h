@@ -139,6 +139,7 @@ private:
     int append(Token token, bool isFirst);
     Token finishValue(Token firstToken, bool singleToken);
     void addDigit(logic_t digit, int maxValue);
+    void spillQuickDigits();
     Diagnostic& addDiag(DiagCode code, SourceLocation location);
     IntResult reportMissingDigits(Token sizeToken, Token baseToken, Token first);
     void reportIntOverflow(Token token);
@@ -150,6 +151,18 @@ private:
     bool hasUnknown = false;
     bool valid = false;
     SVInt decimalValue;
+
+    // Fast path for power-of-two bases: significant digits accumulate
+    // directly into a single 64-bit word, skipping the digit vector for
+    // the short literals that dominate real designs. An unknown digit or
+    // one digit too many spills into `digits` and falls back to the
+    // general path.
+    uint64_t quickValue = 0;
+    uint32_t quickDigitCount = 0;
+    uint32_t quickShift = 0;
+    uint32_t quickCapacity = 0;
+    bool quickLeadingZero = false;
+    bool usingQuick = false;
     Diagnostics& diagnostics;
     BumpAllocator& alloc;
     SmallVector<logic_t> digits;
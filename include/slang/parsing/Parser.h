@@ -14,11 +14,13 @@
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxFacts.h"
 #include "slang/util/Bag.h"
+#include "slang/util/Cancellation.h"
 #include "slang/util/Hash.h"
 
 namespace slang::parsing {
 
 class Preprocessor;
+class TokenPipeline;
 
 namespace detail {
 
@@ -53,9 +55,14 @@ enum class ExpressionOptions {
     BinsSelectContext = 1 << 6,
 
     /// "dist" expressions are allowed in this context.
-    AllowDist = 1 << 7
+    AllowDist = 1 << 7,
+
+    /// Don't consume a trailing conditional (?:) after the subexpression.
+    /// Used internally to parse chained conditionals iteratively instead of
+    /// recursing once per chain link; never propagated to nested operands.
+    DisallowConditional = 1 << 8
 };
-BITMASK(ExpressionOptions, AllowDist)
+BITMASK(ExpressionOptions, DisallowConditional)
 
 /// Various options for parsing names.
 enum class NameOptions {
@@ -125,12 +132,52 @@ struct SLANG_EXPORT ParserOptions {
     /// The maximum depth of nested language constructs (statements, exceptions) before
     /// we give up for fear of stack overflow.
     uint32_t maxRecursionDepth = 1024;
+
+    /// The maximum number of errors that can be encountered while parsing a
+    /// single compilation unit before giving up and dropping the rest of it;
+    /// zero means no limit. The token window only ever moves forward so no
+    /// region is ever lexed twice, but each failed parse attempt can scan
+    /// far ahead before recovery skips on, which makes full error recovery
+    /// on hopelessly malformed input (a corrupted generated file, say) cost
+    /// far more than a clean parse. A budget keeps such files linear: once
+    /// it's spent the rest of the unit is abandoned in one pass.
+    uint32_t errorLimit = 0;
+
+    /// If true, the preprocessor runs ahead of the parser on a separate
+    /// worker thread, overlapping macro expansion with parsing. This only
+    /// applies to full compilation unit parses via SyntaxTree; see the
+    /// TokenPipeline class for the minor behavioral caveats it implies.
+    bool pipelinedPreprocessing = false;
+
+    /// If true, bodies of module / interface / program declarations at
+    /// compilation unit scope are not parsed; instead their raw tokens are
+    /// recorded in the parser metadata so that a body can be parsed later,
+    /// on demand, if the definition is ever actually instantiated (see
+    /// SyntaxTree::expandDeferredBody). This is intended for library files,
+    /// where most definitions are never referenced; deferred bodies that
+    /// are never expanded get no diagnostics beyond preprocessing, and
+    /// instantiations inside them don't count toward top-level inference.
+    bool deferModuleBodies = false;
+
+    /// If true, parsing of a compilation unit stops at the first error
+    /// instead of recovering and continuing; members after the abort point
+    /// are dropped from the resulting tree. This is intended for fast
+    /// syntax-only gating (e.g. pre-commit hooks), where only the presence
+    /// and location of the first error matters.
+    bool stopOnFirstError = false;
+
+    /// A token that allows a long parse to be cancelled from another thread.
+    /// It's checked on member and statement loop backedges; when signaled,
+    /// the parse unwinds by throwing CancellationException out of the
+    /// calling API.
+    CancellationToken cancellationToken;
 };
 
 /// Implements a full syntax parser for SystemVerilog.
 class SLANG_EXPORT Parser : ParserBase, syntax::SyntaxFacts {
 public:
     explicit Parser(Preprocessor& preprocessor, const Bag& options = {});
+    explicit Parser(TokenPipeline& pipeline, const Bag& options = {});
 
     /// Parse a whole compilation unit.
     syntax::CompilationUnitSyntax& parseCompilationUnit();
@@ -154,9 +201,21 @@ public:
     /// Check whether the parser has consumed the entire input stream.
     bool isDone();
 
+    /// Parses the member list of a module body whose parsing was previously
+    /// deferred. @a tokens must be a token range recorded in parser metadata
+    /// by an earlier parse with ParserOptions::deferModuleBodies set, and
+    /// @a parentKind the kind of the declaration that owns the body.
+    std::span<syntax::MemberSyntax*> parseDeferredMembers(std::span<const Token> tokens,
+                                                          syntax::SyntaxKind parentKind);
+
     /// Gets the current set of metadata collected during parsing.
     ParserMetadata&& getMetadata();
 
+    /// Resets the parser so that it can parse a new token stream from its
+    /// preprocessor. All previously collected metadata is discarded, but
+    /// internal buffer capacity is retained; see ParseSession.
+    void reset();
+
 private:
     using ExpressionOptions = detail::ExpressionOptions;
     using NameOptions = detail::NameOptions;
@@ -237,6 +296,7 @@ private:
     syntax::ModuleHeaderSyntax& parseModuleHeader();
     syntax::ParameterPortListSyntax* parseParameterPortList();
     syntax::MemberSyntax& parseModule(AttrList attributes, syntax::SyntaxKind parentKind, bool& anyLocalModules);
+    std::span<Token> captureDeferredBody(TokenKind endKind);
     syntax::AnonymousProgramSyntax& parseAnonymousProgram(AttrList attributes);
     syntax::MemberSyntax& parseModportSubroutinePortList(AttrList attributes);
     syntax::MemberSyntax& parseModportPort();
@@ -287,7 +347,7 @@ private:
     syntax::FunctionPrototypeSyntax& parseFunctionPrototype(syntax::SyntaxKind parentKind, bitmask<FunctionOptions> options, bool* isConstructor = nullptr);
     syntax::FunctionDeclarationSyntax& parseFunctionDeclaration(AttrList attributes, syntax::SyntaxKind functionKind, TokenKind endKind, syntax::SyntaxKind parentKind);
     Token parseLifetime();
-    std::span<syntax::SyntaxNode*> parseBlockItems(TokenKind endKind, Token& end, bool inConstructor);
+    std::span<syntax::SyntaxNode*> parseBlockItems(TokenKind endKind, Token& end, bool inConstructor, syntax::SyntaxNode* initialItem = nullptr);
     syntax::GenvarDeclarationSyntax& parseGenvarDeclaration(AttrList attributes);
     syntax::LoopGenerateSyntax& parseLoopGenerateConstruct(AttrList attributes);
     syntax::IfGenerateSyntax& parseIfGenerateConstruct(AttrList attributes);
@@ -386,16 +446,42 @@ private:
 
     // ---- Lookahead routines, for determining which kind of syntax to parse ----
 
+    // The questions answered by the unbounded lookahead scans below, used to
+    // key the memo table in memoizeScan(). Bounded scans that only look at a
+    // fixed handful of tokens aren't worth an entry.
+    enum class ScanQuestion : uint8_t {
+        PlainPortName,
+        NonAnsiPort,
+        VariableDeclaration,
+        LocalVariableDeclaration,
+        HierarchyInstantiation,
+        NamedHierarchyInstantiation,
+        ConditionalExpression
+    };
+
     bool isMember();
     bool isPortDeclaration(bool inStatement);
     bool isNetDeclaration();
     bool isVariableDeclaration();
+    bool isVariableDeclarationImpl();
     bool isLocalVariableDeclaration();
+    bool isLocalVariableDeclarationImpl();
     bool isHierarchyInstantiation(bool requireName);
+    bool isHierarchyInstantiationImpl(bool requireName);
     bool isNonAnsiPort();
+    bool isNonAnsiPortImpl();
     bool isPlainPortName();
+    bool isPlainPortNameImpl();
     bool isConditionalExpression();
+    bool isConditionalExpressionImpl();
     bool isSequenceRepetition();
+
+    template<typename TScan>
+    bool memoizeScan(ScanQuestion question, TScan&& scan);
+
+    // Hides ParserBase::pushTokens so that the scan verdict memo is
+    // invalidated whenever the token stream is rewritten in place.
+    void pushTokens(std::span<const Token> tokens);
     bool scanDimensionList(uint32_t& index);
     bool scanQualifiedName(uint32_t& index, bool allowNew);
     bool scanAttributes(uint32_t& index);
@@ -423,6 +509,20 @@ private:
         using std::runtime_error::runtime_error;
     };
 
+    // ---- Early abort on error ----
+    // (see ParserOptions::stopOnFirstError and ParserOptions::errorLimit)
+
+    class ParseAbortException : public std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    // Throws ParseAbortException if stopOnFirstError is set and any error
+    // diagnostic has been issued since the last call, or if the total number
+    // of errors in this unit has exhausted the error budget set by
+    // errorLimit; only newly added diagnostics are scanned so that repeated
+    // calls stay cheap.
+    void checkAbortOnError();
+
     // ---- Various helper methods ----
 
     // Reports an error if there are attributes in the given span.
@@ -468,11 +568,41 @@ private:
     // The current depth of recursion in the parser.
     size_t recursionDepth = 0;
 
+    // Set when a subexpression parsed with ExpressionOptions::DisallowConditional
+    // stopped in front of a conditional that it would otherwise have consumed,
+    // so the enclosing conditional chain loop knows to keep going.
+    bool deferredConditional = false;
+
+    // The number of diagnostics already scanned by checkAbortOnError.
+    size_t errorScanIndex = 0;
+
+    // The number of error diagnostics seen so far in the current unit,
+    // counted against ParserOptions::errorLimit.
+    uint32_t unitErrorCount = 0;
+
     // The kind of definition currently being parsed, which could be a module,
     // interface, program, etc.
     syntax::SyntaxKind currentDefinitionKind = syntax::SyntaxKind::Unknown;
+
+    // Memoized verdicts of the unbounded disambiguation scans, keyed by the
+    // location of the token where the scan started. Nested ambiguous
+    // constructs re-ask the same questions at the same positions, so without
+    // the memo parameterized class and instantiation argument lists get
+    // re-scanned once per enclosing decision point.
+    flat_hash_map<std::tuple<SourceLocation, ScanQuestion>, bool> scanVerdicts;
 };
 
+template<typename TScan>
+bool Parser::memoizeScan(ScanQuestion question, TScan&& scan) {
+    auto key = std::make_tuple(peek().location(), question);
+    if (auto it = scanVerdicts.find(key); it != scanVerdicts.end())
+        return it->second;
+
+    bool verdict = scan();
+    scanVerdicts.emplace(key, verdict);
+    return verdict;
+}
+
 template<bool (*IsEnd)(TokenKind)>
 bool Parser::scanTypePart(uint32_t& index, TokenKind start, TokenKind end) {
     int nesting = 1;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "slang/diagnostics/Diagnostics.h"
+#include "slang/numeric/Time.h"
 #include "slang/parsing/Token.h"
 #include "slang/syntax/SyntaxFacts.h"
 #include "slang/syntax/SyntaxNode.h"
@@ -17,12 +18,25 @@
 namespace slang::parsing {
 
 class Preprocessor;
+class TokenPipeline;
+
+enum class KeywordVersion : uint8_t;
 
 /// Base class for the Parser, which contains helpers and language-agnostic parsing routines.
 /// Mostly this helps keep the main Parser smaller and more focused.
+///
+/// The parser is single pass and predictive: grammar decisions are made by
+/// peeking ahead in the token window rather than by speculatively building
+/// syntax nodes and backtracking, so every node allocated from the arena ends
+/// up in the final tree.
 class SLANG_EXPORT ParserBase {
 protected:
     ParserBase(Preprocessor& preprocessor);
+    ParserBase(TokenPipeline& pipeline);
+
+    /// Resets the token window and scratch buffers so that parsing can start
+    /// over from a fresh token stream. Buffer capacity is retained.
+    void reset();
 
     Diagnostics& getDiagnostics();
     Diagnostic& addDiag(DiagCode code, SourceLocation location);
@@ -46,6 +60,23 @@ protected:
 
     Preprocessor& getPP() { return window.tokenSource; }
 
+    /// Indicates whether tokens are being consumed from a pipeline running
+    /// the preprocessor on a separate thread. When true, the preprocessor
+    /// itself must not be touched until parsing completes.
+    bool isPipelined() const { return window.pipeline != nullptr; }
+
+    /// Gets the keyword version to use when re-lexing tokens during parsing.
+    KeywordVersion getKeywordVersion() const;
+
+    /// @name Preprocessor directive state in effect at the current parse
+    /// position. These route through the pipeline when one is active,
+    /// since the preprocessor itself has already run ahead by then.
+    /// @{
+    TokenKind getDefaultNetType() const;
+    TokenKind getUnconnectedDrive() const;
+    std::optional<TimeScale> getTimeScale() const;
+    /// @}
+
     /// Helper class that maintains a sliding window of tokens, with lookahead.
     class Window {
     public:
@@ -63,6 +94,10 @@ protected:
         // the source of all tokens
         Preprocessor& tokenSource;
 
+        // if non-null, tokens are pulled from here instead of directly
+        // from the preprocessor
+        TokenPipeline* pipeline = nullptr;
+
         // a buffer of tokens for implementing lookahead
         Token* buffer = nullptr;
 
@@ -80,6 +115,7 @@ protected:
         void addNew();
         void moveToNext();
         void insertHead(std::span<const Token> tokens);
+        void reset();
     };
 
     BumpAllocator& alloc;
@@ -120,11 +156,13 @@ protected:
             return;
         }
 
-        SmallVector<syntax::TokenOrSyntax, 16> buffer;
+        // Building over the arena lets finalize() hand the buffer off to the
+        // syntax tree without the copy that copy() would make.
+        SmallVector<syntax::TokenOrSyntax, 16> buffer(alloc);
         parseList<IsExpected, IsEnd, TParserFunc>(buffer, closeKind, separatorKind, closeToken,
                                                   requireItems, code,
                                                   std::forward<TParserFunc>(parseItem), allowEmpty);
-        list = buffer.copy(alloc);
+        list = buffer.finalize(alloc);
     }
 
     template<bool (*IsExpected)(TokenKind), bool (*IsEnd)(TokenKind), typename TParserFunc>
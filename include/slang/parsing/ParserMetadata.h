@@ -29,6 +29,11 @@ struct SLANG_EXPORT ParserMetadata {
     /// (such as various bits of preprocessor state).
     flat_hash_map<const syntax::SyntaxNode*, Node> nodeMap;
 
+    /// For module declarations whose body parsing was deferred (see
+    /// ParserOptions::deferModuleBodies), maps the declaration to the raw
+    /// tokens of its body so it can be parsed later on demand.
+    flat_hash_map<const syntax::SyntaxNode*, std::span<const Token>> deferredBodies;
+
     /// A set of names of all instantiations of global modules/interfaces/programs.
     /// This can be used to determine which modules should be considered as top-level
     /// roots of the design.
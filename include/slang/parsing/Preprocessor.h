@@ -51,6 +51,13 @@ struct SLANG_EXPORT PreprocessorOptions {
 
     /// A set of preprocessor directives to be ignored.
     flat_hash_set<std::string_view> ignoreDirectives;
+
+    /// If set to true, text inside inactive conditional directive branches is
+    /// skipped with a raw character scan instead of being fully tokenized.
+    /// This is much faster for heavily ifdef'd-out code, but the skipped text
+    /// is preserved in the syntax tree as a single opaque token and lexical
+    /// errors within it are not reported.
+    bool rawDisabledTextScan = false;
 };
 
 /// Preprocessor - Interface between lexer and parser
@@ -67,9 +74,19 @@ public:
     /// Gets the next token in the stream, after applying preprocessor rules.
     Token next();
 
+    /// Resets the preprocessor back to its freshly constructed state (no active
+    /// sources, no user-defined macros, all directive state at defaults) so
+    /// that it can be reused to preprocess another compilation unit. Container
+    /// capacity is retained, which amortizes allocations when processing many
+    /// files in a row; see ParseSession.
+    void reset(std::span<const syntax::DefineDirectiveSyntax* const> inheritedMacros = {});
+
     /// Push a new source file onto the stack.
     void pushSource(std::string_view source, std::string_view name = "source");
-    void pushSource(SourceBuffer buffer);
+
+    /// Push a new source file onto the stack. If @a startOffset is non-zero,
+    /// lexing begins at that offset into the buffer instead of at the beginning.
+    void pushSource(SourceBuffer buffer, size_t startOffset = 0);
 
     /// Predefines the given macro definition. The given definition string is lexed
     /// as if it were source text immediately following a `define directive.
@@ -269,8 +286,17 @@ private:
         bool isTopLevel = false;
     };
 
+    // Memoized, location-independent facts about a macro's replacement list,
+    // computed once per definition and used to skip the rescanning passes in
+    // handleTopLevelMacro for the common case of simple macro bodies.
+    struct MacroBodyFlags {
+        bool hasNestedUsages = false; // directives (nested macros) in the body
+        bool hasMacroOps = false;     // stringification / concatenation tokens
+    };
+
     // Macro handling methods
     MacroDef findMacro(Token directive);
+    const MacroBodyFlags& getMacroBodyFlags(const syntax::DefineDirectiveSyntax& macro);
     std::pair<syntax::MacroActualArgumentListSyntax*, Trivia> handleTopLevelMacro(Token directive);
     bool expandMacro(MacroDef macro, MacroExpansion& expansion,
                      syntax::MacroActualArgumentListSyntax* actualArgs);
@@ -363,6 +389,9 @@ private:
     // map from macro name to macro definition
     flat_hash_map<std::string_view, MacroDef> macros;
 
+    // memoized per-definition body analysis; see MacroBodyFlags
+    flat_hash_map<const syntax::DefineDirectiveSyntax*, MacroBodyFlags> macroBodyFlags;
+
     // list of expanded macro tokens to drain before continuing with active lexer
     SmallVector<Token> expandedTokens;
     Token* currentMacroToken = nullptr;
@@ -385,6 +414,41 @@ private:
     // have been marked `pragma once so that we avoid trying to include them more than once.
     flat_hash_set<const char*> includeOnceHeaders;
 
+    // State for detecting the classic include guard idiom (a leading `ifndef whose
+    // matching `endif is the last significant thing in the file) as an include file
+    // is preprocessed. There is one entry for each active include file still under
+    // analysis, parallel to the tail of lexerStack.
+    struct GuardDetectEntry {
+        // The start of the include file's text buffer; used as the cache key.
+        const char* fileKey;
+
+        // The depth of lexerStack at which this include file sits.
+        size_t lexerDepth;
+
+        // The name of the candidate guard macro from the leading `ifndef.
+        std::string_view candidate;
+
+        // The depth of branchStack just before the leading `ifndef was pushed.
+        size_t branchDepth = 0;
+
+        // The number of tokens the file's lexer had produced when the guard's
+        // `endif was seen; any tokens lexed after that mean the file has
+        // significant text following the guard.
+        size_t closeCount = 0;
+
+        enum Phase { Detecting, InGuard, Closed, Invalid } phase = Detecting;
+    };
+    SmallVector<GuardDetectEntry, 2> guardDetectStack;
+
+    // Maps from a file (identified as in includeOnceHeaders) to the name of the
+    // include guard macro wrapping it, for files that have been observed to follow
+    // the guard idiom. Re-including such a file while its guard macro is defined
+    // can't produce any tokens, so the include is skipped without relexing.
+    flat_hash_map<const char*, std::string_view> includeGuardHeaders;
+
+    // Returns the guard detection entry for the currently active lexer, if it has one.
+    GuardDetectEntry* activeGuardDetect();
+
     /// Various state set by preprocessor directives.
     std::vector<KeywordVersion> keywordVersionStack;
     std::optional<TimeScale> activeTimeScale;
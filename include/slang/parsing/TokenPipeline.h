@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+//! @file TokenPipeline.h
+//! @brief Runs preprocessing ahead of parsing on a worker thread
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "slang/diagnostics/Diagnostics.h"
+#include "slang/numeric/Time.h"
+#include "slang/parsing/LexerFacts.h"
+#include "slang/parsing/Token.h"
+#include "slang/util/BumpAllocator.h"
+
+namespace slang::parsing {
+
+class Preprocessor;
+
+/// Decouples preprocessing from parsing by running the preprocessor on a
+/// worker thread that produces chunks of tokens into a queue, which the
+/// parser then drains from its own thread. On macro-heavy inputs the two
+/// stages take comparable amounts of time, so overlapping them can nearly
+/// halve the end-to-end latency of parsing a single file.
+///
+/// Because the producer runs ahead of the consumer, the two sides can't
+/// share mutable state. The preprocessor must therefore be constructed
+/// with its own allocator and diagnostics, while the parser-side arena and
+/// diagnostics are passed here; the caller is responsible for merging the
+/// preprocessor's into the parser's once parsing completes (by stealing
+/// the arena and appending the diagnostics). Directive state the parser
+/// needs during parsing (default nettype, unconnected drive, timescale)
+/// travels through the queue alongside the tokens it applied to. There are
+/// two observable differences from serial operation: the parser can't
+/// report design element context back to the preprocessor, so the warning
+/// about directives inside design elements is not issued, and token
+/// splitting during parse uses the keyword version in effect when the
+/// pipeline was started rather than tracking `begin_keywords regions.
+class SLANG_EXPORT TokenPipeline {
+public:
+    /// Constructs a new token pipeline. The preprocessor must have been
+    /// created with its own allocator and diagnostics objects, distinct
+    /// from @a parseAlloc and @a parseDiags which the parser will use.
+    TokenPipeline(Preprocessor& preprocessor, BumpAllocator& parseAlloc, Diagnostics& parseDiags);
+
+    /// Destructor; waits for the worker thread to finish if it's still running.
+    ~TokenPipeline();
+
+    // Not copyable.
+    TokenPipeline(const TokenPipeline&) = delete;
+    TokenPipeline& operator=(const TokenPipeline&) = delete;
+
+    /// Starts the worker thread. All sources should already have been
+    /// pushed into the preprocessor; it must not be touched again until
+    /// @a finish has been called.
+    void start();
+
+    /// Waits for the worker thread to run the preprocessor to completion.
+    /// After this returns the preprocessor may safely be accessed again.
+    void finish();
+
+    /// Gets the next token in the stream, blocking if the preprocessor
+    /// hasn't produced it yet. Once the end of the stream has been reached,
+    /// returns EndOfFile tokens forever.
+    Token next();
+
+    /// Gets the allocator the parser should use for tree nodes.
+    BumpAllocator& getAllocator() const { return parseAlloc; }
+
+    /// Gets the diagnostics the parser should issue into.
+    Diagnostics& getDiagnostics() const { return parseDiags; }
+
+    /// Gets the preprocessor driving the pipeline. Note that it is only
+    /// safe to access before @a start or after @a finish.
+    Preprocessor& getPreprocessor() const { return preprocessor; }
+
+    /// Gets the keyword version that was in effect when the pipeline started.
+    KeywordVersion getKeywordVersion() const { return keywordVersion; }
+
+    /// @name Directive state as of the most recently consumed token.
+    /// These mirror the corresponding Preprocessor methods.
+    /// @{
+    TokenKind getDefaultNetType() const { return state.defaultNetType; }
+    TokenKind getUnconnectedDrive() const { return state.unconnectedDrive; }
+    const std::optional<TimeScale>& getTimeScale() const { return state.timeScale; }
+    /// @}
+
+private:
+    // Preprocessor directive state that the parser queries while parsing.
+    // Directives are rare, so rather than stamping this onto every token
+    // the producer records a change entry whenever it differs from the
+    // previous token and the consumer replays the entries as it goes.
+    struct DirectiveState {
+        TokenKind defaultNetType;
+        TokenKind unconnectedDrive;
+        std::optional<TimeScale> timeScale;
+
+        bool operator==(const DirectiveState& rhs) const = default;
+    };
+
+    struct StateChange {
+        size_t tokenIndex;
+        DirectiveState state;
+    };
+
+    struct Chunk {
+        std::vector<Token> tokens;
+        std::vector<StateChange> stateChanges;
+    };
+
+    void run();
+    DirectiveState snapshotState() const;
+
+    static constexpr size_t ChunkSize = 512;
+
+    Preprocessor& preprocessor;
+    BumpAllocator& parseAlloc;
+    Diagnostics& parseDiags;
+    KeywordVersion keywordVersion;
+
+    // The queue is unbounded on purpose: token memory lives in the
+    // preprocessor's arena for the lifetime of the parse regardless, so
+    // capping the queue would only add producer stalls -- and it guarantees
+    // the worker always runs to completion even if the parser stops
+    // consuming early, which keeps finish() free of deadlocks.
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<Chunk> chunks;
+    size_t nextChunk = 0;
+    bool producerDone = false;
+
+    // Consumer-side state; only ever touched from the parsing thread.
+    Chunk current;
+    size_t currentIndex = 0;
+    size_t stateIndex = 0;
+    DirectiveState state;
+    Token eofToken;
+
+    std::thread worker;
+};
+
+} // namespace slang::parsing
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+//! @file ParseSession.h
+//! @brief Reusable parsing pipeline for batch processing of files
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "slang/parsing/Parser.h"
+#include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/SyntaxTree.h"
+
+namespace slang::syntax {
+
+/// A reusable lexer / preprocessor / parser pipeline for parsing many files
+/// in a row.
+///
+/// Each call to one of the SyntaxTree factory functions constructs a fresh
+/// Preprocessor and Parser, whose setup and teardown (the parser's token
+/// window, the preprocessor's macro tables, number parsing scratch buffers,
+/// and so on) can dominate the cost of parsing large batches of small files.
+/// A ParseSession constructs that machinery once and resets it between files,
+/// retaining container capacity across parses while each returned tree still
+/// takes ownership of its own arena memory. The trees produced are identical
+/// to the ones SyntaxTree::fromBuffer would create.
+///
+/// The session is single threaded; for parallel batch parsing give each
+/// worker thread its own session.
+class SLANG_EXPORT ParseSession {
+public:
+    /// Constructs a new parse session.
+    /// @a sourceManager is the manager that owns all of the loaded source code.
+    /// @a options is an optional bag of lexer, preprocessor, and parser options.
+    explicit ParseSession(SourceManager& sourceManager, const Bag& options = {});
+
+    /// Parses a full compilation unit from an already loaded source buffer.
+    /// @a buffer is the loaded source buffer.
+    /// @a inheritedMacros is a list of macros to predefine in the new syntax tree.
+    /// @return the created and parsed syntax tree.
+    std::shared_ptr<SyntaxTree> parse(const SourceBuffer& buffer,
+                                      SyntaxTree::MacroList inheritedMacros = {});
+
+    /// Parses a full compilation unit formed by concatenating several loaded
+    /// source buffers.
+    /// @a buffers is the list of buffers that should be concatenated to form
+    /// the compilation unit to parse.
+    /// @a inheritedMacros is a list of macros to predefine in the new syntax tree.
+    /// @return the created and parsed syntax tree.
+    std::shared_ptr<SyntaxTree> parse(std::span<const SourceBuffer> buffers,
+                                      SyntaxTree::MacroList inheritedMacros = {});
+
+    /// Gets the source manager used by this session.
+    SourceManager& getSourceManager() const { return sourceManager; }
+
+    /// The options used to construct the session.
+    const Bag& getOptions() const { return options; }
+
+private:
+    SourceManager& sourceManager;
+    Bag options;
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    parsing::Preprocessor preprocessor;
+    parsing::Parser parser;
+};
+
+} // namespace slang::syntax
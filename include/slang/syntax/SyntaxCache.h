@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+//! @file SyntaxCache.h
+//! @brief Cache of parsed syntax trees keyed by source content hash
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+
+#include "slang/util/Bag.h"
+#include "slang/util/Hash.h"
+#include "slang/util/Util.h"
+
+namespace slang {
+struct SourceBuffer;
+}
+
+namespace slang::syntax {
+
+class SyntaxTree;
+
+/// A cache of parsed syntax trees, keyed by the hash of the source text
+/// together with a fingerprint of the lexer / preprocessor / parser options
+/// in effect, so that repeated loads of identical files skip lexing,
+/// preprocessing, and parsing entirely.
+///
+/// To use it, place a shared_ptr to a cache instance into the option bag
+/// passed to the SyntaxTree factory methods. Cached trees are shared by all
+/// lookups that hit them, so callers must not mutate them.
+///
+/// Note that entries are keyed by the contents of the top-level file only;
+/// files pulled in via `include directives are not separately fingerprinted.
+/// The cache is therefore intended to be shared between multiple compilations
+/// within a single tool invocation that use a common SourceManager, where
+/// included files cannot change out from under it.
+class SLANG_EXPORT SyntaxCache {
+public:
+    /// Looks up a previously parsed tree for the given source buffer and
+    /// options. Returns nullptr if there is no matching entry.
+    std::shared_ptr<SyntaxTree> find(const SourceBuffer& buffer, const Bag& options) const;
+
+    /// Records the given parsed tree so that later lookups of identical
+    /// source text and options can reuse it.
+    void insert(const SourceBuffer& buffer, const Bag& options, std::shared_ptr<SyntaxTree> tree);
+
+    /// @return the number of trees currently held by the cache.
+    size_t size() const;
+
+private:
+    static uint64_t hashKey(const SourceBuffer& buffer, const Bag& options);
+
+    mutable std::shared_mutex mut;
+    flat_hash_map<uint64_t, std::shared_ptr<SyntaxTree>> entries;
+};
+
+} // namespace slang::syntax
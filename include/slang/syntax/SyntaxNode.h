@@ -94,6 +94,14 @@ public:
     /// an empty Token.
     Token childToken(size_t index) const;
 
+    /// Gets the child (token or node) at the specified index.
+    /// Note: implemented in AllSyntax.cpp via generated per-kind child tables.
+    ConstTokenOrSyntax getChild(size_t index) const;
+
+    /// Gets the child (token or node) at the specified index.
+    /// Note: implemented in AllSyntax.cpp via generated per-kind child tables.
+    TokenOrSyntax getChild(size_t index);
+
     /// Gets the number of (direct) children underneath this node in the tree.
     size_t getChildCount() const; // Note: implemented in AllSyntax.cpp
 
@@ -152,10 +160,6 @@ public:
 
 protected:
     explicit SyntaxNode(SyntaxKind kind) : kind(kind) {}
-
-private:
-    ConstTokenOrSyntax getChild(size_t index) const;
-    TokenOrSyntax getChild(size_t index);
 };
 
 SLANG_EXPORT SyntaxNode* clone(const SyntaxNode&, BumpAllocator&);
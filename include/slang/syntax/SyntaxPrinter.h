@@ -10,11 +10,51 @@
 #include <string>
 
 #include "slang/syntax/SyntaxNode.h"
+#include "slang/util/BumpAllocator.h"
+#include "slang/util/SmallVector.h"
 
 namespace slang::syntax {
 
 class SyntaxTree;
 
+/// A lightweight rope that accumulates source text as an ordered list of pieces.
+///
+/// Each piece is a string view that either references caller-owned memory
+/// (typically a span of an original source buffer) or text copied into an
+/// internal arena. Adjacent pieces that are contiguous in memory are coalesced,
+/// so an unmodified region of a file collapses into a single piece over the
+/// original buffer no matter how many tokens it spans.
+class SLANG_EXPORT SyntaxRope {
+public:
+    /// Appends @a text to the rope by reference, without copying it.
+    /// The referenced memory must remain valid for as long as the
+    /// rope's contents are used.
+    void append(std::string_view text);
+
+    /// Appends @a text to the rope by copying it into internal storage.
+    void appendCopy(std::string_view text);
+
+    /// @return the ordered list of pieces making up the rope's contents.
+    std::span<const std::string_view> getPieces() const { return pieceList; }
+
+    /// @return the total number of characters across all pieces.
+    size_t length() const { return totalLength; }
+
+    /// @return true if the rope contains no text.
+    bool empty() const { return totalLength == 0; }
+
+    /// @return the last character in the rope, or '\0' if it's empty.
+    char back() const { return totalLength ? pieceList.back().back() : '\0'; }
+
+    /// @return a string containing the concatenation of all pieces.
+    std::string str() const;
+
+private:
+    SmallVector<std::string_view> pieceList;
+    BumpAllocator alloc;
+    size_t totalLength = 0;
+};
+
 /// Provides support for printing tokens, trivia, or whole syntax trees
 /// back to source code.
 class SLANG_EXPORT SyntaxPrinter {
@@ -22,9 +62,10 @@ public:
     SyntaxPrinter() = default;
     explicit SyntaxPrinter(const SourceManager& sourceManager);
 
-    /// Append raw text to the buffer.
+    /// Append raw text to the buffer. The text is always copied, regardless
+    /// of the @a setZeroCopySources setting.
     /// @return a reference to this object, to allow chaining additional method calls.
-    SyntaxPrinter& append(std::string_view text);
+    SyntaxPrinter& append(std::string_view text) { return append(text, /* stable */ false); }
 
     /// Print the provided @a trivia to the internal buffer.
     /// @return a reference to this object, to allow chaining additional method calls.
@@ -91,8 +132,22 @@ public:
         return *this;
     }
 
+    /// Sets whether printed token and trivia text is referenced in place instead of
+    /// being copied into the printer. When enabled, the printed syntax (and any source
+    /// buffers backing it) must outlive use of the printer's output; in exchange,
+    /// unmodified regions of a file are recorded as single zero-copy pieces.
+    /// @return a reference to this object, to allow chaining additional method calls.
+    SyntaxPrinter& setZeroCopySources(bool enable) {
+        zeroCopySources = enable;
+        return *this;
+    }
+
+    /// @return the pieces accumulated in the internal rope, which can be written
+    /// out in order without materializing one large string.
+    std::span<const std::string_view> pieces() const { return buffer.getPieces(); }
+
     /// @return a copy of the internal text buffer.
-    std::string str() const { return buffer; }
+    std::string str() const { return buffer.str(); }
 
     /// A helper method that assists in printing an entire syntax tree back to source
     /// text. A SyntaxPrinter with useful defaults is constructed, the tree is printed,
@@ -100,7 +155,9 @@ public:
     static std::string printFile(const SyntaxTree& tree);
 
 private:
-    std::string buffer;
+    SyntaxPrinter& append(std::string_view text, bool stable);
+
+    SyntaxRope buffer;
     const SourceManager* sourceManager = nullptr;
     bool includeTrivia = true;
     bool includeMissing = false;
@@ -109,6 +166,7 @@ private:
     bool includePreprocessed = true;
     bool includeComments = true;
     bool squashNewlines = true;
+    bool zeroCopySources = false;
 };
 
 } // namespace slang::syntax
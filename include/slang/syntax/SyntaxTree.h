@@ -28,6 +28,12 @@ namespace slang::syntax {
 ///
 /// The SyntaxTree object owns all of the memory for the parse tree, so it must
 /// live for as long as you need to access its syntax nodes.
+///
+/// Once parsing completes a tree is immutable, with the sole exception of
+/// deferred module bodies (see ParserOptions::deferModuleBodies), which are
+/// parsed in place on first use. A tree with no remaining deferred bodies can
+/// be freely shared by any number of compilations, including concurrently
+/// from multiple threads.
 class SLANG_EXPORT SyntaxTree {
 public:
     using MacroList = std::span<const DefineDirectiveSyntax* const>;
@@ -126,6 +132,42 @@ public:
                                                    const Bag& options = {},
                                                    MacroList inheritedMacros = {});
 
+    /// Creates a syntax tree by reparsing an edited version of a previously
+    /// parsed compilation unit. Top-level members that end before the first
+    /// changed character are reused directly from @a oldTree, whose memory is
+    /// kept alive as the new tree's parent; only the rest of the buffer is
+    /// lexed, preprocessed, and parsed again, so the cost of an edit scales
+    /// with the distance from the edit to the end of the file rather than
+    /// with total file size.
+    ///
+    /// Reuse is conservative: if the unchanged leading text contains any
+    /// preprocessor directives (whose state would leak into the reparsed
+    /// region), or the old tree's root is not a compilation unit, the whole
+    /// buffer is reparsed. Diagnostics attached to reused members are copied
+    /// onto the returned tree, so it reports the same set a full reparse
+    /// would. Reused nodes are re-parented into the new tree, so the old tree
+    /// should be discarded (other than as the owner of reused memory)
+    /// afterward.
+    ///
+    /// @a oldTree is the previously parsed tree for this file.
+    /// @a newText is the full new contents of the file.
+    /// @a name is an optional name to give to the new source buffer; if empty,
+    /// the old buffer's name is reused.
+    /// @return the created and parsed syntax tree.
+    static std::shared_ptr<SyntaxTree> fromEdit(const std::shared_ptr<SyntaxTree>& oldTree,
+                                                std::string_view newText,
+                                                std::string_view name = ""sv);
+
+    /// Creates a syntax tree by reparsing an edited version of a previously
+    /// parsed compilation unit, where the new contents have already been
+    /// loaded into a source buffer (e.g. by re-reading the file from disk).
+    /// Behaves the same as the string_view overload otherwise.
+    /// @a oldTree is the previously parsed tree for this file.
+    /// @a newBuffer is a buffer holding the full new contents of the file.
+    /// @return the created and parsed syntax tree.
+    static std::shared_ptr<SyntaxTree> fromEdit(const std::shared_ptr<SyntaxTree>& oldTree,
+                                                const SourceBuffer& newBuffer);
+
     /// Gets any diagnostics generated while parsing.
     Diagnostics& diagnostics() { return diagnosticsBuffer; }
 
@@ -156,9 +198,36 @@ public:
     /// Gets various bits of metadata collected during parsing.
     const parsing::ParserMetadata& getMetadata() const { return *metadata; }
 
+    /// Indicates whether body parsing of the given declaration was deferred
+    /// (see ParserOptions::deferModuleBodies) and hasn't happened yet.
+    bool isModuleBodyDeferred(const ModuleDeclarationSyntax& syntax) const;
+
+    /// Parses the previously deferred body of the given declaration, filling
+    /// in its member list in place. Any diagnostics are appended to this
+    /// tree's diagnostics and metadata found in the body is merged into this
+    /// tree's metadata. Does nothing if the body is not deferred.
+    void expandDeferredBody(const ModuleDeclarationSyntax& syntax);
+
+    /// Indicates whether any declarations in this tree still have deferred,
+    /// unparsed bodies.
+    bool hasDeferredBodies() const;
+
+    /// Parses all previously deferred declaration bodies in this tree. Once
+    /// this returns the tree is fully immutable and can safely be shared by
+    /// multiple compilations across threads.
+    void expandAllDeferredBodies();
+
     /// Gets the list of macros that were defined at the end of the loaded source file.
     MacroList getDefinedMacros() const { return macros; }
 
+    /// Gets a fingerprint of the tree's parsed content, computed from the kind
+    /// and raw text of every token in the tree while excluding trivia. Two
+    /// versions of a file that differ only in comments or whitespace hash
+    /// identically, so incremental tools can use this to prove that a file's
+    /// semantic content is unchanged even when its text or timestamp is not.
+    /// The result is computed on first use and cached.
+    uint64_t getContentHash() const;
+
     /// This is a shared default source manager for cases where the user doesn't
     /// care about managing the lifetime of loaded source. Note that all of
     /// the source loaded by this thing will live in memory for the lifetime of
@@ -166,6 +235,8 @@ public:
     static SourceManager& getDefaultSourceManager();
 
 private:
+    friend class ParseSession;
+
     SyntaxTree(SyntaxNode* root, SourceManager& sourceManager, BumpAllocator&& alloc,
                Diagnostics&& diagnostics, parsing::ParserMetadata&& metadata,
                std::vector<const DefineDirectiveSyntax*>&& macros, Bag options);
@@ -183,6 +254,7 @@ private:
     std::unique_ptr<parsing::ParserMetadata> metadata;
     std::vector<const DefineDirectiveSyntax*> macros;
     std::shared_ptr<SyntaxTree> parentTree;
+    mutable std::optional<uint64_t> contentHash;
 };
 
 } // namespace slang::syntax
@@ -40,12 +40,15 @@ public:
     /// Will visit all child nodes by default.
     template<typename T>
     void visitDefault(T&& node) {
-        for (uint32_t i = 0; i < node.getChildCount(); i++) {
-            auto child = node.childNode(i);
-            if (child)
-                child->visit(*DERIVED);
+        size_t count = node.getChildCount();
+        for (size_t i = 0; i < count; i++) {
+            auto child = node.getChild(i);
+            if (child.isNode()) {
+                if (auto childNode = child.node())
+                    childNode->visit(*DERIVED);
+            }
             else {
-                auto token = node.childToken(i);
+                auto token = child.token();
                 if (token)
                     DERIVED->visitToken(token);
             }
@@ -113,6 +116,10 @@ public:
     /// The tree will be visited in order and each node will be given a chance to be
     /// rewritten (by providing visit() implementations in the derived class).
     ///
+    /// All requested changes are batched and applied in a single rebuild pass
+    /// that clones only the ancestors of changed nodes; unchanged subtrees are
+    /// shared with (and kept alive by) the original tree.
+    ///
     /// @return if no changes are requested, returns the original syntax tree.
     /// Otherwise, the changes are applied and the newly rewritten syntax tree is returned.
     std::shared_ptr<SyntaxTree> transform(const std::shared_ptr<SyntaxTree>& tree) {
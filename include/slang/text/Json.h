@@ -34,6 +34,12 @@ public:
     /// and indentation are added to make the output more human friendly.
     void setPrettyPrint(bool enabled) { pretty = enabled; }
 
+    /// Sets the structural nesting level at which this writer starts,
+    /// for rendering fragments that will later be spliced into another
+    /// writer's output with writePreformatted(). Only affects indentation
+    /// when pretty printing; call after setIndentSize if you change that.
+    void setStartingLevel(int level) { currentIndent = level * indentSize; }
+
     /// @return a view of the emitted JSON text so far.
     /// @note the returned view is not guaranteed to remain valid once
     /// additional writes are performed.
@@ -74,6 +80,12 @@ public:
     /// Writes an array or property boolean value ("true" or "false").
     void writeValue(bool value);
 
+    /// Writes a pre-rendered fragment of JSON verbatim as the next array
+    /// element or property value. The fragment must itself be valid JSON;
+    /// when pretty printing it should have been rendered at this writer's
+    /// current nesting level (see setStartingLevel).
+    void writePreformatted(std::string_view json);
+
 private:
     void endValue();
     size_t findLastComma() const;
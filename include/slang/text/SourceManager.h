@@ -7,7 +7,9 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <bit>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -18,6 +20,7 @@
 
 #include "slang/text/SourceLocation.h"
 #include "slang/util/Hash.h"
+#include "slang/util/OS.h"
 #include "slang/util/Util.h"
 
 namespace slang {
@@ -34,6 +37,7 @@ enum class DiagnosticSeverity;
 class SLANG_EXPORT SourceManager {
 public:
     SourceManager();
+    ~SourceManager();
     SourceManager(const SourceManager&) = delete;
     SourceManager& operator=(const SourceManager&) = delete;
 
@@ -143,11 +147,30 @@ public:
     /// Returns true if the given file path is already loaded and cached in the source manager.
     bool isCached(const std::filesystem::path& path) const;
 
+    /// Drops the cached content for the given file path so that the next read of
+    /// that path fetches fresh content from disk. Buffers already created from the
+    /// old content remain valid.
+    /// @returns true if the file was cached and its entry was dropped.
+    bool invalidateCachedFile(const std::filesystem::path& path);
+
     /// Sets whether filenames should be made "proximate" to the current directory
     /// for diagnostic reporting purposes. This is on by default but can be
     /// disabled to always use the simple filename.
     void setDisableProximatePaths(bool set) { disableProximatePaths = set; }
 
+    /// Sets whether source files should be memory mapped instead of copied
+    /// into owned buffers when read from disk. This is off by default. Files
+    /// that cannot be mapped (for example non-seekable inputs) silently fall
+    /// back to a copying read.
+    void setEnableMemoryMapping(bool set) { enableMemoryMapping = set; }
+
+    /// Sets whether canonicalized path results (both successes and failures)
+    /// are cached for the lifetime of this source manager. This is on by
+    /// default since include lookups probe the same directories over and over,
+    /// and path resolution can be expensive on networked filesystems. Disable
+    /// it if directory symlinks may change while the process is running.
+    void setDisablePathCaching(bool set) { disablePathCaching = set; }
+
     /// Adds a line directive at the given location.
     void addLineDirective(SourceLocation location, size_t lineNum, std::string_view name,
                           uint8_t level);
@@ -208,15 +231,25 @@ private:
     // Stores actual file contents and metadata; only one per loaded file
     struct FileData {
         const std::string name;                       // name of the file
-        const std::vector<char> mem;                  // file contents
-        std::vector<size_t> lineOffsets;              // cache of compute line offsets
+        const std::vector<char> mem;                  // file contents, if owned
+        const std::optional<MappedFile> mapping;      // file contents, if memory mapped
+        std::vector<size_t> lineOffsets;              // cache of computed line offsets
+        std::atomic<size_t> lineOffsetsScanned = 0;   // number of bytes indexed into lineOffsets
         const std::filesystem::path* const directory; // directory in which the file exists
         const std::filesystem::path fullPath;         // full path to the file
 
         FileData(const std::filesystem::path* directory, std::string name, std::vector<char>&& data,
-                 std::filesystem::path fullPath) :
+                 std::filesystem::path fullPath, std::optional<MappedFile>&& mapping = {}) :
             name(std::move(name)),
-            mem(std::move(data)), directory(directory), fullPath(std::move(fullPath)) {}
+            mem(std::move(data)), mapping(std::move(mapping)), directory(directory),
+            fullPath(std::move(fullPath)) {}
+
+        // Gets a view of the file contents, regardless of how they are stored.
+        std::string_view text() const {
+            if (mapping)
+                return mapping->view();
+            return std::string_view(mem.data(), mem.size());
+        }
     };
 
     // Stores a pointer to file data along with information about where we included it.
@@ -259,14 +292,32 @@ private:
             expansionRange(expansionRange), macroName(macroName) {}
     };
 
+    using BufferEntry = std::variant<FileInfo, ExpansionInfo>;
+
     mutable std::shared_mutex mut;
 
-    // index from BufferID to buffer metadata
-    std::vector<std::variant<FileInfo, ExpansionInfo>> bufferEntries;
+    // The index from BufferID to buffer metadata is append-only and built for
+    // lock-free reads: entries live in geometrically sized segments that are
+    // never moved or freed once published, so a BufferID can be resolved
+    // without taking a lock and pointers to entries stay stable as the table
+    // grows. Appends are serialized by bufferMutex and become visible to
+    // readers via the release store of bufferCount. Note that the mutable
+    // pieces inside an entry (the line directive list) are still guarded
+    // by the shared mutex above.
+    static constexpr size_t BufferSegmentBase = 6; // first segment holds 64 entries
+    static constexpr size_t BufferSegmentCount = 32 - BufferSegmentBase;
+
+    std::array<std::atomic<BufferEntry*>, BufferSegmentCount> bufferSegments = {};
+    std::atomic<size_t> bufferCount = 0;
+    std::mutex bufferMutex;
 
     // cache for file lookups; this holds on to the actual file data
     flat_hash_map<std::string, std::unique_ptr<FileData>> lookupCache;
 
+    // file data dropped via invalidateCachedFile; kept alive because
+    // previously created buffer entries still point into it
+    std::vector<std::unique_ptr<FileData>> retiredFiles;
+
     // directories for system and user includes
     std::vector<std::filesystem::path> systemDirectories;
     std::vector<std::filesystem::path> userDirectories;
@@ -274,26 +325,52 @@ private:
     // uniquified backing memory for directories
     std::set<std::filesystem::path> directories;
 
+    // cache of canonicalized paths, keyed by the original path string;
+    // an empty path records a canonicalization failure
+    mutable flat_hash_map<std::string, std::filesystem::path> canonicalPathCache;
+
+    // cache of fully expanded locations, keyed by expansion buffer id; only
+    // populated for non-argument expansions, where the result doesn't depend
+    // on the offset of the queried location
+    mutable flat_hash_map<uint32_t, SourceLocation> expandedLocCache;
+
     // map from buffer to diagnostic directive lists
     flat_hash_map<BufferID, std::vector<DiagnosticDirectiveInfo>> diagDirectives;
 
     std::atomic<uint32_t> unnamedBufferCount = 0;
     bool disableProximatePaths = false;
+    bool enableMemoryMapping = false;
+    bool disablePathCaching = false;
+
+    // Resolves a buffer id to its table entry without locking, or returns
+    // nullptr if the id hasn't been published yet.
+    const BufferEntry* getBufferEntry(BufferID buffer) const;
+    BufferEntry* getBufferEntry(BufferID buffer);
+
+    // Appends an entry to the buffer table and returns its index.
+    size_t appendBufferEntry(BufferEntry&& entry);
 
     FileInfo* getFileInfo(BufferID buffer);
     const FileInfo* getFileInfo(BufferID buffer) const;
-    SourceBuffer createBufferEntry(FileData* fd, SourceLocation includedFrom,
-                                   std::unique_lock<std::shared_mutex>& lock);
+    SourceBuffer createBufferEntry(FileData* fd, SourceLocation includedFrom);
+
+    // Canonicalizes the given path, consulting and filling the path cache.
+    // Returns std::nullopt if canonicalization failed.
+    std::optional<std::filesystem::path> canonicalize(const std::filesystem::path& path) const;
 
     SourceBuffer openCached(const std::filesystem::path& fullPath, SourceLocation includedFrom);
     SourceBuffer cacheBuffer(std::filesystem::path&& path, std::string&& pathStr,
-                             SourceLocation includedFrom, std::vector<char>&& buffer);
+                             SourceLocation includedFrom, std::vector<char>&& buffer,
+                             std::optional<MappedFile>&& mapping = std::nullopt);
 
     // Get raw line number of a file location, ignoring any line directives
     size_t getRawLineNumber(SourceLocation location) const;
 
-    static void computeLineOffsets(const std::vector<char>& buffer,
-                                   std::vector<size_t>& offsets) noexcept;
+    // Appends the offsets of line starts found in text within [start, stop) to the
+    // given vector. Returns the position scanned through, which can be one byte past
+    // @a stop when a two-character newline straddles it.
+    static size_t computeLineOffsets(std::string_view text, size_t start, size_t stop,
+                                     std::vector<size_t>& offsets) noexcept;
 };
 
 } // namespace slang
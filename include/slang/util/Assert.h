@@ -17,6 +17,18 @@
 #    endif
 #endif
 
+// Checks on per-element hot paths (container bounds checks, per-dereference
+// null checks) get their own tier so that a build can keep the cheap
+// structural ASSERTs while eliding the ones that fire millions of times per
+// compile. By default the tier follows ASSERT_ENABLED; the "fast" build
+// presets define ASSERT_ENABLED=1 and SLOW_ASSERT_ENABLED=0 to compile out
+// just this tier.
+#if !defined(SLOW_ASSERT_ENABLED)
+#    if defined(ASSERT_ENABLED) && ASSERT_ENABLED
+#        define SLOW_ASSERT_ENABLED 1
+#    endif
+#endif
+
 #if ASSERT_ENABLED
 #    if defined(__GNUC__) || defined(__clang__)
 #        define ASSERT_FUNCTION __PRETTY_FUNCTION__
@@ -53,6 +65,15 @@
 
 #endif
 
+#if SLOW_ASSERT_ENABLED
+#    define SLOW_ASSERT(cond) ASSERT(cond)
+#else
+#    define SLOW_ASSERT(cond)   \
+        do {                    \
+            (void)sizeof(cond); \
+        } while (false)
+#endif
+
 // Compiler-specific macros for warnings and suppressions
 #ifdef __clang__
 #    define NO_SANITIZE(warningName) __attribute__((no_sanitize(warningName)))
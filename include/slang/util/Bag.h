@@ -8,6 +8,7 @@
 #pragma once
 
 #include <any>
+#include <array>
 #include <typeindex>
 #include <typeinfo>
 
@@ -15,6 +16,37 @@
 
 namespace slang {
 
+namespace ast {
+struct CompilationOptions;
+}
+
+namespace parsing {
+struct LexerOptions;
+struct ParserOptions;
+struct PreprocessorOptions;
+}
+
+namespace detail {
+
+/// The option structs fetched on hot paths (every lexer, preprocessor, and
+/// parser construction) get fixed compile-time slots so that their lookups
+/// are direct array accesses instead of type-index hashing. All other types
+/// fall back to the generic type-keyed map.
+template<typename T>
+inline constexpr int BagSlotIndex = -1;
+template<>
+inline constexpr int BagSlotIndex<parsing::LexerOptions> = 0;
+template<>
+inline constexpr int BagSlotIndex<parsing::PreprocessorOptions> = 1;
+template<>
+inline constexpr int BagSlotIndex<parsing::ParserOptions> = 2;
+template<>
+inline constexpr int BagSlotIndex<ast::CompilationOptions> = 3;
+
+inline constexpr int NumBagSlots = 4;
+
+} // namespace detail
+
 /// Bag - A general container of arbitrary objects.
 ///
 /// The Bag container is a collection of various type-erased objects that can
@@ -34,24 +66,36 @@ public:
     /// (making a copy in the process).
     template<typename T>
     void set(const T& item) {
-        items[std::type_index(typeid(T))] = item;
+        if constexpr (detail::BagSlotIndex<T> >= 0)
+            slots[detail::BagSlotIndex<T>] = item;
+        else
+            items[std::type_index(typeid(T))] = item;
     }
 
     /// Adds or overwrites an existing element of type T in the bag
     /// (moving in the new item in the process).
     template<typename T>
     void set(T&& item) {
-        items[std::type_index(typeid(T))] = std::forward<T>(item);
+        using U = std::remove_cvref_t<T>;
+        if constexpr (detail::BagSlotIndex<U> >= 0)
+            slots[detail::BagSlotIndex<U>] = std::forward<T>(item);
+        else
+            items[std::type_index(typeid(U))] = std::forward<T>(item);
     }
 
     /// Gets an element of type T from the bag, if it exists.
     /// Otherwise returns nullptr.
     template<typename T>
     const T* get() const {
-        auto it = items.find(std::type_index(typeid(T)));
-        if (it == items.end())
-            return nullptr;
-        return std::any_cast<T>(&it->second);
+        if constexpr (detail::BagSlotIndex<T> >= 0) {
+            return std::any_cast<T>(&slots[detail::BagSlotIndex<T>]);
+        }
+        else {
+            auto it = items.find(std::type_index(typeid(T)));
+            if (it == items.end())
+                return nullptr;
+            return std::any_cast<T>(&it->second);
+        }
     }
 
     /// Gets an element of type T from the bag, if it exists.
@@ -65,6 +109,7 @@ public:
     }
 
 private:
+    std::array<std::any, detail::NumBagSlots> slots;
     flat_hash_map<std::type_index, std::any> items;
 };
 
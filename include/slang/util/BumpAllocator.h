@@ -18,6 +18,13 @@ namespace slang {
 /// Allocates items sequentially in memory, with underlying memory allocated in
 /// blocks as needed. Individual items cannot be deallocated; the entire thing
 /// must be destroyed to release the memory.
+///
+/// The allocator is deliberately not thread safe; adding synchronization to the
+/// bump pointer would slow down the single-threaded hot path for everyone. The
+/// supported pattern for concurrent work is to give each worker thread its own
+/// allocator and merge the results into the long-lived owner afterward via
+/// steal() -- this is how parallel parsing builds syntax trees that later feed
+/// a single Compilation.
 class SLANG_EXPORT BumpAllocator {
 public:
     BumpAllocator();
@@ -49,21 +56,67 @@ public:
         return base;
     }
 
+    /// Attempts to resize the most recent allocation in place, either to extend
+    /// it or to return unused space at its end to the allocator. This only
+    /// succeeds if @a ptr plus @a oldSize is exactly the current bump pointer
+    /// and, when growing, the current segment has room for @a newSize bytes.
+    /// @return true if the allocation was resized, and false if nothing changed.
+    bool resizeLast(byte* ptr, size_t oldSize, size_t newSize) {
+        byte* next = ptr + newSize;
+        if (ptr + oldSize != head->current || next > endPtr)
+            return false;
+
+        head->current = next;
+        return true;
+    }
+
     /// Steals ownership of all of the memory contents of the given allocator.
     /// The other allocator will be in a moved-from state after the call.
     void steal(BumpAllocator&& other);
 
+    /// Statistics about the memory held by an allocator; see @a getStats.
+    struct MemoryStats {
+        /// The number of segments requested from the system.
+        size_t segmentCount = 0;
+
+        /// The total bytes requested from the system, including segment headers.
+        size_t allocatedBytes = 0;
+
+        /// The bytes handed out to callers; the difference from @a allocatedBytes
+        /// is segment header overhead and unused tail space in each segment.
+        size_t usedBytes = 0;
+
+        MemoryStats& operator+=(const MemoryStats& rhs) {
+            segmentCount += rhs.segmentCount;
+            allocatedBytes += rhs.allocatedBytes;
+            usedBytes += rhs.usedBytes;
+            return *this;
+        }
+    };
+
+    /// Computes statistics for the memory currently held by this allocator,
+    /// by walking all of its segments.
+    MemoryStats getStats() const;
+
 protected:
     // Allocations are tracked as a linked list of segments.
     struct Segment {
         Segment* prev;
         byte* current;
+        size_t size;
+        bool fromArena;
     };
 
     Segment* head;
     byte* endPtr;
 
-    enum { INITIAL_SIZE = 512, SEGMENT_SIZE = 4096 };
+    // Segment sizes double as the allocator grows, from SEGMENT_SIZE up to
+    // MAX_SEGMENT_SIZE; segments that large are backed directly by OS arena
+    // memory (with transparent huge pages where available) instead of the
+    // global allocator, which matters for TLB behavior on huge compilations.
+    size_t nextSegmentSize = SEGMENT_SIZE;
+
+    enum : size_t { INITIAL_SIZE = 512, SEGMENT_SIZE = 4096, MAX_SEGMENT_SIZE = 1 << 21 };
 
     // Slow path handling of allocation.
     byte* allocateSlow(size_t size, size_t alignment);
@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+//! @file Cancellation.h
+//! @brief Cooperative cancellation of long-running operations
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <stdexcept>
+
+#include "slang/slang_export.h"
+
+namespace slang {
+
+/// An exception thrown when an operation observes that its cancellation
+/// token has been signaled.
+class SLANG_EXPORT CancellationException : public std::runtime_error {
+public:
+    CancellationException() : std::runtime_error("operation was cancelled") {}
+};
+
+/// A lightweight token for cooperatively cancelling long-running operations
+/// (parsing, elaboration, constant evaluation) from another thread.
+///
+/// The token observes a caller-owned flag; the caller sets the flag and the
+/// operation checks the token at phase boundaries and loop backedges,
+/// unwinding via CancellationException in bounded time without tearing down
+/// the process. A default constructed token can never be cancelled and
+/// checking it compiles down to a null pointer test.
+class CancellationToken {
+public:
+    CancellationToken() = default;
+    CancellationToken(const std::atomic<bool>& flag) : flag(&flag) {}
+
+    /// @return true if cancellation has been requested.
+    bool isCancelled() const { return flag && flag->load(std::memory_order_relaxed); }
+
+    /// Throws CancellationException if cancellation has been requested.
+    void throwIfCancelled() const {
+        if (isCancelled())
+            throw CancellationException();
+    }
+
+private:
+    const std::atomic<bool>* flag = nullptr;
+};
+
+} // namespace slang
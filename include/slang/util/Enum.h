@@ -20,7 +20,9 @@
 #define ENUM_SIZED(name, underlying, elements)                                                  \
     enum class SLANG_EXPORT name : underlying { elements(UTIL_ENUM_ELEMENT) };                  \
     inline std::string_view toString(name e) {                                                  \
-        static const char* strings[] = {elements(UTIL_ENUM_STRING)};                            \
+        /* constexpr string_views get their lengths at compile time, so */                      \
+        /* callers copy fixed spans instead of re-measuring C strings.  */                      \
+        static constexpr std::string_view strings[] = {elements(UTIL_ENUM_STRING)};             \
         return strings[static_cast<std::underlying_type_t<name>>(e)];                           \
     }                                                                                           \
     inline std::ostream& operator<<(std::ostream& os, name e) {                                 \
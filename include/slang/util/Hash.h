@@ -9,11 +9,16 @@
 
 #include <ankerl/unordered_dense.h>
 #include <flat_hash_map.hpp>
+#include <string>
+#include <string_view>
 
 #include "slang/util/Util.h"
 
 namespace slang {
 
+template<typename T>
+struct Hasher;
+
 inline void hash_combine(size_t&) {
 }
 
@@ -22,7 +27,7 @@ inline void hash_combine(size_t&) {
 /// previous hash value in @a seed.
 template<typename T, typename... Rest>
 inline void hash_combine(size_t& seed, const T& v, Rest... rest) {
-    std::hash<T> hasher;
+    Hasher<T> hasher;
     seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
     hash_combine(seed, rest...);
 }
@@ -54,6 +59,23 @@ struct Hasher {
     size_t operator()(const T& t) const { return std::hash<T>()(t); }
 };
 
+// Strings get hashed with wyhash, which reads short keys with one or two
+// wide loads. Name lookup tables hash the same short identifiers over and
+// over, so this is measurably better than the generic byte-wise std::hash.
+template<>
+struct Hasher<std::string_view> {
+    size_t operator()(std::string_view str) const {
+        return (size_t)ankerl::unordered_dense::detail::wyhash::hash(str.data(), str.size());
+    }
+};
+
+template<>
+struct Hasher<std::string> {
+    size_t operator()(const std::string& str) const {
+        return (size_t)ankerl::unordered_dense::detail::wyhash::hash(str.data(), str.size());
+    }
+};
+
 template<typename... TT>
 struct Hasher<std::tuple<TT...>> {
     size_t operator()(const std::tuple<TT...>& tt) const {
@@ -522,6 +522,20 @@ public:
         insert(key.first, key.second, value, alloc);
     }
 
+    /// @brief Builds the map in one shot from a pre-sorted list of intervals
+    /// and their associated values.
+    ///
+    /// The map must be empty, the two lists must be the same length, and the
+    /// intervals must be sorted by their left endpoints. Nodes are packed
+    /// bottom-up with no rebalancing, which is much faster than repeated
+    /// insertion when the full set of intervals is known up front. Callers
+    /// that need overlapping input intervals merged as they arrive should
+    /// use @a unionWith instead, which coalesces online.
+    ///
+    /// Complexity is O(n).
+    void build(std::span<const std::pair<TKey, TKey>> intervals, std::span<const TValue> values,
+               allocator_type& alloc);
+
     /// @brief Inserts a new interval and value pair into the map, combining it
     /// with any intervals that already exist in the map that are adjacent to or
     /// overlap with the new one.
@@ -934,6 +948,82 @@ void IntervalMap<TKey, TValue>::clear(allocator_type& alloc) {
     rootSize = 0;
 }
 
+template<typename TKey, typename TValue>
+void IntervalMap<TKey, TValue>::build(std::span<const std::pair<TKey, TKey>> intervals,
+                                      std::span<const TValue> values, allocator_type& alloc) {
+    using namespace IntervalMapDetails;
+
+    ASSERT(empty() && isFlat());
+    ASSERT(intervals.size() == values.size());
+
+    uint32_t count = uint32_t(intervals.size());
+    if (count <= Leaf::Capacity) {
+        for (uint32_t i = 0; i < count; i++) {
+            ASSERT(intervals[i].first <= intervals[i].second);
+            ASSERT(i == 0 || !(intervals[i].first < intervals[i - 1].first));
+            rootLeaf.keyAt(i) = {intervals[i].first, intervals[i].second};
+            rootLeaf.valueAt(i) = values[i];
+        }
+        rootSize = count;
+        return;
+    }
+
+    // Pack the elements into leaf nodes, distributing them as evenly as
+    // possible so that every node ends up at least half full.
+    SmallVector<NodeRef> refs, nextRefs;
+    SmallVector<interval<TKey>> bounds, nextBounds;
+
+    uint32_t numNodes = (count + Leaf::Capacity - 1) / Leaf::Capacity;
+    uint32_t pos = 0;
+    for (uint32_t i = 0; i < numNodes; i++) {
+        uint32_t size = count / numNodes + (i < count % numNodes ? 1 : 0);
+        auto leaf = alloc.template emplace<Leaf>();
+        for (uint32_t j = 0; j < size; j++, pos++) {
+            ASSERT(intervals[pos].first <= intervals[pos].second);
+            ASSERT(pos == 0 || !(intervals[pos].first < intervals[pos - 1].first));
+            leaf->keyAt(j) = {intervals[pos].first, intervals[pos].second};
+            leaf->valueAt(j) = values[pos];
+        }
+
+        refs.push_back(NodeRef(leaf, size));
+        bounds.push_back(leaf->getBounds(size));
+    }
+
+    // Build branch levels bottom-up until the remaining nodes fit in the root.
+    height = 1;
+    while (refs.size() > Branch::Capacity) {
+        count = uint32_t(refs.size());
+        numNodes = (count + Branch::Capacity - 1) / Branch::Capacity;
+        pos = 0;
+        for (uint32_t i = 0; i < numNodes; i++) {
+            uint32_t size = count / numNodes + (i < count % numNodes ? 1 : 0);
+            auto branch = alloc.template emplace<Branch>();
+            for (uint32_t j = 0; j < size; j++, pos++) {
+                branch->childAt(j) = refs[pos];
+                branch->keyAt(j) = bounds[pos];
+            }
+
+            nextRefs.push_back(NodeRef(branch, size));
+            nextBounds.push_back(branch->getBounds(size));
+        }
+
+        refs.swap(nextRefs);
+        bounds.swap(nextBounds);
+        nextRefs.clear();
+        nextBounds.clear();
+        height++;
+    }
+
+    // Fill in the root branch with whatever nodes remain.
+    rootLeaf.~Leaf();
+    new (&rootBranch) Branch();
+    rootSize = uint32_t(refs.size());
+    for (uint32_t i = 0; i < rootSize; i++) {
+        rootBranch.childAt(i) = refs[i];
+        rootBranch.keyAt(i) = bounds[i];
+    }
+}
+
 template<typename TKey, typename TValue>
 template<typename TNode, bool SwitchToBranch>
 IntervalMapDetails::IndexPair IntervalMap<TKey, TValue>::modifyRoot(TNode& rootNode,
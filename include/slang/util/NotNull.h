@@ -35,7 +35,7 @@ public:
     not_null& operator=(const not_null& other) = default;
 
     constexpr T get() const {
-        ASSERT(ptr);
+        SLOW_ASSERT(ptr);
         return ptr;
     }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <filesystem>
+#include <optional>
 #include <vector>
 
 #include "slang/util/ScopeGuard.h"
@@ -21,6 +22,36 @@ class text_style;
 
 namespace slang {
 
+/// A read-only view of a file that has been mapped into the process's
+/// address space. The mapping is released when this object is destroyed.
+class SLANG_EXPORT MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Tries to map the file at @a path into memory. Returns std::nullopt if the
+    /// mapping could not be created, for example because the file is empty,
+    /// not seekable, or its size precludes a guaranteed null terminator.
+    static std::optional<MappedFile> open(const std::filesystem::path& path);
+
+    /// @return a view of the mapped file contents. Like OS::readFile, the view
+    /// includes a null terminator one past the end of the actual file data.
+    std::string_view view() const { return std::string_view((const char*)ptr, len); }
+
+private:
+    MappedFile(void* ptr, size_t len, void* osHandle) : ptr(ptr), len(len), osHandle(osHandle) {}
+    void detach();
+
+    void* ptr = nullptr;
+    size_t len = 0;
+    void* osHandle = nullptr;
+};
+
 /// A collection of various OS-specific utility functions.
 class SLANG_EXPORT OS {
 public:
@@ -44,6 +75,13 @@ public:
     /// Note that the buffer will be null-terminated.
     static bool readFile(const std::filesystem::path& path, std::vector<char>& buffer);
 
+    /// Brings the given range of readable memory into residency, advising the
+    /// OS ahead of time where supported and then touching one byte per page.
+    /// Useful for warming memory mapped files on a background thread so that
+    /// first-touch faults don't land on the thread doing real work. Blocks
+    /// until the range is resident.
+    static void prefetchMemory(const void* ptr, size_t length);
+
     /// Prints text to stdout.
     static void print(std::string_view text);
 
@@ -56,8 +94,41 @@ public:
     /// Prints colored formatted text to stderr.
     static void printE(const fmt::text_style& style, std::string_view text);
 
+    /// Enables or disables buffered output mode. While enabled, the print()
+    /// functions accumulate text -- including any color escape sequences --
+    /// into in-memory buffers that are written out in large chunks: when a
+    /// buffer fills, when flushOutput() is called, or when buffering is
+    /// disabled again. This batches what would otherwise be one write (and
+    /// one color state round trip) per print call, which matters when
+    /// emitting a large diagnostic set or statistics dump through a pipe.
+    /// Note that while buffering is active the relative ordering of stdout
+    /// and stderr as seen by a consumer is not guaranteed.
+    static void setBufferedOutputEnabled(bool enabled);
+
+    /// Writes out and flushes any output accumulated in buffered mode.
+    static void flushOutput();
+
     static std::string getEnv(const std::string& name);
 
+    /// Gets the current resident set size of the process, in bytes.
+    /// Returns zero if the value could not be determined on this platform.
+    static uint64_t getCurrentRSS();
+
+    /// Gets the peak resident set size the process has reached, in bytes.
+    /// Returns zero if the value could not be determined on this platform.
+    static uint64_t getPeakRSS();
+
+    /// Allocates @a size bytes of arena backing memory directly from the OS,
+    /// requesting transparent huge page backing where the platform supports
+    /// it. Intended for large, long-lived allocator segments; memory placement
+    /// follows the first-touch policy, so pages land on the NUMA node of the
+    /// thread that allocates and fills them. Returns nullptr on failure.
+    /// Must be released with @a freeArenaMemory using the same size.
+    static void* allocateArenaMemory(size_t size);
+
+    /// Releases memory obtained from @a allocateArenaMemory.
+    static void freeArenaMemory(void* ptr, size_t size);
+
     static auto captureOutput() {
         capturedStdout.clear();
         capturedStderr.clear();
@@ -7,7 +7,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
-#include <deque>
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 namespace slang {
@@ -18,10 +19,14 @@ namespace slang {
 ///
 /// Indices are never invalidated until they are removed from the index, at
 /// which point they are placed on a freelist and potentially reused.
+/// Freed slots hold a default-constructed element, so reading through a
+/// stale index yields the empty value rather than undefined behavior.
 ///
 /// The index uses a vector internally for managing storage and therefore
 /// has the same performance characteristics when adding new elements and
-/// there are no open slots in the freelist.
+/// there are no open slots in the freelist. Free slots are recycled in
+/// LIFO order, which tends to hand back recently touched storage. Handles
+/// are 32 bits wide; the container holds at most 2^32 - 1 elements.
 ///
 /// Note that index zero is always reserved as an invalid sentinel value.
 /// The Index type must be explicitly convertible to and from size_t.
@@ -41,9 +46,9 @@ public:
     /// Add a new item to the vector by copying and return an Index to its location.
     Index add(const T& item) {
         if (!freelist.empty()) {
-            Index i = freelist.front();
+            Index i = static_cast<Index>(freelist.back());
             storage[static_cast<size_t>(i)] = item;
-            freelist.pop_front();
+            freelist.pop_back();
             return i;
         }
         storage.push_back(item);
@@ -53,9 +58,9 @@ public:
     /// Add a new item to the vector by moving and return an Index to its location.
     Index add(T&& item) {
         if (!freelist.empty()) {
-            Index i = freelist.front();
+            Index i = static_cast<Index>(freelist.back());
             storage[static_cast<size_t>(i)] = std::move(item);
-            freelist.pop_front();
+            freelist.pop_back();
             return i;
         }
         storage.push_back(std::move(item));
@@ -66,9 +71,9 @@ public:
     template<typename... Args>
     Index emplace(Args&&... args) {
         if (!freelist.empty()) {
-            Index i = freelist.front();
+            Index i = static_cast<Index>(freelist.back());
             storage[static_cast<size_t>(i)] = T(std::forward<Args>(args)...);
-            freelist.pop_front();
+            freelist.pop_back();
             return i;
         }
         storage.emplace_back(std::forward<Args>(args)...);
@@ -79,7 +84,7 @@ public:
     /// removed index is added to a free list instead of moving other elements around.
     void remove(Index index) {
         storage[static_cast<size_t>(index)] = T();
-        freelist.push_back(index);
+        freelist.push_back(static_cast<uint32_t>(index));
     }
 
     /// Removes all items from the vector.
@@ -89,6 +94,39 @@ public:
         storage.emplace_back();
     }
 
+    /// Compacts storage so that live elements become contiguous again,
+    /// releasing the freelist and the tail slots it pinned. Elements keep
+    /// their relative order but any element past a freed slot gets a new,
+    /// smaller index; @a onMoved is invoked as onMoved(oldIndex, newIndex)
+    /// for each one so that callers can patch the indices they hold.
+    /// Outstanding indices of freed slots must not be used afterwards.
+    template<typename TCallback>
+    void compact(TCallback&& onMoved) {
+        if (freelist.empty())
+            return;
+
+        std::ranges::sort(freelist);
+
+        size_t out = 1;
+        size_t nextFree = 0;
+        for (size_t i = 1; i < storage.size(); i++) {
+            if (nextFree < freelist.size() && freelist[nextFree] == i) {
+                nextFree++;
+                continue;
+            }
+
+            if (out != i) {
+                storage[out] = std::move(storage[i]);
+                onMoved(static_cast<Index>(i), static_cast<Index>(out));
+            }
+            out++;
+        }
+
+        storage.resize(out);
+        freelist.clear();
+        freelist.shrink_to_fit();
+    }
+
     /// @return the number of elements in the vector.
     [[nodiscard]] size_t size() const { return storage.size() - freelist.size() - 1; }
 
@@ -101,7 +139,7 @@ public:
 
 private:
     std::vector<T> storage;
-    std::deque<Index> freelist;
+    std::vector<uint32_t> freelist;
 };
 
 } // namespace slang
@@ -23,6 +23,7 @@ namespace detail {
 [[noreturn]] SLANG_EXPORT void throwOutOfRange();
 [[noreturn]] SLANG_EXPORT void throwLengthError();
 SLANG_EXPORT void* allocArray(size_t capacity, size_t typeSize);
+SLANG_EXPORT void* reallocArray(void* ptr, size_t capacity, size_t typeSize);
 
 } // namespace detail
 
@@ -79,25 +80,25 @@ public:
 
     /// @return a reference to the first element in the array. The array must not be empty!
     [[nodiscard]] constexpr const_reference front() const {
-        ASSERT(len);
+        SLOW_ASSERT(len);
         return data_[0];
     }
 
     /// @return a reference to the last element in the array. The array must not be empty!
     [[nodiscard]] constexpr const_reference back() const {
-        ASSERT(len);
+        SLOW_ASSERT(len);
         return data_[len - 1];
     }
 
     /// @return a reference to the first element in the array. The array must not be empty!
     [[nodiscard]] constexpr reference front() {
-        ASSERT(len);
+        SLOW_ASSERT(len);
         return data_[0];
     }
 
     /// @return a reference to the last element in the array. The array must not be empty!
     [[nodiscard]] constexpr reference back() {
-        ASSERT(len);
+        SLOW_ASSERT(len);
         return data_[len - 1];
     }
 
@@ -150,7 +151,7 @@ public:
 
     /// Removes the last element from the array. The array must not be empty!
     void pop_back() {
-        ASSERT(len);
+        SLOW_ASSERT(len);
         len--;
         std::destroy_at(data_ + len);
     }
@@ -403,15 +404,41 @@ public:
         return std::span<ConstElem>(copied.data(), copied.size());
     }
 
+    /// Moves the contents of the array into memory owned by the given allocator
+    /// and resets the array to empty.
+    ///
+    /// If the array was constructed over that same allocator (see the SmallVector
+    /// arena constructor) and has spilled its elements onto it, the buffer is
+    /// handed off directly without copying and any unused capacity at its end is
+    /// returned to the allocator when possible. Otherwise this is equivalent
+    /// to copy().
+    [[nodiscard]] std::span<T> finalize(BumpAllocator& alloc) {
+        if (!isSmall() && arena == &alloc) {
+            auto result = std::span<T>(data_, len);
+            alloc.resizeLast(reinterpret_cast<byte*>(data_), cap * sizeof(T), len * sizeof(T));
+
+            // The base class only knows about the single guaranteed stack
+            // element; growing past it again will just reallocate.
+            data_ = reinterpret_cast<pointer>(&firstElement[0]);
+            len = 0;
+            cap = 1;
+            return result;
+        }
+
+        auto result = copy(alloc);
+        clear();
+        return result;
+    }
+
     /// @return the element at the given position in the array.
     constexpr reference operator[](size_type index) {
-        ASSERT(index < len);
+        SLOW_ASSERT(index < len);
         return data_[index];
     }
 
     /// @return the element at the given position in the array.
     constexpr const_reference operator[](size_type index) const {
-        ASSERT(index < len);
+        SLOW_ASSERT(index < len);
         return data_[index];
     }
 
@@ -439,6 +466,8 @@ protected:
     // This way we don't need a virtual destructor, or vtable at all.
     SmallVectorBase() noexcept = default;
     explicit SmallVectorBase(size_type capacity) noexcept : cap(capacity) {}
+    SmallVectorBase(size_type capacity, BumpAllocator& arena) noexcept :
+        cap(capacity), arena(&arena) {}
     ~SmallVectorBase() { cleanup(); }
 
     SmallVectorBase& operator=(const SmallVectorBase& rhs);
@@ -452,6 +481,11 @@ private:
     size_type len = 0;
     size_type cap = 0;
 
+    // When set, spilled buffers are allocated from this arena instead of the
+    // heap; it describes the provenance of data_ so cleanup() knows not to
+    // free it. See the SmallVector arena constructor.
+    BumpAllocator* arena = nullptr;
+
 #ifdef _MSC_VER
 #    pragma warning(push)
 #    pragma warning(disable : 4324) // structure was padded due to alignment specifier
@@ -470,10 +504,16 @@ private:
 
     void cleanup() {
         std::destroy(begin(), end());
-        if (!isSmall())
+        if (!isSmall() && !arena)
             free(data_);
     }
 
+    pointer allocateNew(size_type capacity) {
+        if (arena)
+            return reinterpret_cast<pointer>(arena->allocate(capacity * sizeof(T), alignof(T)));
+        return (pointer)detail::allocArray(capacity, sizeof(T));
+    }
+
     template<typename... Args>
     pointer emplaceRealloc(const pointer pos, Args&&... args);
 
@@ -505,7 +545,28 @@ private:
     }
 
     void reallocateTo(size_type newCapacity) {
-        auto newData = (pointer)detail::allocArray(newCapacity, sizeof(T));
+        if (!isSmall()) {
+            // An arena-backed buffer that is still the most recent arena
+            // allocation can be grown in place without moving any elements.
+            // If it's not, the old buffer is abandoned to the arena.
+            if (arena) {
+                if (arena->resizeLast(reinterpret_cast<byte*>(data_), cap * sizeof(T),
+                                      newCapacity * sizeof(T))) {
+                    cap = newCapacity;
+                    return;
+                }
+            }
+            else if constexpr (std::is_trivially_copyable_v<T>) {
+                // Trivially copyable elements already on the heap can be grown
+                // in place with realloc, which lets the system allocator extend
+                // the block and avoid a copy when there's room.
+                data_ = (pointer)detail::reallocArray(data_, newCapacity, sizeof(T));
+                cap = newCapacity;
+                return;
+            }
+        }
+
+        auto newData = allocateNew(newCapacity);
         std::uninitialized_move(begin(), end(), newData);
 
         cleanup();
@@ -533,7 +594,7 @@ constexpr size_t calculateDefaultSmallVectorElems() {
     // As a default, try to fit the vector into one cache line.
     // Assume 64 is a reasonable approximation of modern cache line sizes.
     size_t preferredSize = 64;
-    size_t availableSize = preferredSize - sizeof(T*) - 2 * sizeof(size_t);
+    size_t availableSize = preferredSize - sizeof(T*) - sizeof(BumpAllocator*) - 2 * sizeof(size_t);
     size_t numElems = availableSize / sizeof(T);
     return numElems < 2 ? 2 : numElems;
 }
@@ -560,6 +621,14 @@ public:
     /// Default constructs the SmallVector.
     SmallVector() noexcept : Base(N) {}
 
+    /// Constructs the SmallVector to allocate spilled elements from the given
+    /// arena instead of the heap. Together with finalize() this lets a list be
+    /// built directly over memory that will outlive the vector, eliminating the
+    /// copy that copy() would otherwise make. Buffers that can't be grown in
+    /// place are abandoned to the arena, so reserve() up front when the final
+    /// size is predictable.
+    explicit SmallVector(BumpAllocator& arena) noexcept : Base(N, arena) {}
+
     /// Constructs the SmallVector with the given capacity. If that capacity is less than
     /// the preallocated stack size `N` it will be ignored. Otherwise it will perform a heap
     /// allocation right away. Unlike std::vector this does not add any elements to the container.
@@ -592,6 +661,7 @@ public:
             this->data_ = std::exchange(other.data_, nullptr);
             this->len = std::exchange(other.len, 0);
             this->cap = std::exchange(other.cap, 0);
+            this->arena = other.arena;
         }
     }
 
@@ -677,8 +747,9 @@ void SmallVectorBase<T>::swap(SmallVectorBase<T>& rhs) {
     if (this == &rhs)
         return;
 
-    // We can only do a true swap if neither vector is small.
-    if (!isSmall() && !rhs.isSmall()) {
+    // We can only do a true swap if neither vector is small and their
+    // buffers have the same provenance.
+    if (!isSmall() && !rhs.isSmall() && arena == rhs.arena) {
         std::swap(data_, rhs.data_);
         std::swap(len, rhs.len);
         std::swap(cap, rhs.cap);
@@ -753,11 +824,14 @@ SmallVectorBase<T>& SmallVectorBase<T>::operator=(SmallVectorBase<T>&& rhs) {
         return *this;
 
     // If the rhs isn't small, clear this vector and then steal its buffer.
+    // The arena pointer travels with the buffer so that cleanup of the
+    // stolen memory remains correct.
     if (!rhs.isSmall()) {
         cleanup();
         this->data_ = std::exchange(rhs.data_, nullptr);
         this->len = std::exchange(rhs.len, 0);
         this->cap = std::exchange(rhs.cap, 0);
+        this->arena = rhs.arena;
         return *this;
     }
 
@@ -803,7 +877,7 @@ typename SmallVectorBase<T>::pointer SmallVectorBase<T>::emplaceRealloc(const po
 
     auto newCap = calculateGrowth(len + 1);
     auto offset = static_cast<size_type>(pos - begin());
-    auto newData = (pointer)detail::allocArray(newCap, sizeof(T));
+    auto newData = allocateNew(newCap);
 
     // First construct the new element in the new memory,
     // so that we don't corrupt the new element if it relied on
@@ -835,7 +909,7 @@ void SmallVectorBase<T>::resizeRealloc(size_type newSize, const TVal& val) {
         detail::throwLengthError();
 
     auto newCap = calculateGrowth(newSize);
-    auto newData = (pointer)detail::allocArray(newCap, sizeof(T));
+    auto newData = allocateNew(newCap);
 
     std::uninitialized_move(begin(), end(), newData);
 
@@ -80,7 +80,8 @@ inline bool operator!=(const StackAllocator<T, N>& x, const StackAllocator<U, M>
 
 /// A hash map container that allocates room for its first `N` elements on the stack.
 /// Prefer this over a normal hash map for temporary stack variables and small maps
-/// where heap allocations can be avoided.
+/// where heap allocations can be avoided. This uses the same open-addressing
+/// flat table as flat_hash_map, just with its initial storage placed inline.
 template<typename K, typename V, size_t N,
          typename Entry = ska::detailv3::sherwood_v3_entry<std::pair<K, V>>,
          typename Alloc = StackAllocator<Entry, N>>
@@ -7,63 +7,161 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <vector>
 
+#include "slang/util/BumpAllocator.h"
 #include "slang/util/Util.h"
 
 namespace slang {
 
 /// This class is a lookup table from string to value. It's optimized for
 /// a known fixed set of keywords.
+///
+/// Since the full key set is provided up front, construction searches for
+/// a perfect hash over that set (hash-and-displace: a per-bucket displacement
+/// table redirects every key to its own slot). Lookups therefore never probe:
+/// each one is a hash, two dependent loads, and a single key compare.
 template<typename T>
 class StringTable {
 public:
     /// Constructs the string table with all possible entries (key / values) already provided.
     /// No other entries can be added after construction.
     StringTable(std::initializer_list<std::pair<std::string_view, T>> entries) {
-        // Give ourselves a bunch of room for entries to hash by using double
-        // the required number of entries. Also round up to power of two so that
-        // we can use bitwise AND instead of mod for wraparound.
-        capacity = (uint32_t)entries.size() * 2;
-        capacity = roundUpToPow2(capacity);
-        table = std::make_unique<Entry[]>(capacity);
+        // Round the slot count up to a power of two so that we can use
+        // bitwise AND instead of mod for index reduction. Double the entry
+        // count gives the displacement search plenty of free slots.
+        uint32_t count = std::max((uint32_t)entries.size(), 1u);
+        indexMask = roundUpToPow2(count * 2) - 1;
+        bucketMask = roundUpToPow2(count) - 1;
+        table = std::make_unique<Entry[]>(indexMask + 1);
+        displacements = std::make_unique<uint32_t[]>(bucketMask + 1);
 
-        for (auto& entry : entries) {
-            size_t hc = std::hash<std::string_view>()(entry.first);
-            uint32_t index = hc & (capacity - 1);
-            while (table[index].hashCode != 0)
-                index = (index + 1) & (capacity - 1);
-
-            table[index].key = entry.first;
-            table[index].value = entry.second;
-            table[index].hashCode = hc;
-        }
+        // The displacement search can fail if the hash function happens to
+        // collide badly for this key set; bump the seed and retry until we
+        // find an arrangement that works (almost always the first one).
+        while (!tryBuild(entries))
+            seed++;
     }
 
     /// Looks for an entry with the given @a key and sets @a value if found.
     /// @return true if the element is found, and false otherwise.
     bool lookup(std::string_view key, T& value) const {
-        size_t hc = std::hash<std::string_view>()(key);
-        uint32_t index = hc & (capacity - 1);
-        do {
-            if (table[index].hashCode == hc && table[index].key == key) {
-                value = table[index].value;
-                return true;
-            }
-            index = (index + 1) & (capacity - 1);
-        } while (table[index].hashCode != 0);
-
+        uint64_t hc = hashKey(key, seed);
+        uint32_t disp = displacements[uint32_t(hc >> 32) & bucketMask];
+        auto& entry = table[(uint32_t(hc) + disp) & indexMask];
+        if (entry.occupied && entry.key == key) {
+            value = entry.value;
+            return true;
+        }
         return false;
     }
 
 private:
     struct Entry {
         std::string_view key;
-        size_t hashCode = 0;
-        T value;
+        T value = T();
+        bool occupied = false;
     };
     std::unique_ptr<Entry[]> table;
-    uint32_t capacity;
+    std::unique_ptr<uint32_t[]> displacements;
+    uint32_t indexMask;
+    uint32_t bucketMask;
+    uint64_t seed = 1;
+
+    bool tryBuild(std::initializer_list<std::pair<std::string_view, T>> entries) {
+        struct Bucket {
+            uint32_t index = 0;
+            std::vector<std::pair<uint32_t, const std::pair<std::string_view, T>*>> keys;
+        };
+
+        std::vector<Bucket> buckets(bucketMask + 1);
+        for (uint32_t i = 0; i <= bucketMask; i++)
+            buckets[i].index = i;
+
+        for (auto& entry : entries) {
+            uint64_t hc = hashKey(entry.first, seed);
+            auto& bucket = buckets[uint32_t(hc >> 32) & bucketMask];
+
+            // Duplicate keys can never be given separate slots; drop all but
+            // the first occurrence (matching old first-entry-wins behavior).
+            // Equal strings hash identically so they always share a bucket.
+            bool dup = false;
+            for (auto& [low, existing] : bucket.keys) {
+                if (existing->first == entry.first) {
+                    dup = true;
+                    break;
+                }
+            }
+            if (!dup)
+                bucket.keys.emplace_back(uint32_t(hc), &entry);
+        }
+
+        // Place the fullest buckets first, while they still have the most
+        // free slots to choose from.
+        std::sort(buckets.begin(), buckets.end(),
+                  [](auto& a, auto& b) { return a.keys.size() > b.keys.size(); });
+
+        std::vector<bool> used(indexMask + 1);
+        std::vector<uint32_t> claimed;
+        for (auto& bucket : buckets) {
+            if (bucket.keys.empty()) {
+                displacements[bucket.index] = 0;
+                continue;
+            }
+
+            uint32_t disp = 0;
+            for (; disp <= indexMask; disp++) {
+                claimed.clear();
+                bool ok = true;
+                for (auto& [low, entry] : bucket.keys) {
+                    uint32_t slot = (low + disp) & indexMask;
+                    if (used[slot] || std::find(claimed.begin(), claimed.end(), slot) != claimed.end()) {
+                        ok = false;
+                        break;
+                    }
+                    claimed.push_back(slot);
+                }
+                if (ok)
+                    break;
+            }
+
+            if (disp > indexMask) {
+                // Two keys in this bucket collided on their full hash (or the
+                // table is too congested); try again with a different seed.
+                std::fill_n(table.get(), indexMask + 1, Entry());
+                return false;
+            }
+
+            displacements[bucket.index] = disp;
+            for (auto& [low, entry] : bucket.keys) {
+                uint32_t slot = (low + disp) & indexMask;
+                used[slot] = true;
+                table[slot].key = entry->first;
+                table[slot].value = entry->second;
+                table[slot].occupied = true;
+            }
+        }
+        return true;
+    }
+
+    static uint64_t hashKey(std::string_view key, uint64_t seed) {
+        // FNV-1a with a seeded basis; keys here are short keywords so the
+        // byte-at-a-time loop is cheap. The finalizer spreads entropy into
+        // the high bits, which select the displacement bucket.
+        uint64_t h = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+        for (char c : key) {
+            h ^= (uint8_t)c;
+            h *= 0x100000001b3ull;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return h;
+    }
 
     static uint32_t roundUpToPow2(uint32_t n) {
         n--;
@@ -77,4 +175,85 @@ private:
     }
 };
 
+/// A table that interns strings into a backing arena, such that each distinct
+/// string is stored exactly once and always maps to the same canonical view of
+/// itself. Interned views can therefore be compared for equality by data pointer
+/// instead of by contents, and remain valid for the lifetime of the interner.
+///
+/// Unlike StringTable the set of entries doesn't need to be known up front;
+/// the table grows as strings are added. Interning is internally synchronized
+/// so a single interner can be shared across threads.
+class StringInterner {
+public:
+    StringInterner() : table(std::make_unique<Entry[]>(InitialCapacity)), capacity(InitialCapacity) {}
+
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    /// Returns the canonical copy of the given string, adding it to the
+    /// table first if it hasn't been seen before.
+    std::string_view intern(std::string_view str) {
+        size_t hc = std::hash<std::string_view>()(str);
+        if (hc == 0)
+            hc = 1;
+
+        std::scoped_lock lock(mut);
+        uint32_t index = hc & (capacity - 1);
+        while (table[index].hashCode != 0) {
+            if (table[index].hashCode == hc && table[index].key == str)
+                return table[index].key;
+            index = (index + 1) & (capacity - 1);
+        }
+
+        char* mem = reinterpret_cast<char*>(arena.allocate(str.size(), 1));
+        std::memcpy(mem, str.data(), str.size());
+        std::string_view canonical(mem, str.size());
+
+        table[index].key = canonical;
+        table[index].hashCode = hc;
+        if (++count * 2 >= capacity)
+            grow();
+
+        return canonical;
+    }
+
+    /// Returns the number of distinct strings that have been interned.
+    size_t size() const {
+        std::scoped_lock lock(mut);
+        return count;
+    }
+
+private:
+    struct Entry {
+        std::string_view key;
+        size_t hashCode = 0;
+    };
+
+    void grow() {
+        uint32_t newCapacity = capacity * 2;
+        auto newTable = std::make_unique<Entry[]>(newCapacity);
+        for (uint32_t i = 0; i < capacity; i++) {
+            auto& entry = table[i];
+            if (entry.hashCode == 0)
+                continue;
+
+            uint32_t index = entry.hashCode & (newCapacity - 1);
+            while (newTable[index].hashCode != 0)
+                index = (index + 1) & (newCapacity - 1);
+            newTable[index] = entry;
+        }
+
+        table = std::move(newTable);
+        capacity = newCapacity;
+    }
+
+    static constexpr uint32_t InitialCapacity = 64;
+
+    mutable std::mutex mut;
+    BumpAllocator arena;
+    std::unique_ptr<Entry[]> table;
+    uint32_t capacity;
+    uint32_t count = 0;
+};
+
 } // namespace slang
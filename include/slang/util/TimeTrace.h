@@ -30,6 +30,16 @@ public:
     /// Writes the results of time tracing to the given stream.
     /// The output is JSON, in Chrome "Trace Event" format, see
     /// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/preview
+    ///
+    /// Alongside the individual trace events the output includes a "counters"
+    /// object with the invocation count and total time of every section name,
+    /// including sections too short to get their own trace event, which is
+    /// useful for tracking regressions across runs.
+    ///
+    /// Each trace event also carries the process resident set size sampled at
+    /// the start and end of its section, and a top-level "memory" object
+    /// records the peak and final RSS, so memory growth can be attributed to
+    /// specific phases without an external profiler.
     static void write(std::ostream& os);
 
     /// Starts tracing a section.
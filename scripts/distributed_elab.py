@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+# Coordinator that shards per-top elaborations across worker machines.
+#
+# Takes a base slang command line (everything except --top) plus a list of
+# top modules and a list of hosts, then runs one elaboration per top, farming
+# jobs out over ssh. Sources are expected to be visible at the same paths on
+# every host (i.e. a shared filesystem); nothing is copied. Results stream
+# back as each job finishes and are aggregated into a summary plus an
+# optional JSON report.
+#
+# SPDX-FileCopyrightText: Michael Popoloski
+# SPDX-License-Identifier: MIT
+
+import argparse
+import concurrent.futures
+import json
+import os
+import queue
+import shlex
+import subprocess
+import sys
+import time
+
+
+def parseHosts(spec):
+    """Parses "host[:slots],host[:slots],..." into a list of (host, slots).
+    The special host name "local" runs jobs directly without ssh."""
+    hosts = []
+    for entry in spec.split(","):
+        entry = entry.strip()
+        if not entry:
+            continue
+        host, _, slots = entry.partition(":")
+        hosts.append((host, int(slots) if slots else os.cpu_count()))
+    return hosts
+
+
+def runJob(baseCmd, top, host, cwd):
+    cmd = baseCmd + ["--top", top]
+    if host != "local":
+        # Reproduce the coordinator's working directory so relative paths in
+        # the command resolve identically on the worker.
+        cmd = ["ssh", "-o", "BatchMode=yes", host,
+               "cd {} && {}".format(shlex.quote(cwd), " ".join(shlex.quote(c) for c in cmd))]
+
+    start = time.monotonic()
+    proc = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    return {
+        "top": top,
+        "host": host,
+        "returncode": proc.returncode,
+        "seconds": round(time.monotonic() - start, 2),
+        "output": proc.stdout.decode("utf-8", errors="replace"),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Distribute per-top elaborations across worker machines",
+        epilog="Everything after '--' is the base slang command line, "
+               "e.g.: %(prog)s --hosts node1:16,node2:16 --topsFile tops.txt "
+               "-- bin/slang -f design.f",
+    )
+    parser.add_argument(
+        "--hosts",
+        default="local",
+        help="Comma-separated worker hosts, each optionally suffixed with "
+             ":slots (default: local, meaning run jobs in this machine)",
+    )
+    parser.add_argument("--top", action="append", default=[], help="A top module to elaborate")
+    parser.add_argument("--topsFile", help="File with one top module name per line")
+    parser.add_argument("--report", help="Write per-top results to this JSON file")
+    parser.add_argument("-q", "--quiet", action="store_true", help="Only report failures")
+    parser.add_argument("command", nargs=argparse.REMAINDER,
+                        help="Base slang command line, preceded by '--'")
+    args = parser.parse_args()
+
+    baseCmd = args.command
+    if baseCmd and baseCmd[0] == "--":
+        baseCmd = baseCmd[1:]
+    if not baseCmd:
+        parser.error("no base command given; pass it after '--'")
+
+    tops = list(args.top)
+    if args.topsFile:
+        with open(args.topsFile, "r") as f:
+            tops += [line.strip() for line in f if line.strip()]
+    if not tops:
+        parser.error("no top modules given; use --top or --topsFile")
+
+    hosts = parseHosts(args.hosts)
+    if not hosts:
+        parser.error("no hosts given")
+
+    # One queue entry per worker slot; each job borrows a slot for its
+    # duration so per-host concurrency never exceeds the configured limit,
+    # while idle hosts pick up the remaining tops for load balancing.
+    slots = queue.Queue()
+    for host, count in hosts:
+        for _ in range(count):
+            slots.put(host)
+
+    cwd = os.getcwd()
+
+    def dispatch(top):
+        host = slots.get()
+        try:
+            return runJob(baseCmd, top, host, cwd)
+        finally:
+            slots.put(host)
+
+    results = []
+    failures = 0
+    with concurrent.futures.ThreadPoolExecutor(max_workers=slots.qsize()) as executor:
+        futures = [executor.submit(dispatch, top) for top in tops]
+        for future in concurrent.futures.as_completed(futures):
+            result = future.result()
+            results.append(result)
+            if result["returncode"] != 0:
+                failures += 1
+                print("FAIL {} on {} ({}s)".format(
+                    result["top"], result["host"], result["seconds"]))
+                sys.stdout.write(result["output"])
+            elif not args.quiet:
+                print("PASS {} on {} ({}s)".format(
+                    result["top"], result["host"], result["seconds"]))
+
+    if args.report:
+        results.sort(key=lambda r: r["top"])
+        with open(args.report, "w") as f:
+            json.dump(results, f, indent=2)
+
+    print("{} passed, {} failed across {} host(s)".format(
+        len(tops) - failures, failures, len(hosts)))
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,171 @@
+#!/usr/bin/env python
+# Parallel runner for the regression suite with compile-result caching.
+#
+# Runs the slang driver over every test input across all cores. Results are
+# cached keyed by a fingerprint of each test's token stream (its source text
+# with comments and whitespace normalized away) plus the compiler binary and
+# flags, so reruns only compile tests whose meaning actually changed.
+#
+# SPDX-FileCopyrightText: Michael Popoloski
+# SPDX-License-Identifier: MIT
+
+import argparse
+import concurrent.futures
+import hashlib
+import json
+import os
+import shlex
+import subprocess
+import sys
+
+
+def tokenFingerprint(path):
+    """Hashes the lexically significant content of a source file: comments are
+    stripped and whitespace between tokens is collapsed to a single separator,
+    so formatting-only edits don't invalidate the cache."""
+    with open(path, "rb") as f:
+        text = f.read().decode("utf-8", errors="replace")
+
+    out = []
+    i = 0
+    n = len(text)
+    pendingSep = False
+    while i < n:
+        c = text[i]
+        if c == "/" and i + 1 < n and text[i + 1] == "/":
+            while i < n and text[i] != "\n":
+                i += 1
+            pendingSep = True
+        elif c == "/" and i + 1 < n and text[i + 1] == "*":
+            i += 2
+            while i + 1 < n and not (text[i] == "*" and text[i + 1] == "/"):
+                i += 1
+            i += 2
+            pendingSep = True
+        elif c == '"':
+            # Strings keep their exact contents, including escaped quotes.
+            start = i
+            i += 1
+            while i < n and text[i] != '"':
+                i += 2 if text[i] == "\\" else 1
+            i += 1
+            out.append(text[start:i])
+            pendingSep = False
+        elif c.isspace():
+            pendingSep = True
+            i += 1
+        else:
+            if pendingSep and out:
+                out.append(" ")
+            pendingSep = False
+            out.append(c)
+            i += 1
+
+    return hashlib.sha256("".join(out).encode("utf-8")).hexdigest()
+
+
+def binaryFingerprint(path):
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+def runTest(slang, flags, path):
+    proc = subprocess.run(
+        [slang] + flags + [path],
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+    )
+    return {
+        "returncode": proc.returncode,
+        "output": proc.stdout.decode("utf-8", errors="replace"),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Parallel regression test runner")
+    parser.add_argument("--slangBin", required=True, help="Path to the slang driver")
+    parser.add_argument(
+        "--testDir",
+        default=os.path.join(os.path.dirname(os.path.realpath(__file__)), "..", "tests", "regression"),
+        help="Directory containing regression test inputs",
+    )
+    parser.add_argument(
+        "--cacheFile",
+        default=None,
+        help="Path to the result cache (default: <testDir>/.regression_cache.json)",
+    )
+    parser.add_argument("--flags", default="", help="Extra flags to pass to each compile")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count(), help="Parallel jobs")
+    parser.add_argument(
+        "--no-cache", action="store_true", help="Ignore and overwrite any cached results"
+    )
+    parser.add_argument("-q", "--quiet", action="store_true", help="Only report failures")
+    args = parser.parse_args()
+
+    testDir = os.path.realpath(args.testDir)
+    cachePath = args.cacheFile or os.path.join(testDir, ".regression_cache.json")
+    flags = shlex.split(args.flags)
+
+    tests = []
+    for root, _, files in os.walk(testDir):
+        for name in sorted(files):
+            if os.path.splitext(name)[1] in (".v", ".sv"):
+                tests.append(os.path.join(root, name))
+
+    if not tests:
+        sys.exit("no test inputs found in {}".format(testDir))
+
+    cache = {}
+    if not args.no_cache:
+        try:
+            with open(cachePath, "r") as f:
+                cache = json.load(f)
+        except (OSError, ValueError):
+            cache = {}
+
+    # The compiler binary and flags participate in every key so a new build
+    # or changed options invalidates all cached results at once.
+    prefix = binaryFingerprint(args.slangBin) + "|" + " ".join(flags) + "|"
+
+    keys = {test: prefix + tokenFingerprint(test) for test in tests}
+    stale = [test for test in tests if keys[test] not in cache]
+
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as executor:
+        futures = {
+            executor.submit(runTest, args.slangBin, flags, test): test for test in stale
+        }
+        for future in concurrent.futures.as_completed(futures):
+            cache[keys[futures[future]]] = future.result()
+
+    failures = 0
+    for test in tests:
+        result = cache[keys[test]]
+        name = os.path.relpath(test, testDir)
+        cached = test not in stale
+        if result["returncode"] != 0:
+            failures += 1
+            print("FAIL {}{}".format(name, " (cached)" if cached else ""))
+            sys.stdout.write(result["output"])
+        elif not args.quiet:
+            print("PASS {}{}".format(name, " (cached)" if cached else ""))
+
+    # Drop entries for tests that no longer exist or whose inputs changed.
+    liveKeys = set(keys.values())
+    cache = {k: v for k, v in cache.items() if k in liveKeys}
+
+    with open(cachePath, "w") as f:
+        json.dump(cache, f, indent=2)
+
+    print(
+        "{} passed, {} failed, {} from cache".format(
+            len(tests) - failures, failures, len(tests) - len(stale)
+        )
+    )
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -348,28 +348,172 @@ namespace slang::syntax {
 #include "slang/syntax/AllSyntax.h"
 #include "slang/util/TypeTraits.h"
 
+#include <cstddef>
+
 // This file contains all parse tree syntax node generated definitions.
 // It is auto-generated by the syntax_gen.py script under the scripts/ directory.
 
 namespace slang::syntax {
 
-size_t SyntaxNode::getChildCount() const {
+namespace {
+
+// Per-kind child access metadata. Each concrete syntax kind gets a table of
+// entries describing where its children live within the node object, so that
+// the generic SyntaxNode child accessors can reach any child with a couple of
+// table lookups instead of dispatching to the per-type getChild functions.
+enum class ChildKind : uint8_t {
+    Token, // a Token stored by value
+    Node,  // a (possibly null) pointer to a child node
+    List   // a list node (SyntaxList et al) stored by value
+};
+
+struct ChildEntry {
+    uint16_t offset;
+    ChildKind childKind;
+};
+
+struct ChildTable {
+    const ChildEntry* entries;
+    uint16_t count;
+};
+
+// All of the list types share SyntaxListBase as their first base class, so the
+// adjustment from a list member's address to its SyntaxNode subobject is the
+// same for each of them; compute it from a real object so that the compiler
+// performs the cast.
+ptrdiff_t listNodeDelta() {
+    static const ptrdiff_t delta = [] {
+        TokenList list(nullptr);
+        return reinterpret_cast<const char*>(static_cast<const SyntaxNode*>(&list)) -
+               reinterpret_cast<const char*>(&list);
+    }();
+    return delta;
+}
+
+// offsetof on the syntax types is conditionally-supported (they aren't
+// standard layout), but all supported compilers implement it for
+// single-inheritance hierarchies like these.
+#if defined(__GNUC__) || defined(__clang__)
+#    pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+"""
+    )
+
+    seenTableTypes = set()
+    for k, v in sorted(kindmap.items()):
+        if v in seenTableTypes:
+            continue
+        seenTableTypes.add(v)
+
+        currtype = alltypes[v]
+        if not currtype.combinedMembers:
+            continue
+
+        cppf.write("constexpr ChildEntry childEntries_{}[] = {{\n".format(v))
+        for m in currtype.combinedMembers:
+            if m[0] == "Token":
+                ck = "Token"
+            elif m[1] in currtype.pointerMembers:
+                ck = "List"
+            else:
+                ck = "Node"
+            cppf.write("    {{offsetof({}, {}), ChildKind::{}}},\n".format(v, m[1], ck))
+        cppf.write("};\n\n")
+
+    cppf.write("constexpr ChildTable childTables[] = {\n")
+    cppf.write("    {nullptr, 0}, // Unknown\n")
+    cppf.write("    {nullptr, 0}, // SyntaxList\n")
+    cppf.write("    {nullptr, 0}, // TokenList\n")
+    cppf.write("    {nullptr, 0}, // SeparatedList\n")
+    for k, v in sorted(kindmap.items()):
+        count = len(alltypes[v].combinedMembers)
+        if count:
+            cppf.write("    {{childEntries_{}, {}}}, // {}\n".format(v, count, k))
+        else:
+            cppf.write("    {{nullptr, 0}}, // {}\n".format(k))
+    cppf.write("};\n\n")
+    cppf.write(
+        "static_assert(sizeof(childTables) / sizeof(childTables[0]) == {});\n\n".format(
+            len(kindmap) + 4
+        )
+    )
+    cppf.write("} // namespace\n\n")
+
+    cppf.write(
+        """size_t SyntaxNode::getChildCount() const {
     switch (kind) {
-        case SyntaxKind::Unknown: return 0;
+        case SyntaxKind::Unknown:
+            return 0;
         case SyntaxKind::SyntaxList:
         case SyntaxKind::TokenList:
         case SyntaxKind::SeparatedList:
             return ((const SyntaxListBase*)this)->getChildCount();
-"""
-    )
+        default:
+            return childTables[size_t(kind)].count;
+    }
+}
 
-    for k, v in sorted(kindmap.items()):
-        count = len(alltypes[v].combinedMembers)
-        cppf.write("        case SyntaxKind::{}: return {};\n".format(k, count))
+ConstTokenOrSyntax SyntaxNode::getChild(size_t index) const {
+    switch (kind) {
+        case SyntaxKind::Unknown:
+            return nullptr;
+        case SyntaxKind::SyntaxList:
+        case SyntaxKind::TokenList:
+        case SyntaxKind::SeparatedList:
+            return ((const SyntaxListBase*)this)->getChild(index);
+        default:
+            break;
+    }
+
+    auto& table = childTables[size_t(kind)];
+    if (index >= table.count)
+        return nullptr;
+
+    auto& entry = table.entries[index];
+    auto ptr = reinterpret_cast<const char*>(this) + entry.offset;
+    switch (entry.childKind) {
+        case ChildKind::Token:
+            return *reinterpret_cast<const parsing::Token*>(ptr);
+        case ChildKind::Node:
+            return *reinterpret_cast<const SyntaxNode* const*>(ptr);
+        case ChildKind::List:
+            return reinterpret_cast<const SyntaxNode*>(ptr + listNodeDelta());
+    }
+    ASSUME_UNREACHABLE;
+}
+
+TokenOrSyntax SyntaxNode::getChild(size_t index) {
+    switch (kind) {
+        case SyntaxKind::Unknown:
+            return nullptr;
+        case SyntaxKind::SyntaxList:
+        case SyntaxKind::TokenList:
+        case SyntaxKind::SeparatedList:
+            return ((SyntaxListBase*)this)->getChild(index);
+        default:
+            break;
+    }
+
+    auto& table = childTables[size_t(kind)];
+    if (index >= table.count)
+        return nullptr;
+
+    auto& entry = table.entries[index];
+    auto ptr = reinterpret_cast<char*>(this) + entry.offset;
+    switch (entry.childKind) {
+        case ChildKind::Token:
+            return *reinterpret_cast<parsing::Token*>(ptr);
+        case ChildKind::Node:
+            return *reinterpret_cast<SyntaxNode**>(ptr);
+        case ChildKind::List:
+            return reinterpret_cast<SyntaxNode*>(ptr + listNodeDelta());
+    }
+    ASSUME_UNREACHABLE;
+}
 
-    cppf.write("    }\n")
-    cppf.write("    ASSUME_UNREACHABLE;\n")
-    cppf.write("}\n\n")
+"""
+    )
 
     # Build a reverse mapping from class types to their syntax kinds.
     reverseKindmap = {}
@@ -507,21 +651,28 @@ std::ostream& operator<<(std::ostream& os, SyntaxKind kind) {
     return os;
 }
 
-std::string_view toString(SyntaxKind kind) {
-    switch (kind) {
-        case SyntaxKind::Unknown: return "Unknown";
-        case SyntaxKind::SyntaxList: return "SyntaxList";
-        case SyntaxKind::TokenList: return "TokenList";
-        case SyntaxKind::SeparatedList: return "SeparatedList";
+// Kind names in enum order; constexpr string_views carry lengths computed
+// at compile time so serialization hot loops copy fixed spans instead of
+// re-measuring C strings on every call.
+static constexpr std::string_view syntaxKindNames[] = {
+    "Unknown",
+    "SyntaxList",
+    "TokenList",
+    "SeparatedList",
 """
     )
 
     for k, _ in sorted(kindmap.items()):
-        cppf.write('        case SyntaxKind::{}: return "{}";\n'.format(k, k))
+        cppf.write('    "{}",\n'.format(k))
 
     cppf.write(
-        """        default: return "";
-    }
+        """};
+
+std::string_view toString(SyntaxKind kind) {
+    auto index = static_cast<size_t>(kind);
+    if (index >= std::size(syntaxKindNames))
+        return "";
+    return syntaxKindNames[index];
 }
 
 """
@@ -7,8 +7,12 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/ASTSerializer.h"
 
+#include <atomic>
+#include <thread>
+
 #include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
 
 namespace slang::ast {
 
@@ -16,6 +20,89 @@ ASTSerializer::ASTSerializer(Compilation& compilation, JsonWriter& writer) :
     compilation(compilation), writer(writer) {
 }
 
+std::string ASTSerializer::serializeParallel(Compilation& compilation, uint32_t threadCount,
+                                             bool prettyPrint, bool includeAddresses) {
+    auto& root = compilation.getRoot();
+
+    // Serialization must not trigger lazy binding once workers are running,
+    // so push the whole design through elaboration up front.
+    compilation.forceElaborate(root);
+
+    SmallVector<const Symbol*> members;
+    for (auto& member : root.members())
+        members.push_back(&member);
+
+    threadCount = (uint32_t)std::min<size_t>(threadCount, members.size());
+    if (threadCount <= 1) {
+        JsonWriter writer;
+        writer.setPrettyPrint(prettyPrint);
+
+        ASTSerializer serializer(compilation, writer);
+        serializer.setIncludeAddresses(includeAddresses);
+        serializer.serialize(root);
+        return std::string(writer.view());
+    }
+
+    // Each worker renders complete top-level members into its own writer.
+    // Chunks land in member order so the stitched result is deterministic
+    // regardless of scheduling. Eval result caching is disabled on the
+    // workers; everything else the serializer touches is read-only once
+    // elaboration has finished.
+    std::vector<std::string> chunks(members.size());
+    std::atomic<size_t> nextIndex = 0;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++) {
+        workers.emplace_back([&] {
+            while (true) {
+                size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+                if (index >= members.size())
+                    break;
+
+                JsonWriter writer;
+                writer.setPrettyPrint(prettyPrint);
+                writer.setStartingLevel(2); // inside the root object's members array
+
+                ASTSerializer serializer(compilation, writer);
+                serializer.setIncludeAddresses(includeAddresses);
+                serializer.cacheEvalResults = false;
+                serializer.serialize(*members[index], /* inMembersArray */ true);
+                chunks[index] = std::string(writer.view());
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    // Write the root envelope the same way the generic symbol path would
+    // and splice the pre-rendered members into it. The root symbol has no
+    // attributes and an empty serializeTo, so this covers everything.
+    JsonWriter writer;
+    writer.setPrettyPrint(prettyPrint);
+
+    ASTSerializer serializer(compilation, writer);
+    writer.startObject();
+    serializer.write("name", root.name);
+    serializer.write("kind", toString(root.kind));
+    if (includeAddresses)
+        serializer.write("addr", uintptr_t(&root));
+
+    if (!members.empty()) {
+        serializer.startArray("members");
+        for (auto& chunk : chunks) {
+            // Chunks can be empty when the member elected to skip itself.
+            if (!chunk.empty())
+                writer.writePreformatted(chunk);
+        }
+        serializer.endArray();
+    }
+
+    serializer.endObject();
+    return std::string(writer.view());
+}
+
 void ASTSerializer::serialize(const Symbol& symbol, bool inMembersArray) {
     symbol.visit(*this, inMembersArray);
 }
@@ -189,7 +276,8 @@ void ASTSerializer::visit(const T& elem, bool inMembersArray) {
             elem.serializeTo(*this);
         }
 
-        EvalContext ctx(compilation, EvalFlags::CacheResults);
+        EvalContext ctx(compilation,
+                        cacheEvalResults ? EvalFlags::CacheResults : EvalFlags::None);
         ConstantValue constant = elem.eval(ctx);
         if (constant)
             write("constant", constant);
@@ -8,6 +8,7 @@
 #include "slang/ast/Bitstream.h"
 
 #include "../text/FormatBuffer.h"
+#include <iterator>
 #include <numeric>
 
 #include "slang/ast/Compilation.h"
@@ -260,6 +261,12 @@ static ConstantValue constContainer(const Type& type, std::span<ConstantValue> e
 }
 
 /// Performs pack operation to create a bit-stream.
+///
+/// Note that this doesn't flatten the value into one giant bit vector; it only
+/// collects pointers to the integer and string leaves in stream order. The
+/// unpack side then slices directly from those leaves into the destination
+/// elements via slicePacked, so the transient memory for a conversion is
+/// bounded by the largest single element rather than the total stream width.
 static void packBitstream(ConstantValue& value, SmallVectorBase<ConstantValue*>& packed) {
     if (value.isInteger()) {
         packed.push_back(&value);
@@ -296,7 +303,10 @@ static SVInt slicePacked(PackIterator& iter, const PackIterator iterEnd, bitwidt
         return SVInt(width, 0, false); // filling with zero bits on the right
     }
 
-    ConstantValue cp = **iter;
+    // The packed values are owned by the (consumable) source of the pack operation,
+    // so we can slice them in place instead of copying. Strings are converted to
+    // integers on first touch so that repeated partial slices don't re-convert.
+    ConstantValue& cp = **iter;
     if (cp.isString())
         cp = cp.convertToInt();
 
@@ -674,7 +684,8 @@ static bool unpackConcatenation(const StreamingConcatenationExpression& lhs, Pac
             }
 
             // Re-order to a new rvalue with the slice size
-            ConstantValue cv = std::vector(toBeOrdered.begin(), toBeOrdered.end());
+            ConstantValue cv = std::vector(std::make_move_iterator(toBeOrdered.begin()),
+                                           std::make_move_iterator(toBeOrdered.end()));
             auto rvalue = Bitstream::reOrder(std::move(cv), concat.sliceSize, cv.bitstreamWidth());
 
             SmallVector<ConstantValue*> packed;
@@ -8,9 +8,13 @@
 #include "slang/ast/Compilation.h"
 
 #include "ElabVisitors.h"
+#include <algorithm>
+#include <bit>
 #include <fmt/core.h>
+#include <fstream>
 
 #include "slang/ast/Definition.h"
+#include "slang/ast/EvalBytecode.h"
 #include "slang/ast/ScriptSession.h"
 #include "slang/ast/SystemSubroutine.h"
 #include "slang/ast/types/TypePrinter.h"
@@ -22,10 +26,14 @@
 #include "slang/syntax/SyntaxTree.h"
 #include "slang/text/CharInfo.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/OS.h"
+#include "slang/util/String.h"
 #include "slang/util/TimeTrace.h"
 
 using namespace slang::parsing;
 
+namespace fs = std::filesystem;
+
 namespace slang::ast::builtins {
 
 void registerArrayMethods(Compilation&);
@@ -199,10 +207,32 @@ void Compilation::addSyntaxTree(std::shared_ptr<SyntaxTree> tree) {
     root->addMember(*unit);
     compilationUnits.push_back(unit);
 
-    for (auto& [n, meta] : tree->getMetadata().nodeMap) {
+    collectDefinitionMetadata(*tree);
+
+    if (node.kind == SyntaxKind::CompilationUnit) {
+        auto& members = node.as<CompilationUnitSyntax>().members;
+        unit->reserveMembers(members.size());
+        for (auto member : members)
+            unit->addMembers(*member);
+    }
+    else {
+        unit->addMembers(node);
+    }
+
+    syntaxTrees.emplace_back(std::move(tree));
+    cachedParseDiagnostics.reset();
+
+    // File additions are infrequent enough to report unconditionally.
+    progress.filesAdded++;
+    if (options.progressCallback)
+        options.progressCallback(progress);
+}
+
+void Compilation::collectDefinitionMetadata(const SyntaxTree& tree) {
+    for (auto& [n, meta] : tree.getMetadata().nodeMap) {
         auto decl = &n->as<ModuleDeclarationSyntax>();
         DefinitionMetadata result;
-        result.tree = tree.get();
+        result.tree = &tree;
         result.defaultNetType = &getNetType(meta.defaultNetType);
         result.timeScale = meta.timeScale;
 
@@ -221,23 +251,133 @@ void Compilation::addSyntaxTree(std::shared_ptr<SyntaxTree> tree) {
         definitionMetadata[decl] = result;
     }
 
-    for (auto& name : tree->getMetadata().globalInstances)
+    for (auto& name : tree.getMetadata().globalInstances)
         globalInstantiations.emplace(name);
+}
 
-    if (node.kind == SyntaxKind::CompilationUnit) {
-        for (auto member : node.as<CompilationUnitSyntax>().members)
-            unit->addMembers(*member);
+std::span<const std::shared_ptr<SyntaxTree>> Compilation::getSyntaxTrees() const {
+    return syntaxTrees;
+}
+
+static constexpr std::string_view CheckpointHeader = "slang-checkpoint v1\n"sv;
+
+bool Compilation::saveCheckpoint(const fs::path& path) const {
+    if (!sourceManager)
+        return false;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    file << CheckpointHeader;
+
+    // Embed every file buffer the source manager has loaded; this covers
+    // both top files and anything pulled in through include directives, so
+    // a restore never has to consult the original file tree.
+    for (auto buffer : sourceManager->getAllBuffers()) {
+        if (!sourceManager->isFileLoc(SourceLocation(buffer, 0)))
+            continue;
+
+        auto filePath = getU8Str(sourceManager->getFullPath(buffer));
+        auto text = sourceManager->getSourceText(buffer);
+        file << "file " << filePath.size() << ' ' << text.size() << '\n';
+        file << filePath << '\n';
+        file.write(text.data(), (std::streamsize)text.size());
+        file << '\n';
     }
-    else {
-        unit->addMembers(node);
+
+    // Record each syntax tree by the path of its top-level buffer, in the
+    // order the trees were added so that restoration preserves declaration
+    // order and diagnostics stay deterministic.
+    for (auto& tree : syntaxTrees) {
+        auto buffer = tree->root().getFirstToken().location().buffer();
+        if (!buffer)
+            return false;
+
+        auto filePath = getU8Str(sourceManager->getFullPath(buffer));
+        file << "tree " << filePath.size() << ' ' << (tree->isLibrary ? 1 : 0) << '\n';
+        file << filePath << '\n';
     }
 
-    syntaxTrees.emplace_back(std::move(tree));
-    cachedParseDiagnostics.reset();
+    file.flush();
+    return file.good();
 }
 
-std::span<const std::shared_ptr<SyntaxTree>> Compilation::getSyntaxTrees() const {
-    return syntaxTrees;
+std::unique_ptr<Compilation> Compilation::restoreCheckpoint(const fs::path& path,
+                                                            SourceManager& sourceManager,
+                                                            const Bag& optionBag) {
+    std::vector<char> contents;
+    if (!OS::readFile(path, contents))
+        return nullptr;
+
+    std::string_view data(contents.data(), contents.size() - 1);
+    if (!data.starts_with(CheckpointHeader))
+        return nullptr;
+    data.remove_prefix(CheckpointHeader.size());
+
+    auto takeLine = [&]() -> std::optional<std::string_view> {
+        auto pos = data.find('\n');
+        if (pos == std::string_view::npos)
+            return std::nullopt;
+
+        auto line = data.substr(0, pos);
+        data.remove_prefix(pos + 1);
+        return line;
+    };
+
+    auto takeBytes = [&](size_t count) -> std::optional<std::string_view> {
+        // Each byte-counted field is followed by a separator newline.
+        if (data.size() < count + 1 || data[count] != '\n')
+            return std::nullopt;
+
+        auto bytes = data.substr(0, count);
+        data.remove_prefix(count + 1);
+        return bytes;
+    };
+
+    auto compilation = std::make_unique<Compilation>(optionBag);
+    flat_hash_map<std::string, SourceBuffer> buffers;
+
+    while (!data.empty()) {
+        auto line = takeLine();
+        if (!line)
+            return nullptr;
+
+        size_t pathLen = 0, arg = 0;
+        char tag[5] = {};
+        if (sscanf(std::string(*line).c_str(), "%4s %zu %zu", tag, &pathLen, &arg) != 3)
+            return nullptr;
+
+        auto filePath = takeBytes(pathLen);
+        if (!filePath)
+            return nullptr;
+
+        if (std::string_view(tag) == "file"sv) {
+            auto text = takeBytes(arg);
+            if (!text)
+                return nullptr;
+
+            auto buffer = sourceManager.assignText(*filePath, *text);
+            if (!buffer)
+                return nullptr;
+
+            buffers.emplace(std::string(*filePath), buffer);
+        }
+        else if (std::string_view(tag) == "tree"sv) {
+            auto it = buffers.find(std::string(*filePath));
+            if (it == buffers.end())
+                return nullptr;
+
+            auto tree = SyntaxTree::fromBuffer(it->second, sourceManager, optionBag);
+            tree->isLibrary = arg != 0;
+            compilation->addSyntaxTree(std::move(tree));
+        }
+        else {
+            return nullptr;
+        }
+    }
+
+    return compilation;
 }
 
 std::span<const CompilationUnitSymbol* const> Compilation::getCompilationUnits() const {
@@ -418,11 +558,26 @@ const CompilationUnitSymbol* Compilation::getCompilationUnit(
 
 const Definition* Compilation::getDefinition(std::string_view lookupName,
                                              const Scope& scope) const {
+    // Instantiations tend to come in long runs of the same definition, most
+    // obviously in gate-level netlists, so remember the last successful lookup
+    // and skip the map entirely when it repeats.
+    if (lastFoundDefinition && lookupName == lastDefinitionName &&
+        &scope == lastDefinitionScope) {
+        return lastFoundDefinition;
+    }
+
+    auto remember = [&](const Definition* def) {
+        lastDefinitionName = lookupName;
+        lastDefinitionScope = &scope;
+        lastFoundDefinition = def;
+        return def;
+    };
+
     // First try to do a quick lookup in the top definitions map (most definitions are global).
     // If the flag is set it means we have to do a full scope lookup instead.
     if (auto it = topDefinitions.find(lookupName); it != topDefinitions.end()) {
         if (!it->second.second)
-            return it->second.first;
+            return remember(it->second.first);
     }
 
     // There are nested modules somewhere with this same name, so we need to do the full search.
@@ -430,11 +585,19 @@ const Definition* Compilation::getDefinition(std::string_view lookupName,
     do {
         auto it = definitionMap.find(std::make_tuple(lookupName, searchScope));
         if (it != definitionMap.end())
-            return it->second;
+            return remember(it->second);
 
         searchScope = searchScope->asSymbol().getParentScope();
     } while (searchScope);
 
+    // A miss may just mean the definition's body parsing was deferred and it
+    // hasn't been materialized yet. Resolution only ever adds to the lazily
+    // built definition tables, so the const_cast here is safe.
+    if (!deferredDefinitions.empty() &&
+        const_cast<Compilation*>(this)->resolveDeferredDefinitions(lookupName)) {
+        return getDefinition(lookupName, scope);
+    }
+
     return nullptr;
 }
 
@@ -451,6 +614,13 @@ const Definition* Compilation::getDefinition(const ModuleDeclarationSyntax& synt
         if (dmIt != definitionMap.end() && dmIt->second == def)
             return def;
     }
+
+    if (!deferredDefinitions.empty()) {
+        auto name = syntax.header->name.valueText();
+        if (!name.empty() && const_cast<Compilation*>(this)->resolveDeferredDefinitions(name))
+            return getDefinition(syntax);
+    }
+
     return nullptr;
 }
 
@@ -467,6 +637,16 @@ static void reportRedefinition(const Scope& scope, const T& newSym, const U& old
 void Compilation::createDefinition(const Scope& scope, LookupLocation location,
                                    const ModuleDeclarationSyntax& syntax) {
     auto& metadata = definitionMetadata[&syntax];
+    if (metadata.tree && metadata.tree->isModuleBodyDeferred(syntax)) {
+        // The body of this declaration hasn't been parsed yet; building the
+        // Definition would scan its (empty) member list. Record where it was
+        // declared and materialize it only if a lookup ever asks for the name.
+        auto name = syntax.header->name.valueText();
+        if (!name.empty())
+            deferredDefinitions[name].push_back({&scope, location, &syntax});
+        return;
+    }
+
     auto def = definitionMemory
                    .emplace_back(std::make_unique<Definition>(scope, location, syntax,
                                                               *metadata.defaultNetType,
@@ -479,6 +659,10 @@ void Compilation::createDefinition(const Scope& scope, LookupLocation location,
     // it to the root scope instead so that lookups from other compilation units will find it.
     auto targetScope = scope.asSymbol().kind == SymbolKind::CompilationUnit ? root.get() : &scope;
     auto [it, inserted] = definitionMap.emplace(std::tuple(def->name, targetScope), def);
+
+    // A new definition (particularly a nested one shadowing a global) can
+    // change what an existing name should resolve to.
+    lastFoundDefinition = nullptr;
     if (!inserted) {
         reportRedefinition(scope, *def, *it->second, diag::DuplicateDefinition);
         return;
@@ -497,6 +681,39 @@ void Compilation::createDefinition(const Scope& scope, LookupLocation location,
     }
 }
 
+bool Compilation::resolveDeferredDefinitions(std::string_view name) {
+    auto it = deferredDefinitions.find(name);
+    if (it == deferredDefinitions.end())
+        return false;
+
+    auto entries = std::move(it->second);
+    deferredDefinitions.erase(it);
+
+    for (auto& entry : entries) {
+        // Find the owning tree so we can expand the body in place. The
+        // expansion may discover nested declarations, so refresh the parse
+        // metadata from the tree afterward.
+        auto treePtr = definitionMetadata[entry.syntax].tree;
+        for (auto& tree : syntaxTrees) {
+            if (tree.get() == treePtr) {
+                tree->expandDeferredBody(*entry.syntax);
+                collectDefinitionMetadata(*tree);
+                cachedParseDiagnostics.reset();
+                break;
+            }
+        }
+
+        createDefinition(*entry.scope, entry.location, *entry.syntax);
+    }
+    return true;
+}
+
+// Note that packages always come from syntax trees added to this compilation;
+// there is no notion of loading a precompiled package from disk. Package
+// symbols are arena-allocated pointer graphs tied to this compilation's
+// lifetime (see the note on ASTSerializer), so the supported way to amortize
+// a stable package across many runs is to share the parsed syntax tree, with
+// member elaboration remaining lazy until something in the package is used.
 const PackageSymbol* Compilation::getPackage(std::string_view lookupName) const {
     auto it = packageMap.find(lookupName);
     if (it == packageMap.end())
@@ -504,6 +721,16 @@ const PackageSymbol* Compilation::getPackage(std::string_view lookupName) const
     return it->second;
 }
 
+std::vector<const PackageSymbol*> Compilation::getPackages() const {
+    std::vector<const PackageSymbol*> result;
+    result.reserve(packageMap.size());
+    for (auto [name, package] : packageMap)
+        result.push_back(package);
+
+    std::ranges::sort(result, {}, &PackageSymbol::name);
+    return result;
+}
+
 const PackageSymbol& Compilation::createPackage(const Scope& scope,
                                                 const ModuleDeclarationSyntax& syntax) {
     auto& metadata = definitionMetadata[&syntax];
@@ -590,47 +817,61 @@ const SystemSubroutine* Compilation::getSystemMethod(SymbolKind typeKind,
 
 void Compilation::setAttributes(const Symbol& symbol,
                                 std::span<const AttributeSymbol* const> attributes) {
-    attributeMap[&symbol] = attributes;
+    symbolAttributes[&symbol] = {attributes, {}, nullptr};
+}
+
+void Compilation::setAttributes(const Symbol& symbol,
+                                std::span<const syntax::AttributeInstanceSyntax* const> syntax,
+                                const Scope& scope) {
+    symbolAttributes[&symbol] = {{}, syntax, &scope};
 }
 
 void Compilation::setAttributes(const Statement& stmt,
                                 std::span<const AttributeSymbol* const> attributes) {
-    attributeMap[&stmt] = attributes;
+    stmtAttributes[&stmt] = attributes;
 }
 
 void Compilation::setAttributes(const Expression& expr,
                                 std::span<const AttributeSymbol* const> attributes) {
-    attributeMap[&expr] = attributes;
+    exprAttributes[&expr] = attributes;
 }
 
 void Compilation::setAttributes(const PortConnection& conn,
                                 std::span<const AttributeSymbol* const> attributes) {
-    attributeMap[&conn] = attributes;
+    connAttributes[&conn] = attributes;
 }
 
 std::span<const AttributeSymbol* const> Compilation::getAttributes(const Symbol& symbol) const {
-    return getAttributes(static_cast<const void*>(&symbol));
+    auto it = symbolAttributes.find(&symbol);
+    if (it == symbolAttributes.end())
+        return {};
+
+    // Attributes registered as raw syntax are bound on first query; any
+    // diagnostics they produce (duplicate names, bad expressions) still
+    // surface in a normal compile because the design-wide checking pass
+    // queries every symbol's attributes.
+    auto& entry = it->second;
+    if (entry.bindScope) {
+        auto scope = std::exchange(entry.bindScope, nullptr);
+        entry.attributes = AttributeSymbol::fromSyntax(entry.syntax, *scope, symbol);
+    }
+    return entry.attributes;
 }
 
 std::span<const AttributeSymbol* const> Compilation::getAttributes(const Statement& stmt) const {
-    return getAttributes(static_cast<const void*>(&stmt));
+    auto it = stmtAttributes.find(&stmt);
+    return it == stmtAttributes.end() ? std::span<const AttributeSymbol* const>{} : it->second;
 }
 
 std::span<const AttributeSymbol* const> Compilation::getAttributes(const Expression& expr) const {
-    return getAttributes(static_cast<const void*>(&expr));
+    auto it = exprAttributes.find(&expr);
+    return it == exprAttributes.end() ? std::span<const AttributeSymbol* const>{} : it->second;
 }
 
 std::span<const AttributeSymbol* const> Compilation::getAttributes(
     const PortConnection& conn) const {
-    return getAttributes(static_cast<const void*>(&conn));
-}
-
-std::span<const AttributeSymbol* const> Compilation::getAttributes(const void* ptr) const {
-    auto it = attributeMap.find(ptr);
-    if (it == attributeMap.end())
-        return {};
-
-    return it->second;
+    auto it = connAttributes.find(&conn);
+    return it == connAttributes.end() ? std::span<const AttributeSymbol* const>{} : it->second;
 }
 
 void Compilation::notePackageExportCandidate(const PackageSymbol& packageScope,
@@ -694,6 +935,13 @@ void Compilation::addExternInterfaceMethod(const SubroutineSymbol& method) {
     externInterfaceMethods.push_back(&method);
 }
 
+const EvalBytecode* Compilation::getBytecode(const SubroutineSymbol& subroutine) {
+    auto [it, inserted] = bytecodeCache.emplace(&subroutine, nullptr);
+    if (inserted)
+        it->second = EvalBytecode::compile(subroutine);
+    return it->second.get();
+}
+
 void Compilation::noteDefaultClocking(const Scope& scope, const Symbol& clocking,
                                       SourceRange range) {
     auto [it, inserted] = defaultClockingMap.emplace(&scope, &clocking);
@@ -774,6 +1022,24 @@ void Compilation::noteNameConflict(const Symbol& symbol) {
     nameConflicts.push_back(&symbol);
 }
 
+void Compilation::noteInstanceCreated() {
+    progress.instancesCreated++;
+    reportProgress();
+}
+
+void Compilation::noteInstanceChecked() {
+    progress.instancesChecked++;
+    reportProgress();
+}
+
+void Compilation::reportProgress() {
+    // Instance events fire for every body in the design, so rate limit the
+    // callback to keep these notes cheap enough to leave permanently enabled.
+    // One callback per 256 events is plenty for liveness reporting.
+    if (options.progressCallback && (++progressEvents & 0xff) == 0)
+        options.progressCallback(progress);
+}
+
 const Expression* Compilation::getDefaultDisable(const Scope& scope) const {
     auto curr = &scope;
     while (true) {
@@ -852,12 +1118,30 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
     if (cachedSemanticDiagnostics)
         return *cachedSemanticDiagnostics;
 
-    // If we haven't already done so, touch every symbol, scope, statement,
-    // and expression tree so that we can be sure we have all the diagnostics.
+    // Parse errors count against the error limit just like elaboration
+    // errors do. When a heavily included source file is broken, binding the
+    // rest of the design mostly manufactures follow-on noise long after the
+    // build is known to be red, so a design that is already over the limit
+    // skips semantic binding entirely; otherwise the elaboration pass gets
+    // whatever error budget remains. The AST itself is still fully formed --
+    // lazily evaluated members just stay unresolved.
     uint32_t errorLimit = options.errorLimit == 0 ? UINT32_MAX : options.errorLimit;
-    DiagnosticVisitor elabVisitor(*this, numErrors, errorLimit);
-    getRoot().visit(elabVisitor);
-    elabVisitor.finalize();
+    size_t parseErrors = 0;
+    for (auto& tree : syntaxTrees) {
+        for (auto& diag : tree->diagnostics()) {
+            if (diag.isError())
+                parseErrors++;
+        }
+    }
+
+    const bool skipElaboration = parseErrors > errorLimit;
+    DiagnosticVisitor elabVisitor(*this, numErrors,
+                                  skipElaboration ? 0
+                                                  : errorLimit - (uint32_t)parseErrors);
+    if (!skipElaboration) {
+        getRoot().visit(elabVisitor);
+        elabVisitor.finalize();
+    }
 
     // Note for the following checks here: anything that depends on a list
     // stored in the compilation object should think carefully about taking
@@ -979,18 +1263,20 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
                 def->scope.addDiag(diag::UnusedDefinition, def->location) << def->getKindString();
         }
 
-        if (!elabVisitor.hierarchyProblem && numErrors == 0) {
+        if (!skipElaboration && !elabVisitor.hierarchyProblem && numErrors == 0) {
             PostElabVisitor postElabVisitor(*this);
             getRoot().visit(postElabVisitor);
         }
     }
 
     Diagnostics results;
-    for (auto& [key, diagList] : diagMap) {
+    for (auto& [key, entry] : diagMap) {
+        mergePendingDiag(entry);
+
         // If the location is NoLocation, just issue each diagnostic.
         if (std::get<1>(key) == SourceLocation::NoLocation) {
-            for (auto& diag : diagList)
-                results.emplace_back(diag);
+            for (auto& [symbol, idx] : entry.copies)
+                results.emplace_back(entry.distinct[idx]);
             continue;
         }
 
@@ -1000,8 +1286,8 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
         const Symbol* inst = nullptr;
         size_t count = 0;
 
-        for (auto& diag : diagList) {
-            auto symbol = diag.symbol;
+        for (auto& [diagSym, idx] : entry.copies) {
+            auto symbol = diagSym;
             while (symbol && symbol->kind != SymbolKind::InstanceBody) {
                 auto scope = symbol->getParentScope();
                 symbol = scope ? &scope->asSymbol() : nullptr;
@@ -1017,7 +1303,7 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
             if (auto scope = parent->getParentScope()) {
                 auto& sym = scope->asSymbol();
                 if (sym.kind != SymbolKind::Root && sym.kind != SymbolKind::CompilationUnit) {
-                    found = &diag;
+                    found = &entry.distinct[idx];
                     inst = parent;
                 }
             }
@@ -1033,13 +1319,16 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
             results.emplace_back(std::move(diag));
         }
         else {
-            auto it = diagList.begin();
-            ASSERT(it != diagList.end());
-
-            results.emplace_back(*it);
-            for (++it; it != diagList.end(); ++it) {
-                if (*it != results.back())
-                    results.emplace_back(*it);
+            auto it = entry.copies.begin();
+            ASSERT(it != entry.copies.end());
+
+            uint32_t lastIdx = it->second;
+            results.emplace_back(entry.distinct[lastIdx]);
+            for (++it; it != entry.copies.end(); ++it) {
+                if (it->second != lastIdx) {
+                    lastIdx = it->second;
+                    results.emplace_back(entry.distinct[lastIdx]);
+                }
             }
         }
     }
@@ -1051,13 +1340,64 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
     return *cachedSemanticDiagnostics;
 }
 
+const Diagnostics& Compilation::getSemanticDiagnostics(const Symbol& subtreeRoot) {
+    if (auto it = subtreeDiagCache.find(&subtreeRoot); it != subtreeDiagCache.end())
+        return *it->second;
+
+    forceElaborate(subtreeRoot);
+
+    auto isBeneath = [&](const Symbol* symbol) {
+        while (symbol) {
+            if (symbol == &subtreeRoot)
+                return true;
+
+            if (symbol->kind == SymbolKind::InstanceBody) {
+                symbol = symbol->as<InstanceBodySymbol>().parentInstance;
+            }
+            else {
+                auto scope = symbol->getParentScope();
+                symbol = scope ? &scope->asSymbol() : nullptr;
+            }
+        }
+        return false;
+    };
+
+    // Like the design-wide collection in getSemanticDiagnostics, emit each
+    // distinct diagnostic once per run of copies, but keep only the copies
+    // that originated beneath the given root.
+    auto results = std::make_unique<Diagnostics>();
+    for (auto& [key, entry] : diagMap) {
+        mergePendingDiag(entry);
+
+        std::optional<uint32_t> lastIdx;
+        for (auto& [diagSym, idx] : entry.copies) {
+            if (!isBeneath(diagSym))
+                continue;
+
+            if (lastIdx != idx) {
+                lastIdx = idx;
+                results->emplace_back(entry.distinct[idx]);
+            }
+        }
+    }
+
+    if (sourceManager)
+        results->sort(*sourceManager);
+
+    auto& slot = subtreeDiagCache[&subtreeRoot];
+    slot = std::move(results);
+    return *slot;
+}
+
 const Diagnostics& Compilation::getAllDiagnostics() {
     if (cachedAllDiagnostics)
         return *cachedAllDiagnostics;
 
+    // Query semantic diagnostics first; elaboration can expand deferred
+    // module bodies, which appends their parse diagnostics to the owning tree.
     cachedAllDiagnostics.emplace();
-    cachedAllDiagnostics->append(getParseDiagnostics());
     cachedAllDiagnostics->append(getSemanticDiagnostics());
+    cachedAllDiagnostics->append(getParseDiagnostics());
 
     if (sourceManager)
         cachedAllDiagnostics->sort(*sourceManager);
@@ -1093,20 +1433,41 @@ Diagnostic& Compilation::addDiag(Diagnostic diag) {
 
     // Coalesce diagnostics that are at the same source location and have the same code.
     if (auto it = diagMap.find({diag.code, diag.location}); it != diagMap.end()) {
-        auto& diagList = it->second;
-        diagList.emplace_back(std::move(diag));
-        return diagList.back();
+        auto& entry = it->second;
+        mergePendingDiag(entry);
+        entry.pending = std::move(diag);
+        return entry.pending;
     }
 
     if (diag.isError())
         numErrors++;
 
     auto key = std::make_tuple(diag.code, diag.location);
-    std::vector<Diagnostic> newEntry;
-    newEntry.emplace_back(std::move(diag));
+    CoalescedDiags newEntry;
+    newEntry.pending = std::move(diag);
 
     auto [it, inserted] = diagMap.emplace(key, std::move(newEntry));
-    return it->second.back();
+    return it->second.pending;
+}
+
+void Compilation::mergePendingDiag(CoalescedDiags& entry) {
+    auto& p = entry.pending;
+    if (!p.code)
+        return;
+
+    uint32_t idx = 0;
+    for (; idx < entry.distinct.size(); idx++) {
+        if (entry.distinct[idx] == p)
+            break;
+    }
+
+    entry.copies.emplace_back(p.symbol, idx);
+    if (idx == entry.distinct.size())
+        entry.distinct.emplace_back(std::move(p));
+
+    // Clear the slot so that folding is idempotent; subtree diagnostic
+    // queries can fold entries ahead of the design-wide collection pass.
+    p = Diagnostic();
 }
 
 const ImplicitTypeSyntax& Compilation::createEmptyTypeSyntax(SourceLocation loc) {
@@ -1114,12 +1475,177 @@ const ImplicitTypeSyntax& Compilation::createEmptyTypeSyntax(SourceLocation loc)
                                         Token(*this, TokenKind::Placeholder, {}, {}, loc));
 }
 
+// The interned range covers the small signed values that dominate generated
+// code: -1 through 64, with slot 0 holding -1.
+static std::optional<size_t> commonConstantSlot(int32_t value) {
+    if (value < -1 || value > 64)
+        return std::nullopt;
+    return size_t(value + 1);
+}
+
+const ConstantValue* Compilation::getCommonConstant(const ConstantValue& value) {
+    if (!value.isInteger())
+        return nullptr;
+
+    auto& sv = value.integer();
+    if (sv.getBitWidth() != 32 || !sv.isSigned() || sv.hasUnknown())
+        return nullptr;
+
+    auto val = sv.as<int32_t>();
+    if (!val)
+        return nullptr;
+
+    auto slot = commonConstantSlot(*val);
+    if (!slot)
+        return nullptr;
+
+    auto& entry = commonConstants[*slot];
+    if (!entry)
+        entry = allocConstant(ConstantValue(value));
+    return entry;
+}
+
+static bool isSameRepresentation(const ConstantValue& a, const ConstantValue& b) {
+    if (a.getVariant().index() != b.getVariant().index())
+        return false;
+
+    if (a.isInteger()) {
+        auto& ai = a.integer();
+        auto& bi = b.integer();
+        return ai.getBitWidth() == bi.getBitWidth() && ai.isSigned() == bi.isSigned() &&
+               ai.hasUnknown() == bi.hasUnknown() && exactlyEqual(ai, bi);
+    }
+
+    // Reals compare by bit pattern; operator== would merge 0.0 with -0.0.
+    if (a.isReal())
+        return std::bit_cast<uint64_t>((double)a.real()) == std::bit_cast<uint64_t>((double)b.real());
+    if (a.isShortReal()) {
+        return std::bit_cast<uint32_t>((float)a.shortReal()) ==
+               std::bit_cast<uint32_t>((float)b.shortReal());
+    }
+
+    if (a.isUnpacked())
+        return std::ranges::equal(a.elements(), b.elements(), isSameRepresentation);
+
+    if (a.isQueue()) {
+        auto& aq = *a.queue();
+        auto& bq = *b.queue();
+        return aq.maxBound == bq.maxBound && std::ranges::equal(aq, bq, isSameRepresentation);
+    }
+
+    if (a.isMap()) {
+        auto& am = *a.map();
+        auto& bm = *b.map();
+        if (am.size() != bm.size() || !isSameRepresentation(am.defaultValue, bm.defaultValue))
+            return false;
+
+        for (auto ait = am.begin(), bit = bm.begin(); ait != am.end(); ++ait, ++bit) {
+            if (!isSameRepresentation(ait->first, bit->first) ||
+                !isSameRepresentation(ait->second, bit->second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    if (a.isUnion()) {
+        auto& au = *a.unionVal();
+        auto& bu = *b.unionVal();
+        return au.activeMember == bu.activeMember && isSameRepresentation(au.value, bu.value);
+    }
+
+    // Strings, null, unbounded, and bad values have a single representation
+    // per logical value.
+    return a == b;
+}
+
+size_t Compilation::ConstantDerefHasher::operator()(const ConstantValue* cv) const {
+    // ConstantValue::hash is already computed purely from the representation,
+    // so representationally equal values hash equal; folding in the width and
+    // signedness of top-level integers just avoids needless collisions
+    // between same-valued parameters of different types.
+    size_t h = cv->hash();
+    if (cv->isInteger()) {
+        auto& sv = cv->integer();
+        hash_combine(h, sv.getBitWidth(), sv.isSigned());
+    }
+    return h;
+}
+
+bool Compilation::ConstantDerefEq::operator()(const ConstantValue* a,
+                                              const ConstantValue* b) const {
+    return isSameRepresentation(*a, *b);
+}
+
+const ConstantValue* Compilation::internConstant(ConstantValue&& value) {
+    if (auto common = getCommonConstant(value))
+        return common;
+
+    if (auto it = internedConstants.find(&value); it != internedConstants.end())
+        return *it;
+
+    auto result = allocConstant(std::move(value));
+    internedConstants.insert(result);
+    return result;
+}
+
+Expression* Compilation::getCachedIntLiteral(int32_t value) const {
+    if (auto slot = commonConstantSlot(value))
+        return cachedIntLiterals[*slot];
+    return nullptr;
+}
+
+void Compilation::cacheIntLiteral(int32_t value, Expression& expr) {
+    if (auto slot = commonConstantSlot(value))
+        cachedIntLiterals[*slot] = &expr;
+}
+
+const PortConnectionShape* Compilation::getCachedPortConnectionShapes(
+    const Scope& scope, const syntax::SyntaxNode& syntax) const {
+    if (auto it = portConnShapeCache.find({&scope, &syntax}); it != portConnShapeCache.end())
+        return it->second;
+    return nullptr;
+}
+
+void Compilation::cachePortConnectionShapes(const Scope& scope, const syntax::SyntaxNode& syntax,
+                                            const PortConnectionShape* shapes) {
+    portConnShapeCache.emplace(std::make_tuple(&scope, &syntax), shapes);
+}
+
+const Expression* Compilation::getCachedAssertionInstance(const Symbol& symbol) const {
+    if (auto it = assertionInstanceCache.find(&symbol); it != assertionInstanceCache.end())
+        return it->second;
+    return nullptr;
+}
+
+void Compilation::cacheAssertionInstance(const Symbol& symbol, const Expression& expr) {
+    assertionInstanceCache.emplace(&symbol, &expr);
+}
+
 void Compilation::forceElaborate(const Symbol& symbol) {
+    // Callers (notably parallel AST serialization) depend on everything
+    // underneath actually being elaborated when this returns, so the dedup
+    // shortcuts that are fine for pure diagnostic walks are disabled here.
     DiagnosticVisitor visitor(*this, numErrors,
-                              options.errorLimit == 0 ? UINT32_MAX : options.errorLimit);
+                              options.errorLimit == 0 ? UINT32_MAX : options.errorLimit,
+                              /* visitAll */ true);
     symbol.visit(visitor);
 }
 
+Compilation::MemoryStats Compilation::getMemoryStats() const {
+    MemoryStats stats;
+    stats.ast = BumpAllocator::getStats();
+    stats.symbolMaps = symbolMapAllocator.getStats();
+    stats.pointerMaps = pointerMapAllocator.getStats();
+    stats.constants = constantAllocator.getStats();
+    stats.genericClasses = genericClassAllocator.getStats();
+
+    for (auto& tree : syntaxTrees)
+        stats.syntax += tree->allocator().getStats();
+
+    return stats;
+}
+
 const Type& Compilation::getType(SyntaxKind typeKind) const {
     auto it = knownTypes.find(typeKind);
     return it == knownTypes.end() ? *errorType : *it->second;
@@ -1144,12 +1670,68 @@ const Type& Compilation::getType(bitwidth_t width, bitmask<IntegralFlags> flags)
     if (it != vectorTypeCache.end())
         return *it->second;
 
-    auto type = emplace<PackedArrayType>(getScalarType(flags), ConstantRange{int32_t(width - 1), 0},
-                                         width);
-    vectorTypeCache.emplace_hint(it, key, type);
+    auto& type = getPackedArrayType(getScalarType(flags), ConstantRange{int32_t(width - 1), 0},
+                                    width);
+    vectorTypeCache.emplace_hint(it, key, &type);
+    return type;
+}
+
+const Type& Compilation::getPackedArrayType(const Type& elementType, ConstantRange range,
+                                            bitwidth_t fullWidth) {
+    auto key = std::make_tuple(&elementType, range.left, range.right);
+    auto it = packedArrayCache.find(key);
+    if (it != packedArrayCache.end())
+        return *it->second;
+
+    auto type = emplace<PackedArrayType>(elementType, range, fullWidth);
+    packedArrayCache.emplace_hint(it, key, type);
     return *type;
 }
 
+const Type& Compilation::getVirtualInterfaceType(const InstanceSymbol& iface,
+                                                 const ModportSymbol* modport, bool isRealIface,
+                                                 SourceLocation loc) {
+    auto key = std::make_tuple(&iface, modport, isRealIface);
+    auto it = virtualIfaceTypeCache.find(key);
+    if (it != virtualIfaceTypeCache.end())
+        return *it->second;
+
+    auto type = emplace<VirtualInterfaceType>(iface, modport, isRealIface, loc);
+    virtualIfaceTypeCache.emplace_hint(it, key, type);
+    return *type;
+}
+
+Compilation::TypeCompat Compilation::getTypeCompat(const Type& targetType,
+                                                   const Type& sourceType) {
+    auto tc = &targetType.getCanonicalType();
+    auto sc = &sourceType.getCanonicalType();
+    if (tc == sc)
+        return {true, true};
+
+    auto key = std::make_tuple(tc, sc);
+    auto it = typeCompatCache.find(key);
+    if (it != typeCompatCache.end())
+        return it->second;
+
+    TypeCompat result;
+    result.isEquivalent = targetType.isEquivalent(sourceType);
+    result.isAssignmentCompatible = result.isEquivalent ||
+                                    targetType.isAssignmentCompatible(sourceType);
+
+    typeCompatCache.emplace_hint(it, key, result);
+    return result;
+}
+
+const NormalizedConstraintSet& Compilation::getNormalizedConstraints(const ClassType& classType) {
+    auto it = normalizedConstraintCache.find(&classType);
+    if (it != normalizedConstraintCache.end())
+        return *it->second;
+
+    auto& result = NormalizedConstraintSet::compute(*this, classType);
+    normalizedConstraintCache.emplace_hint(it, &classType, &result);
+    return result;
+}
+
 const Type& Compilation::getScalarType(bitmask<IntegralFlags> flags) {
     Type* ptr = scalarTypeTable[flags.bits() & 0x7];
     ASSERT(ptr);
@@ -1692,6 +2274,54 @@ void Compilation::resolveDefParamsAndBinds() {
         }
     };
 
+    // Checks whether the set of defparams we just collected is order independent;
+    // that is, whether no defparam can change the value or the resolved target of
+    // any other defparam. Parameter overrides only propagate downward through the
+    // hierarchy, so a defparam's value can change only if some other defparam
+    // targets an instance enclosing the defparam itself, and its target can
+    // resolve differently only if some defparam targets an instance along the
+    // path to that target. When neither holds, the values from the initial
+    // elaboration pass are already final and the fixpoint loop below can be
+    // skipped along with its full re-elaborations of the design.
+    auto isOrderIndependent = [&](const DefParamVisitor& visitor) {
+        // Intern every path in a shared trie; ancestor prefixes are stored
+        // once and "is any prefix of this path a target" becomes a walk up
+        // the parent chain with pointer-based set lookups.
+        InstancePathTrie trie;
+        flat_hash_set<const InstancePathTrie::Node*> targetNodes;
+        for (auto& entry : overrides) {
+            // If any target failed to resolve we can't reason about what
+            // might affect it, so conservatively assume a dependency.
+            if (!entry.targetSyntax)
+                return false;
+
+            targetNodes.emplace(trie.insert(entry.path));
+        }
+
+        auto anyPrefixTargeted = [&](const InstancePathTrie::Node* node) {
+            for (; node; node = node->parent) {
+                if (targetNodes.count(node))
+                    return true;
+            }
+            return false;
+        };
+
+        for (size_t i = 0; i < overrides.size(); i++) {
+            // Another defparam targeting an instance that encloses this one
+            // (or the instance containing it) can change the parameters its
+            // value expression is evaluated against.
+            InstancePath sitePath(*visitor.found[i]);
+            if (anyPrefixTargeted(trie.insert(sitePath)))
+                return false;
+
+            // A defparam targeting an instance along the path to this one's
+            // target can reshape the hierarchy the target name resolves through.
+            if (anyPrefixTargeted(trie.insert(overrides[i].path)->parent))
+                return false;
+        }
+        return true;
+    };
+
     auto checkProblem = [&](const DefParamVisitor& visitor) {
         if (visitor.hierarchyProblem) {
             auto& diag = root->addDiag(diag::MaxInstanceDepthExceeded,
@@ -1735,9 +2365,12 @@ void Compilation::resolveDefParamsAndBinds() {
         // defparams can change the value of parameters, further affecting the value of
         // other defparams elsewhere in the design. This means we need to iterate,
         // reevaluating defparams until they all settle to a stable value or until we
-        // give up due to the potential of cyclical references.
+        // give up due to the potential of cyclical references. In the common case
+        // of netlists full of mutually independent defparams we can prove up front
+        // that no reevaluation is needed and skip the iteration entirely.
         bool allSame = true;
-        for (uint32_t i = 0; i < options.maxDefParamSteps; i++) {
+        const bool orderIndependent = isOrderIndependent(initialVisitor);
+        for (uint32_t i = 0; !orderIndependent && i < options.maxDefParamSteps; i++) {
             Compilation c;
             cloneInto(c);
 
@@ -502,4 +502,277 @@ void ForeachConstraint::serializeTo(ASTSerializer& serializer) const {
     serializer.write("body", body);
 }
 
+static std::optional<NormalizedRelOp> normalizeRelOp(BinaryOperator op, bool& swapOperands) {
+    swapOperands = false;
+    switch (op) {
+        case BinaryOperator::Equality:
+            return NormalizedRelOp::Equal;
+        case BinaryOperator::Inequality:
+            return NormalizedRelOp::NotEqual;
+        case BinaryOperator::LessThan:
+            return NormalizedRelOp::LessThan;
+        case BinaryOperator::LessThanEqual:
+            return NormalizedRelOp::LessThanEqual;
+        case BinaryOperator::GreaterThan:
+            swapOperands = true;
+            return NormalizedRelOp::LessThan;
+        case BinaryOperator::GreaterThanEqual:
+            swapOperands = true;
+            return NormalizedRelOp::LessThanEqual;
+        default:
+            return std::nullopt;
+    }
+}
+
+namespace {
+
+// Collects the random class properties referenced by an expression or
+// constraint; this forms the support set used for partitioning.
+struct SupportCollector : public ASTVisitor<SupportCollector, false, true> {
+    SmallVector<const ClassPropertySymbol*, 4> symbols;
+
+    void handle(const NamedValueExpression& expr) { add(expr.symbol); }
+
+    void handle(const MemberAccessExpression& expr) {
+        add(expr.member);
+        visitDefault(expr);
+    }
+
+    void add(const Symbol& symbol) {
+        if (symbol.kind != SymbolKind::ClassProperty)
+            return;
+
+        auto& prop = symbol.as<ClassPropertySymbol>();
+        if (prop.randMode == RandMode::None)
+            return;
+
+        if (std::ranges::find(symbols, &prop) == symbols.end())
+            symbols.push_back(&prop);
+    }
+};
+
+// Walks bound constraints and flattens them into normalized terms,
+// threading the active guard stack from implications and conditionals.
+struct ConstraintNormalizer {
+    Compilation& comp;
+    SmallVector<NormalizedConstraint, 8> terms;
+    SmallVector<NormalizedConstraint::Guard, 4> guards;
+    SmallVector<const SolveBeforeConstraint*, 2> solveBefore;
+    SmallVector<const DisableSoftConstraint*, 2> disableSoft;
+
+    explicit ConstraintNormalizer(Compilation& comp) : comp(comp) {}
+
+    void addConstraint(const Constraint& constraint) {
+        switch (constraint.kind) {
+            case ConstraintKind::Invalid:
+                break;
+            case ConstraintKind::List:
+                for (auto item : constraint.as<ConstraintList>().list)
+                    addConstraint(*item);
+                break;
+            case ConstraintKind::Expression: {
+                auto& ec = constraint.as<ExpressionConstraint>();
+                addExpr(ec.expr, ec.isSoft);
+                break;
+            }
+            case ConstraintKind::Implication: {
+                auto& ic = constraint.as<ImplicationConstraint>();
+                guards.push_back({&ic.predicate, false});
+                addConstraint(ic.body);
+                guards.pop_back();
+                break;
+            }
+            case ConstraintKind::Conditional: {
+                auto& cc = constraint.as<ConditionalConstraint>();
+                guards.push_back({&cc.predicate, false});
+                addConstraint(cc.ifBody);
+                guards.pop_back();
+
+                if (cc.elseBody) {
+                    guards.push_back({&cc.predicate, true});
+                    addConstraint(*cc.elseBody);
+                    guards.pop_back();
+                }
+                break;
+            }
+            case ConstraintKind::Uniqueness: {
+                NormalizedConstraint term{NormalizedConstraint::Unique};
+                term.items = constraint.as<UniquenessConstraint>().items;
+                finishTerm(term);
+                break;
+            }
+            case ConstraintKind::DisableSoft:
+                disableSoft.push_back(&constraint.as<DisableSoftConstraint>());
+                break;
+            case ConstraintKind::SolveBefore:
+                solveBefore.push_back(&constraint.as<SolveBeforeConstraint>());
+                break;
+            default: {
+                NormalizedConstraint term{NormalizedConstraint::Opaque};
+                term.opaque = &constraint;
+                finishTerm(term);
+                break;
+            }
+        }
+    }
+
+    void addExpr(const Expression& expr, bool isSoft) {
+        if (expr.bad())
+            return;
+
+        if (expr.kind == ExpressionKind::BinaryOp) {
+            auto& bin = expr.as<BinaryExpression>();
+
+            // Conjunctions flatten into separate terms.
+            if (bin.op == BinaryOperator::LogicalAnd) {
+                addExpr(bin.left(), isSoft);
+                addExpr(bin.right(), isSoft);
+                return;
+            }
+
+            bool swap;
+            if (auto relOp = normalizeRelOp(bin.op, swap)) {
+                NormalizedConstraint term{NormalizedConstraint::Relation};
+                term.relOp = *relOp;
+                term.left = swap ? &bin.right() : &bin.left();
+                term.right = swap ? &bin.left() : &bin.right();
+                term.isSoft = isSoft;
+                finishTerm(term);
+                return;
+            }
+        }
+        else if (expr.kind == ExpressionKind::Inside) {
+            if (tryMembership(expr.as<InsideExpression>(), isSoft))
+                return;
+        }
+
+        NormalizedConstraint term{NormalizedConstraint::Truth};
+        term.left = &expr;
+        term.isSoft = isSoft;
+        finishTerm(term);
+    }
+
+    bool tryMembership(const InsideExpression& inside, bool isSoft) {
+        // Range lists only normalize to intervals when every element is a
+        // constant integer; otherwise the whole expression stays behind as
+        // a truth term.
+        EvalContext evalCtx(comp);
+        SmallVector<NormalizedConstraint::Interval, 4> intervals;
+
+        auto evalBound = [&](const Expression& expr) -> const ConstantValue* {
+            ConstantValue cv = expr.eval(evalCtx);
+            if (!cv.isInteger())
+                return nullptr;
+            return comp.allocConstant(std::move(cv));
+        };
+
+        for (auto elem : inside.rangeList()) {
+            if (elem->kind == ExpressionKind::OpenRange) {
+                auto& range = elem->as<OpenRangeExpression>();
+                auto low = evalBound(range.left());
+                auto high = evalBound(range.right());
+                if (!low || !high)
+                    return false;
+
+                intervals.push_back({low, high});
+            }
+            else {
+                auto val = evalBound(*elem);
+                if (!val)
+                    return false;
+
+                intervals.push_back({val, val});
+            }
+        }
+
+        NormalizedConstraint term{NormalizedConstraint::Membership};
+        term.left = &inside.left();
+        term.intervals = intervals.copy(comp);
+        term.isSoft = isSoft;
+        finishTerm(term);
+        return true;
+    }
+
+    void finishTerm(NormalizedConstraint& term) {
+        term.guards = guards.copy(comp);
+
+        SupportCollector collector;
+        if (term.left)
+            term.left->visit(collector);
+        if (term.right)
+            term.right->visit(collector);
+        for (auto item : term.items)
+            item->visit(collector);
+        if (term.opaque)
+            term.opaque->visit(collector);
+        for (auto& guard : term.guards)
+            guard.condition->visit(collector);
+
+        term.support = collector.symbols.copy(comp);
+        terms.push_back(term);
+    }
+};
+
+} // namespace
+
+const NormalizedConstraintSet& NormalizedConstraintSet::compute(Compilation& comp,
+                                                                const ClassType& classType) {
+    ConstraintNormalizer normalizer(comp);
+
+    // Collect constraint blocks from the class and its base classes;
+    // a derived block overrides a base block of the same name.
+    SmallSet<std::string_view, 4> seenNames;
+    const Type* type = &classType;
+    while (type && type->isClass()) {
+        auto& ct = type->getCanonicalType().as<ClassType>();
+        for (auto& block : ct.membersOfType<ConstraintBlockSymbol>()) {
+            if (block.name.empty() || seenNames.emplace(block.name).second)
+                normalizer.addConstraint(block.getConstraints());
+        }
+        type = ct.getBaseClass();
+    }
+
+    // Group terms into independent partitions: union-find over term
+    // indices, uniting terms that share a support variable.
+    auto& terms = normalizer.terms;
+    SmallVector<uint32_t> parent;
+    for (uint32_t i = 0; i < terms.size(); i++)
+        parent.push_back(i);
+
+    auto find = [&](uint32_t x) {
+        while (parent[x] != x)
+            x = parent[x] = parent[parent[x]];
+        return x;
+    };
+
+    SmallMap<const ClassPropertySymbol*, uint32_t, 8> firstUse;
+    for (uint32_t i = 0; i < terms.size(); i++) {
+        for (auto prop : terms[i].support) {
+            auto [it, inserted] = firstUse.emplace(prop, i);
+            if (!inserted) {
+                uint32_t a = find(i);
+                uint32_t b = find(it->second);
+                if (a != b)
+                    parent[b] = a;
+            }
+        }
+    }
+
+    SmallMap<uint32_t, uint32_t, 8> rootIds;
+    uint32_t partitionCount = 0;
+    for (uint32_t i = 0; i < terms.size(); i++) {
+        auto [it, inserted] = rootIds.emplace(find(i), partitionCount);
+        if (inserted)
+            partitionCount++;
+        terms[i].partition = it->second;
+    }
+
+    auto result = comp.emplace<NormalizedConstraintSet>();
+    result->terms = terms.copy(comp);
+    result->partitionCount = partitionCount;
+    result->solveBefore = normalizer.solveBefore.copy(comp);
+    result->disableSoft = normalizer.disableSoft.copy(comp);
+    return *result;
+}
+
 } // namespace slang::ast
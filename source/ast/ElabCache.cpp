@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+// ElabCache.cpp
+// Cross-run cache of elaboration results for canonical instance bodies
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/ElabCache.h"
+
+#include <algorithm>
+#include <ankerl/unordered_dense.h>
+#include <cinttypes>
+#include <fstream>
+
+#include "slang/ast/Compilation.h"
+#include "slang/ast/Definition.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
+#include "slang/ast/symbols/ParameterSymbols.h"
+#include "slang/ast/types/Type.h"
+#include "slang/syntax/AllSyntax.h"
+#include "slang/syntax/SyntaxPrinter.h"
+#include "slang/syntax/SyntaxVisitor.h"
+#include "slang/util/OS.h"
+
+namespace slang::ast {
+
+using namespace syntax;
+
+static constexpr std::string_view ElabCacheHeader = "slang-elabcache v1"sv;
+
+namespace {
+
+uint64_t hashText(std::string_view text) {
+    return ankerl::unordered_dense::detail::wyhash::hash(text.data(), text.size());
+}
+
+uint64_t hashSyntax(const SyntaxNode& node) {
+    SyntaxPrinter printer;
+    printer.setIncludeDirectives(true);
+    printer.print(node);
+    return hashText(printer.str());
+}
+
+// Collects the names of every definition a module's syntax can reference:
+// module / interface / program instantiations and interface port headers.
+// Names that don't resolve to a definition still get folded into the hash,
+// so a previously missing module appearing changes the fingerprint too.
+struct ReferencedNameCollector : public SyntaxVisitor<ReferencedNameCollector> {
+    std::vector<std::string_view> names;
+
+    void handle(const HierarchyInstantiationSyntax& node) {
+        names.push_back(node.type.valueText());
+        visitDefault(node);
+    }
+
+    void handle(const InterfacePortHeaderSyntax& node) {
+        names.push_back(node.nameOrKeyword.valueText());
+        visitDefault(node);
+    }
+};
+
+} // namespace
+
+std::shared_ptr<ElabCache> ElabCache::open(const std::filesystem::path& path) {
+    std::shared_ptr<ElabCache> result(new ElabCache(path));
+
+    std::vector<char> contents;
+    if (!OS::readFile(path, contents))
+        return result;
+
+    std::string_view data(contents.data(), contents.size() - 1);
+    if (!data.starts_with(ElabCacheHeader))
+        return result;
+    data.remove_prefix(ElabCacheHeader.size());
+
+    while (!data.empty()) {
+        if (data[0] == '\n') {
+            data.remove_prefix(1);
+            continue;
+        }
+
+        size_t end = data.find('\n');
+        auto line = data.substr(0, end);
+        data.remove_prefix(end == std::string_view::npos ? data.size() : end + 1);
+
+        uint64_t value;
+        if (sscanf(std::string(line).c_str(), "%" SCNx64, &value) != 1) {
+            // A malformed entry means the file was truncated or corrupted;
+            // drop everything rather than trusting a partial read.
+            result->entries.clear();
+            return result;
+        }
+        result->entries.insert(value);
+    }
+
+    return result;
+}
+
+uint64_t ElabCache::fingerprint(const InstanceBodySymbol& body) {
+    size_t seed = (size_t)getDefinitionHash(body.getDefinition());
+    hash_combine(seed, getSalt(body.getCompilation()));
+
+    for (auto param : body.parameters) {
+        auto& sym = param->symbol;
+        hash_combine(seed, (int)sym.kind);
+        if (sym.kind == SymbolKind::Parameter)
+            hash_combine(seed, sym.as<ParameterSymbol>().getValue().toString());
+        else
+            hash_combine(seed, sym.as<TypeParameterSymbol>().targetType.getType().toString());
+    }
+
+    return seed;
+}
+
+bool ElabCache::isKnownClean(uint64_t fingerprint) const {
+    if (entries.find(fingerprint) == entries.end())
+        return false;
+
+    numHits++;
+    return true;
+}
+
+void ElabCache::noteClean(uint64_t fingerprint) {
+    entries.insert(fingerprint);
+}
+
+bool ElabCache::save() const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    file << ElabCacheHeader << '\n' << std::hex;
+    for (auto entry : entries)
+        file << entry << '\n';
+
+    file.flush();
+    return file.good();
+}
+
+uint64_t ElabCache::getDefinitionHash(const Definition& definition) {
+    // A zero placeholder marks a definition whose hash is being computed
+    // further up the stack; recursive instantiations fold in the referenced
+    // name only, which every participant in the cycle does symmetrically.
+    auto [it, inserted] = definitionHashes.emplace(&definition, 0);
+    if (!inserted)
+        return it->second;
+
+    size_t seed = (size_t)hashSyntax(definition.syntax);
+
+    ReferencedNameCollector collector;
+    definition.syntax.visit(collector);
+
+    auto& names = collector.names;
+    std::ranges::sort(names);
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    auto& comp = definition.scope.getCompilation();
+    for (auto name : names) {
+        hash_combine(seed, name);
+        if (auto child = comp.getDefinition(name, definition.scope); child && child != &definition)
+            hash_combine(seed, getDefinitionHash(*child));
+    }
+
+    // The map may have rehashed during recursion; don't reuse the iterator.
+    definitionHashes[&definition] = seed;
+    return seed;
+}
+
+uint64_t ElabCache::getSalt(const Compilation& compilation) {
+    auto [it, inserted] = saltCache.emplace(&compilation, 0);
+    if (!inserted)
+        return it->second;
+
+    // Packages have no defined iteration order, so combine their content
+    // hashes in an order-independent way.
+    uint64_t salt = 0;
+    for (auto package : compilation.getPackages()) {
+        if (auto syntax = package->getSyntax())
+            salt ^= hashSyntax(*syntax);
+    }
+
+    saltCache[&compilation] = salt;
+    return salt;
+}
+
+} // namespace slang::ast
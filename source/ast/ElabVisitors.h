@@ -8,8 +8,11 @@
 #pragma once
 
 #include "slang/ast/ASTVisitor.h"
+#include "slang/ast/ElabCache.h"
 #include "slang/diagnostics/CompilationDiags.h"
 #include "slang/diagnostics/DeclarationsDiags.h"
+#include "slang/syntax/AllSyntax.h"
+#include "slang/syntax/SyntaxTree.h"
 #include "slang/util/StackContainer.h"
 #include "slang/util/TimeTrace.h"
 
@@ -19,9 +22,21 @@ using namespace syntax;
 
 // This visitor is used to touch every node in the AST to ensure that all lazily
 // evaluated members have been realized and we have recorded every diagnostic.
+//
+// Note that despite being a "read-only" traversal from the caller's point of
+// view, this pass is what actually performs most of elaboration: every lazy
+// member it touches is resolved into the Compilation's shared allocator and
+// caches. It must therefore run on a single thread; see the threading notes
+// in the developer docs.
 struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
-    DiagnosticVisitor(Compilation& compilation, const size_t& numErrors, uint32_t errorLimit) :
-        compilation(compilation), numErrors(numErrors), errorLimit(errorLimit) {}
+    /// @a visitAll disables the dedup / cache shortcuts that let the normal
+    /// diagnostic walk skip provably redundant bodies. Compilation::forceElaborate
+    /// sets it because its callers rely on every symbol underneath actually
+    /// being elaborated afterward, not just diagnosed.
+    DiagnosticVisitor(Compilation& compilation, const size_t& numErrors, uint32_t errorLimit,
+                      bool visitAll = false) :
+        compilation(compilation), numErrors(numErrors), errorLimit(errorLimit),
+        visitAll(visitAll) {}
 
     template<typename T>
     void handle(const T& symbol) {
@@ -160,6 +175,13 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
     }
 
     void handle(const CovergroupType& symbol) {
+        // Covergroup internals are only ever diagnosed from this pass; nothing
+        // else in elaboration reads them. If the user has opted out of coverage
+        // checking don't descend into the body at all, which avoids binding
+        // every coverpoint, bin, and cross in the design.
+        if (compilation.getOptions().skipCoverageChecks)
+            return;
+
         if (!handleDefault(symbol))
             return;
 
@@ -236,6 +258,11 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         if (numErrors > errorLimit || hierarchyProblem)
             return;
 
+        // The diagnostic pass visits fully elaborated scopes without expanding
+        // them again, so it needs its own per-instance cancellation check.
+        compilation.getOptions().cancellationToken.throwIfCancelled();
+        compilation.noteInstanceChecked();
+
         TimeTraceScope timeScope("AST Instance", [&] {
             std::string buffer;
             symbol.getHierarchicalPath(buffer);
@@ -276,10 +303,112 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
             return;
         }
 
+        // Elements of an instance array all share one piece of syntax and,
+        // unless a defparam or bind targeted a specific element, have
+        // identical bodies. The first element visited acts as a template for
+        // its siblings: any later element whose parameter values match it
+        // skips the body walk entirely. This is only sound for bodies that
+        // can't reference names outside themselves: skipping the walk also
+        // skips ValueDriver registration, and a body that drives something
+        // through a hierarchical or upward name contributes one driver per
+        // element, not just duplicate diagnostics. Port connections were
+        // already checked per element above, because they can slice
+        // differently across the array.
+        if (!visitAll && !compilation.getOptions().disableInstanceArrayDedup &&
+            !symbol.arrayPath.empty() && !symbol.body.hierarchyOverrideNode &&
+            !symbol.body.isFromBind && !mayReferenceOutside(symbol.body.getDefinition())) {
+            if (auto syntax = symbol.getSyntax()) {
+                auto [it, inserted] = elaboratedArrayElements.emplace(syntax, &symbol.body);
+                if (!inserted && it->second->hasSameType(symbol.body))
+                    return;
+            }
+        }
+
+        // Cross-run reuse: when a persistent elaboration cache is attached,
+        // a body whose fingerprint is recorded as having elaborated cleanly
+        // before skips the walk the same way identical array elements do
+        // above. Ports and connections were already checked at this call
+        // site, so only body-internal work is elided. Defparams and binds
+        // reach inside bodies from the outside, and interface ports make a
+        // body's meaning depend on what got connected, so those cases are
+        // always walked. Bodies that can reference names outside themselves
+        // are never cached: their drivers land on symbols the fingerprint
+        // doesn't cover, so a stale entry could hide a multi-driver error
+        // introduced by an edit elsewhere in the design.
+        if (auto& cache = compilation.getOptions().elabCache;
+            cache && !visitAll && !anyDefParamsOrBinds() && !symbol.body.hierarchyOverrideNode &&
+            !symbol.body.isFromBind && !mayReferenceOutside(symbol.body.getDefinition())) {
+
+            bool cacheable = true;
+            for (auto port : symbol.body.getPortList()) {
+                if (port->kind == SymbolKind::InterfacePort) {
+                    cacheable = false;
+                    break;
+                }
+            }
+
+            if (cacheable) {
+                uint64_t fp = cache->fingerprint(symbol.body);
+                if (cache->isKnownClean(fp))
+                    return;
+
+                size_t diagsBefore = compilation.getDistinctDiagnosticCount();
+                visit(symbol.body);
+                if (!hierarchyProblem && compilation.getDistinctDiagnosticCount() == diagsBefore)
+                    cache->noteClean(fp);
+                return;
+            }
+        }
+
         visit(symbol.body);
     }
 
+    void handle(const GenerateBlockArraySymbol& symbol) {
+        if (numErrors > errorLimit || hierarchyProblem)
+            return;
+
+        for (auto attr : compilation.getAttributes(symbol))
+            attr->getValue();
+
+        // A loop generate whose body never references the genvar produces
+        // identical entries, so checking the first one covers them all, just
+        // like the instance array case above. Defparams and binds can still
+        // reach inside individual entries and make them differ, so the
+        // sharing is off whenever the design contains any. It's also off
+        // when the entries can register value drivers: unlike an instance
+        // body, a plain name inside a generate entry can resolve to a
+        // symbol outside the block, and N entries driving one module
+        // variable is a multi-driver error that checking a single entry
+        // can't see. Genvar independence says the entries look alike, not
+        // that their effects are idempotent.
+        if (!visitAll && symbol.genvarIndependent &&
+            !compilation.getOptions().disableGenerateArrayDedup && !anyDefParamsOrBinds() &&
+            !entriesMayRegisterDrivers(symbol)) {
+            if (!symbol.entries.empty())
+                symbol.entries[0]->visit(*this);
+            return;
+        }
+
+        visitDefault(symbol);
+    }
+
     void handle(const SubroutineSymbol& symbol) {
+        // When deferring class method bodies, check only the signature of
+        // methods that nothing has bound so far; the body still binds on
+        // demand if a later constant eval or script call needs it.
+        if (compilation.getOptions().deferClassMethodBodies && !symbol.isBodyBound() &&
+            symbol.getParentScope()->asSymbol().kind == SymbolKind::ClassType) {
+            for (auto attr : compilation.getAttributes(symbol))
+                attr->getValue();
+
+            symbol.getReturnType();
+            for (auto arg : symbol.getArguments()) {
+                arg->getType();
+                arg->getInitializer();
+            }
+            return;
+        }
+
         if (!handleDefault(symbol))
             return;
 
@@ -385,12 +514,152 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         }
     }
 
+    // Recursively checks the given syntax for names that can resolve outside
+    // the enclosing definition: scoped / dotted names and package imports.
+    // Member accesses like s.field parse as scoped names too, so this is
+    // deliberately over-approximate. Names instantiated by the syntax are
+    // collected along the way so callers can extend the scan transitively.
+    static bool scanForOutsideRefs(const SyntaxNode& node,
+                                   SmallVector<std::string_view>& instNames) {
+        switch (node.kind) {
+            case SyntaxKind::ScopedName:
+            case SyntaxKind::PackageImportDeclaration:
+                return true;
+            case SyntaxKind::HierarchyInstantiation:
+                // Record the target and keep scanning; the port connections
+                // can themselves contain hierarchical names.
+                instNames.push_back(node.as<HierarchyInstantiationSyntax>().type.valueText());
+                break;
+            default:
+                break;
+        }
+
+        size_t count = node.getChildCount();
+        for (size_t i = 0; i < count; i++) {
+            if (auto child = node.childNode(i); child && scanForOutsideRefs(*child, instNames))
+                return true;
+        }
+        return false;
+    }
+
+    // Conservative scan for constructs that can register value drivers:
+    // procedural blocks, continuous assigns, net aliases, and any kind of
+    // instantiation (whose port connections can drive outward), plus the
+    // scoped names and imports from scanForOutsideRefs. Used to decide
+    // whether generate loop entries are safe to share.
+    static bool containsDriverConstructs(const SyntaxNode& node) {
+        switch (node.kind) {
+            case SyntaxKind::AlwaysBlock:
+            case SyntaxKind::AlwaysCombBlock:
+            case SyntaxKind::AlwaysFFBlock:
+            case SyntaxKind::AlwaysLatchBlock:
+            case SyntaxKind::InitialBlock:
+            case SyntaxKind::FinalBlock:
+            case SyntaxKind::ContinuousAssign:
+            case SyntaxKind::NetAlias:
+            case SyntaxKind::HierarchyInstantiation:
+            case SyntaxKind::PrimitiveInstantiation:
+            case SyntaxKind::CheckerInstantiation:
+            case SyntaxKind::ScopedName:
+            case SyntaxKind::PackageImportDeclaration:
+                return true;
+            default:
+                break;
+        }
+
+        size_t count = node.getChildCount();
+        for (size_t i = 0; i < count; i++) {
+            if (auto child = node.childNode(i); child && containsDriverConstructs(*child))
+                return true;
+        }
+        return false;
+    }
+
+    bool entriesMayRegisterDrivers(const GenerateBlockArraySymbol& symbol) {
+        auto syntax = symbol.getSyntax();
+        if (!syntax)
+            return true;
+
+        auto [it, inserted] = driverScanVerdicts.emplace(syntax, false);
+        if (inserted)
+            it->second = containsDriverConstructs(*syntax);
+        return it->second;
+    }
+
+    // Conservative verdict for whether instances of the given definition can
+    // reference names outside their own body: true if the definition's
+    // syntax, or that of any definition it transitively instantiates,
+    // contains a scoped / hierarchical name or a package import, or if
+    // plain unqualified names can escape the body through the lexical
+    // scope chain. Such bodies register value drivers on symbols elsewhere
+    // in the design, so skipping their elaboration loses more than
+    // duplicate diagnostics.
+    bool mayReferenceOutside(const Definition& definition) {
+        // A false placeholder breaks recursive instantiation cycles; the
+        // recursion itself gets diagnosed by the instance depth checks.
+        auto [it, inserted] = outsideRefVerdicts.emplace(&definition, false);
+        if (!inserted)
+            return it->second;
+
+        // A definition nested inside another one resolves plain names
+        // upward into the enclosing body, and a root definition can resolve
+        // them against $unit declarations in its compilation unit. Packages
+        // and primitives live in their own namespaces and are reachable
+        // only through scoped names, which the syntax scan already flags.
+        bool result = definition.scope.asSymbol().kind != SymbolKind::CompilationUnit;
+        if (!result) {
+            for (auto& member : definition.scope.members()) {
+                if (member.kind != SymbolKind::Package && member.kind != SymbolKind::Primitive &&
+                    member.kind != SymbolKind::EmptyMember) {
+                    result = true;
+                    break;
+                }
+            }
+        }
+
+        SmallVector<std::string_view> instNames;
+        if (!result)
+            result = scanForOutsideRefs(definition.syntax, instNames);
+        if (!result) {
+            for (auto name : instNames) {
+                auto child = compilation.getDefinition(name, definition.scope);
+                if (child && child != &definition && mayReferenceOutside(*child)) {
+                    result = true;
+                    break;
+                }
+            }
+        }
+
+        // The map may have rehashed during recursion; don't reuse the iterator.
+        outsideRefVerdicts[&definition] = result;
+        return result;
+    }
+
+    bool anyDefParamsOrBinds() {
+        if (!hasDefParamsOrBinds.has_value()) {
+            hasDefParamsOrBinds = false;
+            for (auto& tree : compilation.getSyntaxTrees()) {
+                auto& meta = tree->getMetadata();
+                if (meta.hasDefparams || meta.hasBindDirectives) {
+                    hasDefParamsOrBinds = true;
+                    break;
+                }
+            }
+        }
+        return *hasDefParamsOrBinds;
+    }
+
     Compilation& compilation;
     const size_t& numErrors;
     uint32_t errorLimit;
+    bool visitAll = false;
     bool hierarchyProblem = false;
+    std::optional<bool> hasDefParamsOrBinds;
     flat_hash_map<const Definition*, size_t> instanceCount;
     flat_hash_set<const InstanceBodySymbol*> activeInstanceBodies;
+    flat_hash_map<const syntax::SyntaxNode*, const InstanceBodySymbol*> elaboratedArrayElements;
+    flat_hash_map<const Definition*, bool> outsideRefVerdicts;
+    flat_hash_map<const syntax::SyntaxNode*, bool> driverScanVerdicts;
     flat_hash_set<const Definition*> usedIfacePorts;
     SmallVector<const GenericClassDefSymbol*> genericClasses;
     SmallVector<const SubroutineSymbol*> dpiImports;
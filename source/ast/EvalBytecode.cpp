@@ -0,0 +1,1073 @@
+//------------------------------------------------------------------------------
+// EvalBytecode.cpp
+// Compiled bytecode form of constant function bodies
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/EvalBytecode.h"
+
+#include "slang/ast/EvalContext.h"
+#include "slang/ast/Statements.h"
+#include "slang/ast/expressions/AssignmentExpressions.h"
+#include "slang/ast/expressions/LiteralExpressions.h"
+#include "slang/ast/expressions/MiscExpressions.h"
+#include "slang/ast/expressions/OperatorExpressions.h"
+#include "slang/ast/symbols/SubroutineSymbols.h"
+#include "slang/ast/symbols/VariableSymbols.h"
+#include "slang/ast/types/Type.h"
+#include "slang/diagnostics/NumericDiags.h"
+#include "slang/util/Hash.h"
+#include "slang/util/SmallVector.h"
+
+namespace slang::ast {
+
+struct EvalBytecode::Instr {
+    enum class Opcode : uint8_t {
+        /// Counts one statement against the context's step limit,
+        /// mirroring Statement::eval.
+        Step,
+
+        /// dst = constants[a]
+        Const,
+
+        /// dst = regs[a]
+        Copy,
+
+        /// dst = expr->eval(context); used for leaf expressions whose value
+        /// doesn't live in a register (parameters, enum values, specparams)
+        /// so that their checking and diagnostics stay in one place.
+        EvalLeaf,
+
+        /// dst = unaryOp applied to regs[a]
+        Unary,
+
+        /// dst = binaryOp applied to regs[a], regs[b]
+        Binary,
+
+        /// dst = binaryOp applied to regs[a], regs[b], where every type
+        /// involved is two-state and at most 64 bits wide; computes with
+        /// native integer arithmetic, skipping unknown handling entirely.
+        /// If an unknown value shows up at runtime anyway the instruction
+        /// promotes itself to the general Binary handling.
+        BinaryTwoState,
+
+        /// dst = old (postfix) or new (prefix) value of regs[a], which is
+        /// incremented or decremented in place
+        IncDec,
+
+        /// dst = regs[a] converted from type 'from' to type 'to'
+        Convert,
+
+        /// dst = SVInt::conditional(regs[c], regs[a], regs[b]); used to merge
+        /// both sides of a ?: whose condition contains unknown bits
+        CondMerge,
+
+        /// pc = target
+        Jump,
+
+        /// pc = target when regs[a] is known true
+        JumpIfTrue,
+
+        /// pc = target when regs[a] is anything other than known true
+        JumpIfNotTrue,
+
+        /// pc = target when regs[a] is known false
+        JumpIfFalse,
+
+        /// dst = loop iteration count computed from regs[a] using the
+        /// repeat statement's range checking rules
+        RepeatInit,
+
+        /// stop execution; the result is the return value register
+        Return
+    };
+
+    Opcode op;
+    UnaryOperator unaryOp;
+    BinaryOperator binaryOp;
+    ConversionKind conversion;
+    uint32_t dst = 0;
+    uint32_t a = 0;
+    uint32_t b = 0;
+    uint32_t c = 0;
+    uint32_t target = 0;
+    const Type* from = nullptr;
+    const Type* to = nullptr;
+    const Expression* expr = nullptr;
+    SourceRange range;
+};
+
+/// Lowers a subroutine body into an EvalBytecode instruction stream.
+/// Each statement and expression kind either compiles exactly (matching the
+/// evaluation order, step counting, and failure behavior of the AST walker)
+/// or causes the whole compilation to bail out.
+class BytecodeCompiler {
+public:
+    explicit BytecodeCompiler(const SubroutineSymbol& subroutine) : subroutine(subroutine) {}
+
+    std::unique_ptr<EvalBytecode> compile() {
+        // Formal arguments occupy the first registers, in declaration order,
+        // so that execute() can copy the evaluated call arguments straight in.
+        for (auto arg : subroutine.getArguments())
+            localRegs[arg] = allocReg();
+
+        code->returnReg = allocReg();
+        localRegs[subroutine.returnValVar] = code->returnReg;
+
+        auto& body = subroutine.getBody();
+        if (body.bad() || !compileStatement(body) || failed)
+            return nullptr;
+
+        emit(OC::Return);
+        return std::move(code);
+    }
+
+private:
+    using Instr = EvalBytecode::Instr;
+    using OC = Instr::Opcode;
+
+    // Cap on emitted instructions; compiling nested conditional operators
+    // duplicates their operands, so pathological inputs could otherwise
+    // explode. Anything this large falls back to the AST walker.
+    static constexpr size_t MaxInstrs = 1 << 16;
+
+    struct LoopFrame {
+        SmallVector<size_t> breakJumps;
+        SmallVector<size_t> continueJumps;
+    };
+
+    uint32_t allocReg() { return code->numRegisters++; }
+    size_t here() const { return code->instrs.size(); }
+    Instr& instr(size_t index) { return code->instrs[index]; }
+
+    size_t emit(OC op) {
+        if (code->instrs.size() >= MaxInstrs)
+            failed = true;
+
+        auto& in = code->instrs.emplace_back();
+        in.op = op;
+        return code->instrs.size() - 1;
+    }
+
+    void emitStep(SourceRange range) { instr(emit(OC::Step)).range = range; }
+
+    void emitCopy(uint32_t dst, uint32_t src) {
+        auto& in = instr(emit(OC::Copy));
+        in.dst = dst;
+        in.a = src;
+    }
+
+    void emitConst(uint32_t dst, ConstantValue&& value) {
+        auto& in = instr(emit(OC::Const));
+        in.dst = dst;
+        in.a = (uint32_t)code->constants.size();
+        code->constants.emplace_back(std::move(value));
+    }
+
+    uint32_t emitConst(ConstantValue&& value) {
+        uint32_t dst = allocReg();
+        emitConst(dst, std::move(value));
+        return dst;
+    }
+
+    uint32_t emitBinary(BinaryOperator op, uint32_t lhs, uint32_t rhs) {
+        uint32_t dst = allocReg();
+        auto& in = instr(emit(OC::Binary));
+        in.binaryOp = op;
+        in.dst = dst;
+        in.a = lhs;
+        in.b = rhs;
+        return dst;
+    }
+
+    size_t emitJump(OC op, uint32_t condReg = 0) {
+        size_t index = emit(op);
+        instr(index).a = condReg;
+        return index;
+    }
+
+    void patch(size_t jumpIndex) { instr(jumpIndex).target = (uint32_t)here(); }
+    void patch(std::span<const size_t> jumps, size_t target) {
+        for (size_t index : jumps)
+            instr(index).target = (uint32_t)target;
+    }
+
+    bool compileStatement(const Statement& stmt) {
+        if (failed || stmt.bad())
+            return false;
+
+        // Statement::eval counts every statement it visits against the step
+        // limit before dispatching, so do the same here.
+        emitStep(stmt.sourceRange);
+
+        switch (stmt.kind) {
+            case StatementKind::Empty:
+                return true;
+            case StatementKind::List: {
+                for (auto item : stmt.as<StatementList>().list) {
+                    if (!compileStatement(*item))
+                        return false;
+                }
+                return true;
+            }
+            case StatementKind::Block: {
+                auto& block = stmt.as<BlockStatement>();
+                if (block.blockKind != StatementBlockKind::Sequential)
+                    return false;
+                return compileStatement(block.body);
+            }
+            case StatementKind::ExpressionStatement:
+                return compileExpression(stmt.as<ExpressionStatement>().expr).has_value();
+            case StatementKind::VariableDeclaration:
+                return compileVariableDecl(stmt.as<VariableDeclStatement>());
+            case StatementKind::Return: {
+                auto& ret = stmt.as<ReturnStatement>();
+                if (ret.expr) {
+                    auto value = compileExpression(*ret.expr);
+                    if (!value)
+                        return false;
+                    emitCopy(code->returnReg, *value);
+                }
+                emit(OC::Return);
+                return true;
+            }
+            case StatementKind::Break:
+                if (loopStack.empty())
+                    return false;
+                loopStack.back().breakJumps.push_back(emitJump(OC::Jump));
+                return true;
+            case StatementKind::Continue:
+                if (loopStack.empty())
+                    return false;
+                loopStack.back().continueJumps.push_back(emitJump(OC::Jump));
+                return true;
+            case StatementKind::Conditional:
+                return compileConditional(stmt.as<ConditionalStatement>());
+            case StatementKind::ForLoop:
+                return compileForLoop(stmt.as<ForLoopStatement>());
+            case StatementKind::RepeatLoop:
+                return compileRepeatLoop(stmt.as<RepeatLoopStatement>());
+            case StatementKind::WhileLoop:
+                return compileWhileLoop(stmt.as<WhileLoopStatement>());
+            case StatementKind::DoWhileLoop:
+                return compileDoWhileLoop(stmt.as<DoWhileLoopStatement>());
+            case StatementKind::ForeverLoop:
+                return compileForeverLoop(stmt.as<ForeverLoopStatement>());
+            default:
+                return false;
+        }
+    }
+
+    bool compileVariableDecl(const VariableDeclStatement& stmt) {
+        // Static variables keep their value across calls and warn about
+        // skipped initialization each time they're evaluated; leave those
+        // to the AST walker.
+        auto& symbol = stmt.symbol;
+        if (symbol.lifetime == VariableLifetime::Static)
+            return false;
+
+        uint32_t reg;
+        if (auto initializer = symbol.getInitializer()) {
+            if (initializer->bad())
+                return false;
+
+            auto value = compileExpression(*initializer);
+            if (!value)
+                return false;
+            reg = *value;
+        }
+        else {
+            reg = emitConst(symbol.getType().getDefaultValue());
+        }
+
+        localRegs[&symbol] = reg;
+        return true;
+    }
+
+    bool compileConditional(const ConditionalStatement& stmt) {
+        // The AST walker flattens else-if chains and evaluates every
+        // condition in the chain, in order, before running the first matched
+        // branch (the extra evaluations feed unique/priority checking).
+        // Mirror that: evaluate all conditions up front, then select.
+        SmallVector<const ConditionalStatement*> chain;
+        const Statement* finalElse = nullptr;
+
+        auto current = &stmt;
+        while (true) {
+            if (current->check != UniquePriorityCheck::None || current->conditions.size() != 1 ||
+                current->conditions[0].pattern) {
+                return false;
+            }
+
+            chain.push_back(current);
+            if (!current->ifFalse)
+                break;
+
+            if (auto next = current->ifFalse->as_if<ConditionalStatement>()) {
+                current = next;
+            }
+            else {
+                finalElse = current->ifFalse;
+                break;
+            }
+        }
+
+        SmallVector<uint32_t> condRegs;
+        for (auto link : chain) {
+            auto cond = compileExpression(*link->conditions[0].expr);
+            if (!cond)
+                return false;
+            condRegs.push_back(*cond);
+        }
+
+        SmallVector<size_t> branchJumps;
+        for (auto reg : condRegs)
+            branchJumps.push_back(emitJump(OC::JumpIfTrue, reg));
+
+        // No condition matched; fall through to the else branch (if any).
+        SmallVector<size_t> endJumps;
+        if (finalElse && !compileStatement(*finalElse))
+            return false;
+        endJumps.push_back(emitJump(OC::Jump));
+
+        for (size_t i = 0; i < chain.size(); i++) {
+            patch(branchJumps[i]);
+            if (!compileStatement(chain[i]->ifTrue))
+                return false;
+            if (i + 1 != chain.size())
+                endJumps.push_back(emitJump(OC::Jump));
+        }
+
+        patch(endJumps, here());
+        return true;
+    }
+
+    bool compileForLoop(const ForLoopStatement& stmt) {
+        // Note that loopVars is intentionally ignored, matching the AST
+        // walker; declarations are materialized by separate
+        // VariableDeclStatements in the enclosing block.
+        for (auto init : stmt.initializers) {
+            if (!compileExpression(*init))
+                return false;
+        }
+
+        size_t top = here();
+        size_t exitJump = SIZE_MAX;
+        if (stmt.stopExpr) {
+            auto stop = compileExpression(*stmt.stopExpr);
+            if (!stop)
+                return false;
+            exitJump = emitJump(OC::JumpIfNotTrue, *stop);
+        }
+
+        auto body = compileLoopBody(stmt.body);
+        if (!body)
+            return false;
+
+        size_t stepsStart = here();
+        for (auto step : stmt.steps) {
+            if (!compileExpression(*step))
+                return false;
+        }
+
+        instr(emitJump(OC::Jump)).target = (uint32_t)top;
+        patch(body->continueJumps, stepsStart);
+        patch(body->breakJumps, here());
+        if (exitJump != SIZE_MAX)
+            patch(exitJump);
+        return true;
+    }
+
+    bool compileRepeatLoop(const RepeatLoopStatement& stmt) {
+        if (!stmt.count.type->isIntegral())
+            return false;
+
+        auto count = compileExpression(stmt.count);
+        if (!count)
+            return false;
+
+        uint32_t counter = allocReg();
+        auto& init = instr(emit(OC::RepeatInit));
+        init.dst = counter;
+        init.a = *count;
+        init.range = stmt.count.sourceRange;
+
+        uint32_t zero = emitConst(SVInt(64, 0, true));
+        uint32_t one = emitConst(SVInt(64, 1, true));
+
+        size_t top = here();
+        uint32_t test = emitBinary(BinaryOperator::GreaterThan, counter, zero);
+        size_t exitJump = emitJump(OC::JumpIfNotTrue, test);
+
+        auto body = compileLoopBody(stmt.body);
+        if (!body)
+            return false;
+
+        size_t decrement = here();
+        auto& dec = instr(emit(OC::Binary));
+        dec.binaryOp = BinaryOperator::Subtract;
+        dec.dst = counter;
+        dec.a = counter;
+        dec.b = one;
+
+        instr(emitJump(OC::Jump)).target = (uint32_t)top;
+        patch(body->continueJumps, decrement);
+        patch(body->breakJumps, here());
+        patch(exitJump);
+        return true;
+    }
+
+    bool compileWhileLoop(const WhileLoopStatement& stmt) {
+        size_t top = here();
+        auto cond = compileExpression(stmt.cond);
+        if (!cond)
+            return false;
+
+        size_t exitJump = emitJump(OC::JumpIfNotTrue, *cond);
+        auto body = compileLoopBody(stmt.body);
+        if (!body)
+            return false;
+
+        instr(emitJump(OC::Jump)).target = (uint32_t)top;
+        patch(body->continueJumps, top);
+        patch(body->breakJumps, here());
+        patch(exitJump);
+        return true;
+    }
+
+    bool compileDoWhileLoop(const DoWhileLoopStatement& stmt) {
+        size_t top = here();
+        auto body = compileLoopBody(stmt.body);
+        if (!body)
+            return false;
+
+        size_t condStart = here();
+        auto cond = compileExpression(stmt.cond);
+        if (!cond)
+            return false;
+
+        instr(emitJump(OC::JumpIfTrue, *cond)).target = (uint32_t)top;
+        patch(body->continueJumps, condStart);
+        patch(body->breakJumps, here());
+        return true;
+    }
+
+    bool compileForeverLoop(const ForeverLoopStatement& stmt) {
+        size_t top = here();
+        auto body = compileLoopBody(stmt.body);
+        if (!body)
+            return false;
+
+        instr(emitJump(OC::Jump)).target = (uint32_t)top;
+        patch(body->continueJumps, top);
+        patch(body->breakJumps, here());
+        return true;
+    }
+
+    std::optional<LoopFrame> compileLoopBody(const Statement& body) {
+        loopStack.emplace_back();
+        bool ok = compileStatement(body);
+        auto frame = std::move(loopStack.back());
+        loopStack.pop_back();
+        if (!ok)
+            return std::nullopt;
+        return frame;
+    }
+
+    std::optional<uint32_t> compileExpression(const Expression& expr) {
+        if (failed || expr.bad())
+            return std::nullopt;
+
+        switch (expr.kind) {
+            case ExpressionKind::IntegerLiteral:
+                return emitConst(expr.as<IntegerLiteral>().getValue());
+            case ExpressionKind::RealLiteral:
+                return emitConst(real_t(expr.as<RealLiteral>().getValue()));
+            case ExpressionKind::TimeLiteral:
+                return emitConst(real_t(expr.as<TimeLiteral>().getValue()));
+            case ExpressionKind::UnbasedUnsizedIntegerLiteral:
+                return emitConst(expr.as<UnbasedUnsizedIntegerLiteral>().getValue());
+            case ExpressionKind::StringLiteral:
+                return emitLeaf(expr);
+            case ExpressionKind::NamedValue:
+                return compileNamedValue(expr.as<NamedValueExpression>());
+            case ExpressionKind::UnaryOp:
+                return compileUnary(expr.as<UnaryExpression>());
+            case ExpressionKind::BinaryOp:
+                return compileBinary(expr.as<BinaryExpression>());
+            case ExpressionKind::ConditionalOp:
+                return compileConditionalOp(expr.as<ConditionalExpression>());
+            case ExpressionKind::Conversion:
+                return compileConversion(expr.as<ConversionExpression>());
+            case ExpressionKind::Assignment:
+                return compileAssignment(expr.as<AssignmentExpression>());
+            case ExpressionKind::LValueReference: {
+                // This only appears as the lhs placeholder inside the rhs of
+                // a compound assignment, where it reads the current value of
+                // the assignment target.
+                if (compoundTargets.empty())
+                    return std::nullopt;
+
+                uint32_t dst = allocReg();
+                emitCopy(dst, compoundTargets.back());
+                return dst;
+            }
+            default:
+                return std::nullopt;
+        }
+    }
+
+    uint32_t emitLeaf(const Expression& expr) {
+        uint32_t dst = allocReg();
+        auto& in = instr(emit(OC::EvalLeaf));
+        in.dst = dst;
+        in.expr = &expr;
+        return dst;
+    }
+
+    std::optional<uint32_t> compileNamedValue(const NamedValueExpression& expr) {
+        // Parameters, enum values, and specparams aren't frame locals; defer
+        // to the expression itself so that its constant checking (e.g. that
+        // a parameter was declared before the function call's lookup
+        // location) still applies.
+        switch (expr.symbol.kind) {
+            case SymbolKind::Parameter:
+            case SymbolKind::EnumValue:
+            case SymbolKind::Specparam:
+                return emitLeaf(expr);
+            default:
+                break;
+        }
+
+        auto it = localRegs.find(&expr.symbol);
+        if (it == localRegs.end())
+            return std::nullopt;
+
+        uint32_t dst = allocReg();
+        emitCopy(dst, it->second);
+        return dst;
+    }
+
+    std::optional<uint32_t> compileUnary(const UnaryExpression& expr) {
+        switch (expr.op) {
+            case UnaryOperator::Preincrement:
+            case UnaryOperator::Predecrement:
+            case UnaryOperator::Postincrement:
+            case UnaryOperator::Postdecrement: {
+                // The operand must be a register-backed lvalue.
+                if (expr.operand().kind != ExpressionKind::NamedValue)
+                    return std::nullopt;
+
+                auto& type = *expr.operand().type;
+                if (!type.isIntegral() && !type.isFloating())
+                    return std::nullopt;
+
+                auto it = localRegs.find(&expr.operand().as<NamedValueExpression>().symbol);
+                if (it == localRegs.end())
+                    return std::nullopt;
+
+                uint32_t dst = allocReg();
+                auto& in = instr(emit(OC::IncDec));
+                in.unaryOp = expr.op;
+                in.dst = dst;
+                in.a = it->second;
+                return dst;
+            }
+            default: {
+                auto operand = compileExpression(expr.operand());
+                if (!operand)
+                    return std::nullopt;
+
+                uint32_t dst = allocReg();
+                auto& in = instr(emit(OC::Unary));
+                in.unaryOp = expr.op;
+                in.dst = dst;
+                in.a = *operand;
+                return dst;
+            }
+        }
+    }
+
+    std::optional<uint32_t> compileBinary(const BinaryExpression& expr) {
+        if (expr.left().kind == ExpressionKind::TypeReference ||
+            expr.right().kind == ExpressionKind::TypeReference) {
+            return std::nullopt;
+        }
+
+        auto lhs = compileExpression(expr.left());
+        if (!lhs)
+            return std::nullopt;
+
+        // The logical operators short circuit when the lhs is known, in
+        // which case the rhs must not be evaluated at all.
+        std::optional<bool> shortCircuitResult;
+        OC shortCircuitJump = OC::JumpIfFalse;
+        switch (expr.op) {
+            case BinaryOperator::LogicalOr:
+                shortCircuitJump = OC::JumpIfTrue;
+                shortCircuitResult = true;
+                break;
+            case BinaryOperator::LogicalAnd:
+                shortCircuitResult = false;
+                break;
+            case BinaryOperator::LogicalImplication:
+                shortCircuitResult = true;
+                break;
+            default:
+                break;
+        }
+
+        uint32_t dst = allocReg();
+        if (!shortCircuitResult) {
+            auto rhs = compileExpression(expr.right());
+            if (!rhs)
+                return std::nullopt;
+
+            auto& in = instr(emit(canUseTwoState(expr) ? OC::BinaryTwoState : OC::Binary));
+            in.binaryOp = expr.op;
+            in.dst = dst;
+            in.a = *lhs;
+            in.b = *rhs;
+            in.from = expr.left().type;
+            in.to = expr.type;
+            return dst;
+        }
+
+        size_t shortJump = emitJump(shortCircuitJump, *lhs);
+        auto rhs = compileExpression(expr.right());
+        if (!rhs)
+            return std::nullopt;
+
+        auto& in = instr(emit(OC::Binary));
+        in.binaryOp = expr.op;
+        in.dst = dst;
+        in.a = *lhs;
+        in.b = *rhs;
+
+        size_t endJump = emitJump(OC::Jump);
+        patch(shortJump);
+        emitConst(dst, SVInt(*shortCircuitResult));
+        patch(endJump);
+        return dst;
+    }
+
+    // The two-state fast path handles operations whose result is a pure
+    // function of at most 64 value bits: no unknown plane, no division by
+    // zero producing X, no shift amount complications.
+    static bool canUseTwoState(const BinaryExpression& expr) {
+        auto isSimple = [](const Type& type) {
+            return type.isIntegral() && !type.isFourState() && type.getBitWidth() <= 64;
+        };
+        if (!isSimple(*expr.type) || !isSimple(*expr.left().type) ||
+            !isSimple(*expr.right().type)) {
+            return false;
+        }
+
+        switch (expr.op) {
+            case BinaryOperator::Add:
+            case BinaryOperator::Subtract:
+            case BinaryOperator::Multiply:
+            case BinaryOperator::BinaryAnd:
+            case BinaryOperator::BinaryOr:
+            case BinaryOperator::BinaryXor:
+            case BinaryOperator::Equality:
+            case BinaryOperator::Inequality:
+            case BinaryOperator::CaseEquality:
+            case BinaryOperator::CaseInequality:
+            case BinaryOperator::GreaterThanEqual:
+            case BinaryOperator::GreaterThan:
+            case BinaryOperator::LessThanEqual:
+            case BinaryOperator::LessThan:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    std::optional<uint32_t> compileConditionalOp(const ConditionalExpression& expr) {
+        if (expr.conditions.size() != 1 || expr.conditions[0].pattern)
+            return std::nullopt;
+
+        // When the condition has unknown bits both sides are evaluated and
+        // merged; restrict to numeric conditions and integral operands so
+        // that the merge is always SVInt::conditional.
+        auto& cond = *expr.conditions[0].expr;
+        if (!cond.type->isNumeric() || !expr.left().type->isIntegral() ||
+            !expr.right().type->isIntegral()) {
+            return std::nullopt;
+        }
+
+        auto condReg = compileExpression(cond);
+        if (!condReg)
+            return std::nullopt;
+
+        uint32_t dst = allocReg();
+        size_t trueJump = emitJump(OC::JumpIfTrue, *condReg);
+        size_t falseJump = emitJump(OC::JumpIfFalse, *condReg);
+
+        // Unknown condition: evaluate both sides and merge.
+        auto mergeLeft = compileExpression(expr.left());
+        if (!mergeLeft)
+            return std::nullopt;
+        auto mergeRight = compileExpression(expr.right());
+        if (!mergeRight)
+            return std::nullopt;
+
+        auto& merge = instr(emit(OC::CondMerge));
+        merge.dst = dst;
+        merge.a = *mergeLeft;
+        merge.b = *mergeRight;
+        merge.c = *condReg;
+        SmallVector<size_t, 2> endJumps;
+        endJumps.push_back(emitJump(OC::Jump));
+
+        patch(trueJump);
+        auto left = compileExpression(expr.left());
+        if (!left)
+            return std::nullopt;
+        emitCopy(dst, *left);
+        endJumps.push_back(emitJump(OC::Jump));
+
+        patch(falseJump);
+        auto right = compileExpression(expr.right());
+        if (!right)
+            return std::nullopt;
+        emitCopy(dst, *right);
+
+        patch(endJumps, here());
+        return dst;
+    }
+
+    std::optional<uint32_t> compileConversion(const ConversionExpression& expr) {
+        auto operand = compileExpression(expr.operand());
+        if (!operand)
+            return std::nullopt;
+
+        uint32_t dst = allocReg();
+        auto& in = instr(emit(OC::Convert));
+        in.conversion = expr.conversionKind;
+        in.dst = dst;
+        in.a = *operand;
+        in.from = expr.operand().type;
+        in.to = expr.type;
+        in.range = expr.sourceRange;
+        return dst;
+    }
+
+    std::optional<uint32_t> compileAssignment(const AssignmentExpression& expr) {
+        if (expr.timingControl || expr.isNonBlocking())
+            return std::nullopt;
+
+        if (expr.left().kind != ExpressionKind::NamedValue)
+            return std::nullopt;
+
+        auto it = localRegs.find(&expr.left().as<NamedValueExpression>().symbol);
+        if (it == localRegs.end())
+            return std::nullopt;
+
+        uint32_t target = it->second;
+        std::optional<uint32_t> rvalue;
+        if (expr.isCompound()) {
+            compoundTargets.push_back(target);
+            rvalue = compileExpression(expr.right());
+            compoundTargets.pop_back();
+        }
+        else {
+            rvalue = compileExpression(expr.right());
+        }
+
+        if (!rvalue)
+            return std::nullopt;
+
+        emitCopy(target, *rvalue);
+        return rvalue;
+    }
+
+    const SubroutineSymbol& subroutine;
+    std::unique_ptr<EvalBytecode> code{new EvalBytecode()};
+    flat_hash_map<const ValueSymbol*, uint32_t> localRegs;
+    SmallVector<LoopFrame, 4> loopStack;
+    SmallVector<uint32_t, 2> compoundTargets;
+    bool failed = false;
+};
+
+EvalBytecode::~EvalBytecode() = default;
+
+std::unique_ptr<EvalBytecode> EvalBytecode::compile(const SubroutineSymbol& subroutine) {
+    if (subroutine.subroutineKind != SubroutineKind::Function || subroutine.thisVar ||
+        !subroutine.returnValVar || subroutine.flags != MethodFlags::None) {
+        return nullptr;
+    }
+
+    // Only input arguments are supported; anything else would need to be
+    // written back into the caller's frame.
+    for (auto arg : subroutine.getArguments()) {
+        if (arg->direction != ArgumentDirection::In)
+            return nullptr;
+    }
+
+    BytecodeCompiler compiler(subroutine);
+    return compiler.compile();
+}
+
+std::optional<ConstantValue> EvalBytecode::execute(EvalContext& context,
+                                                   std::span<const ConstantValue> args) const {
+    using OC = Instr::Opcode;
+
+    std::vector<ConstantValue> regs(numRegisters);
+    for (size_t i = 0; i < args.size(); i++)
+        regs[i] = args[i];
+
+    size_t pc = 0;
+    while (true) {
+        auto& in = instrs[pc++];
+        switch (in.op) {
+            case OC::Step:
+                if (!context.step(in.range.start()))
+                    return std::nullopt;
+                break;
+            case OC::Const:
+                regs[in.dst] = constants[in.a];
+                break;
+            case OC::Copy:
+                regs[in.dst] = regs[in.a];
+                break;
+            case OC::EvalLeaf: {
+                auto cv = in.expr->eval(context);
+                if (!cv)
+                    return std::nullopt;
+                regs[in.dst] = std::move(cv);
+                break;
+            }
+            case OC::Unary: {
+                auto cv = Expression::evalUnaryOperator(in.unaryOp, regs[in.a]);
+                if (!cv)
+                    return std::nullopt;
+                regs[in.dst] = std::move(cv);
+                break;
+            }
+            case OC::Binary: {
+                auto cv = Expression::evalBinaryOperator(in.binaryOp, regs[in.a], regs[in.b]);
+                if (!cv)
+                    return std::nullopt;
+                regs[in.dst] = std::move(cv);
+                break;
+            }
+            case OC::BinaryTwoState: {
+                auto& l = regs[in.a];
+                auto& r = regs[in.b];
+                if (l.isInteger() && r.isInteger() && !l.integer().hasUnknown() &&
+                    !r.integer().hasUnknown()) {
+                    regs[in.dst] = evalBinaryTwoState(in, l.integer(), r.integer());
+                }
+                else {
+                    // Shouldn't happen for well-typed inputs, but if an
+                    // unknown sneaks in just promote to the general path.
+                    auto cv = Expression::evalBinaryOperator(in.binaryOp, l, r);
+                    if (!cv)
+                        return std::nullopt;
+                    regs[in.dst] = std::move(cv);
+                }
+                break;
+            }
+            case OC::IncDec:
+                evalIncDec(in, regs);
+                break;
+            case OC::Convert: {
+                auto cv = ConversionExpression::convert(context, *in.from, *in.to, in.range,
+                                                        ConstantValue(regs[in.a]), in.conversion);
+                if (!cv)
+                    return std::nullopt;
+                regs[in.dst] = std::move(cv);
+                break;
+            }
+            case OC::CondMerge:
+                regs[in.dst] = SVInt::conditional(regs[in.c].integer(), regs[in.a].integer(),
+                                                  regs[in.b].integer());
+                break;
+            case OC::Jump:
+                pc = in.target;
+                break;
+            case OC::JumpIfTrue:
+                if (regs[in.a].isTrue())
+                    pc = in.target;
+                break;
+            case OC::JumpIfNotTrue:
+                if (!regs[in.a].isTrue())
+                    pc = in.target;
+                break;
+            case OC::JumpIfFalse:
+                if (regs[in.a].isFalse())
+                    pc = in.target;
+                break;
+            case OC::RepeatInit: {
+                auto& cv = regs[in.a];
+                std::optional<int64_t> oc = cv.integer().as<int64_t>();
+                if (!oc || oc < 0) {
+                    if (cv.integer().hasUnknown()) {
+                        oc = 0;
+                    }
+                    else {
+                        auto& diag = context.addDiag(diag::ValueOutOfRange, in.range);
+                        diag << cv << 0 << INT64_MAX;
+                        return std::nullopt;
+                    }
+                }
+
+                regs[in.dst] = SVInt(64, (uint64_t)*oc, true);
+                break;
+            }
+            case OC::Return:
+                return std::move(regs[returnReg]);
+        }
+    }
+}
+
+SVInt EvalBytecode::evalBinaryTwoState(const Instr& in, const SVInt& l, const SVInt& r) {
+    uint64_t lv = l.getRawPtr()[0];
+    uint64_t rv = r.getRawPtr()[0];
+
+    // Arithmetic wraps mod 2^64 and then gets truncated to the result width;
+    // since the operands are already masked to that width this matches the
+    // general path exactly.
+    auto result = [&](uint64_t value) {
+        bitwidth_t width = in.to->getBitWidth();
+        if (width < 64)
+            value &= (uint64_t(1) << width) - 1;
+        return SVInt(width, value, in.to->isSigned());
+    };
+
+    // Comparisons sign-extend from the operand width when the common operand
+    // type is signed and compare natively otherwise.
+    auto compare = [&](auto cmp) {
+        if (in.from->isSigned()) {
+            auto extend = [&](uint64_t value) {
+                bitwidth_t width = in.from->getBitWidth();
+                if (width < 64) {
+                    uint64_t mask = uint64_t(1) << (width - 1);
+                    value = (value ^ mask) - mask;
+                }
+                return (int64_t)value;
+            };
+            return SVInt(logic_t(cmp(extend(lv), extend(rv))));
+        }
+        return SVInt(logic_t(cmp(lv, rv)));
+    };
+
+    switch (in.binaryOp) {
+        case BinaryOperator::Add:
+            return result(lv + rv);
+        case BinaryOperator::Subtract:
+            return result(lv - rv);
+        case BinaryOperator::Multiply:
+            return result(lv * rv);
+        case BinaryOperator::BinaryAnd:
+            return result(lv & rv);
+        case BinaryOperator::BinaryOr:
+            return result(lv | rv);
+        case BinaryOperator::BinaryXor:
+            return result(lv ^ rv);
+        case BinaryOperator::Equality:
+        case BinaryOperator::CaseEquality:
+            return SVInt(logic_t(lv == rv));
+        case BinaryOperator::Inequality:
+        case BinaryOperator::CaseInequality:
+            return SVInt(logic_t(lv != rv));
+        case BinaryOperator::GreaterThanEqual:
+            return compare([](auto a, auto b) { return a >= b; });
+        case BinaryOperator::GreaterThan:
+            return compare([](auto a, auto b) { return a > b; });
+        case BinaryOperator::LessThanEqual:
+            return compare([](auto a, auto b) { return a <= b; });
+        case BinaryOperator::LessThan:
+            return compare([](auto a, auto b) { return a < b; });
+        default:
+            ASSUME_UNREACHABLE;
+    }
+}
+
+void EvalBytecode::evalIncDec(const Instr& in, std::span<ConstantValue> regs) {
+    // Mirrors the lvalue handling in UnaryExpression::evalImpl.
+    ConstantValue& var = regs[in.a];
+    ConstantValue result;
+    if (var.isInteger()) {
+        SVInt v = std::move(var).integer();
+        switch (in.unaryOp) {
+            case UnaryOperator::Preincrement:
+                ++v;
+                result = v;
+                break;
+            case UnaryOperator::Predecrement:
+                --v;
+                result = v;
+                break;
+            case UnaryOperator::Postincrement:
+                result = v;
+                v = v + 1;
+                break;
+            case UnaryOperator::Postdecrement:
+                result = v;
+                v = v - 1;
+                break;
+            default:
+                ASSUME_UNREACHABLE;
+        }
+        var = std::move(v);
+    }
+    else if (var.isReal()) {
+        double v = var.real();
+        switch (in.unaryOp) {
+            case UnaryOperator::Preincrement:
+                ++v;
+                result = real_t(v);
+                break;
+            case UnaryOperator::Predecrement:
+                --v;
+                result = real_t(v);
+                break;
+            case UnaryOperator::Postincrement:
+                result = real_t(v);
+                v = v + 1;
+                break;
+            case UnaryOperator::Postdecrement:
+                result = real_t(v);
+                v = v - 1;
+                break;
+            default:
+                ASSUME_UNREACHABLE;
+        }
+        var = real_t(v);
+    }
+    else if (var.isShortReal()) {
+        float v = var.shortReal();
+        switch (in.unaryOp) {
+            case UnaryOperator::Preincrement:
+                ++v;
+                result = shortreal_t(v);
+                break;
+            case UnaryOperator::Predecrement:
+                --v;
+                result = shortreal_t(v);
+                break;
+            case UnaryOperator::Postincrement:
+                result = shortreal_t(v);
+                v = v + 1;
+                break;
+            case UnaryOperator::Postdecrement:
+                result = shortreal_t(v);
+                v = v - 1;
+                break;
+            default:
+                ASSUME_UNREACHABLE;
+        }
+        var = shortreal_t(v);
+    }
+    else {
+        ASSUME_UNREACHABLE;
+    }
+
+    regs[in.dst] = std::move(result);
+}
+
+} // namespace slang::ast
@@ -19,46 +19,75 @@
 namespace slang::ast {
 
 void EvalContext::reset() {
-    steps = 0;
+    chunkRemaining = 1;
+    stepsUsed = 0;
     disableTarget = nullptr;
     queueTarget = nullptr;
     stack.clear();
     lvalStack.clear();
+    localStorage.clear();
+    localCount = 0;
     diags.clear();
     disableRange = {};
 }
 
+const EvalContext::Local* EvalContext::findFrameLocal(const Frame& frame,
+                                                      const ValueSymbol* symbol) const {
+    // Search newest to oldest; iterator variables and loop locals tend to be
+    // both the most recently created and the most frequently accessed.
+    for (size_t i = frame.localsEnd; i > frame.localsStart; i--) {
+        auto& local = localStorage[i - 1];
+        if (local.symbol == symbol)
+            return &local;
+    }
+    return nullptr;
+}
+
 ConstantValue* EvalContext::createLocal(const ValueSymbol* symbol, ConstantValue value) {
     ASSERT(!stack.empty());
-    ConstantValue& result = stack.back().temporaries[symbol];
+
+    auto& frame = stack.back();
+    auto local = const_cast<Local*>(findFrameLocal(frame, symbol));
+    if (!local) {
+        if (localCount == localStorage.size())
+            localStorage.emplace_back();
+
+        local = &localStorage[localCount++];
+        local->symbol = symbol;
+        frame.localsEnd = localCount;
+    }
+
     if (!value) {
-        result = symbol->getType().getDefaultValue();
+        local->value = symbol->getType().getDefaultValue();
     }
     else {
         ASSERT(!value.isInteger() ||
                value.integer().getBitWidth() == symbol->getType().getBitWidth());
 
-        result = std::move(value);
+        local->value = std::move(value);
     }
 
-    return &result;
+    return &local->value;
 }
 
 ConstantValue* EvalContext::findLocal(const ValueSymbol* symbol) {
     if (stack.empty())
         return nullptr;
 
-    auto& frame = stack.back();
-    auto it = frame.temporaries.find(symbol);
-    if (it == frame.temporaries.end())
+    auto local = const_cast<Local*>(findFrameLocal(stack.back(), symbol));
+    if (!local)
         return nullptr;
-    return &it->second;
+    return &local->value;
 }
 
 void EvalContext::deleteLocal(const ValueSymbol* symbol) {
     if (!stack.empty()) {
-        auto& frame = stack.back();
-        frame.temporaries.erase(symbol);
+        if (auto local = const_cast<Local*>(findFrameLocal(stack.back(), symbol))) {
+            // The slot is tombstoned rather than removed; it gets recycled
+            // along with the rest of the frame's slots when the frame pops.
+            local->symbol = nullptr;
+            local->value = nullptr;
+        }
     }
 }
 
@@ -71,18 +100,29 @@ bool EvalContext::pushFrame(const SubroutineSymbol& subroutine, SourceLocation c
     }
 
     Frame frame;
+    frame.localsStart = frame.localsEnd = localCount;
     frame.subroutine = &subroutine;
     frame.callLocation = callLocation;
     frame.lookupLocation = lookupLocation;
-    stack.emplace_back(std::move(frame));
+    stack.emplace_back(frame);
     return true;
 }
 
 void EvalContext::pushEmptyFrame() {
-    stack.emplace_back(Frame{});
+    Frame frame;
+    frame.localsStart = frame.localsEnd = localCount;
+    stack.emplace_back(frame);
 }
 
 void EvalContext::popFrame() {
+    // Release the values of this frame's locals but keep the slots
+    // themselves around for reuse by the next frame that gets pushed.
+    auto& frame = stack.back();
+    while (localCount > frame.localsStart) {
+        auto& local = localStorage[--localCount];
+        local.symbol = nullptr;
+        local.value = nullptr;
+    }
     stack.pop_back();
 }
 
@@ -101,12 +141,25 @@ LValue* EvalContext::getTopLValue() const {
     return lvalStack.back();
 }
 
-bool EvalContext::step(SourceLocation loc) {
-    if (++steps < compilation.getOptions().maxConstexprSteps)
-        return true;
+bool EvalContext::refillStepBudget(SourceLocation loc) {
+    // Chunk boundaries also bound how long a cancellation request
+    // can go unnoticed during a runaway evaluation.
+    auto& options = compilation.getOptions();
+    options.cancellationToken.throwIfCancelled();
 
-    addDiag(diag::ConstEvalExceededMaxSteps, loc);
-    return false;
+    const uint32_t maxSteps = options.maxConstexprSteps;
+    if (stepsUsed >= maxSteps) {
+        addDiag(diag::ConstEvalExceededMaxSteps, loc);
+        return false;
+    }
+
+    const uint32_t chunk = std::min(StepChunkSize, maxSteps - stepsUsed);
+    stepsUsed += chunk;
+
+    // The chunk pays for the step that triggered the refill plus
+    // the next chunk - 1 steps.
+    chunkRemaining = chunk;
+    return true;
 }
 
 std::string EvalContext::dumpStack() const {
@@ -114,8 +167,11 @@ std::string EvalContext::dumpStack() const {
     int index = 0;
     for (const Frame& frame : stack) {
         buffer.format("{}: {}\n", index++, frame.subroutine ? frame.subroutine->name : "<global>");
-        for (auto& [symbol, value] : frame.temporaries)
-            buffer.format("    {} = {}\n", symbol->name, value.toString());
+        for (size_t i = frame.localsStart; i < frame.localsEnd; i++) {
+            auto& local = localStorage[i];
+            if (local.symbol)
+                buffer.format("    {} = {}\n", local.symbol->name, local.value.toString());
+        }
     }
     return buffer.str();
 }
@@ -157,7 +213,7 @@ void EvalContext::reportDiags(const ASTContext& context) {
     context.scope->addDiags(diags);
 }
 
-static void reportFrame(Diagnostic& diag, const EvalContext::Frame& frame) {
+void EvalContext::reportFrame(Diagnostic& diag, const Frame& frame) const {
     if (!frame.subroutine)
         return;
 
@@ -165,10 +221,14 @@ static void reportFrame(Diagnostic& diag, const EvalContext::Frame& frame) {
     buffer.format("{}(", frame.subroutine->name);
 
     for (auto arg : frame.subroutine->getArguments()) {
-        auto it = frame.temporaries.find(arg);
-        ASSERT(it != frame.temporaries.end());
+        // Arguments normally have storage in the frame, but bodies that were
+        // compiled to bytecode keep their values in registers instead, in
+        // which case they aren't observable here.
+        if (auto local = findFrameLocal(frame, arg))
+            buffer.append(local->value.toString());
+        else
+            buffer.append("...");
 
-        buffer.append(it->second.toString());
         if (arg != frame.subroutine->getArguments().last(1)[0])
             buffer.append(", ");
     }
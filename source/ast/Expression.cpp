@@ -22,6 +22,12 @@ namespace {
 using namespace slang;
 using namespace slang::ast;
 
+// Note that this is the extent of constant evaluation memoization: results are
+// cached on the bound expression itself (when the context allows it), and value
+// symbols like parameters additionally cache their resolved values. A wider
+// memo table keyed by (expression, parameter values) wouldn't add anything,
+// because expressions are bound per instance body -- two instances never share
+// an Expression node, and within one body each node evaluates at most once.
 struct EvalVisitor {
     template<typename T>
     ConstantValue visit(const T& expr, EvalContext& context) {
@@ -36,7 +42,12 @@ struct EvalVisitor {
 
         ConstantValue cv = expr.evalImpl(context);
         if (cv && context.cacheResults()) {
-            expr.constant = context.compilation.allocConstant(std::move(cv));
+            // Common small values share preallocated constants instead of
+            // growing the constant pool once per folded expression.
+            if (auto shared = context.compilation.getCommonConstant(cv))
+                expr.constant = shared;
+            else
+                expr.constant = context.compilation.allocConstant(std::move(cv));
             return *expr.constant;
         }
 
@@ -1251,9 +1262,8 @@ Expression* Expression::tryBindInterfaceRef(const ASTContext& context,
     // Fabricate a virtual interface type for the rhs that we can use for matching.
     ASSERT(iface->parentInstance);
     auto sourceRange = syntax.sourceRange();
-    const Type* type = comp.emplace<VirtualInterfaceType>(*iface->parentInstance, modport,
-                                                          /* isRealIface */ true,
-                                                          sourceRange.start());
+    const Type* type = &comp.getVirtualInterfaceType(*iface->parentInstance, modport,
+                                                     /* isRealIface */ true, sourceRange.start());
     if (!dims.empty())
         type = &FixedSizeUnpackedArrayType::fromDims(*context.scope, *type, dims, sourceRange);
 
@@ -82,4 +82,27 @@ void InstancePath::buildPath(const Symbol& symbol) {
     entries.push_back(*syntax);
 }
 
+const InstancePathTrie::Node* InstancePathTrie::insert(const InstancePath& path) {
+    Node* node = &root;
+    for (auto& entry : path.entries) {
+        auto [it, inserted] = node->children.emplace(entry, nullptr);
+        if (inserted) {
+            auto child = alloc.emplace();
+            child->parent = node;
+            child->entry = entry;
+            child->depth = node->depth + 1;
+            it->second = child;
+        }
+        node = it->second;
+    }
+    return node;
+}
+
+bool InstancePathTrie::isPrefixOf(const Node& prefix, const Node& node) {
+    auto curr = &node;
+    while (curr->depth > prefix.depth)
+        curr = curr->parent;
+    return curr == &prefix;
+}
+
 } // namespace slang::ast
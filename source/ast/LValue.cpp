@@ -40,62 +40,67 @@ ConstantValue LValue::load() const {
         return SVInt::concat(vals);
     }
 
-    // Otherwise, we have an lvalue path. Walk the path and apply each element.
+    // Otherwise, we have an lvalue path. Walk the path down to the target value
+    // without copying any of the containers along the way; only the final
+    // resolved value is copied out. This keeps single element loads from large
+    // arrays cheap. Slices and string indexing still materialize a temporary
+    // since they have no single backing value to point at.
     auto& path = std::get<Path>(value);
-    ConstantValue result = *path.base;
+    ConstantValue owned;
+    const ConstantValue* current = path.base;
     for (auto& elem : path.elements) {
-        if (!result)
+        if (!*current)
             return nullptr;
 
         std::visit(
-            [&result](auto&& arg) {
+            [&current, &owned](auto&& arg) {
                 using T = std::decay_t<decltype(arg)>;
                 if constexpr (std::is_same_v<T, BitSlice>) {
-                    result = result.getSlice(arg.range.upper(), arg.range.lower(), nullptr);
+                    owned = current->getSlice(arg.range.upper(), arg.range.lower(), nullptr);
+                    current = &owned;
                 }
                 else if constexpr (std::is_same_v<T, ElementIndex>) {
                     if (arg.forceOutOfBounds) {
-                        result = arg.defaultValue;
+                        current = &arg.defaultValue;
                     }
-                    else if (result.isUnion()) {
+                    else if (current->isUnion()) {
                         // If we're selecting the active member all is well. If not,
                         // we need to return the default value because we have no
                         // idea what type this should be.
-                        if (arg.index < 0 || result.unionVal()->activeMember != uint32_t(arg.index))
-                            result = arg.defaultValue;
+                        if (arg.index < 0 ||
+                            current->unionVal()->activeMember != uint32_t(arg.index)) {
+                            current = &arg.defaultValue;
+                        }
                     }
-                    else if (arg.index < 0 || size_t(arg.index) >= result.size()) {
-                        result = arg.defaultValue;
+                    else if (arg.index < 0 || size_t(arg.index) >= current->size()) {
+                        current = &arg.defaultValue;
                     }
-                    else if (result.isString()) {
-                        result = SVInt(8, (uint64_t)result.str()[size_t(arg.index)], false);
+                    else if (current->isString()) {
+                        owned = SVInt(8, (uint64_t)current->str()[size_t(arg.index)], false);
+                        current = &owned;
                     }
                     else {
-                        // Be careful not to assign to the result while
-                        // still referencing its elements.
-                        ConstantValue temp(std::move(result.at(size_t(arg.index))));
-                        result = std::move(temp);
+                        current = &current->at(size_t(arg.index));
                     }
                 }
                 else if constexpr (std::is_same_v<T, ArraySlice>) {
-                    result = result.getSlice(arg.range.upper(), arg.range.lower(),
-                                             arg.defaultValue);
+                    owned = current->getSlice(arg.range.upper(), arg.range.lower(),
+                                              arg.defaultValue);
+                    current = &owned;
                 }
                 else if constexpr (std::is_same_v<T, ArrayLookup>) {
-                    auto& map = *result.map();
+                    auto& map = *current->map();
                     if (auto it = map.find(arg.index); it != map.end()) {
                         // If we find the index in the target map, return the value.
-                        ConstantValue temp(std::move(it->second));
-                        result = std::move(temp);
+                        current = &it->second;
                     }
                     else if (map.defaultValue) {
                         // Otherwise, if the map itself has a default set, use that.
-                        ConstantValue temp(std::move(map.defaultValue));
-                        result = std::move(temp);
+                        current = &map.defaultValue;
                     }
                     else {
                         // Finally, fall back on whatever the default default is.
-                        result = arg.defaultValue;
+                        current = &arg.defaultValue;
                     }
                 }
                 else {
@@ -105,7 +110,7 @@ ConstantValue LValue::load() const {
             elem);
     }
 
-    return result;
+    return *current;
 }
 
 void LValue::store(const ConstantValue& newValue) {
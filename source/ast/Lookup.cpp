@@ -1584,6 +1584,12 @@ bool Lookup::findAssertionLocalVar(const ASTContext& context, const NameSyntax&
     return lookupDownward(nameParts, name, context, result);
 }
 
+// Note that lookup results are deliberately not memoized. Each step here is a
+// hash map probe in the scope's name map, and the answer depends on the lookup
+// location (declaration-before-use rules) as well as scope contents that can
+// still change during elaboration (deferred members, binds), so a cache keyed
+// by scope and name would either be unsound or need the location in its key,
+// at which point hot names rarely repeat an exact key anyway.
 void Lookup::unqualifiedImpl(const Scope& scope, std::string_view name, LookupLocation location,
                              std::optional<SourceRange> sourceRange, bitmask<LookupFlags> flags,
                              SymbolIndex outOfBlockIndex, LookupResult& result,
@@ -85,23 +85,51 @@ const NetType& Scope::getDefaultNetType() const {
 }
 
 std::optional<TimeScale> Scope::getTimeScale() const {
-    const Scope* current = this;
-    do {
+    // Scopes that carry their own time scale answer directly; their values
+    // can still be in flux while the surrounding declaration is being
+    // populated, so they are deliberately not cached.
+    switch (asSymbol().kind) {
+        case SymbolKind::CompilationUnit:
+            return asSymbol().as<CompilationUnitSymbol>().timeScale;
+        case SymbolKind::Package:
+            return asSymbol().as<PackageSymbol>().timeScale;
+        case SymbolKind::InstanceBody:
+            return asSymbol().as<InstanceBodySymbol>().getDefinition().timeScale;
+        default:
+            break;
+    }
+
+    if (timeScaleCached)
+        return cachedTimeScale;
+
+    // Nested scopes only exist (and only get queried) once their enclosing
+    // unit / package / instance body has its time scale fixed, so the
+    // resolved value can be cached for all later queries.
+    const Scope* current = asSymbol().getParentScope();
+    while (current) {
         auto& sym = current->asSymbol();
         switch (sym.kind) {
             case SymbolKind::CompilationUnit:
-                return sym.as<CompilationUnitSymbol>().timeScale;
+                cachedTimeScale = sym.as<CompilationUnitSymbol>().timeScale;
+                break;
             case SymbolKind::Package:
-                return sym.as<PackageSymbol>().timeScale;
+                cachedTimeScale = sym.as<PackageSymbol>().timeScale;
+                break;
             case SymbolKind::InstanceBody:
-                return sym.as<InstanceBodySymbol>().getDefinition().timeScale;
+                cachedTimeScale = sym.as<InstanceBodySymbol>().getDefinition().timeScale;
+                break;
             default:
                 current = sym.getParentScope();
-                break;
+                continue;
         }
-    } while (current);
+        break;
+    }
 
-    return getCompilation().getDefaultTimeScale();
+    if (!current)
+        cachedTimeScale = getCompilation().getDefaultTimeScale();
+
+    timeScaleCached = true;
+    return cachedTimeScale;
 }
 
 bool Scope::isProceduralContext() const {
@@ -162,6 +190,10 @@ void Scope::addDiags(const Diagnostics& diags) const {
     }
 }
 
+void Scope::reserveMembers(size_t count) {
+    nameMap->reserve(nameMap->size() + count);
+}
+
 void Scope::addMember(const Symbol& symbol) {
     // For any symbols that expose a type to the surrounding scope, keep track of it in our
     // deferred data so that we can include enum values in our member list.
@@ -813,7 +845,18 @@ void Scope::checkImportConflict(const Symbol& member, const Symbol& existing) co
     }
 }
 
+// Elaboration materializes all deferred members of the scope at once; there is
+// deliberately no per-name variant. A lookup can only report "not found" once
+// every deferred member has been expanded, because generate constructs, enum
+// value hoisting, and imports can all introduce names that aren't evident from
+// the member syntax alone. Note that this step only creates member symbols and
+// the name map -- types, initializers, and subroutine bodies remain lazy, so
+// the expensive part of a large scope stays pay-as-you-go after this runs.
 void Scope::elaborate() const {
+    // Scope expansion is the backedge of all elaboration work, so checking
+    // here lets callers cancel a long compile in bounded time.
+    compilation.getOptions().cancellationToken.throwIfCancelled();
+
     if (thisSym->kind == SymbolKind::InstanceBody && TimeTrace::isEnabled()) {
         TimeTrace::beginTrace("elaborate scope"sv, [&] {
             std::string buffer;
@@ -12,6 +12,7 @@
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/VariableSymbols.h"
+#include "slang/parsing/Lexer.h"
 #include "slang/syntax/AllSyntax.h"
 
 namespace slang::ast {
@@ -32,8 +33,44 @@ ScriptSession::ScriptSession() :
 
 ConstantValue ScriptSession::eval(std::string_view text) {
     syntaxTrees.emplace_back(SyntaxTree::fromText(text));
+    return evalRoot(syntaxTrees.back()->root());
+}
+
+std::vector<ConstantValue> ScriptSession::evalBatch(std::span<const std::string_view> snippets) {
+    std::vector<ConstantValue> results;
+    results.reserve(snippets.size());
+    syntaxTrees.reserve(syntaxTrees.size() + snippets.size());
+
+    // The parsed trees are only ever used for binding, so don't bother
+    // recording trivia on the tokens.
+    parsing::LexerOptions lo;
+    lo.minimalTrivia = true;
+
+    Bag options;
+    options.set(lo);
+
+    // Expressions (the common case for batch callers) get bound through one
+    // shared context instead of constructing a fresh one per snippet.
+    ASTContext context(scope, LookupLocation::max);
+    for (auto text : snippets) {
+        syntaxTrees.emplace_back(
+            SyntaxTree::fromText(text, SyntaxTree::getDefaultSourceManager(), "source", "",
+                                 options));
+
+        const auto& node = syntaxTrees.back()->root();
+        if (ExpressionSyntax::isKind(node.kind)) {
+            auto& bound = Expression::bind(node.as<ExpressionSyntax>(), context,
+                                           ASTFlags::AssignmentAllowed);
+            results.emplace_back(bound.eval(evalContext));
+        }
+        else {
+            results.emplace_back(evalRoot(node));
+        }
+    }
+    return results;
+}
 
-    const auto& node = syntaxTrees.back()->root();
+ConstantValue ScriptSession::evalRoot(const syntax::SyntaxNode& node) {
     switch (node.kind) {
         case SyntaxKind::ParameterDeclarationStatement:
         case SyntaxKind::FunctionDeclaration:
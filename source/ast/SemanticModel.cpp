@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/SemanticModel.h"
 
+#include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
 #include "slang/ast/Definition.h"
 #include "slang/syntax/AllSyntax.h"
@@ -15,9 +16,46 @@ namespace slang::ast {
 
 using namespace syntax;
 
+namespace {
+
+class PreloadVisitor : public ASTVisitor<PreloadVisitor, false, false> {
+public:
+    explicit PreloadVisitor(flat_hash_map<const SyntaxNode*, const Symbol*>& cache) :
+        cache(cache) {}
+
+    template<typename T>
+    void handle(const T& symbol) {
+        if constexpr (std::is_base_of_v<Symbol, T>) {
+            if (auto syntax = symbol.getSyntax())
+                cache.emplace(syntax, &symbol);
+        }
+        visitDefault(symbol);
+    }
+
+    void handle(const InstanceSymbol& symbol) {
+        if (auto syntax = symbol.getSyntax())
+            cache.emplace(syntax, &symbol);
+
+        // The body shares the definition's syntax; don't record it since
+        // queries for a definition expect the instance-level placeholder
+        // handling in getDeclaredSymbol instead.
+        visitDefault(symbol.body);
+    }
+
+private:
+    flat_hash_map<const SyntaxNode*, const Symbol*>& cache;
+};
+
+} // namespace
+
 SemanticModel::SemanticModel(Compilation& compilation) : compilation(compilation) {
 }
 
+void SemanticModel::preload() {
+    PreloadVisitor visitor(symbolCache);
+    compilation.getRoot().visit(visitor);
+}
+
 void SemanticModel::withContext(const SyntaxNode& node, const Symbol& symbol) {
     symbolCache[&node] = &symbol;
 }
@@ -1077,6 +1077,58 @@ static CaseStatementCondition getCondition(TokenKind kind) {
     return condition;
 }
 
+// Builds the optional constant dispatch table for a case statement; see the
+// comment on CaseStatement::dispatchTable. Only plain case statements are
+// eligible; wildcard and inside conditions need per-item matching, and
+// unique checks require visiting every item anyway. A handful of items
+// isn't worth the table, so small statements are skipped.
+static std::span<const CaseStatement::DispatchEntry> buildCaseDispatchTable(
+    Compilation& compilation, const ASTContext& context, const CaseStatement& stmt) {
+
+    static constexpr size_t MinDispatchLabels = 8;
+
+    if (stmt.condition != CaseStatementCondition::Normal ||
+        (stmt.check != UniquePriorityCheck::None && stmt.check != UniquePriorityCheck::Priority)) {
+        return {};
+    }
+
+    auto& type = *stmt.expr.type;
+    if (!type.isIntegral() || type.getBitWidth() > 64)
+        return {};
+
+    SmallVector<CaseStatement::DispatchEntry> entries;
+    for (auto& group : stmt.items) {
+        for (auto item : group.expressions) {
+            if (item->kind == ExpressionKind::OpenRange ||
+                item->kind == ExpressionKind::TypeReference) {
+                return {};
+            }
+
+            ConstantValue val = context.tryEval(*item);
+            if (!val.isInteger())
+                return {};
+
+            auto& sv = val.integer();
+            if (sv.hasUnknown() || sv.getBitWidth() != type.getBitWidth())
+                return {};
+
+            entries.push_back({sv.getRawPtr()[0], group.stmt});
+        }
+    }
+
+    if (entries.size() < MinDispatchLabels)
+        return {};
+
+    // Earlier items win on duplicate labels, matching sequential evaluation.
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](auto& a, auto& b) { return a.label < b.label; });
+    auto newEnd = std::unique(entries.begin(), entries.end(),
+                              [](auto& a, auto& b) { return a.label == b.label; });
+    entries.resize(size_t(newEnd - entries.begin()));
+
+    return entries.copy(compilation);
+}
+
 Statement& CaseStatement::fromSyntax(Compilation& compilation, const CaseStatementSyntax& syntax,
                                      const ASTContext& context, StatementContext& stmtCtx) {
     if (syntax.matchesOrInside.kind == TokenKind::MatchesKeyword)
@@ -1169,6 +1221,7 @@ Statement& CaseStatement::fromSyntax(Compilation& compilation, const CaseStateme
     if (bad)
         return badStmt(compilation, result);
 
+    result->dispatchTable = buildCaseDispatchTable(compilation, context, *result);
     return *result;
 }
 
@@ -1211,6 +1264,30 @@ ER CaseStatement::evalImpl(EvalContext& context) const {
             return ER::Fail;
     }
 
+    // If a dispatch table was built at bind time and the selector is a clean
+    // two-state value, look up the matching item directly instead of
+    // comparing against every label in order.
+    if (!dispatchTable.empty() && cv.isInteger() && !cv.integer().hasUnknown()) {
+        const uint64_t key = cv.integer().getRawPtr()[0];
+        auto it = std::lower_bound(dispatchTable.begin(), dispatchTable.end(), key,
+                                   [](const DispatchEntry& entry, uint64_t k) {
+                                       return entry.label < k;
+                                   });
+
+        const Statement* target = defaultCase;
+        if (it != dispatchTable.end() && it->label == key)
+            target = it->stmt;
+
+        if (target)
+            return target->eval(context);
+
+        if (check == UniquePriorityCheck::Priority) {
+            auto& diag = context.addDiag(diag::ConstEvalNoCaseItemsMatched, expr.sourceRange);
+            diag << "priority"sv << cv;
+        }
+        return ER::Success;
+    }
+
     const Statement* matchedStmt = nullptr;
     SourceRange matchRange;
     bool unique = check == UniquePriorityCheck::Unique || check == UniquePriorityCheck::Unique0;
@@ -1300,6 +1377,63 @@ void CaseStatement::serializeTo(ASTSerializer& serializer) const {
     }
 }
 
+// Decoder-style `case ... matches` statements over a tagged union often have
+// one arm per tag, and there can be hundreds of them. Index the arms by
+// discriminant at bind time so that evaluation consults only the arms that
+// can match the active member instead of testing every pattern in sequence.
+// Wildcard and variable patterns match any value and so land in every bucket
+// (preserving priority order); any other top-level pattern disables the
+// dispatch since we can't classify what it matches.
+static std::span<const std::span<const uint32_t>> buildTagDispatch(
+    Compilation& comp, const Type& exprType,
+    std::span<const PatternCaseStatement::ItemGroup> items) {
+
+    if (items.size() < 4 || !exprType.isTaggedUnion())
+        return {};
+
+    bool anyTagged = false;
+    for (auto& item : items) {
+        switch (item.pattern->kind) {
+            case PatternKind::Tagged:
+                anyTagged = true;
+                break;
+            case PatternKind::Wildcard:
+            case PatternKind::Variable:
+                break;
+            default:
+                return {};
+        }
+    }
+
+    uint32_t fieldCount = 0;
+    for ([[maybe_unused]] auto& field :
+         exprType.getCanonicalType().as<Scope>().membersOfType<FieldSymbol>()) {
+        fieldCount++;
+    }
+
+    if (!anyTagged || !fieldCount)
+        return {};
+
+    std::vector<SmallVector<uint32_t, 4>> buckets(fieldCount);
+    for (uint32_t i = 0; i < items.size(); i++) {
+        if (items[i].pattern->kind == PatternKind::Tagged) {
+            uint32_t fieldIndex = items[i].pattern->as<TaggedPattern>().member.fieldIndex;
+            ASSERT(fieldIndex < fieldCount);
+            buckets[fieldIndex].push_back(i);
+        }
+        else {
+            for (auto& bucket : buckets)
+                bucket.push_back(i);
+        }
+    }
+
+    SmallVector<std::span<const uint32_t>> spans;
+    for (auto& bucket : buckets)
+        spans.push_back(bucket.copy(comp));
+
+    return spans.copy(comp);
+}
+
 Statement& PatternCaseStatement::fromSyntax(Compilation& compilation,
                                             const CaseStatementSyntax& syntax,
                                             const ASTContext& context, StatementContext& stmtCtx) {
@@ -1355,6 +1489,7 @@ Statement& PatternCaseStatement::fromSyntax(Compilation& compilation,
     if (bad)
         return badStmt(compilation, result);
 
+    result->tagDispatch = buildTagDispatch(compilation, *expr.type, result->items);
     return *result;
 }
 
@@ -1365,22 +1500,28 @@ ER PatternCaseStatement::evalImpl(EvalContext& context) const {
 
     const Statement* matchedStmt = nullptr;
     SourceRange matchRange;
+    bool failed = false;
 
-    for (auto& item : items) {
+    // Tries to match one item; returns false when scanning should stop.
+    auto tryItem = [&](const ItemGroup& item) {
         auto val = item.pattern->eval(context, cv, condition);
-        if (!val)
-            return ER::Fail;
+        if (!val) {
+            failed = true;
+            return false;
+        }
 
         if (!val.isTrue())
-            continue;
+            return true;
 
         if (item.filter) {
             val = item.filter->eval(context);
-            if (!val)
-                return ER::Fail;
+            if (!val) {
+                failed = true;
+                return false;
+            }
 
             if (!val.isTrue())
-                continue;
+                return true;
         }
 
         // If we already matched with a previous item, the only we reason
@@ -1390,16 +1531,36 @@ ER PatternCaseStatement::evalImpl(EvalContext& context) const {
             auto& diag =
                 context.addDiag(diag::ConstEvalCaseItemsNotUnique, item.pattern->sourceRange) << cv;
             diag.addNote(diag::NotePreviousMatch, matchRange);
-            break;
+            return false;
         }
 
         matchedStmt = item.stmt;
         matchRange = item.pattern->sourceRange;
 
-        if (check != UniquePriorityCheck::Unique && check != UniquePriorityCheck::Unique0)
-            break;
+        return check == UniquePriorityCheck::Unique || check == UniquePriorityCheck::Unique0;
+    };
+
+    // When the bind-time dispatch table is available, only the items listed
+    // for the active member can possibly match; the rest would just test
+    // their tag and fail, so skipping them can't change the result (or the
+    // uniqueness check).
+    if (!tagDispatch.empty() && cv.isUnion() && cv.unionVal()->activeMember &&
+        *cv.unionVal()->activeMember < tagDispatch.size()) {
+        for (uint32_t index : tagDispatch[*cv.unionVal()->activeMember]) {
+            if (!tryItem(items[index]))
+                break;
+        }
+    }
+    else {
+        for (auto& item : items) {
+            if (!tryItem(item))
+                break;
+        }
     }
 
+    if (failed)
+        return ER::Fail;
+
     if (!matchedStmt)
         matchedStmt = defaultCase;
 
@@ -1622,12 +1783,12 @@ private:
             auto& containingSym = astCtx.getContainingSymbol();
             for (auto& [expr, stateVec] : driverMap) {
                 for (auto& state : stateVec) {
-                    auto driver = comp.emplace<ValueDriver>(DriverKind::Procedural,
-                                                            *state.longestStaticPrefix,
-                                                            containingSym, AssignFlags::None);
+                    auto driverIndex = comp.addDriver(
+                        ValueDriver(DriverKind::Procedural, *state.longestStaticPrefix,
+                                    containingSym, AssignFlags::None));
 
                     for (auto it = state.intervals.begin(); it != state.intervals.end(); ++it)
-                        state.symbol->addDriver(it.bounds(), *driver);
+                        state.symbol->addDriver(it.bounds(), driverIndex);
 
                     state.intervals.clear(comp.getUnrollIntervalMapAllocator());
                 }
@@ -1651,6 +1812,164 @@ private:
     flat_hash_map<const AssignmentExpression*, SmallVector<PerAssignDriverState>> driverMap;
 };
 
+struct LoopVarUseVisitor : public ASTVisitor<LoopVarUseVisitor, true, true> {
+    const ValueSymbol& var;
+    bool used = false;
+
+    explicit LoopVarUseVisitor(const ValueSymbol& var) : var(var) {}
+
+    void handle(const NamedValueExpression& expr) {
+        if (&expr.symbol == &var)
+            used = true;
+    }
+
+    void handle(const HierarchicalValueExpression& expr) {
+        if (&expr.symbol == &var)
+            used = true;
+    }
+};
+
+// Detects the canonical affine loop shape described by AffineLoopInfo.
+// The detection is deliberately strict: the step must be a bare increment
+// or decrement of the loop variable, the condition must compare that same
+// variable (with no intervening conversion) against a bound that folds to
+// a compile-time constant, and the comparison direction must match the
+// step so that the loop can't rely on the variable wrapping around.
+static std::optional<ForLoopStatement::AffineLoopInfo> detectAffineLoop(
+    const ASTContext& context, const ForLoopStatement& loop) {
+
+    if (loop.steps.size() != 1 || loop.steps[0]->kind != ExpressionKind::UnaryOp || !loop.stopExpr ||
+        loop.stopExpr->kind != ExpressionKind::BinaryOp) {
+        return std::nullopt;
+    }
+
+    auto& step = loop.steps[0]->as<UnaryExpression>();
+    bool increment;
+    switch (step.op) {
+        case UnaryOperator::Preincrement:
+        case UnaryOperator::Postincrement:
+            increment = true;
+            break;
+        case UnaryOperator::Predecrement:
+        case UnaryOperator::Postdecrement:
+            increment = false;
+            break;
+        default:
+            return std::nullopt;
+    }
+
+    if (step.operand().kind != ExpressionKind::NamedValue)
+        return std::nullopt;
+
+    auto& var = step.operand().as<NamedValueExpression>().symbol;
+    auto& type = var.getType();
+    if (!type.isIntegral())
+        return std::nullopt;
+
+    // The machine counter is an int64, so the variable's whole range
+    // must be representable in one.
+    const uint32_t width = type.getBitWidth();
+    const bool isSigned = type.isSigned();
+    if (width > 64 || (!isSigned && width > 63))
+        return std::nullopt;
+
+    // One side of the comparison must be the loop variable and the other
+    // side must fold to a constant bound. If the variable is on the right,
+    // flip the operator so it reads as `var <op> bound`.
+    auto& stop = loop.stopExpr->as<BinaryExpression>();
+    auto isVar = [&](const Expression& expr) {
+        return expr.kind == ExpressionKind::NamedValue &&
+               &expr.as<NamedValueExpression>().symbol == &var;
+    };
+
+    BinaryOperator cmp = stop.op;
+    const Expression* boundExpr;
+    if (isVar(stop.left())) {
+        boundExpr = &stop.right();
+    }
+    else if (isVar(stop.right())) {
+        boundExpr = &stop.left();
+        switch (cmp) {
+            case BinaryOperator::LessThan:
+                cmp = BinaryOperator::GreaterThan;
+                break;
+            case BinaryOperator::LessThanEqual:
+                cmp = BinaryOperator::GreaterThanEqual;
+                break;
+            case BinaryOperator::GreaterThan:
+                cmp = BinaryOperator::LessThan;
+                break;
+            case BinaryOperator::GreaterThanEqual:
+                cmp = BinaryOperator::LessThanEqual;
+                break;
+            default:
+                break;
+        }
+    }
+    else {
+        return std::nullopt;
+    }
+
+    bool inclusive;
+    switch (cmp) {
+        case BinaryOperator::LessThan:
+        case BinaryOperator::LessThanEqual:
+            if (!increment)
+                return std::nullopt;
+            inclusive = cmp == BinaryOperator::LessThanEqual;
+            break;
+        case BinaryOperator::GreaterThan:
+        case BinaryOperator::GreaterThanEqual:
+            if (increment)
+                return std::nullopt;
+            inclusive = cmp == BinaryOperator::GreaterThanEqual;
+            break;
+        default:
+            return std::nullopt;
+    }
+
+    ConstantValue boundVal = context.tryEval(*boundExpr);
+    if (!boundVal.isInteger())
+        return std::nullopt;
+
+    auto bound = boundVal.integer().as<int64_t>();
+    if (!bound)
+        return std::nullopt;
+
+    // The loop exits with the variable holding the first value that fails
+    // the comparison, so that value must be representable in the variable's
+    // type; otherwise the real loop would have wrapped around instead.
+    int64_t typeMax, typeMin;
+    if (isSigned) {
+        typeMax = int64_t((uint64_t(1) << (width - 1)) - 1);
+        typeMin = -typeMax - 1;
+    }
+    else {
+        typeMax = int64_t((uint64_t(1) << width) - 1);
+        typeMin = 0;
+    }
+
+    if (increment) {
+        if (*bound > typeMax || (inclusive && *bound == typeMax))
+            return std::nullopt;
+    }
+    else {
+        if (*bound < typeMin || (inclusive && *bound == typeMin))
+            return std::nullopt;
+    }
+
+    LoopVarUseVisitor useVisitor(var);
+    loop.body.visit(useVisitor);
+
+    ForLoopStatement::AffineLoopInfo info;
+    info.var = &var;
+    info.bound = *bound;
+    info.inclusive = inclusive;
+    info.increment = increment;
+    info.bodyUsesVar = useVisitor.used;
+    return info;
+}
+
 Statement& ForLoopStatement::fromSyntax(Compilation& compilation,
                                         const ForLoopStatementSyntax& syntax,
                                         const ASTContext& context, StatementContext& stmtCtx) {
@@ -1727,6 +2046,8 @@ Statement& ForLoopStatement::fromSyntax(Compilation& compilation,
     if (bodyStmt.bad())
         return badStmt(compilation, result);
 
+    result->affineInfo = detectAffineLoop(context, *result);
+
     // If this is the top-level unrollable for loop, attempt the unrolling now.
     // If not top-level, just pop up the stack and let the parent loop handle us.
     if (wasFirst && !compilation.getOptions().strictDriverChecking &&
@@ -1737,12 +2058,91 @@ Statement& ForLoopStatement::fromSyntax(Compilation& compilation,
     return *result;
 }
 
+// Runs an affine-shaped loop with a machine integer counter instead of
+// evaluating the condition and step expression trees every iteration.
+// Returns std::nullopt if the runtime values don't cooperate, in which
+// case the caller's tree-walking loop picks up from the current state.
+static std::optional<ER> evalAffineLoop(EvalContext& context, const ForLoopStatement& loop) {
+    auto& info = *loop.affineInfo;
+    ConstantValue* storage = context.findLocal(info.var);
+    if (!storage || !storage->isInteger())
+        return std::nullopt;
+
+    auto init = storage->integer().as<int64_t>();
+    if (!init)
+        return std::nullopt;
+
+    const bitwidth_t width = storage->integer().getBitWidth();
+    const bool isSigned = storage->integer().isSigned();
+    auto materialize = [&](int64_t counter) {
+        *storage = SVInt(width, uint64_t(counter), isSigned);
+    };
+
+    int64_t counter = *init;
+    while (true) {
+        bool keepGoing = info.increment
+                             ? (info.inclusive ? counter <= info.bound : counter < info.bound)
+                             : (info.inclusive ? counter >= info.bound : counter > info.bound);
+        if (!keepGoing)
+            break;
+
+        if (info.bodyUsesVar)
+            materialize(counter);
+
+        ER result = loop.body.eval(context);
+        if (result != ER::Success) {
+            if (result == ER::Break) {
+                if (!info.bodyUsesVar)
+                    materialize(counter);
+                return ER::Success;
+            }
+            if (result != ER::Continue) {
+                if (!info.bodyUsesVar)
+                    materialize(counter);
+                return result;
+            }
+        }
+
+        if (info.bodyUsesVar) {
+            // The body might have assigned to the loop variable; resync the
+            // counter from its storage. If it no longer holds a simple
+            // two-state value, run the step once and hand the remainder of
+            // the loop back to the tree walker.
+            std::optional<int64_t> next;
+            if (storage->isInteger())
+                next = storage->integer().as<int64_t>();
+
+            if (!next) {
+                for (auto step : loop.steps) {
+                    if (!step->eval(context))
+                        return ER::Fail;
+                }
+                return std::nullopt;
+            }
+            counter = *next;
+        }
+
+        if (info.increment)
+            counter++;
+        else
+            counter--;
+    }
+
+    materialize(counter);
+    return ER::Success;
+}
+
 ER ForLoopStatement::evalImpl(EvalContext& context) const {
     for (auto init : initializers) {
         if (!init->eval(context))
             return ER::Fail;
     }
 
+    if (affineInfo) {
+        if (auto result = evalAffineLoop(context, *this))
+            return *result;
+    }
+
     while (true) {
         if (stopExpr) {
             auto result = stopExpr->eval(context);
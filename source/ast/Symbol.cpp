@@ -76,7 +76,8 @@ const DeclaredType* Symbol::getDeclaredType() const {
     }
 }
 
-static void getHierarchicalPathImpl(const Symbol& symbol, FormatBuffer& buffer) {
+static void getHierarchicalPathImpl(const Symbol& symbol, FormatBuffer& buffer,
+                                    flat_hash_map<const Symbol*, std::string>& cache) {
     auto scope = symbol.getParentScope();
     auto current = &symbol;
     if (scope && symbol.kind == SymbolKind::InstanceBody) {
@@ -90,7 +91,17 @@ static void getHierarchicalPathImpl(const Symbol& symbol, FormatBuffer& buffer)
     if (scope) {
         auto& parent = scope->asSymbol();
         if (parent.kind != SymbolKind::Root && parent.kind != SymbolKind::CompilationUnit) {
-            getHierarchicalPathImpl(parent, buffer);
+            // Ancestor paths are memoized since deep hierarchies format the
+            // same prefixes over and over across diagnostics.
+            if (auto it = cache.find(&parent); it != cache.end()) {
+                buffer.append(it->second);
+            }
+            else {
+                size_t start = buffer.size();
+                getHierarchicalPathImpl(parent, buffer, cache);
+                cache.emplace(&parent, std::string(buffer.data() + start,
+                                                   buffer.size() - start));
+            }
             if (parent.kind == SymbolKind::Package || parent.kind == SymbolKind::ClassType ||
                 parent.kind == SymbolKind::CovergroupType) {
                 separator = "::"sv;
@@ -143,12 +154,36 @@ static void getHierarchicalPathImpl(const Symbol& symbol, FormatBuffer& buffer)
 }
 
 void Symbol::getHierarchicalPath(std::string& result) const {
+    auto scope = getParentScope();
+    if (!scope) {
+        // No parent means no ancestors to memoize; just format directly.
+        FormatBuffer buffer;
+        flat_hash_map<const Symbol*, std::string> localCache;
+        getHierarchicalPathImpl(*this, buffer, localCache);
+        if (buffer.empty())
+            result.append("$unit");
+        else
+            result.append(buffer.data(), buffer.size());
+        return;
+    }
+
+    auto& cache = scope->getCompilation().hierPathCache;
+    if (auto it = cache.find(this); it != cache.end()) {
+        if (it->second.empty())
+            result.append("$unit");
+        else
+            result.append(it->second);
+        return;
+    }
+
     FormatBuffer buffer;
-    getHierarchicalPathImpl(*this, buffer);
-    if (buffer.empty())
-        buffer.append("$unit");
+    getHierarchicalPathImpl(*this, buffer, cache);
+    cache.emplace(this, std::string(buffer.data(), buffer.size()));
 
-    result.append(buffer.data(), buffer.size());
+    if (buffer.empty())
+        result.append("$unit");
+    else
+        result.append(buffer.data(), buffer.size());
 }
 
 static void getLexicalPathImpl(const Symbol& symbol, std::string& buffer) {
@@ -247,7 +282,10 @@ void Symbol::setAttributes(const Scope& scope,
     if (syntax.empty())
         return;
 
-    scope.getCompilation().setAttributes(*this, AttributeSymbol::fromSyntax(syntax, scope, *this));
+    // Binding is deferred until the attributes are first queried; gate-level
+    // netlists hang attributes off nearly every instance and most flows only
+    // ever read a handful of them.
+    scope.getCompilation().setAttributes(*this, syntax, scope);
 }
 
 const Scope* Symbol::scopeOrNull() const {
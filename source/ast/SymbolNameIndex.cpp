@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+// SymbolNameIndex.cpp
+// Compact on-disk index of symbol names for cross-run queries
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/SymbolNameIndex.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "slang/ast/ASTVisitor.h"
+#include "slang/ast/Compilation.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/Hash.h"
+
+namespace slang::ast {
+
+// File layout: four header words (magic, version, entry count, offset of the
+// string blob from the start of the file), then entryCount fixed-size entries
+// of EntryWords words each (name, path, kind, and file offsets into the
+// string blob, then line and column), then the null-terminated string blob.
+// Entries are sorted by name, ties broken by path, so lookups can binary
+// search; strings are deduplicated.
+static constexpr uint32_t IndexMagic = 0x58495653; // "SVIX"
+static constexpr uint32_t IndexVersion = 1;
+static constexpr size_t HeaderWords = 4;
+static constexpr size_t EntryWords = 6;
+
+namespace {
+
+struct BuildEntry {
+    std::string name;
+    std::string path;
+    std::string_view kind;
+    std::string_view file;
+    uint32_t line = 0;
+    uint32_t column = 0;
+};
+
+class IndexBuilder : public ASTVisitor<IndexBuilder, false, false> {
+public:
+    std::vector<BuildEntry> items;
+
+    explicit IndexBuilder(const SourceManager* sourceManager) : sourceManager(sourceManager) {}
+
+    template<typename T>
+    void handle(const T& node) {
+        if constexpr (std::is_base_of_v<Symbol, T>)
+            record(node);
+        visitDefault(node);
+    }
+
+    void handle(const InstanceSymbol& symbol) {
+        record(symbol);
+
+        // Instances of the same module can share an elaborated body;
+        // index each body only once.
+        if (visitedBodies.insert(&symbol.body).second)
+            symbol.body.visit(*this);
+    }
+
+private:
+    void record(const Symbol& symbol) {
+        if (symbol.name.empty())
+            return;
+
+        BuildEntry entry;
+        entry.name = symbol.name;
+        entry.kind = toString(symbol.kind);
+        symbol.getHierarchicalPath(entry.path);
+
+        if (sourceManager && symbol.location) {
+            entry.file = sourceManager->getFileName(symbol.location);
+            entry.line = (uint32_t)sourceManager->getLineNumber(symbol.location);
+            entry.column = (uint32_t)sourceManager->getColumnNumber(symbol.location);
+        }
+
+        items.emplace_back(std::move(entry));
+    }
+
+    const SourceManager* sourceManager;
+    flat_hash_set<const InstanceBodySymbol*> visitedBodies;
+};
+
+} // namespace
+
+std::string SymbolNameIndex::serialize(Compilation& compilation) {
+    IndexBuilder builder(compilation.getSourceManager());
+    compilation.getRoot().visit(builder);
+
+    auto& items = builder.items;
+    std::sort(items.begin(), items.end(), [](const BuildEntry& a, const BuildEntry& b) {
+        if (int cmp = a.name.compare(b.name); cmp != 0)
+            return cmp < 0;
+        return a.path < b.path;
+    });
+
+    // Build the deduplicated string blob. The items are stable now that
+    // they're sorted, so the pool can key on views into them.
+    std::string blob;
+    flat_hash_map<std::string_view, uint32_t> pool;
+    auto intern = [&](std::string_view s) {
+        auto [it, inserted] = pool.emplace(s, (uint32_t)blob.size());
+        if (inserted) {
+            blob += s;
+            blob += '\0';
+        }
+        return it->second;
+    };
+
+    std::string result;
+    result.reserve((HeaderWords + items.size() * EntryWords) * sizeof(uint32_t));
+    auto writeWord = [&](uint32_t w) { result.append((const char*)&w, sizeof(w)); };
+
+    writeWord(IndexMagic);
+    writeWord(IndexVersion);
+    writeWord((uint32_t)items.size());
+    writeWord((uint32_t)((HeaderWords + items.size() * EntryWords) * sizeof(uint32_t)));
+
+    for (auto& item : items) {
+        writeWord(intern(item.name));
+        writeWord(intern(item.path));
+        writeWord(intern(item.kind));
+        writeWord(intern(item.file));
+        writeWord(item.line);
+        writeWord(item.column);
+    }
+
+    result += blob;
+    return result;
+}
+
+std::optional<SymbolNameIndex> SymbolNameIndex::open(const std::filesystem::path& path) {
+    SymbolNameIndex result;
+
+    // The mapped view includes a null terminator past the end of the actual
+    // file contents; so does the fallback read. Trim it back off.
+    if (auto mapped = MappedFile::open(path)) {
+        result.mapped = std::move(*mapped);
+        auto view = result.mapped.view();
+        if (!result.init(view.substr(0, view.size() - 1)))
+            return std::nullopt;
+        return result;
+    }
+
+    if (!OS::readFile(path, result.buffer))
+        return std::nullopt;
+    if (!result.init(std::string_view(result.buffer.data(), result.buffer.size() - 1)))
+        return std::nullopt;
+    return result;
+}
+
+std::optional<SymbolNameIndex> SymbolNameIndex::fromMemory(std::string_view data) {
+    SymbolNameIndex result;
+    result.buffer.assign(data.begin(), data.end());
+    if (!result.init(std::string_view(result.buffer.data(), result.buffer.size())))
+        return std::nullopt;
+    return result;
+}
+
+bool SymbolNameIndex::init(std::string_view data) {
+    base = data.data();
+    if (data.size() < HeaderWords * sizeof(uint32_t))
+        return false;
+
+    if (word(0) != IndexMagic || word(1) != IndexVersion)
+        return false;
+
+    entryCount = word(2);
+    size_t stringOffset = word(3);
+    if (stringOffset != (HeaderWords + entryCount * EntryWords) * sizeof(uint32_t) ||
+        stringOffset > data.size()) {
+        return false;
+    }
+
+    strings = base + stringOffset;
+    stringsLen = data.size() - stringOffset;
+    return true;
+}
+
+uint32_t SymbolNameIndex::word(size_t index) const {
+    // The backing memory has no alignment guarantee, so load bytewise.
+    uint32_t w;
+    memcpy(&w, base + index * sizeof(uint32_t), sizeof(w));
+    return w;
+}
+
+std::string_view SymbolNameIndex::str(uint32_t offset) const {
+    if (offset >= stringsLen)
+        return {};
+
+    const char* s = strings + offset;
+    size_t maxLen = stringsLen - offset;
+    auto end = (const char*)memchr(s, '\0', maxLen);
+    return std::string_view(s, end ? size_t(end - s) : maxLen);
+}
+
+SymbolNameIndex::Entry SymbolNameIndex::entryAt(size_t index) const {
+    size_t w = HeaderWords + index * EntryWords;
+    Entry entry;
+    entry.name = str(word(w));
+    entry.path = str(word(w + 1));
+    entry.kind = str(word(w + 2));
+    entry.file = str(word(w + 3));
+    entry.line = word(w + 4);
+    entry.column = word(w + 5);
+    return entry;
+}
+
+std::vector<SymbolNameIndex::Entry> SymbolNameIndex::lookup(std::string_view name) const {
+    auto nameAt = [this](size_t index) { return str(word(HeaderWords + index * EntryWords)); };
+
+    size_t lo = 0, hi = entryCount;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (nameAt(mid) < name)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    std::vector<Entry> results;
+    for (; lo < entryCount; lo++) {
+        auto entry = entryAt(lo);
+        if (entry.name != name)
+            break;
+        results.push_back(entry);
+    }
+    return results;
+}
+
+} // namespace slang::ast
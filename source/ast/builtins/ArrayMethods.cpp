@@ -21,12 +21,47 @@ static bool isComparable(const Type& type) {
     return type.isNumeric() || type.isString();
 }
 
+// Several of the methods below have fast paths for the common case of an
+// array whose values are all two-state integers that fit in a machine word.
+// The values get extracted once into a flat buffer of raw bits, processed
+// there, and converted back at the end, instead of going element by element
+// through generic ConstantValue operations.
+template<typename TElements>
+static bool flattenInts(const TElements& elements, bitwidth_t bitWidth, std::vector<uint64_t>& out) {
+    out.reserve(elements.size());
+    for (auto& cv : elements) {
+        if (!cv.isInteger())
+            return false;
+
+        auto& sv = cv.integer();
+        if (sv.getBitWidth() != bitWidth || sv.hasUnknown())
+            return false;
+
+        out.push_back(sv.getRawPtr()[0]);
+    }
+    return true;
+}
+
+static bool flattenInts(const ConstantValue& arr, bitwidth_t bitWidth, std::vector<uint64_t>& out) {
+    if (arr.isQueue())
+        return flattenInts(*arr.queue(), bitWidth, out);
+    if (std::holds_alternative<ConstantValue::Elements>(arr.getVariant()))
+        return flattenInts(std::get<ConstantValue::Elements>(arr.getVariant()), bitWidth, out);
+    return false;
+}
+
+static int64_t signExtend(uint64_t value, bitwidth_t bitWidth) {
+    const uint32_t shift = 64 - bitWidth;
+    return int64_t(value << shift) >> shift;
+}
+
 class ArrayReductionMethod : public SystemSubroutine {
 public:
     using Operator = function_ref<void(SVInt&, const SVInt&)>;
+    using FlatOperator = function_ref<void(uint64_t&, const uint64_t&)>;
 
-    ArrayReductionMethod(const std::string& name, Operator op) :
-        SystemSubroutine(name, SubroutineKind::Function), op(op) {
+    ArrayReductionMethod(const std::string& name, Operator op, FlatOperator flatOp) :
+        SystemSubroutine(name, SubroutineKind::Function), op(op), flatOp(flatOp) {
         withClauseMode = WithClauseMode::Iterator;
     }
 
@@ -91,9 +126,17 @@ public:
             return result;
         }
         else {
-            if (arr.empty()) {
-                auto elemType = args[0]->type->getArrayElementType();
+            auto elemType = args[0]->type->getArrayElementType();
+            if (arr.empty())
                 return SVInt(elemType->getBitWidth(), 0, elemType->isSigned());
+
+            const bitwidth_t width = elemType->getBitWidth();
+            std::vector<uint64_t> flat;
+            if (width > 0 && width <= 64 && !arr.isMap() && flattenInts(arr, width, flat)) {
+                uint64_t result = flat[0];
+                for (size_t i = 1; i < flat.size(); i++)
+                    flatOp(result, flat[i]);
+                return SVInt(width, result, elemType->isSigned());
             }
 
             auto it = begin(arr);
@@ -107,6 +150,7 @@ public:
 
 private:
     Operator op;
+    FlatOperator flatOp;
 };
 
 class ArraySortMethod : public SystemSubroutine {
@@ -187,6 +231,30 @@ public:
         }
         else {
             auto sortTarget = [&](auto& target) {
+                // Sort raw machine integers when the elements allow it;
+                // comparing SVInts element by element is much slower.
+                auto elemType = args[0]->type->getArrayElementType();
+                const bitwidth_t width = elemType ? elemType->getBitWidth() : 0;
+                std::vector<uint64_t> flat;
+                if (width > 0 && width <= 64 && flattenInts(target, width, flat)) {
+                    if (elemType->isSigned()) {
+                        std::sort(flat.begin(), flat.end(), [width](uint64_t a, uint64_t b) {
+                            return signExtend(a, width) < signExtend(b, width);
+                        });
+                    }
+                    else {
+                        std::sort(flat.begin(), flat.end());
+                    }
+
+                    if (reversed)
+                        std::reverse(flat.begin(), flat.end());
+
+                    auto dest = target.begin();
+                    for (uint64_t val : flat)
+                        *dest++ = SVInt(width, val, elemType->isSigned());
+                    return;
+                }
+
                 if (reversed)
                     std::sort(target.rbegin(), target.rend());
                 else
@@ -406,7 +474,7 @@ public:
             auto it = begin(arr);
             auto guard = context.disableCaching();
             auto iterVal = context.createLocal(iterVar, *it);
-            ConstantValue elem = *it;
+            auto best = it;
             ConstantValue val = iterExpr->eval(context);
 
             for (++it; it != end(arr); ++it) {
@@ -415,33 +483,57 @@ public:
 
                 if (isMin) {
                     if (cv < val) {
-                        val = cv;
-                        elem = *it;
+                        val = std::move(cv);
+                        best = it;
                     }
                 }
                 else {
                     if (val < cv) {
-                        val = cv;
-                        elem = *it;
+                        val = std::move(cv);
+                        best = it;
                     }
                 }
             }
-            result.emplace_back(std::move(elem));
+            result.emplace_back(std::move(*best));
         }
         else {
+            auto elemType = args[0]->type->getArrayElementType();
+            const bitwidth_t width = elemType ? elemType->getBitWidth() : 0;
+            std::vector<uint64_t> flat;
+            if (width > 0 && width <= 64 && !arr.isMap() && flattenInts(arr, width, flat)) {
+                size_t best = 0;
+                if (elemType->isSigned()) {
+                    for (size_t i = 1; i < flat.size(); i++) {
+                        if (isMin ? signExtend(flat[i], width) < signExtend(flat[best], width)
+                                  : signExtend(flat[best], width) < signExtend(flat[i], width)) {
+                            best = i;
+                        }
+                    }
+                }
+                else {
+                    for (size_t i = 1; i < flat.size(); i++) {
+                        if (isMin ? flat[i] < flat[best] : flat[best] < flat[i])
+                            best = i;
+                    }
+                }
+
+                result.emplace_back(SVInt(width, flat[best], elemType->isSigned()));
+                return result;
+            }
+
             auto it = begin(arr);
-            ConstantValue elem = *it;
+            auto best = it;
             for (++it; it != end(arr); ++it) {
                 if (isMin) {
-                    if (*it < elem)
-                        elem = *it;
+                    if (*it < *best)
+                        best = it;
                 }
                 else {
-                    if (elem < *it)
-                        elem = *it;
+                    if (*best < *it)
+                        best = it;
                 }
             }
-            result.emplace_back(std::move(elem));
+            result.emplace_back(std::move(*best));
         }
 
         return result;
@@ -510,6 +602,22 @@ public:
             }
         }
         else {
+            auto elemType = args[0]->type->getArrayElementType();
+            const bitwidth_t width = elemType ? elemType->getBitWidth() : 0;
+            std::vector<uint64_t> flat;
+            if (width > 0 && width <= 64 && !arr.isMap() && flattenInts(arr, width, flat)) {
+                flat_hash_set<uint64_t> seen;
+                for (uint32_t index = 0; index < flat.size(); index++) {
+                    if (seen.emplace(flat[index]).second) {
+                        if (isIndexed)
+                            result.emplace_back(SVInt(32, index, true));
+                        else
+                            result.emplace_back(SVInt(width, flat[index], elemType->isSigned()));
+                    }
+                }
+                return result;
+            }
+
             uint32_t index = 0;
             flat_hash_set<ConstantValue> seen;
             for (auto it = begin(arr); it != end(arr); ++it, ++index) {
@@ -954,11 +1062,16 @@ void registerArrayMethods(Compilation& c) {
 
     for (auto kind : {SymbolKind::FixedSizeUnpackedArrayType, SymbolKind::DynamicArrayType,
                       SymbolKind::AssociativeArrayType, SymbolKind::QueueType}) {
-        REGISTER(kind, ArrayReduction, "or", [](auto& l, auto& r) { l |= r; });
-        REGISTER(kind, ArrayReduction, "and", [](auto& l, auto& r) { l &= r; });
-        REGISTER(kind, ArrayReduction, "xor", [](auto& l, auto& r) { l ^= r; });
-        REGISTER(kind, ArrayReduction, "sum", [](auto& l, auto& r) { l += r; });
-        REGISTER(kind, ArrayReduction, "product", [](auto& l, auto& r) { l *= r; });
+        REGISTER(kind, ArrayReduction, "or", [](auto& l, auto& r) { l |= r; },
+                 [](auto& l, auto& r) { l |= r; });
+        REGISTER(kind, ArrayReduction, "and", [](auto& l, auto& r) { l &= r; },
+                 [](auto& l, auto& r) { l &= r; });
+        REGISTER(kind, ArrayReduction, "xor", [](auto& l, auto& r) { l ^= r; },
+                 [](auto& l, auto& r) { l ^= r; });
+        REGISTER(kind, ArrayReduction, "sum", [](auto& l, auto& r) { l += r; },
+                 [](auto& l, auto& r) { l += r; });
+        REGISTER(kind, ArrayReduction, "product", [](auto& l, auto& r) { l *= r; },
+                 [](auto& l, auto& r) { l *= r; });
 
         REGISTER(kind, ArrayLocator, "find", ArrayLocatorMethod::All, false);
         REGISTER(kind, ArrayLocator, "find_index", ArrayLocatorMethod::All, true);
@@ -33,25 +33,11 @@ public:
         noHierarchical(context, *args[0]);
         const EnumType& type = args[0]->type->getCanonicalType().as<EnumType>();
 
-        auto range = type.values();
-        if (range.begin() == range.end())
+        auto list = type.valueList();
+        if (list.empty())
             return nullptr;
 
-        const EnumValueSymbol* value;
-        if (first) {
-            value = &*range.begin();
-        }
-        else {
-            for (auto it = range.begin();;) {
-                auto prev = it++;
-                if (it == range.end()) {
-                    value = &*prev;
-                    break;
-                }
-            }
-        }
-
-        return value->getValue();
+        return (first ? list.front() : list.back())->getValue();
     }
 
 private:
@@ -101,31 +87,14 @@ public:
             count.setSigned(true);
         }
 
-        std::optional<size_t> foundIndex;
-        SmallVector<const EnumValueSymbol*> values;
         const EnumType& type = args[0]->type->getCanonicalType().as<EnumType>();
-        auto& targetInt = val.integer();
-
-        // Get all values into an array for easier handling. Along the way,
-        // try to find the current value among the enum members.
-        size_t current = 0;
-        for (auto& enumerand : type.values()) {
-            auto& cv = enumerand.getValue();
-            if (!cv)
-                return nullptr;
-
-            if (cv.integer() == targetInt)
-                foundIndex = current;
-
-            values.push_back(&enumerand);
-            current++;
-        }
-
-        if (values.empty())
+        auto list = type.valueList();
+        if (list.empty())
             return nullptr;
 
         // If the current value is not in the set of enumerands, the spec
         // says we should return the default value.
+        auto foundIndex = type.findValueIndex(val.integer());
         if (!foundIndex.has_value())
             return type.getDefaultValue();
 
@@ -133,13 +102,13 @@ public:
             count = -count;
 
         // Handle wraparound for both zero and the size of the array.
-        SVInt size(33, values.size(), true);
+        SVInt size(33, list.size(), true);
         SVInt offset = SVInt(33, *foundIndex, true) + count;
         offset += (one - offset / size) * size;
 
-        count = offset % SVInt(33, values.size(), true);
+        count = offset % size;
         uint32_t i = count.as<uint32_t>().value();
-        return values[i]->getValue();
+        return list[i]->getValue();
     }
 
 private:
@@ -164,7 +133,7 @@ public:
         // Expression isn't actually evaluated here; we know the value to return at compile time.
         noHierarchical(context, *args[0]);
         const EnumType& type = args[0]->type->getCanonicalType().as<EnumType>();
-        return SVInt(32, (uint64_t)type.values().size(), true);
+        return SVInt(32, (uint64_t)type.valueList().size(), true);
     }
 };
 
@@ -181,16 +150,8 @@ public:
             return nullptr;
 
         const EnumType& type = args[0]->type->getCanonicalType().as<EnumType>();
-        auto& targetInt = val.integer();
-
-        for (auto& enumerand : type.values()) {
-            auto& cv = enumerand.getValue();
-            if (!cv)
-                return nullptr;
-
-            if (cv.integer() == targetInt)
-                return std::string(enumerand.name);
-        }
+        if (auto found = type.findValue(val.integer()))
+            return std::string(found->name);
 
         return ""s;
     }
@@ -250,7 +250,12 @@ Expression& Expression::convertAssignment(const ASTContext& context, const Type&
 
     Expression* result = &expr;
     const Type* rt = expr.type;
-    if (type.isEquivalent(*rt)) {
+
+    // Conversion legality is a pure function of the two types, so the
+    // verdicts are cached per type pair; netlists bind millions of
+    // assignments between the same handful of types.
+    auto compat = comp.getTypeCompat(type, *rt);
+    if (compat.isEquivalent) {
         selfDetermined(context, result);
         return *result;
     }
@@ -262,7 +267,7 @@ Expression& Expression::convertAssignment(const ASTContext& context, const Type&
         // If the connection is already of the right size and simply differs in
         // terms of four-statedness or signedness, don't bother trying to slice
         // out the connection.
-        if (type.getBitWidth() != rt->getBitWidth() || !type.isAssignmentCompatible(*rt)) {
+        if (type.getBitWidth() != rt->getBitWidth() || !compat.isAssignmentCompatible) {
             // If we have an lhsExpr here, this is an output (or inout) port being connected.
             // We need to pass the lhs in as the expression to be connected, since we can't
             // slice the port side. If lhsExpr is null, this is an input port and we should
@@ -291,7 +296,7 @@ Expression& Expression::convertAssignment(const ASTContext& context, const Type&
         }
     }
 
-    if (!type.isAssignmentCompatible(*rt)) {
+    if (!compat.isAssignmentCompatible) {
         if (expr.isImplicitlyAssignableTo(comp, type)) {
             return ConversionExpression::makeImplicit(context, type, ConversionKind::Implicit,
                                                       *result, location);
@@ -348,7 +353,7 @@ Expression& Expression::convertAssignment(const ASTContext& context, const Type&
         // propagated down to operands, not the sign flag. Once the expression is appropriately
         // sized, the makeImplicit call down below will convert the sign for us.
         rt = binaryOperatorType(comp, &type, rt, false, /* signednessFromRt */ true);
-        bool expanding = type.isEquivalent(*rt);
+        bool expanding = comp.getTypeCompat(type, *rt).isEquivalent;
         if (expanding)
             rt = &type;
 
@@ -1397,19 +1402,19 @@ static const Expression* matchElementValue(
     // Otherwise, we check first if the type is a struct or array, in which
     // case we descend recursively into its members before continuing on with the default.
     if (elementType.isStruct()) {
-        const Scope* structScope;
+        std::span<const FieldSymbol* const> fields;
         if (elementType.isUnpackedStruct())
-            structScope = &elementType.getCanonicalType().as<UnpackedStructType>();
+            fields = elementType.getCanonicalType().as<UnpackedStructType>().fields;
         else
-            structScope = &elementType.getCanonicalType().as<PackedStructType>();
+            fields = elementType.getCanonicalType().as<PackedStructType>().fields;
 
         SmallVector<const Expression*> elements;
-        for (auto& field : structScope->membersOfType<FieldSymbol>()) {
-            const Type& type = field.getType();
-            if (type.isError() || field.name.empty())
+        for (auto field : fields) {
+            const Type& type = field->getType();
+            if (type.isError() || field->name.empty())
                 return nullptr;
 
-            auto elemExpr = matchElementValue(context, type, &field, sourceRange, typeSetters,
+            auto elemExpr = matchElementValue(context, type, field, sourceRange, typeSetters,
                                               defaultSetter);
             if (!elemExpr)
                 return nullptr;
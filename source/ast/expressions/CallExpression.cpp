@@ -10,6 +10,7 @@
 #include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
 #include "slang/ast/Constraints.h"
+#include "slang/ast/EvalBytecode.h"
 #include "slang/ast/SystemSubroutine.h"
 #include "slang/ast/expressions/MiscExpressions.h"
 #include "slang/ast/expressions/SelectExpressions.h"
@@ -659,6 +660,15 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
     if (!context.pushFrame(symbol, sourceRange.start(), lookupLocation))
         return nullptr;
 
+    // If the function body has been compiled to bytecode, dispatch to that
+    // instead of walking the AST. Locals live in the bytecode's register
+    // file, so there's no need to create them in the frame.
+    if (auto code = context.compilation.getBytecode(symbol)) {
+        auto result = code->execute(context, args);
+        context.popFrame();
+        return result ? std::move(*result) : nullptr;
+    }
+
     std::span<const FormalArgumentSymbol* const> formals = symbol.getArguments();
     for (size_t i = 0; i < formals.size(); i++)
         context.createLocal(formals[i], args[i]);
@@ -63,8 +63,20 @@ Expression& IntegerLiteral::fromConstant(Compilation& compilation, const SVInt&
     SVInt val = value.resize(32);
     val.setSigned(true);
 
-    return *compilation.emplace<IntegerLiteral>(compilation, compilation.getIntType(),
-                                                std::move(val), true, SourceRange());
+    // These source-less literals are created for every compiler-generated
+    // select, overwhelmingly with the same small indices, so common values
+    // are handed out as shared flyweight nodes.
+    auto i32 = val.as<int32_t>();
+    if (i32) {
+        if (auto cached = compilation.getCachedIntLiteral(*i32))
+            return *cached;
+    }
+
+    auto& result = *compilation.emplace<IntegerLiteral>(compilation, compilation.getIntType(),
+                                                        std::move(val), true, SourceRange());
+    if (i32)
+        compilation.cacheIntLiteral(*i32, result);
+    return result;
 }
 
 ConstantValue IntegerLiteral::evalImpl(EvalContext&) const {
@@ -764,6 +764,26 @@ Expression& AssertionInstanceExpression::fromLookup(const Symbol& symbol,
             return badExpr(comp, nullptr);
     }
 
+    // Argument-less sequences and properties bind their bodies entirely in the
+    // declaration scope, so the result is identical at every instantiation site.
+    // Protocol checkers tend to instantiate the same few sequences in thousands
+    // of assertions; share one bound body across those sites and stamp out a
+    // per-site expression so diagnostics keep pointing at the right location.
+    // Instantiations nested inside another assertion expansion are skipped
+    // since lookups there can chase the outer instantiation context.
+    bool cacheable = formalPorts.empty() && orderedArgs.empty() && namedArgs.empty() &&
+                     !context.assertionInstance && symbol.kind != SymbolKind::LetDecl;
+    if (cacheable) {
+        if (auto cached = comp.getCachedAssertionInstance(symbol)) {
+            auto& aie = cached->as<AssertionInstanceExpression>();
+            auto result = comp.emplace<AssertionInstanceExpression>(
+                *type, symbol, aie.body, /* isRecursiveProperty */ false, range);
+            result->arguments = aie.arguments;
+            result->localVars = aie.localVars;
+            return *result;
+        }
+    }
+
     ASTContext::AssertionInstanceDetails instance;
     instance.symbol = &symbol;
     instance.prevContext = &context;
@@ -953,6 +973,11 @@ Expression& AssertionInstanceExpression::fromLookup(const Symbol& symbol,
     if (bad || body.bad())
         return badExpr(comp, result);
 
+    // Only successful binds are cached so that each bad instantiation
+    // site still gets diagnosed on its own.
+    if (cacheable)
+        comp.cacheAssertionInstance(symbol, *result);
+
     return *result;
 }
 
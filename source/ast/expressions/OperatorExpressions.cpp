@@ -515,7 +515,10 @@ ConstantValue UnaryExpression::evalImpl(EvalContext& context) const {
         ASSUME_UNREACHABLE;
     }
 
-    ConstantValue cv = operand().eval(context);
+    return evalUnaryOperator(op, operand().eval(context));
+}
+
+ConstantValue Expression::evalUnaryOperator(UnaryOperator op, const ConstantValue& cv) {
     if (!cv)
         return nullptr;
 
@@ -524,7 +527,7 @@ ConstantValue UnaryExpression::evalImpl(EvalContext& context) const {
         return v;
 
     if (cv.isInteger()) {
-        SVInt v = std::move(cv).integer();
+        const SVInt& v = cv.integer();
         switch (op) {
             OP(Plus, v);
             OP(Minus, -v);
@@ -570,30 +573,101 @@ void UnaryExpression::serializeTo(ASTSerializer& serializer) const {
     serializer.write("operand", operand());
 }
 
+static bool isBinaryOperatorSyntax(SyntaxKind kind) {
+    // The set of syntax kinds that Expression::create dispatches to
+    // BinaryExpression::fromSyntax; notably this excludes the compound
+    // assignment operators, which are also BinaryExpressionSyntax nodes.
+    switch (kind) {
+        case SyntaxKind::AddExpression:
+        case SyntaxKind::SubtractExpression:
+        case SyntaxKind::MultiplyExpression:
+        case SyntaxKind::DivideExpression:
+        case SyntaxKind::ModExpression:
+        case SyntaxKind::BinaryAndExpression:
+        case SyntaxKind::BinaryOrExpression:
+        case SyntaxKind::BinaryXorExpression:
+        case SyntaxKind::BinaryXnorExpression:
+        case SyntaxKind::EqualityExpression:
+        case SyntaxKind::InequalityExpression:
+        case SyntaxKind::CaseEqualityExpression:
+        case SyntaxKind::CaseInequalityExpression:
+        case SyntaxKind::GreaterThanEqualExpression:
+        case SyntaxKind::GreaterThanExpression:
+        case SyntaxKind::LessThanEqualExpression:
+        case SyntaxKind::LessThanExpression:
+        case SyntaxKind::WildcardEqualityExpression:
+        case SyntaxKind::WildcardInequalityExpression:
+        case SyntaxKind::LogicalAndExpression:
+        case SyntaxKind::LogicalOrExpression:
+        case SyntaxKind::LogicalImplicationExpression:
+        case SyntaxKind::LogicalEquivalenceExpression:
+        case SyntaxKind::LogicalShiftLeftExpression:
+        case SyntaxKind::LogicalShiftRightExpression:
+        case SyntaxKind::ArithmeticShiftLeftExpression:
+        case SyntaxKind::ArithmeticShiftRightExpression:
+        case SyntaxKind::PowerExpression:
+            return true;
+        default:
+            return false;
+    }
+}
+
 Expression& BinaryExpression::fromSyntax(Compilation& compilation,
                                          const BinaryExpressionSyntax& syntax,
                                          const ASTContext& context) {
-    // If we are allowed unbounded literals here, pass that along to subexpressions.
-    bitmask<ASTFlags> flags = ASTFlags::None;
-    if (context.flags.has(ASTFlags::AllowUnboundedLiteral) &&
-        context.flags.has(ASTFlags::AllowUnboundedLiteralArithmetic)) {
-        flags = ASTFlags::AllowUnboundedLiteral;
-    }
+    auto extraFlagsFor = [](const ASTContext& ctx, BinaryOperator op) {
+        // If we are allowed unbounded literals here, pass that along to subexpressions.
+        bitmask<ASTFlags> flags = ASTFlags::None;
+        if (ctx.flags.has(ASTFlags::AllowUnboundedLiteral) &&
+            ctx.flags.has(ASTFlags::AllowUnboundedLiteralArithmetic)) {
+            flags = ASTFlags::AllowUnboundedLiteral;
+        }
+
+        if (op == BinaryOperator::Equality || op == BinaryOperator::Inequality ||
+            op == BinaryOperator::CaseEquality || op == BinaryOperator::CaseInequality) {
+            flags |= ASTFlags::AllowTypeReferences;
+        }
+        return flags;
+    };
+
+    // Generated code commonly contains enormous left-leaning operator chains
+    // that would otherwise recurse once per term. Collect the left spine with
+    // an explicit stack and fold it back up in a loop, binding each node with
+    // exactly the context it would have seen recursively.
+    struct SpineEntry {
+        const BinaryExpressionSyntax* syntax;
+        BinaryOperator op;
+        ASTContext context;
+    };
+    SmallVector<SpineEntry, 4> spine;
+
+    auto childContextFor = [&](const SpineEntry& entry) {
+        return entry.context.resetFlags(extraFlagsFor(entry.context, entry.op));
+    };
 
-    auto op = getBinaryOperator(syntax.kind);
-    if (op == BinaryOperator::Equality || op == BinaryOperator::Inequality ||
-        op == BinaryOperator::CaseEquality || op == BinaryOperator::CaseInequality) {
-        flags |= ASTFlags::AllowTypeReferences;
+    spine.push_back({&syntax, getBinaryOperator(syntax.kind), context});
+    while (isBinaryOperatorSyntax(spine.back().syntax->left->kind)) {
+        auto& left = spine.back().syntax->left->as<BinaryExpressionSyntax>();
+        auto childContext = childContextFor(spine.back());
+        spine.push_back({&left, getBinaryOperator(left.kind), childContext});
     }
 
-    Expression& lhs = create(compilation, *syntax.left, context, flags);
-    Expression& rhs = create(compilation, *syntax.right, context, flags);
+    Expression* lhs = &create(compilation, *spine.back().syntax->left,
+                              childContextFor(spine.back()));
 
-    auto& result = fromComponents(lhs, rhs, op, syntax.operatorToken.location(),
-                                  syntax.sourceRange(), context);
-    context.setAttributes(result, syntax.attributes);
+    while (!spine.empty()) {
+        auto& entry = spine.back();
+        Expression& rhs = create(compilation, *entry.syntax->right, childContextFor(entry));
 
-    return result;
+        auto& result = fromComponents(*lhs, rhs, entry.op, entry.syntax->operatorToken.location(),
+                                      entry.syntax->sourceRange(), entry.context);
+        entry.context.setAttributes(result, entry.syntax->attributes);
+
+        lhs = &result;
+        spine.pop_back();
+    }
+
+    return *lhs;
 }
 
 Expression& BinaryExpression::fromComponents(Expression& lhs, Expression& rhs, BinaryOperator op,
@@ -814,7 +888,7 @@ Expression& BinaryExpression::fromComponents(Expression& lhs, Expression& rhs, B
     return *result;
 }
 
-bool BinaryExpression::propagateType(const ASTContext& context, const Type& newType) {
+static bool propagatesToLeft(BinaryOperator op) {
     switch (op) {
         case BinaryOperator::Add:
         case BinaryOperator::Subtract:
@@ -825,40 +899,18 @@ bool BinaryExpression::propagateType(const ASTContext& context, const Type& newT
         case BinaryOperator::BinaryOr:
         case BinaryOperator::BinaryXor:
         case BinaryOperator::BinaryXnor:
-            type = &newType;
-            contextDetermined(context, left_, newType);
-            contextDetermined(context, right_, newType);
-            return true;
-        case BinaryOperator::Equality:
-        case BinaryOperator::Inequality:
-        case BinaryOperator::CaseEquality:
-        case BinaryOperator::CaseInequality:
-        case BinaryOperator::GreaterThanEqual:
-        case BinaryOperator::GreaterThan:
-        case BinaryOperator::LessThanEqual:
-        case BinaryOperator::LessThan:
-        case BinaryOperator::WildcardEquality:
-        case BinaryOperator::WildcardInequality:
-        case BinaryOperator::LogicalAnd:
-        case BinaryOperator::LogicalOr:
-        case BinaryOperator::LogicalImplication:
-        case BinaryOperator::LogicalEquivalence:
-            // Type is already set (always 1 bit) and operands are already folded.
-            return false;
         case BinaryOperator::LogicalShiftLeft:
         case BinaryOperator::LogicalShiftRight:
         case BinaryOperator::ArithmeticShiftLeft:
         case BinaryOperator::ArithmeticShiftRight:
         case BinaryOperator::Power:
-            // Only the left hand side gets propagated; the rhs is self determined.
-            type = &newType;
-            contextDetermined(context, left_, newType);
             return true;
+        default:
+            return false;
     }
-    ASSUME_UNREACHABLE;
 }
 
-std::optional<bitwidth_t> BinaryExpression::getEffectiveWidthImpl() const {
+static bool propagatesToRight(BinaryOperator op) {
     switch (op) {
         case BinaryOperator::Add:
         case BinaryOperator::Subtract:
@@ -869,7 +921,75 @@ std::optional<bitwidth_t> BinaryExpression::getEffectiveWidthImpl() const {
         case BinaryOperator::BinaryOr:
         case BinaryOperator::BinaryXor:
         case BinaryOperator::BinaryXnor:
-            return std::max(left().getEffectiveWidth(), right().getEffectiveWidth());
+            return true;
+        default:
+            // For the shift and power operators the rhs is self determined.
+            return false;
+    }
+}
+
+bool BinaryExpression::propagateType(const ASTContext& context, const Type& newType) {
+    // Comparisons and the logical operators: type is already set (always
+    // 1 bit) and operands are already folded.
+    if (!propagatesToLeft(op))
+        return false;
+
+    // Operator chains tens of thousands of terms long are bound iteratively
+    // (see fromSyntax), so type propagation has to walk them iteratively too
+    // or it reintroduces the one-stack-frame-per-term recursion. Descend the
+    // left spine in place whenever the propagation visitor would have pushed
+    // the type down without inserting a conversion; everything else goes
+    // through the normal recursive path.
+    auto expr = this;
+    while (true) {
+        expr->type = &newType;
+        if (propagatesToRight(expr->op))
+            contextDetermined(context, expr->right_, newType);
+
+        auto left = expr->left_;
+        if (left->kind == ExpressionKind::BinaryOp && !left->bad() &&
+            ((newType.isFloating() && left->type->isFloating()) ||
+             (newType.isIntegral() && left->type->isIntegral()) || newType.isString())) {
+            // This is exactly the case where the visitor would have called
+            // propagateType on the left child and gotten true back, skipping
+            // the conversion; continue with it directly.
+            auto& leftBin = left->as<BinaryExpression>();
+            if (propagatesToLeft(leftBin.op)) {
+                expr = &leftBin;
+                continue;
+            }
+        }
+
+        contextDetermined(context, expr->left_, newType);
+        return true;
+    }
+}
+
+std::optional<bitwidth_t> BinaryExpression::getEffectiveWidthImpl() const {
+    switch (op) {
+        case BinaryOperator::Add:
+        case BinaryOperator::Subtract:
+        case BinaryOperator::Multiply:
+        case BinaryOperator::Divide:
+        case BinaryOperator::Mod:
+        case BinaryOperator::BinaryAnd:
+        case BinaryOperator::BinaryOr:
+        case BinaryOperator::BinaryXor:
+        case BinaryOperator::BinaryXnor: {
+            // Walk the left spine iteratively so long operator chains don't
+            // recurse per term; see propagateType.
+            auto expr = this;
+            auto result = right().getEffectiveWidth();
+            while (expr->left().kind == ExpressionKind::BinaryOp) {
+                auto& leftBin = expr->left().as<BinaryExpression>();
+                if (!propagatesToRight(leftBin.op))
+                    break;
+
+                expr = &leftBin;
+                result = std::max(result, expr->right().getEffectiveWidth());
+            }
+            return std::max(result, expr->left().getEffectiveWidth());
+        }
         case BinaryOperator::LogicalShiftLeft:
         case BinaryOperator::LogicalShiftRight:
         case BinaryOperator::ArithmeticShiftLeft:
@@ -922,7 +1042,7 @@ ConstantValue BinaryExpression::evalImpl(EvalContext& context) const {
     if (!cvr)
         return nullptr;
 
-    return evalBinaryOperator(op, cvl, cvr);
+    return evalBinaryOperator(op, std::move(cvl), cvr);
 }
 
 void BinaryExpression::serializeTo(ASTSerializer& serializer) const {
@@ -2195,4 +2315,42 @@ ConstantValue Expression::evalBinaryOperator(BinaryOperator op, const ConstantVa
     ASSUME_UNREACHABLE;
 }
 
+ConstantValue Expression::evalBinaryOperator(BinaryOperator op, ConstantValue&& cvl,
+                                             const ConstantValue& cvr) {
+    if (!cvl || !cvr)
+        return nullptr;
+
+    // The arithmetic and bitwise operators can compute directly into the
+    // left operand's storage since we own it; everything else produces a
+    // new value anyway so just defer to the copying overload.
+    if (cvl.isInteger() && cvr.isInteger()) {
+        SVInt& l = cvl.integer();
+        const SVInt& r = cvr.integer();
+        switch (op) {
+            case BinaryOperator::Add:
+                l += r;
+                return std::move(cvl);
+            case BinaryOperator::Subtract:
+                l -= r;
+                return std::move(cvl);
+            case BinaryOperator::Multiply:
+                l *= r;
+                return std::move(cvl);
+            case BinaryOperator::BinaryAnd:
+                l &= r;
+                return std::move(cvl);
+            case BinaryOperator::BinaryOr:
+                l |= r;
+                return std::move(cvl);
+            case BinaryOperator::BinaryXor:
+                l ^= r;
+                return std::move(cvl);
+            default:
+                break;
+        }
+    }
+
+    return evalBinaryOperator(op, cvl, cvr);
+}
+
 } // namespace slang::ast
@@ -127,6 +127,22 @@ bool requireLValueHelper(const T& expr, const ASTContext& context, SourceLocatio
     return val.requireLValue(context, location, flags, longestStaticPrefix);
 }
 
+// Builds the normalized SelectInfo for a select of a value of the given
+// type, or std::nullopt if the type doesn't have a fixed index range.
+static std::optional<SelectInfo> computeSelectInfo(const Type& valueType) {
+    if (!valueType.hasFixedRange())
+        return std::nullopt;
+
+    SelectInfo info;
+    info.valueRange = valueType.getFixedRange();
+    if (valueType.isUnpackedArray())
+        info.unpacked = true;
+    else if (valueType.isPackedArray())
+        info.elementWidth = int32_t(valueType.getArrayElementType()->getBitWidth());
+
+    return info;
+}
+
 Expression& ElementSelectExpression::fromSyntax(Compilation& compilation, Expression& value,
                                                 const ExpressionSyntax& syntax,
                                                 SourceRange fullRange, const ASTContext& context) {
@@ -170,6 +186,8 @@ Expression& ElementSelectExpression::fromSyntax(Compilation& compilation, Expres
     if (value.bad() || selector->bad() || result->bad())
         return badExpr(compilation, result);
 
+    result->selectInfo = computeSelectInfo(valueType);
+
     // If the selector is constant, and the underlying type has a fixed range,
     // we can do checking at compile time that it's within bounds.
     // Only do that if we're not in an unevaluated conditional branch.
@@ -209,6 +227,7 @@ Expression& ElementSelectExpression::fromConstant(Compilation& compilation, Expr
     if (value.bad() || indexExpr->bad() || result->bad())
         return badExpr(compilation, result);
 
+    result->selectInfo = computeSelectInfo(*value.type);
     return *result;
 }
 
@@ -343,8 +362,8 @@ std::optional<ConstantRange> ElementSelectExpression::evalIndex(EvalContext& con
         return std::nullopt;
     }
 
-    if (valType.hasFixedRange()) {
-        ConstantRange range = valType.getFixedRange();
+    if (selectInfo) {
+        ConstantRange range = selectInfo->valueRange;
         if (!range.containsPoint(*index)) {
             if (!warnedAboutIndex)
                 context.addDiag(diag::IndexOOB, sourceRange) << cs << valType;
@@ -352,7 +371,7 @@ std::optional<ConstantRange> ElementSelectExpression::evalIndex(EvalContext& con
             return std::nullopt;
         }
 
-        if (valType.isUnpackedArray()) {
+        if (selectInfo->unpacked) {
             // Unpacked arrays are stored reversed in memory, so reverse the range here.
             range = range.reverse();
             int32_t i = range.translateIndex(*index);
@@ -361,7 +380,7 @@ std::optional<ConstantRange> ElementSelectExpression::evalIndex(EvalContext& con
 
         // For packed arrays, we're selecting bit ranges, not necessarily single bits,
         // so multiply out by the width of each element.
-        int32_t width = (int32_t)type->getBitWidth();
+        int32_t width = selectInfo->elementWidth;
         int32_t i = range.translateIndex(*index) * width;
         return ConstantRange{i + width - 1, i};
     }
@@ -475,6 +494,8 @@ Expression& RangeSelectExpression::fromSyntax(Compilation& compilation, Expressi
     // Selects of vectored nets are disallowed.
     checkForVectoredSelect(value, fullRange, context);
 
+    result->selectInfo = computeSelectInfo(valueType);
+
     if (!valueType.hasFixedRange() && context.flags.has(ASTFlags::NonProcedural)) {
         context.addDiag(diag::DynamicNotProcedural, fullRange);
         return badExpr(compilation, result);
@@ -651,6 +672,8 @@ Expression& RangeSelectExpression::fromConstant(Compilation& compilation, Expres
     ASSERT(range.isLittleEndian() == valueType.getFixedRange().isLittleEndian());
     ASSERT(valueType.hasFixedRange());
 
+    result->selectInfo = computeSelectInfo(valueType);
+
     if (valueType.isUnpackedArray()) {
         result->type = &FixedSizeUnpackedArrayType::fromDim(*context.scope, elementType, range,
                                                             result->sourceRange);
@@ -738,9 +761,7 @@ std::optional<ConstantRange> RangeSelectExpression::evalRange(EvalContext& conte
         result = {*li, *ri};
     }
     else {
-        bool isLittleEndian = false;
-        if (valueType.hasFixedRange())
-            isLittleEndian = valueType.getFixedRange().isLittleEndian();
+        bool isLittleEndian = selectInfo && selectInfo->valueRange.isLittleEndian();
 
         auto range = ConstantRange::getIndexedRange(*li, *ri, isLittleEndian,
                                                     selectionKind == RangeSelectionKind::IndexedUp);
@@ -752,8 +773,8 @@ std::optional<ConstantRange> RangeSelectExpression::evalRange(EvalContext& conte
         result = *range;
     }
 
-    if (valueType.hasFixedRange()) {
-        ConstantRange valueRange = valueType.getFixedRange();
+    if (selectInfo) {
+        ConstantRange valueRange = selectInfo->valueRange;
         if (!warnedAboutRange &&
             (!valueRange.containsPoint(result.left) || !valueRange.containsPoint(result.right))) {
             auto& diag = context.addDiag(diag::RangeOOB, sourceRange);
@@ -761,18 +782,17 @@ std::optional<ConstantRange> RangeSelectExpression::evalRange(EvalContext& conte
             diag << valueType;
         }
 
-        if (!valueType.isPackedArray()) {
-            if (valueType.isUnpackedArray()) {
-                // Unpacked arrays are stored reversed in memory, so reverse the range here.
-                valueRange = valueRange.reverse();
-            }
+        if (selectInfo->unpacked) {
+            // Unpacked arrays are stored reversed in memory, so reverse the range here.
+            valueRange = valueRange.reverse();
             result.left = valueRange.translateIndex(result.left);
             result.right = valueRange.translateIndex(result.right);
             return result;
         }
 
-        // For packed arrays we're potentially selecting multi-bit elements.
-        int32_t width = (int32_t)valueType.getArrayElementType()->getBitWidth();
+        // For packed types we're potentially selecting multi-bit elements;
+        // the element width is 1 for plain bit vectors.
+        int32_t width = selectInfo->elementWidth;
         result.left = valueRange.translateIndex(result.left) * width + width - 1;
         result.right = valueRange.translateIndex(result.right) * width;
 
@@ -570,6 +570,22 @@ static uint64_t getGenerateLoopCount(const Scope& parent) {
     return count ? count : 1;
 }
 
+static bool referencesName(const SyntaxNode& node, std::string_view name) {
+    size_t count = node.getChildCount();
+    for (size_t i = 0; i < count; i++) {
+        if (auto child = node.childNode(i)) {
+            if (referencesName(*child, name))
+                return true;
+        }
+        else {
+            Token token = node.childToken(i);
+            if (token.kind == TokenKind::Identifier && token.valueText() == name)
+                return true;
+        }
+    }
+    return false;
+}
+
 GenerateBlockArraySymbol& GenerateBlockArraySymbol::fromSyntax(Compilation& compilation,
                                                                const LoopGenerateSyntax& syntax,
                                                                SymbolIndex scopeIndex,
@@ -713,6 +729,14 @@ GenerateBlockArraySymbol& GenerateBlockArraySymbol::fromSyntax(Compilation& comp
 
     // If the generate loop completed successfully, go through and create blocks.
     if (result->valid) {
+        // If the body never mentions the genvar by name, every instantiated
+        // entry elaborates to the same thing; note that here so that the
+        // design-wide checking pass can visit just the first entry. A plain
+        // textual scan is conservative but cheap -- it runs once per loop,
+        // not per iteration.
+        if (indices.size() > 1)
+            result->genvarIndependent = !referencesName(*syntax.block, genvar.valueText());
+
         bool isUninstantiated = context.scope->isUninstantiated();
         for (auto& index : indices)
             createBlock(index, isUninstantiated);
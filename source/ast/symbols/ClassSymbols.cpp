@@ -761,11 +761,21 @@ const Type* GenericClassDefSymbol::getDefaultSpecialization() const {
 const Type& GenericClassDefSymbol::getSpecialization(
     const ASTContext& context, const ParameterValueAssignmentSyntax& syntax) const {
 
+    // A given parameter assignment syntax bound in a given scope always resolves
+    // to the same specialization, so remember the result per site. Registry-style
+    // classes get specialized with identical arguments from a huge number of
+    // places; this skips re-binding and re-evaluating the parameter expressions
+    // when the same site is queried again.
+    auto siteKey = std::make_tuple((const SyntaxNode*)&syntax, context.scope.get());
+    if (auto it = specSiteMap.find(siteKey); it != specSiteMap.end())
+        return *it->second;
+
     auto result = getSpecializationImpl(context, syntax.getFirstToken().location(),
                                         /* forceInvalidParams */ false, &syntax);
     if (!result)
         return context.getCompilation().getErrorType();
 
+    specSiteMap.emplace(siteKey, result);
     return *result;
 }
 
@@ -834,7 +844,10 @@ const Type* GenericClassDefSymbol::getSpecializationImpl(
         }
     }
 
-    SpecializationKey key(*this, paramValues.copy(comp), typeParams.copy(comp));
+    // Look up the hashed parameter signature first with a key that borrows the
+    // local value arrays; only copy them into permanent memory if we actually
+    // need to insert a new entry.
+    SpecializationKey key(*this, paramValues, typeParams);
     if (auto it = specMap.find(key); it != specMap.end())
         return it->second;
 
@@ -845,7 +858,8 @@ const Type* GenericClassDefSymbol::getSpecializationImpl(
         specializeFunc(comp, *classType);
     else
         classType->populate(*scope, getSyntax()->as<ClassDeclarationSyntax>());
-    specMap.emplace(key, classType);
+    specMap.emplace(SpecializationKey(*this, paramValues.copy(comp), typeParams.copy(comp)),
+                    classType);
     return classType;
 }
 
@@ -75,6 +75,8 @@ PackageSymbol& PackageSymbol::fromSyntax(const Scope& scope, const ModuleDeclara
     std::optional<SourceRange> precisionRange;
     SmallVector<const PackageImportItemSyntax*> exportDecls;
 
+    result->reserveMembers(syntax.members.size());
+
     for (auto member : syntax.members) {
         if (member->kind == SyntaxKind::TimeUnitsDeclaration) {
             if (!result->timeScale)
@@ -106,10 +108,44 @@ PackageSymbol& PackageSymbol::fromSyntax(const Scope& scope, const ModuleDeclara
     return *result;
 }
 
+// Computes the filter word index and probe mask for the given name; the
+// filter is a blocked bloom filter that sets two bits within a single word
+// so a probe costs one hash and one memory access. The word count is always
+// a power of two.
+static std::pair<size_t, uint64_t> importFilterProbe(std::string_view name, size_t numWords) {
+    uint64_t h = Hasher<std::string_view>()(name);
+    uint64_t mask = (1ull << (h & 63)) | (1ull << ((h >> 6) & 63));
+    return {size_t(h >> 12) & (numWords - 1), mask};
+}
+
 const Symbol* PackageSymbol::findForImport(std::string_view lookupName) const {
-    auto sym = find(lookupName);
-    if (sym)
-        return sym;
+    // Every wildcard import in scope probes this package for every name that
+    // misses locally, so put a name filter in front of the full lookup. Build
+    // it from the name map on first use; by then the package is elaborated
+    // and the map is stable. Sized at sixteen bits per name the false
+    // positive rate stays negligible.
+    if (importNameFilter.empty()) {
+        auto& map = getNameMap();
+        size_t numWords = std::bit_ceil(std::max<size_t>(map.size() / 4, 1));
+
+        auto& comp = getCompilation();
+        auto words = reinterpret_cast<uint64_t*>(
+            comp.allocate(numWords * sizeof(uint64_t), alignof(uint64_t)));
+        std::fill_n(words, numWords, 0);
+
+        for (auto& [memberName, _] : map) {
+            auto [word, mask] = importFilterProbe(memberName, numWords);
+            words[word] |= mask;
+        }
+
+        importNameFilter = {words, numWords};
+    }
+
+    auto [word, mask] = importFilterProbe(lookupName, importNameFilter.size());
+    if ((importNameFilter[word] & mask) == mask) {
+        if (auto sym = find(lookupName))
+            return sym;
+    }
 
     if (!hasExportAll && exportDecls.empty())
         return nullptr;
@@ -94,6 +94,12 @@ private:
 
     Symbol* createInstance(const HierarchicalInstanceSyntax& syntax,
                            const HierarchyOverrideNode* overrideNode) {
+        // Note that each instance gets its own body, even when the definition and
+        // parameter values are identical. Bodies cannot be shared between instances
+        // because hierarchical references can reach into any individual instance
+        // (affecting driver tracking, defparams, and binds) and because each body's
+        // parentInstance back-pointer establishes its place in the hierarchy.
+        // Body creation is shallow though; members are elaborated lazily.
         paramBuilder.setOverrides(overrideNode);
         auto [name, loc] = getNameLoc(syntax);
         auto inst = compilation.emplace<InstanceSymbol>(compilation, name, loc, definition,
@@ -599,6 +605,7 @@ InstanceBodySymbol& InstanceBodySymbol::fromDefinition(Compilation& comp,
     auto overrideNode = paramBuilder.getOverrides();
     auto result = comp.emplace<InstanceBodySymbol>(comp, definition, overrideNode, isUninstantiated,
                                                    isFromBind);
+    comp.noteInstanceCreated();
 
     auto& declSyntax = definition.syntax;
     result->setSyntax(declSyntax);
@@ -624,6 +631,7 @@ InstanceBodySymbol& InstanceBodySymbol::fromDefinition(Compilation& comp,
         result->addMembers(*declSyntax.header->ports);
 
     // Finally add members from the body.
+    result->reserveMembers(declSyntax.members.size());
     for (auto member : declSyntax.members) {
         // If this is a parameter declaration we will create the symbol manually
         // as we need to apply any overrides.
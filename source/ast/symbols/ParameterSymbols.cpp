@@ -105,7 +105,7 @@ const ConstantValue& ParameterSymbol::getValue(SourceRange referencingRange) con
             evaluating = true;
             auto guard = ScopeGuard([this] { evaluating = false; });
 
-            value = scope->getCompilation().allocConstant(
+            value = scope->getCompilation().internConstant(
                 ctx.eval(*init, EvalFlags::AllowUnboundedPlaceholder));
 
             // If this parameter has an implicit type declared and it was assigned
@@ -126,7 +126,7 @@ const ConstantValue& ParameterSymbol::getValue(SourceRange referencingRange) con
         auto scope = getParentScope();
         ASSERT(scope);
 
-        value = scope->getCompilation().allocConstant(getType().coerceValue(*value));
+        value = scope->getCompilation().internConstant(getType().coerceValue(*value));
         needsCoercion = false;
     }
 
@@ -145,7 +145,7 @@ bool ParameterSymbol::isOverridden() const {
 
 void ParameterSymbol::setValue(Compilation& compilation, ConstantValue newValue,
                                bool newNeedsCoercion) {
-    value = compilation.allocConstant(std::move(newValue));
+    value = compilation.internConstant(std::move(newValue));
     needsCoercion = newNeedsCoercion;
 }
 
@@ -422,7 +422,7 @@ const ConstantValue& SpecparamSymbol::getValue(SourceRange referencingRange) con
             auto guard = ScopeGuard([this] { evaluating = false; });
 
             auto& comp = scope->getCompilation();
-            value1 = comp.allocConstant(ctx.eval(*init, EvalFlags::SpecparamsAllowed));
+            value1 = comp.internConstant(ctx.eval(*init, EvalFlags::SpecparamsAllowed));
 
             // Specparams can also be a "PATHPULSE$" which has two values to bind.
             auto syntax = getSyntax();
@@ -432,7 +432,7 @@ const ConstantValue& SpecparamSymbol::getValue(SourceRange referencingRange) con
             if (auto exprSyntax = decl.value2) {
                 auto& expr2 = Expression::bindRValue(getType(), *exprSyntax, decl.equals.location(),
                                                      ctx);
-                value2 = comp.allocConstant(ctx.eval(expr2, EvalFlags::SpecparamsAllowed));
+                value2 = comp.internConstant(ctx.eval(expr2, EvalFlags::SpecparamsAllowed));
             }
             else {
                 value2 = &ConstantValue::Invalid;
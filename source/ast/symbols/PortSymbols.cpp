@@ -908,6 +908,11 @@ public:
     }
 
     PortConnection* getIfaceConnection(const InterfacePortSymbol& port) {
+        // Interface connections can resolve differently per array element
+        // (the connection may slice an interface array across the rows), so
+        // a connection list containing one is never cached.
+        shapesValid = false;
+
         // If the port definition is empty it means an error already
         // occurred; there's no way to check this connection so early out.
         if (port.isInvalid() || port.name.empty()) {
@@ -997,12 +1002,27 @@ public:
         }
     }
 
+    // Returns the connection shapes recorded while resolving, copied into the
+    // compilation's allocator, or nullptr if this connection list can't be
+    // cached (it involves interface ports, whose resolution can differ per
+    // array element). The caller passes the port count as a sanity check that
+    // exactly one shape was recorded per port.
+    const PortConnectionShape* copyShapes(size_t portCount) {
+        if (!shapesValid || shapes.size() != portCount)
+            return nullptr;
+        return shapes.copy(comp).data();
+    }
+
 private:
+    void recordShape(const PortConnectionShape& shape) { shapes.push_back(shape); }
+
     PortConnection* emptyConnection(const PortSymbol& port) {
+        recordShape({});
         return comp.emplace<PortConnection>(port, instance);
     }
 
     PortConnection* emptyConnection(const MultiPortSymbol& port) {
+        recordShape({});
         return comp.emplace<PortConnection>(port, instance);
     }
 
@@ -1012,6 +1032,7 @@ private:
 
     PortConnection* defaultConnection(const PortSymbol& port,
                                       std::span<const AttributeSymbol* const> attributes) {
+        recordShape({PortConnectionShape::UseDefault, nullptr, nullptr, {}, attributes});
         auto conn = comp.emplace<PortConnection>(port, instance, /* useDefault */ true);
         if (!attributes.empty())
             comp.setAttributes(*conn, attributes);
@@ -1021,6 +1042,7 @@ private:
 
     PortConnection* defaultConnection(const MultiPortSymbol& port,
                                       std::span<const AttributeSymbol* const> attributes) {
+        recordShape({PortConnectionShape::UseDefault, nullptr, nullptr, {}, attributes});
         auto conn = comp.emplace<PortConnection>(port, instance, /* useDefault */ false);
         if (!attributes.empty())
             comp.setAttributes(*conn, attributes);
@@ -1043,6 +1065,7 @@ private:
         if (!exprSyntax)
             return emptyConnection(port);
 
+        recordShape({PortConnectionShape::Expr, exprSyntax, nullptr, {}, attributes});
         auto conn = comp.emplace<PortConnection>(port, instance, *exprSyntax);
         if (!attributes.empty())
             comp.setAttributes(*conn, attributes);
@@ -1087,6 +1110,7 @@ private:
             diag.addNote(diag::NoteDeclarationHere, symbol->location);
         }
 
+        recordShape({PortConnectionShape::Implicit, nullptr, symbol, range, attributes});
         auto conn = comp.emplace<PortConnection>(port, instance, symbol, range);
         if (!attributes.empty())
             comp.setAttributes(*conn, attributes);
@@ -1239,6 +1263,7 @@ private:
     Compilation& comp;
     SmallVector<ConstantRange, 4> instanceDims;
     SmallVector<const PortConnectionSyntax*> orderedConns;
+    SmallVector<PortConnectionShape> shapes;
     SmallMap<std::string_view, std::pair<const NamedPortConnectionSyntax*, bool>, 8> namedConns;
     std::span<const AttributeSymbol* const> wildcardAttrs;
     LookupLocation lookupLocation;
@@ -1248,6 +1273,7 @@ private:
     bool hasWildcard = false;
     bool warnedAboutUnnamed = false;
     bool unnamedRefError = false;
+    bool shapesValid = true;
 };
 
 struct PortBackrefVisitor {
@@ -2000,6 +2026,46 @@ void PortConnection::makeConnections(
     const SeparatedSyntaxList<PortConnectionSyntax>& portConnections,
     SmallVector<const PortConnection*>& results) {
 
+    // All rows of an instance array share one connection list and one
+    // instantiating scope, so if an earlier row has already resolved the list
+    // we can stamp this row's connections from the cached shapes instead of
+    // redoing lookup and checking. Standalone instances have their own syntax
+    // nodes and would never hit the cache, so they don't participate at all.
+    auto scope = instance.getParentScope();
+    auto& comp = scope->getCompilation();
+    auto instanceSyntax = instance.arrayPath.empty() ? nullptr : instance.getSyntax();
+
+    if (instanceSyntax) {
+        if (auto shapes = comp.getCachedPortConnectionShapes(*scope, *instanceSyntax)) {
+            for (auto portBase : ports) {
+                auto& shape = shapes[results.size()];
+                PortConnection* conn;
+                switch (shape.kind) {
+                    case PortConnectionShape::UseDefault:
+                        conn = comp.emplace<PortConnection>(*portBase, instance,
+                                                            portBase->kind == SymbolKind::Port);
+                        break;
+                    case PortConnectionShape::Expr:
+                        conn = comp.emplace<PortConnection>(*portBase, instance, *shape.expr);
+                        break;
+                    case PortConnectionShape::Implicit:
+                        conn = comp.emplace<PortConnection>(*portBase, instance, shape.symbol,
+                                                            shape.implicitNameRange);
+                        break;
+                    default:
+                        conn = comp.emplace<PortConnection>(*portBase, instance);
+                        break;
+                }
+
+                if (!shape.attributes.empty())
+                    comp.setAttributes(*conn, shape.attributes);
+
+                results.push_back(conn);
+            }
+            return;
+        }
+    }
+
     PortConnectionBuilder builder(instance, portConnections);
     for (auto portBase : ports) {
         if (portBase->kind == SymbolKind::Port) {
@@ -2023,6 +2089,11 @@ void PortConnection::makeConnections(
     }
 
     builder.finalize();
+
+    if (instanceSyntax) {
+        if (auto shapes = builder.copyShapes(ports.size()))
+            comp.cachePortConnectionShapes(*scope, *instanceSyntax, shapes);
+    }
 }
 
 void PortConnection::serializeTo(ASTSerializer& serializer) const {
@@ -130,6 +130,34 @@ bool SpecifyBlockSymbol::checkPathTerminal(const ValueSymbol& terminal, const Ty
     return false;
 }
 
+bool SpecifyBlockSymbol::checkPathTerminalCached(const ValueSymbol& terminal, const Type& type,
+                                                 const Scope& specifyParent, bool isSource,
+                                                 bool allowAnyNet, SourceRange sourceRange) const {
+    // The type portion of the check depends on the individual expression, since
+    // selects of one terminal can produce different types, so it is always
+    // performed. Everything else depends only on the terminal and the direction
+    // flags and can be memoized across all of the block's timing arcs.
+    if (!type.isIntegral()) {
+        if (!type.isError())
+            specifyParent.addDiag(diag::InvalidSpecifyType, sourceRange) << terminal.name << type;
+        return false;
+    }
+
+    if (!goodTerminals)
+        goodTerminals = getCompilation().allocPointerMap();
+
+    const uintptr_t bit = uintptr_t(1) << ((isSource ? 1 : 0) | (allowAnyNet ? 2 : 0));
+    auto& entry = (*goodTerminals)[reinterpret_cast<uintptr_t>(&terminal)];
+    if (entry & bit)
+        return true;
+
+    if (!checkPathTerminal(terminal, type, specifyParent, isSource, allowAnyNet, sourceRange))
+        return false;
+
+    entry |= bit;
+    return true;
+}
+
 TimingPathSymbol::TimingPathSymbol(SourceLocation loc, ConnectionKind connectionKind,
                                    Polarity polarity, Polarity edgePolarity,
                                    EdgeKind edgeIdentifier) :
@@ -230,8 +258,9 @@ static const Expression* bindTerminal(const ExpressionSyntax& syntax, bool isSou
     }
     else {
         auto& symbol = valueExpr->as<NamedValueExpression>().symbol;
-        if (SpecifyBlockSymbol::checkPathTerminal(symbol, *expr->type, *parentParent, isSource,
-                                                  allowAnyNet, valueExpr->sourceRange)) {
+        auto& specifyBlock = context.scope->asSymbol().as<SpecifyBlockSymbol>();
+        if (specifyBlock.checkPathTerminalCached(symbol, *expr->type, *parentParent, isSource,
+                                                 allowAnyNet, valueExpr->sourceRange)) {
             return expr;
         }
     }
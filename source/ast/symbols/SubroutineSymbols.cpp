@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/symbols/SubroutineSymbols.h"
 
+#include <atomic>
+
 #include "slang/ast/ASTSerializer.h"
 #include "slang/ast/Compilation.h"
 #include "slang/ast/symbols/ClassSymbols.h"
@@ -27,34 +29,49 @@ using namespace parsing;
 using namespace syntax;
 
 const Statement& SubroutineSymbol::getBody() const {
-    if (!stmt) {
-        auto syntax = getSyntax();
-        if (!syntax || !FunctionDeclarationSyntax::isKind(syntax->kind)) {
-            // DPI functions, subroutines created from prototypes, etc
-            // don't have a real body.
-            stmt = &StatementList::makeEmpty(getCompilation());
-        }
-        else if (isConstructing) {
-            // Avoid issues with recursive function calls re-entering this
-            // method while we're still constructing.
-            return InvalidStatement::Instance;
-        }
-        else {
-            isConstructing = true;
-            auto guard = ScopeGuard([this] { isConstructing = false; });
+    // Lock-free fast path: once a bound body has been published it never
+    // changes, so concurrent readers only need a single acquire load.
+    if (auto body = std::atomic_ref(stmt).load(std::memory_order_acquire))
+        return *body;
+
+    auto& comp = getCompilation();
+    std::scoped_lock lock(comp.getBindLock());
+    if (stmt)
+        return *stmt;
+
+    const Statement* body;
+    auto syntax = getSyntax();
+    if (!syntax || !FunctionDeclarationSyntax::isKind(syntax->kind)) {
+        // DPI functions, subroutines created from prototypes, etc
+        // don't have a real body.
+        body = &StatementList::makeEmpty(comp);
+    }
+    else if (isConstructing) {
+        // Avoid issues with recursive function calls re-entering this
+        // method while we're still constructing.
+        return InvalidStatement::Instance;
+    }
+    else {
+        isConstructing = true;
+        auto guard = ScopeGuard([this] { isConstructing = false; });
 
-            ASTContext context(*this, LookupLocation::max);
-            if (subroutineKind == SubroutineKind::Function)
-                context.flags |= ASTFlags::Function;
+        ASTContext context(*this, LookupLocation::max);
+        if (subroutineKind == SubroutineKind::Function)
+            context.flags |= ASTFlags::Function;
 
-            Statement::StatementContext stmtCtx(context);
-            stmtCtx.blocks = blocks;
+        Statement::StatementContext stmtCtx(context);
+        stmtCtx.blocks = blocks;
 
-            stmt = &Statement::bindItems(syntax->as<FunctionDeclarationSyntax>().items, context,
-                                         stmtCtx);
-        }
+        body = &Statement::bindItems(syntax->as<FunctionDeclarationSyntax>().items, context,
+                                     stmtCtx);
     }
-    return *stmt;
+
+    std::atomic_ref(stmt).store(body, std::memory_order_release);
+    return *body;
+}
+
+bool SubroutineSymbol::isBodyBound() const {
+    return std::atomic_ref(stmt).load(std::memory_order_acquire) != nullptr;
 }
 
 SubroutineSymbol* SubroutineSymbol::fromSyntax(Compilation& compilation,
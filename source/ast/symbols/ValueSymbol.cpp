@@ -202,9 +202,8 @@ void ValueSymbol::addDriver(DriverKind driverKind, const Expression& longestStat
     if (!bounds)
         return;
 
-    auto driver = comp.emplace<ValueDriver>(driverKind, longestStaticPrefix, containingSymbol,
-                                            flags);
-    addDriver(*bounds, *driver);
+    addDriver(*bounds, comp.addDriver(
+                            ValueDriver(driverKind, longestStaticPrefix, containingSymbol, flags)));
 }
 
 void ValueSymbol::addDriver(DriverKind driverKind, std::pair<uint32_t, uint32_t> bounds,
@@ -214,18 +213,18 @@ void ValueSymbol::addDriver(DriverKind driverKind, std::pair<uint32_t, uint32_t>
     ASSERT(scope);
 
     auto& comp = scope->getCompilation();
-    auto driver = comp.emplace<ValueDriver>(driverKind, longestStaticPrefix, containingSymbol,
-                                            AssignFlags::None);
-    driver->procCallExpression = &procCallExpression;
+    ValueDriver driver(driverKind, longestStaticPrefix, containingSymbol, AssignFlags::None);
+    driver.procCallExpression = &procCallExpression;
 
-    addDriver(bounds, *driver);
+    addDriver(bounds, comp.addDriver(std::move(driver)));
 }
 
-void ValueSymbol::addDriver(std::pair<uint32_t, uint32_t> bounds, const ValueDriver& driver) const {
+void ValueSymbol::addDriver(std::pair<uint32_t, uint32_t> bounds, uint32_t driverIndex) const {
     auto scope = getParentScope();
     ASSERT(scope);
 
     auto& comp = scope->getCompilation();
+    auto& driver = comp.getDriver(driverIndex);
 
     if (driverMap.empty()) {
         // The first time we add a driver, check whether there is also an
@@ -235,10 +234,10 @@ void ValueSymbol::addDriver(std::pair<uint32_t, uint32_t> bounds, const ValueDri
                 *this, SourceRange{location, location + name.length()});
 
             std::pair<uint32_t, uint32_t> initBounds{0, getType().getSelectableWidth() - 1};
-            auto initDriver = comp.emplace<ValueDriver>(driverKind, valExpr, scope->asSymbol(),
-                                                        AssignFlags::None);
+            auto initIndex = comp.addDriver(
+                ValueDriver(driverKind, valExpr, scope->asSymbol(), AssignFlags::None));
 
-            driverMap.insert(initBounds, initDriver, comp.getDriverMapAllocator());
+            driverMap.insert(initBounds, initIndex, comp.getDriverMapAllocator());
         };
 
         switch (kind) {
@@ -257,7 +256,7 @@ void ValueSymbol::addDriver(std::pair<uint32_t, uint32_t> bounds, const ValueDri
         }
 
         if (driverMap.empty()) {
-            driverMap.insert(bounds, &driver, comp.getDriverMapAllocator());
+            driverMap.insert(bounds, driverIndex, comp.getDriverMapAllocator());
             return;
         }
     }
@@ -303,7 +302,7 @@ void ValueSymbol::addDriver(std::pair<uint32_t, uint32_t> bounds, const ValueDri
         // - Assertion local variable formal arguments can't drive more than
         //   one output to the same local variable.
         bool isProblem = false;
-        auto curr = *it;
+        auto curr = &comp.getDriver(*it);
 
         if (curr->isUnidirectionalPort() != driver.isUnidirectionalPort()) {
             isProblem = true;
@@ -337,7 +336,17 @@ void ValueSymbol::addDriver(std::pair<uint32_t, uint32_t> bounds, const ValueDri
         }
     }
 
-    driverMap.insert(bounds, &driver, comp.getDriverMapAllocator());
+    driverMap.insert(bounds, driverIndex, comp.getDriverMapAllocator());
+}
+
+iterator_range<DriverIterator> ValueSymbol::drivers() const {
+    auto scope = getParentScope();
+    auto comp = scope ? &scope->getCompilation() : nullptr;
+    return {DriverIterator(driverMap.begin(), comp), DriverIterator(driverMap.end(), comp)};
+}
+
+const ValueDriver* DriverIterator::operator*() const {
+    return &compilation->getDriver(*it);
 }
 
 void ValueSymbol::addPortBackref(const PortSymbol& port) const {
@@ -84,14 +84,27 @@ void VariableSymbol::fromSyntax(Compilation& compilation, const DataDeclarationS
         scope.asSymbol().as<InstanceBodySymbol>().getDefinition().definitionKind ==
             DefinitionKind::Interface;
 
+    // All declarators in the list share one type syntax, so resolve it once
+    // through the first symbol and link the rest to it; each declarator's
+    // unpacked dimensions still apply on top of the shared base type. A
+    // symbol with dimensions of its own can't serve as the link target
+    // because the link takes its fully resolved type.
+    const VariableSymbol* linkTarget = nullptr;
     for (auto declarator : syntax.declarators) {
         auto variable = compilation.emplace<VariableSymbol>(declarator->name.valueText(),
                                                             declarator->name.location(), *lifetime);
-        variable->setDeclaredType(*syntax.type);
+        if (linkTarget)
+            variable->getDeclaredType()->setLink(*linkTarget->getDeclaredType());
+        else
+            variable->setDeclaredType(*syntax.type);
+
         variable->setFromDeclarator(*declarator);
         variable->setAttributes(scope, syntax.attributes);
         results.push_back(variable);
 
+        if (!linkTarget && declarator->dimensions.empty())
+            linkTarget = variable;
+
         if (isConst)
             variable->flags |= VariableFlags::Const;
 
@@ -260,14 +273,24 @@ void NetSymbol::fromSyntax(const Scope& scope, const NetDeclarationSyntax& synta
             break;
     }
 
+    // As with variables above, the whole declarator list shares one type
+    // syntax: resolve it through the first net and link the rest to it.
+    const NetSymbol* linkTarget = nullptr;
     for (auto declarator : syntax.declarators) {
         auto net = comp.emplace<NetSymbol>(declarator->name.valueText(),
                                            declarator->name.location(), netType);
         net->expansionHint = expansionHint;
-        net->setDeclaredType(*syntax.type);
+        if (linkTarget)
+            net->getDeclaredType()->setLink(*linkTarget->getDeclaredType());
+        else
+            net->setDeclaredType(*syntax.type);
+
         net->setFromDeclarator(*declarator);
         net->setAttributes(scope, syntax.attributes);
         results.push_back(net);
+
+        if (!linkTarget && declarator->dimensions.empty())
+            linkTarget = net;
     }
 }
 
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/types/AllTypes.h"
 
+#include <algorithm>
+
 #include "slang/ast/ASTContext.h"
 #include "slang/ast/ASTSerializer.h"
 #include "slang/ast/Compilation.h"
@@ -487,6 +489,29 @@ const Type& EnumType::fromSyntax(Compilation& compilation, const EnumTypeSyntax&
         }
     }
 
+    // Build the flat value table that backs the enum's builtin value queries,
+    // so that name(), next(), and prev() don't have to walk the member list.
+    {
+        SmallVector<const EnumValueSymbol*> table;
+        SmallVector<ValueTableEntry> sorted;
+        for (auto& ev : resultType->values()) {
+            if (auto& cv = ev.getValue(); cv) {
+                auto& sv = cv.integer();
+                if (!sv.hasUnknown() && sv.getBitWidth() <= 64)
+                    sorted.push_back({sv.getRawPtr()[0], (uint32_t)table.size()});
+            }
+            table.push_back(&ev);
+        }
+
+        // Order duplicate values by declaration so lookups find the first one.
+        std::sort(sorted.begin(), sorted.end(), [](auto& a, auto& b) {
+            return a.key != b.key ? a.key < b.key : a.index < b.index;
+        });
+
+        resultType->flatValues = table.copy(compilation);
+        resultType->sortedValues = sorted.copy(compilation);
+    }
+
     // If this enum is inside a typedef, override the types of each member to be
     // the typedef instead of the enum itself. This is done as a separate pass
     // so that we don't try to access the type of the enum values while we're
@@ -499,6 +524,39 @@ const Type& EnumType::fromSyntax(Compilation& compilation, const EnumTypeSyntax&
     return createPackedDims(context, resultType, syntax.dimensions);
 }
 
+std::optional<uint32_t> EnumType::findValueIndex(const SVInt& value) const {
+    // Logical equality against a value with unknown bits is never true, so
+    // such a query can't match any enumerand.
+    if (value.hasUnknown())
+        return std::nullopt;
+
+    if (value.getBitWidth() <= 64) {
+        uint64_t key = value.getRawPtr()[0];
+        auto it = std::lower_bound(sortedValues.begin(), sortedValues.end(), key,
+                                   [](const ValueTableEntry& entry, uint64_t k) {
+                                       return entry.key < k;
+                                   });
+        if (it != sortedValues.end() && it->key == key)
+            return it->index;
+        return std::nullopt;
+    }
+
+    // Wide enums aren't in the sorted table; scan the value list instead.
+    uint32_t index = 0;
+    for (auto ev : flatValues) {
+        auto& cv = ev->getValue();
+        if (cv && (bool)(cv.integer() == value))
+            return index;
+        index++;
+    }
+    return std::nullopt;
+}
+
+const EnumValueSymbol* EnumType::findValue(const SVInt& value) const {
+    auto index = findValueIndex(value);
+    return index ? flatValues[*index] : nullptr;
+}
+
 static std::string_view getEnumValueName(Compilation& comp, std::string_view name, int32_t index) {
     if (!name.empty()) {
         ASSERT(index >= 0);
@@ -659,11 +717,10 @@ const Type& PackedArrayType::fromDim(const Scope& scope, const Type& elementType
         return comp.getErrorType();
     }
 
-    auto result = comp.emplace<PackedArrayType>(elementType, dim, bitwidth_t(*width));
-    if (auto syntax = sourceRange.syntax())
-        result->setSyntax(*syntax);
-
-    return *result;
+    // Packed array types are uniquified by the compilation; structurally
+    // identical arrays share one type object, so like the cached vector types
+    // they don't carry syntax for any particular declaration site.
+    return comp.getPackedArrayType(elementType, dim, bitwidth_t(*width));
 }
 
 FixedSizeUnpackedArrayType::FixedSizeUnpackedArrayType(const Type& elementType, ConstantRange range,
@@ -828,6 +885,8 @@ const Type& PackedStructType::fromSyntax(Compilation& comp, const StructUnionTyp
         offset += member->getType().getBitWidth();
     }
 
+    structType->fields = members.copy(comp);
+
     return createPackedDims(parentContext, structType, syntax.dimensions);
 }
 
@@ -1120,7 +1179,7 @@ const Type& VirtualInterfaceType::fromSyntax(const ASTContext& context,
         }
     }
 
-    return *comp.emplace<VirtualInterfaceType>(iface, modport, /* isRealIface */ false, loc);
+    return comp.getVirtualInterfaceType(iface, modport, /* isRealIface */ false, loc);
 }
 
 ConstantValue VirtualInterfaceType::getDefaultValueImpl() const {
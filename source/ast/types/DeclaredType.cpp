@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/types/DeclaredType.h"
 
+#include <atomic>
+
 #include "slang/ast/Compilation.h"
 #include "slang/ast/Expression.h"
 #include "slang/ast/Scope.h"
@@ -36,6 +38,15 @@ DeclaredType::DeclaredType(const Symbol& parent, bitmask<DeclaredTypeFlags> flag
 }
 
 const Type& DeclaredType::getType() const {
+    // Lock-free fast path: once a resolved type has been published it never
+    // changes, so a single acquire load is all a concurrent reader needs.
+    if (auto resolved = std::atomic_ref(type).load(std::memory_order_acquire))
+        return *resolved;
+
+    auto scope = parent.getParentScope();
+    ASSERT(scope);
+
+    std::scoped_lock lock(scope->getCompilation().getBindLock());
     if (!type)
         resolveType(getASTContext<false>(), getASTContext<true>());
     return *type;
@@ -57,8 +68,10 @@ void DeclaredType::setDimensionSyntax(const SyntaxList<VariableDimensionSyntax>&
 void DeclaredType::mergeImplicitPort(
     const ImplicitTypeSyntax& implicit, SourceLocation location,
     std::span<const VariableDimensionSyntax* const> unpackedDimensions) {
-    mergePortTypes(getASTContext<false>(), parent.as<ValueSymbol>(), implicit, location,
-                   unpackedDimensions);
+    if (auto merged = mergePortTypes(getASTContext<false>(), parent.as<ValueSymbol>(), implicit,
+                                     location, unpackedDimensions)) {
+        std::atomic_ref(type).store(merged, std::memory_order_release);
+    }
 }
 
 void DeclaredType::resolveType(const ASTContext& typeContext,
@@ -66,16 +79,24 @@ void DeclaredType::resolveType(const ASTContext& typeContext,
     auto& comp = typeContext.getCompilation();
     if (hasLink) {
         ASSERT(typeOrLink.link);
-        type = &typeOrLink.link->getType();
+        const Type* resolved = &typeOrLink.link->getType();
         if (dimensions)
-            type = &comp.getType(*type, *dimensions, typeContext);
+            resolved = &comp.getType(*resolved, *dimensions, typeContext);
+
+        // Symbols that share a declarator list link to the first symbol's
+        // declared type but still need their own per-symbol checks, since
+        // their unpacked dimensions can change the result.
+        if (flags.has(DeclaredTypeFlags::NeedsTypeCheck) && !resolved->isError())
+            resolved = &checkType(initializerContext, *resolved);
+
+        std::atomic_ref(type).store(resolved, std::memory_order_release);
         return;
     }
 
     auto syntax = typeOrLink.typeSyntax;
     ASSERT(syntax);
     if (!syntax) {
-        type = &comp.getErrorType();
+        std::atomic_ref(type).store(&comp.getErrorType(), std::memory_order_release);
         return;
     }
 
@@ -83,52 +104,58 @@ void DeclaredType::resolveType(const ASTContext& typeContext,
     evaluating = true;
     auto guard = ScopeGuard([this] { evaluating = false; });
 
+    // Resolve into locals and publish the members exactly once at the end;
+    // concurrent readers must never observe a partially built type.
+    const Type* resolved = nullptr;
+    const Expression* init = nullptr;
+
     // If we are configured to infer implicit types, bind the initializer expression
     // first so that we can derive our type from whatever that happens to be.
     if (syntax->kind == SyntaxKind::ImplicitType && flags.has(DeclaredTypeFlags::InferImplicit)) {
         if (dimensions) {
             auto& its = syntax->as<ImplicitTypeSyntax>();
             if (its.signing || !its.dimensions.empty()) {
-                type = &comp.getType(*syntax, typeContext, nullptr);
-                type = &comp.getType(*type, *dimensions, typeContext);
+                resolved = &comp.getType(*syntax, typeContext, nullptr);
+                resolved = &comp.getType(*resolved, *dimensions, typeContext);
             }
             else {
                 typeContext.addDiag(diag::UnpackedArrayParamType, dimensions->sourceRange());
-                type = &comp.getErrorType();
+                resolved = &comp.getErrorType();
             }
         }
         else if (!initializerSyntax) {
-            type = &comp.getErrorType();
+            resolved = &comp.getErrorType();
         }
         else {
             bitmask<ASTFlags> extraFlags;
             if (flags.has(DeclaredTypeFlags::AllowUnboundedLiteral))
                 extraFlags = ASTFlags::AllowUnboundedLiteral;
 
-            std::tie(initializer, type) = Expression::bindImplicitParam(*syntax, *initializerSyntax,
-                                                                        initializerLocation,
-                                                                        initializerContext,
-                                                                        typeContext, extraFlags);
+            std::tie(init, resolved) = Expression::bindImplicitParam(*syntax, *initializerSyntax,
+                                                                     initializerLocation,
+                                                                     initializerContext,
+                                                                     typeContext, extraFlags);
         }
     }
     else if (flags.has(DeclaredTypeFlags::InterconnectNet)) {
         // An interconnect net is always untyped (or some array of untyped elements).
-        type = &comp.getType(SyntaxKind::Untyped);
+        resolved = &comp.getType(SyntaxKind::Untyped);
         if (syntax->kind == SyntaxKind::ImplicitType) {
             // This should always be an implicit type unless there's an
             // error (diagnosed by the parser).
             auto& its = syntax->as<ImplicitTypeSyntax>();
             if (!its.dimensions.empty())
-                type = &comp.getType(*type, its.dimensions,
-                                     typeContext.resetFlags(ASTFlags::AllowInterconnect));
+                resolved = &comp.getType(*resolved, its.dimensions,
+                                         typeContext.resetFlags(ASTFlags::AllowInterconnect));
         }
 
         if (dimensions) {
-            type = &comp.getType(*type, *dimensions,
-                                 typeContext.resetFlags(ASTFlags::AllowInterconnect));
+            resolved = &comp.getType(*resolved, *dimensions,
+                                     typeContext.resetFlags(ASTFlags::AllowInterconnect));
         }
 
-        // Return early to skip additional checks for net types.
+        // Publish early to skip additional checks for net types.
+        std::atomic_ref(type).store(resolved, std::memory_order_release);
         return;
     }
     else {
@@ -136,13 +163,17 @@ void DeclaredType::resolveType(const ASTContext& typeContext,
         if (flags.has(DeclaredTypeFlags::TypedefTarget))
             typedefTarget = &parent.as<Type>();
 
-        type = &comp.getType(*syntax, typeContext, typedefTarget);
+        resolved = &comp.getType(*syntax, typeContext, typedefTarget);
         if (dimensions)
-            type = &comp.getType(*type, *dimensions, typeContext);
+            resolved = &comp.getType(*resolved, *dimensions, typeContext);
     }
 
-    if (flags.has(DeclaredTypeFlags::NeedsTypeCheck) && !type->isError())
-        checkType(initializerContext);
+    if (flags.has(DeclaredTypeFlags::NeedsTypeCheck) && !resolved->isError())
+        resolved = &checkType(initializerContext, *resolved);
+
+    if (init)
+        std::atomic_ref(initializer).store(init, std::memory_order_release);
+    std::atomic_ref(type).store(resolved, std::memory_order_release);
 }
 
 static bool isValidForNet(const Type& type) {
@@ -209,37 +240,40 @@ static bool isValidForIfaceVar(const Type& type) {
     return true;
 }
 
-void DeclaredType::checkType(const ASTContext& context) const {
+const Type& DeclaredType::checkType(const ASTContext& context, const Type& type) const {
     uint32_t masked = (flags & DeclaredTypeFlags::NeedsTypeCheck).bits();
     ASSERT(std::popcount(masked) == 1);
 
     switch (masked) {
         case uint32_t(DeclaredTypeFlags::NetType): {
             auto& net = parent.as<NetSymbol>();
-            if (net.netType.netKind != NetType::UserDefined && !isValidForNet(*type))
-                context.addDiag(diag::InvalidNetType, parent.location) << *type;
-            else if (type->getBitWidth() == 1 && net.expansionHint != NetSymbol::None)
+            if (net.netType.netKind != NetType::UserDefined && !isValidForNet(type))
+                context.addDiag(diag::InvalidNetType, parent.location) << type;
+            else if (type.getBitWidth() == 1 && net.expansionHint != NetSymbol::None)
                 context.addDiag(diag::SingleBitVectored, parent.location);
             break;
         }
         case uint32_t(DeclaredTypeFlags::UserDefinedNetType):
-            if (!isValidForUserDefinedNet(*type))
-                context.addDiag(diag::InvalidUserDefinedNetType, parent.location) << *type;
+            if (!isValidForUserDefinedNet(type))
+                context.addDiag(diag::InvalidUserDefinedNetType, parent.location) << type;
             break;
         case uint32_t(DeclaredTypeFlags::FormalArgMergeVar):
             if (auto var = parent.as<FormalArgumentSymbol>().getMergedVariable()) {
                 ASSERT(!hasLink);
                 ASSERT(typeOrLink.typeSyntax);
-                mergePortTypes(context, *var, typeOrLink.typeSyntax->as<ImplicitTypeSyntax>(),
-                               parent.location,
-                               dimensions ? *dimensions
-                                          : std::span<const VariableDimensionSyntax* const>{});
+                if (auto merged = mergePortTypes(
+                        context, *var, typeOrLink.typeSyntax->as<ImplicitTypeSyntax>(),
+                        parent.location,
+                        dimensions ? *dimensions
+                                   : std::span<const VariableDimensionSyntax* const>{})) {
+                    return *merged;
+                }
             }
             break;
         case uint32_t(DeclaredTypeFlags::Rand): {
             RandMode mode = parent.getRandMode();
-            if (!type->isValidForRand(mode)) {
-                auto& diag = context.addDiag(diag::InvalidRandType, parent.location) << *type;
+            if (!type.isValidForRand(mode)) {
+                auto& diag = context.addDiag(diag::InvalidRandType, parent.location) << type;
                 if (mode == RandMode::Rand)
                     diag << "rand"sv;
                 else
@@ -248,31 +282,33 @@ void DeclaredType::checkType(const ASTContext& context) const {
             break;
         }
         case uint32_t(DeclaredTypeFlags::DPIReturnType): {
-            if (!type->isValidForDPIReturn())
-                context.addDiag(diag::InvalidDPIReturnType, parent.location) << *type;
-            else if (parent.as<SubroutineSymbol>().flags.has(MethodFlags::Pure) && type->isVoid())
+            if (!type.isValidForDPIReturn())
+                context.addDiag(diag::InvalidDPIReturnType, parent.location) << type;
+            else if (parent.as<SubroutineSymbol>().flags.has(MethodFlags::Pure) && type.isVoid())
                 context.addDiag(diag::DPIPureReturn, parent.location);
             break;
         }
         case uint32_t(DeclaredTypeFlags::DPIArg):
-            if (!type->isValidForDPIArg())
-                context.addDiag(diag::InvalidDPIArgType, parent.location) << *type;
+            if (!type.isValidForDPIArg())
+                context.addDiag(diag::InvalidDPIArgType, parent.location) << type;
             break;
         case uint32_t(DeclaredTypeFlags::RequireSequenceType):
-            if (!type->isValidForSequence())
-                context.addDiag(diag::AssertionExprType, parent.location) << *type;
+            if (!type.isValidForSequence())
+                context.addDiag(diag::AssertionExprType, parent.location) << type;
             break;
         case uint32_t(DeclaredTypeFlags::CoverageType):
-            if (!type->isIntegral())
-                context.addDiag(diag::NonIntegralCoverageExpr, parent.location) << *type;
+            if (!type.isIntegral())
+                context.addDiag(diag::NonIntegralCoverageExpr, parent.location) << type;
             break;
         case uint32_t(DeclaredTypeFlags::InterfaceVariable):
-            if (!isValidForIfaceVar(*type))
+            if (!isValidForIfaceVar(type))
                 context.addDiag(diag::VirtualInterfaceIfaceMember, parent.location);
             break;
         default:
             ASSUME_UNREACHABLE;
     }
+
+    return type;
 }
 
 static const Type* makeSigned(Compilation& compilation, const Type& type) {
@@ -298,13 +334,13 @@ static const Type* makeSigned(Compilation& compilation, const Type& type) {
     for (size_t i = 0; i < count; i++) {
         // There's no worry about size overflow here because we started with a valid type.
         ConstantRange dim = dims[count - i - 1];
-        curr = compilation.emplace<PackedArrayType>(*curr, dim, curr->getBitWidth() * dim.width());
+        curr = &compilation.getPackedArrayType(*curr, dim, curr->getBitWidth() * dim.width());
     }
 
     return curr;
 }
 
-void DeclaredType::mergePortTypes(
+const Type* DeclaredType::mergePortTypes(
     const ASTContext& context, const ValueSymbol& sourceSymbol, const ImplicitTypeSyntax& implicit,
     SourceLocation location,
     std::span<const VariableDimensionSyntax* const> unpackedDimensions) const {
@@ -331,7 +367,7 @@ void DeclaredType::mergePortTypes(
         }
 
         if (sourceType->isError())
-            return;
+            return nullptr;
 
         if (!sourceType->isIntegral()) {
             if (sourceSymbol.kind == SymbolKind::Net &&
@@ -345,7 +381,7 @@ void DeclaredType::mergePortTypes(
                 diag << sourceSymbol.name << implicit.signing.valueText() << *destType;
                 diag.addNote(diag::NoteDeclarationHere, sourceSymbol.location);
             }
-            return;
+            return nullptr;
         }
 
         auto warnSignedness = [&] {
@@ -372,8 +408,9 @@ void DeclaredType::mergePortTypes(
         }
     }
 
-    // Our declared type takes on the merged type from the variable definition.
-    this->type = destType;
+    // Our declared type takes on the merged type from the variable definition;
+    // the caller is responsible for publishing it.
+    const Type* merged = destType;
 
     auto errorDims = [&](auto& dims) {
         auto& diag = context.addDiag(diag::PortDeclDimensionsMismatch, dims.sourceRange());
@@ -412,9 +449,12 @@ void DeclaredType::mergePortTypes(
     // for the packed one to look at.
     checkDims(unpackedDimensions, SymbolKind::FixedSizeUnpackedArrayType, false);
     checkDims(implicit.dimensions, SymbolKind::PackedArrayType, true);
+
+    return merged;
 }
 
 void DeclaredType::resolveAt(const ASTContext& context) const {
+    std::scoped_lock lock(context.getCompilation().getBindLock());
     if (!type) {
         resolveType(getASTContext<false>(), context);
         if (initializer)
@@ -438,11 +478,13 @@ void DeclaredType::resolveAt(const ASTContext& context) const {
         extraFlags = ASTFlags::AllowUnboundedLiteral;
     }
 
-    initializer = &Expression::bindRValue(*targetType, *initializerSyntax, initializerLocation,
-                                          context, extraFlags);
+    auto& expr = Expression::bindRValue(*targetType, *initializerSyntax, initializerLocation,
+                                        context, extraFlags);
+    std::atomic_ref(initializer).store(&expr, std::memory_order_release);
 }
 
 void DeclaredType::forceResolveAt(const ASTContext& context) const {
+    std::scoped_lock lock(context.getCompilation().getBindLock());
     if (!type)
         resolveType(context, context);
 
@@ -451,6 +493,14 @@ void DeclaredType::forceResolveAt(const ASTContext& context) const {
 }
 
 const Expression* DeclaredType::getInitializer() const {
+    // Lock-free fast path, same as getType().
+    if (auto init = std::atomic_ref(initializer).load(std::memory_order_acquire))
+        return init;
+
+    auto scope = parent.getParentScope();
+    ASSERT(scope);
+
+    std::scoped_lock lock(scope->getCompilation().getBindLock());
     if (initializer)
         return initializer;
 
@@ -81,7 +81,7 @@ bool isSameEnum(const EnumType& le, const EnumType& re) {
 
 } // namespace
 
-bitwidth_t Type::getBitWidth() const {
+bitwidth_t Type::resolveBitWidth() const {
     const Type& ct = getCanonicalType();
     if (ct.isIntegral())
         return ct.as<IntegralType>().bitWidth;
@@ -429,6 +429,11 @@ bool Type::isTaggedUnion() const {
 }
 
 bool Type::isMatching(const Type& rhs) const {
+    // Fast path: a type always matches itself, without needing to
+    // canonicalize first.
+    if (this == &rhs)
+        return true;
+
     // See [6.22.1] for Matching Types.
     const Type* l = &getCanonicalType();
     const Type* r = &rhs.getCanonicalType();
@@ -523,6 +528,10 @@ bool Type::isMatching(const Type& rhs) const {
 }
 
 bool Type::isEquivalent(const Type& rhs) const {
+    // Fast path: a type is always equivalent to itself.
+    if (this == &rhs)
+        return true;
+
     // See [6.22.2] for Equivalent Types
     const Type* l = &getCanonicalType();
     const Type* r = &rhs.getCanonicalType();
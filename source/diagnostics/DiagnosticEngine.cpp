@@ -190,13 +190,28 @@ void DiagnosticEngine::issue(const Diagnostic& diagnostic) {
 }
 
 bool DiagnosticEngine::issueImpl(const Diagnostic& diagnostic, DiagnosticSeverity severity) {
-    // Walk out until we find a location for this diagnostic that isn't inside a macro.
     SmallVector<SourceLocation, 8> expansionLocs;
     SourceLocation loc = diagnostic.location;
     size_t ignoreUntil = 0;
     bool showIncludeStack = false;
 
     if (loc != SourceLocation::NoLocation) {
+        // Check for path-based warning suppression up front, before we spend time
+        // building the macro backtrace or mark the include stack as reported.
+        if (!ignoreWarnPrefixes.empty() &&
+            getDefaultSeverity(diagnostic.code) == DiagnosticSeverity::Warning) {
+
+            auto& path = sourceManager.getFullPath(
+                sourceManager.getFullyExpandedLoc(loc).buffer());
+            for (auto& prefix : ignoreWarnPrefixes) {
+                auto [_, mismatchIt] = std::mismatch(path.begin(), path.end(), prefix.begin(),
+                                                     prefix.end());
+                if (mismatchIt == prefix.end())
+                    return false;
+            }
+        }
+
+        // Walk out until we find a location for this diagnostic that isn't inside a macro.
         while (sourceManager.isMacroLoc(loc)) {
             SourceLocation prevLoc = loc;
             if (sourceManager.isMacroArgLoc(loc)) {
@@ -213,18 +228,6 @@ bool DiagnosticEngine::issueImpl(const Diagnostic& diagnostic, DiagnosticSeverit
         }
 
         showIncludeStack = reportedIncludeStack.emplace(loc.buffer()).second;
-
-        if (!ignoreWarnPrefixes.empty() &&
-            getDefaultSeverity(diagnostic.code) == DiagnosticSeverity::Warning) {
-
-            auto& path = sourceManager.getFullPath(loc.buffer());
-            for (auto& prefix : ignoreWarnPrefixes) {
-                auto [_, mismatchIt] = std::mismatch(path.begin(), path.end(), prefix.begin(),
-                                                     prefix.end());
-                if (mismatchIt == prefix.end())
-                    return false;
-            }
-        }
     }
 
     std::string message = formatMessage(diagnostic);
@@ -563,6 +566,11 @@ Diagnostics DiagnosticEngine::setMappingsFromPragmas(BufferID buffer) {
 
 std::optional<DiagnosticSeverity> DiagnosticEngine::findMappedSeverity(
     DiagCode code, SourceLocation location) const {
+    // The mappings for each (code, buffer) pair are a step function: an
+    // offset-sorted list of points where the severity changes, with pops
+    // recorded as explicit reversion entries by setMappingsFromPragmasImpl.
+    // That makes the per-diagnostic query two hash lookups plus one binary
+    // search, which is cheaper than stabbing an interval tree would be.
     auto byCode = diagMappings.find(code);
     if (byCode == diagMappings.end())
         return std::nullopt;
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// JsonDiagnosticClient.cpp
+// Diagnostic client that serializes to machine-readable JSON
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/diagnostics/JsonDiagnosticClient.h"
+
+#include "slang/text/Json.h"
+#include "slang/text/SourceManager.h"
+
+namespace slang {
+
+JsonDiagnosticClient::JsonDiagnosticClient() : writer(std::make_unique<JsonWriter>()) {
+    writer->startObject();
+    writer->writeProperty("diagnostics");
+    writer->startArray();
+}
+
+JsonDiagnosticClient::~JsonDiagnosticClient() = default;
+
+void JsonDiagnosticClient::report(const ReportedDiagnostic& diag) {
+    auto code = diag.originalDiagnostic.code;
+
+    writer->startObject();
+    writer->writeProperty("severity");
+    writer->writeValue(getSeverityString(diag.severity));
+    writer->writeProperty("code");
+    writer->writeValue(toString(code));
+
+    if (auto optionName = engine->getOptionName(code); !optionName.empty()) {
+        writer->writeProperty("option");
+        writer->writeValue(optionName);
+    }
+
+    if (diag.location != SourceLocation::NoLocation) {
+        writer->writeProperty("file");
+        writer->writeValue(getFileIndex(diag.location.buffer()));
+        writer->writeProperty("line");
+        writer->writeValue(uint64_t(sourceManager->getLineNumber(diag.location)));
+        writer->writeProperty("column");
+        writer->writeValue(uint64_t(sourceManager->getColumnNumber(diag.location)));
+        writer->writeProperty("offset");
+        writer->writeValue(uint64_t(diag.location.offset()));
+    }
+
+    if (auto count = diag.originalDiagnostic.coalesceCount) {
+        writer->writeProperty("occurrences");
+        writer->writeValue(uint64_t(*count));
+    }
+
+    writer->writeProperty("message");
+    writer->writeValue(diag.formattedMessage);
+    writer->endObject();
+}
+
+std::string JsonDiagnosticClient::getString() {
+    if (!finished) {
+        finished = true;
+        writer->endArray();
+
+        writer->writeProperty("files");
+        writer->startArray();
+        for (auto name : fileNames)
+            writer->writeValue(name);
+        writer->endArray();
+
+        writer->endObject();
+    }
+
+    return std::string(writer->view());
+}
+
+uint64_t JsonDiagnosticClient::getFileIndex(BufferID buffer) {
+    auto [it, inserted] = fileIndices.emplace(buffer, fileNames.size());
+    if (inserted)
+        fileNames.push_back(sourceManager->getFileName(SourceLocation(buffer, 0)));
+    return it->second;
+}
+
+} // namespace slang
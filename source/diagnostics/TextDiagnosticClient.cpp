@@ -187,6 +187,20 @@ struct SourceSnippet {
     SourceSnippet(std::string_view sourceLine, uint32_t tabStop) {
         ASSERT(!sourceLine.empty());
 
+        // The vast majority of source lines are plain printable ASCII, where
+        // bytes and columns are the same thing and the line can be shown
+        // verbatim. Skip the per-character decode loop for those.
+        if (std::all_of(sourceLine.begin(), sourceLine.end(),
+                        [](char c) { return isPrintableASCII(c); })) {
+            byteToColumn.resize(sourceLine.size() + 1);
+            for (size_t i = 0; i < byteToColumn.size(); i++)
+                byteToColumn[i] = (int)i;
+
+            snippetLine = sourceLine;
+            highlightLine = std::string(sourceLine.size(), ' ');
+            return;
+        }
+
         byteToColumn.resize(sourceLine.size() + 1);
         for (size_t i = 0; i < byteToColumn.size(); i++)
             byteToColumn[i] = -1;
@@ -8,8 +8,16 @@
 //------------------------------------------------------------------------------
 #include "slang/driver/Driver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <fmt/color.h>
+#include <fstream>
+#include <mutex>
+#include <thread>
 
+#include "slang/ast/ASTVisitor.h"
+#include "slang/ast/ElabCache.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/diagnostics/DeclarationsDiags.h"
@@ -19,11 +27,16 @@
 #include "slang/diagnostics/StatementsDiags.h"
 #include "slang/diagnostics/SysFuncsDiags.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
+#include "slang/parsing/Lexer.h"
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
 #include "slang/syntax/SyntaxPrinter.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/syntax/SyntaxVisitor.h"
+#include "slang/text/Json.h"
 #include "slang/util/Random.h"
+#include "slang/util/ScopeGuard.h"
+#include "slang/util/TimeTrace.h"
 
 namespace fs = std::filesystem;
 
@@ -50,6 +63,9 @@ void Driver::addStandardArgs() {
                 /* isFileName */ true);
     cmdLine.add("-Y,--libext", options.libExts, "Additional library file extensions to search",
                 "<ext>");
+    cmdLine.add("--lib-index", options.libraryIndex,
+                "Build and use a persistent module name index for each library "
+                "search path so missing modules are found without scanning");
     cmdLine.add(
         "--exclude-ext",
         [this](std::string_view value) {
@@ -69,6 +85,10 @@ void Driver::addStandardArgs() {
     cmdLine.add("--libraries-inherit-macros", options.librariesInheritMacros,
                 "If true, library files will inherit macro definitions from the primary source "
                 "files. --single-unit must also be passed when this option is used.");
+    cmdLine.add("--raw-disabled-text-scan", options.rawDisabledTextScan,
+                "Skip text inside inactive conditional directive branches with a raw character "
+                "scan instead of fully tokenizing it; faster, but lexical errors in the disabled "
+                "text are not reported");
 
     // Legacy vendor commands support
     cmdLine.add(
@@ -91,6 +111,33 @@ void Driver::addStandardArgs() {
                 "Maximum number of errors that can occur during lexing before the rest of the file "
                 "is skipped",
                 "<count>");
+    cmdLine.add("--stop-on-first-error", options.stopOnFirstError,
+                "Stop parsing each file at its first syntax error instead of recovering and "
+                "continuing; combined with --parse-only and --threads this gives the fastest "
+                "possible syntax gating");
+    cmdLine.add("--minimal-trivia", options.minimalTrivia,
+                "Don't record whitespace and comment trivia on tokens; reduces memory usage for "
+                "very large inputs but the original source text can no longer be reproduced from "
+                "the syntax tree");
+    cmdLine.add("--collapse-trivia", options.collapseTrivia,
+                "Collapse runs of whitespace and comment trivia into single source spans; reduces "
+                "memory usage for very large inputs while still allowing the original source text "
+                "to be reproduced");
+    cmdLine.add("--dedup-string-literals", options.dedupStringLiterals,
+                "Deduplicate long string literal values into shared storage instead of storing "
+                "them per occurrence; reduces memory usage when the same literals repeat across "
+                "many files");
+    cmdLine.add("--pipelined-preprocessing", options.pipelinedPreprocessing,
+                "Run the preprocessor ahead of the parser on a separate worker thread for each "
+                "compilation unit, overlapping macro expansion with parsing");
+    cmdLine.add("--defer-module-bodies", options.deferModuleBodies,
+                "Don't parse the bodies of module, interface, and program declarations in library "
+                "files up front; each body is parsed on demand if the definition is actually "
+                "referenced by the design");
+    cmdLine.add("--pipelined-compilation", options.pipelinedCompilation,
+                "Add completed syntax trees to the compilation while the remaining files are "
+                "still being parsed, overlapping definition registration with parsing; has an "
+                "effect only when parsing with more than one thread");
 
     // Compilation
     cmdLine.add("--max-hierarchy-depth", options.maxInstanceDepth,
@@ -135,6 +182,10 @@ void Driver::addStandardArgs() {
                 "procedural 'for' loop unrolling.");
     cmdLine.add("--lint-only", options.onlyLint,
                 "Only perform linting of code, don't try to elaborate a full hierarchy");
+    cmdLine.add("--elab-cache", options.elabCacheFile,
+                "Persist elaboration results for module bodies in the given file so that "
+                "later runs skip re-checking bodies that are unchanged and previously clean",
+                "<file>");
     cmdLine.add("--top", options.topModules,
                 "One or more top-level modules to instantiate "
                 "(instead of figuring it out automatically)",
@@ -174,6 +225,18 @@ void Driver::addStandardArgs() {
     cmdLine.add("--single-unit", options.singleUnit,
                 "Treat all input files as a single compilation unit");
 
+    cmdLine.add("--threads", options.numThreads,
+                "The number of threads to use for parsing source files "
+                "and for dumping the AST to JSON. "
+                "A value of 0 means one thread per hardware core. "
+                "Parsing is not parallelized when --single-unit is also provided.",
+                "<count>");
+
+    cmdLine.add("--prefetch-sources", options.prefetchSources,
+                "Read ahead through the source files in filelist order on a "
+                "background thread while parsing runs, overlapping cold-cache "
+                "I/O latency with parsing");
+
     cmdLine.add("-v", options.libraryFiles,
                 "One or more library files, which are separate compilation units "
                 "where modules are not automatically instantiated.",
@@ -429,9 +492,15 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
     for (auto it = buffers.rbegin(); it != buffers.rend(); it++)
         preprocessor.pushSource(*it);
 
-    SyntaxPrinter output;
+    // Most preprocessed output is verbatim source text, so reference it in
+    // place; contiguous runs of unmodified tokens collapse into single spans
+    // over the original buffers and only macro expansions materialize text.
+    // Everything the spans point into (the source buffers and the token
+    // allocator) outlives the write at the end of this function.
+    SyntaxPrinter output(sourceManager);
     output.setIncludeComments(includeComments);
     output.setIncludeDirectives(includeDirectives);
+    output.setZeroCopySources(true);
 
     std::optional<std::mt19937> rng;
     flat_hash_map<std::string, std::string> obfuscationMap;
@@ -479,7 +548,13 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
         }
     }
 
-    OS::print(fmt::format("{}\n", output.str()));
+    // Gather-write the spans in order rather than concatenating them
+    // into one large intermediate string.
+    OS::setBufferedOutputEnabled(true);
+    for (auto piece : output.pieces())
+        OS::print(piece);
+    OS::print("\n"sv);
+    OS::setBufferedOutputEnabled(false);
     return true;
 }
 
@@ -516,11 +591,435 @@ void Driver::reportMacros() {
     }
 }
 
+void Driver::reportDependencies(bool json) {
+    struct FileDeps {
+        std::string path;
+        std::vector<std::string_view> provides;
+        std::vector<std::string_view> references;
+    };
+
+    auto pathFor = [&](BufferID buffer) -> std::string {
+        auto& path = sourceManager.getFullPath(buffer);
+        if (!path.empty())
+            return path.string();
+        return std::string(sourceManager.getRawFileName(buffer));
+    };
+
+    // Collect include edges across all loaded buffers. These are file-level
+    // dependencies regardless of which syntax tree the includer belongs to.
+    flat_hash_map<std::string, std::vector<std::string>> includeMap;
+    for (auto buffer : sourceManager.getAllBuffers()) {
+        auto includedFrom = sourceManager.getIncludedFrom(buffer);
+        if (includedFrom)
+            includeMap[pathFor(includedFrom.buffer())].push_back(pathFor(buffer));
+    }
+
+    // For each tree, gather the definitions it provides and the names it
+    // references, straight from the parser metadata.
+    std::vector<FileDeps> files;
+    flat_hash_map<std::string_view, size_t> providers;
+    for (auto& tree : syntaxTrees) {
+        auto loc = tree->root().getFirstToken().location();
+        if (!loc)
+            continue;
+
+        FileDeps deps;
+        deps.path = pathFor(loc.buffer());
+
+        auto& meta = tree->getMetadata();
+        for (auto& [n, _] : meta.nodeMap) {
+            std::string_view name = n->as<ModuleDeclarationSyntax>().header->name.valueText();
+            if (!name.empty())
+                deps.provides.push_back(name);
+        }
+
+        for (auto classDecl : meta.classDecls) {
+            std::string_view name = classDecl->name.valueText();
+            if (!name.empty())
+                deps.provides.push_back(name);
+        }
+
+        flat_hash_set<std::string_view> seenNames;
+        auto addReference = [&](std::string_view name) {
+            if (!name.empty() && seenNames.emplace(name).second)
+                deps.references.push_back(name);
+        };
+
+        for (auto name : meta.globalInstances)
+            addReference(name);
+
+        for (auto idName : meta.classPackageNames)
+            addReference(idName->identifier.valueText());
+
+        for (auto importDecl : meta.packageImports) {
+            for (auto importItem : importDecl->items)
+                addReference(importItem->package.valueText());
+        }
+
+        // The metadata sets iterate in hash order; sort so that the emitted
+        // graph is stable from run to run.
+        std::ranges::sort(deps.provides);
+        std::ranges::sort(deps.references);
+
+        for (auto name : deps.provides)
+            providers.emplace(name, files.size());
+
+        files.emplace_back(std::move(deps));
+    }
+
+    // Resolve a file's references against the provider map and chase include
+    // edges transitively, producing the final per-file dependency list.
+    auto resolve = [&](const FileDeps& deps) {
+        std::vector<std::string> result;
+        flat_hash_set<std::string> seenPaths;
+        for (auto name : deps.references) {
+            if (auto it = providers.find(name); it != providers.end()) {
+                auto& path = files[it->second].path;
+                if (path != deps.path && seenPaths.emplace(path).second)
+                    result.push_back(path);
+            }
+        }
+
+        std::vector<std::string> worklist{deps.path};
+        while (!worklist.empty()) {
+            auto curr = std::move(worklist.back());
+            worklist.pop_back();
+            if (auto it = includeMap.find(curr); it != includeMap.end()) {
+                for (auto& path : it->second) {
+                    if (path != deps.path && seenPaths.emplace(path).second) {
+                        result.push_back(path);
+                        worklist.push_back(path);
+                    }
+                }
+            }
+        }
+
+        std::ranges::sort(result);
+        return result;
+    };
+
+    if (json) {
+        JsonWriter writer;
+        writer.setPrettyPrint(true);
+        writer.startObject();
+        writer.writeProperty("files");
+        writer.startArray();
+        for (auto& deps : files) {
+            writer.startObject();
+            writer.writeProperty("path");
+            writer.writeValue(deps.path);
+
+            writer.writeProperty("provides");
+            writer.startArray();
+            for (auto name : deps.provides)
+                writer.writeValue(name);
+            writer.endArray();
+
+            writer.writeProperty("references");
+            writer.startArray();
+            for (auto name : deps.references)
+                writer.writeValue(name);
+            writer.endArray();
+
+            writer.writeProperty("dependsOn");
+            writer.startArray();
+            for (auto& path : resolve(deps))
+                writer.writeValue(path);
+            writer.endArray();
+            writer.endObject();
+        }
+        writer.endArray();
+        writer.endObject();
+        OS::print(fmt::format("{}\n", writer.view()));
+    }
+    else {
+        for (auto& deps : files) {
+            auto resolved = resolve(deps);
+            if (resolved.empty())
+                continue;
+
+            std::string line = deps.path;
+            line += ":";
+            for (auto& path : resolved) {
+                line += " ";
+                line += path;
+            }
+            OS::print(fmt::format("{}\n", line));
+        }
+    }
+}
+
+bool Driver::reparseChangedSources() {
+    // Find which files have changed on disk since the last scan.
+    // The first scan only records baseline timestamps.
+    bool firstScan = watchedFileTimes.empty();
+    flat_hash_set<std::string> changedPaths;
+    for (auto buffer : sourceManager.getAllBuffers()) {
+        auto& path = sourceManager.getFullPath(buffer);
+        if (path.empty())
+            continue;
+
+        auto pathStr = path.string();
+        if (changedPaths.find(pathStr) != changedPaths.end())
+            continue;
+
+        std::error_code ec;
+        auto time = fs::last_write_time(path, ec);
+        if (ec)
+            continue;
+
+        auto [it, inserted] = watchedFileTimes.emplace(pathStr, time);
+        if (inserted || it->second == time)
+            continue;
+
+        it->second = time;
+        sourceManager.invalidateCachedFile(path);
+        changedPaths.emplace(std::move(pathStr));
+    }
+
+    if (firstScan || changedPaths.empty())
+        return false;
+
+    // Changes propagate up the include chain; re-parsing happens at the root
+    // file of every tree that pulled in a changed file. Several buffers can
+    // share a path (one per reparse), so roots are tracked by path as well.
+    flat_hash_set<std::string> changedRootPaths;
+    for (auto buffer : sourceManager.getAllBuffers()) {
+        auto& path = sourceManager.getFullPath(buffer);
+        if (path.empty() || changedPaths.find(path.string()) == changedPaths.end())
+            continue;
+
+        auto root = buffer;
+        while (auto includedFrom = sourceManager.getIncludedFrom(root))
+            root = includedFrom.buffer();
+
+        auto& rootPath = sourceManager.getFullPath(root);
+        if (!rootPath.empty())
+            changedRootPaths.emplace(rootPath.string());
+    }
+
+    auto optionBag = createOptionBag();
+    bool onlyLint = options.onlyLint == true;
+    bool reparsed = false;
+
+    if (options.singleUnit == true && !syntaxTrees.empty()) {
+        // All primary files form one compilation unit; re-read the changed
+        // buffers and rebuild the whole combined tree.
+        bool mainUnitChanged = false;
+        for (auto& buffer : buffers) {
+            auto& path = sourceManager.getFullPath(buffer.id);
+            if (path.empty() || changedRootPaths.erase(path.string()) == 0)
+                continue;
+
+            auto newBuffer = sourceManager.readSource(path);
+            if (newBuffer) {
+                buffer = newBuffer;
+                mainUnitChanged = true;
+            }
+        }
+
+        if (mainUnitChanged) {
+            auto tree = SyntaxTree::fromBuffers(buffers, sourceManager, optionBag);
+            if (onlyLint)
+                tree->isLibrary = true;
+
+            syntaxTrees[0] = std::move(tree);
+            reparsed = true;
+        }
+    }
+
+    // Re-parse each remaining tree whose root file (or one of its includes)
+    // changed, leaving all other trees untouched.
+    for (auto& tree : syntaxTrees) {
+        auto loc = tree->root().getFirstToken().location();
+        if (!loc)
+            continue;
+
+        auto rootBuffer = loc.buffer();
+        auto& rootPath = sourceManager.getFullPath(rootBuffer);
+        if (rootPath.empty() || changedRootPaths.find(rootPath.string()) == changedRootPaths.end())
+            continue;
+
+        auto newBuffer = sourceManager.readSource(rootPath);
+        if (!newBuffer)
+            continue;
+
+        bool wasLibrary = tree->isLibrary;
+
+        // Reuse leading unchanged members from the old tree where possible;
+        // fromEdit falls back to a full reparse on its own when it can't.
+        auto newTree = SyntaxTree::fromEdit(tree, newBuffer);
+        newTree->isLibrary = wasLibrary || onlyLint;
+        tree = std::move(newTree);
+        reparsed = true;
+
+        for (auto& buffer : buffers) {
+            if (buffer.id == rootBuffer)
+                buffer = newBuffer;
+        }
+    }
+
+    return reparsed;
+}
+
+namespace {
+
+// Lexes the given buffer and appends the names of all design elements declared
+// in it: modules, interfaces, programs, packages, and classes. This is a raw
+// lexical scan without preprocessing, which is all the typical vendor cell
+// library needs; files whose declarations hide behind macros just won't be
+// indexed and fall back to the name-based probe.
+void scanElementNames(SourceBuffer buffer, SmallVector<std::string_view>& names) {
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    Lexer lexer(buffer, alloc, diagnostics);
+
+    while (true) {
+        Token token = lexer.lex();
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+
+        switch (token.kind) {
+            case TokenKind::ModuleKeyword:
+            case TokenKind::MacromoduleKeyword:
+            case TokenKind::InterfaceKeyword:
+            case TokenKind::ProgramKeyword:
+            case TokenKind::PackageKeyword:
+            case TokenKind::ClassKeyword:
+                // The name is the next identifier, skipping an optional
+                // lifetime (and the class keyword of an interface class).
+                do {
+                    token = lexer.lex();
+                } while (token.kind == TokenKind::StaticKeyword ||
+                         token.kind == TokenKind::AutomaticKeyword ||
+                         token.kind == TokenKind::ClassKeyword);
+
+                if (token.kind == TokenKind::Identifier)
+                    names.push_back(token.valueText());
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+// Loads the persistent library index for the given directory, or scans the
+// directory to build and save one if it's missing or out of date. The index
+// maps each design element name declared in the directory to the file that
+// declares it, and is validated against the directory's last write time and
+// the extension set in use, so adding or removing files triggers a rebuild.
+// An edit to an existing file doesn't change the directory mtime, but it also
+// doesn't move declarations between files in any flow we care about.
+flat_hash_map<std::string, std::string> loadOrBuildLibraryIndex(
+    const fs::path& dir, std::span<const fs::path> extensions) {
+
+    flat_hash_map<std::string, std::string> index;
+
+    std::vector<std::string> exts;
+    for (auto& ext : extensions)
+        exts.push_back(ext.string());
+    std::ranges::sort(exts);
+
+    auto makeHeader = [&]() -> std::string {
+        std::error_code ec;
+        auto dirTime = fs::last_write_time(dir, ec);
+        if (ec)
+            return {};
+
+        std::string header = fmt::format("slang-libindex 1 {}",
+                                         dirTime.time_since_epoch().count());
+        for (size_t i = 0; i < exts.size(); i++) {
+            header += i == 0 ? ' ' : ',';
+            header += exts[i];
+        }
+        return header;
+    };
+
+    std::string header = makeHeader();
+    if (header.empty())
+        return index;
+
+    auto indexPath = dir / ".slang-libindex";
+    {
+        std::ifstream file(indexPath);
+        std::string line;
+        if (file && std::getline(file, line) && line == header) {
+            while (std::getline(file, line)) {
+                auto space = line.find(' ');
+                if (space != std::string::npos)
+                    index.emplace(line.substr(0, space), line.substr(space + 1));
+            }
+            return index;
+        }
+    }
+
+    // Scan the directory, lexing each library file once. The scratch source
+    // manager keeps the scanned file contents out of the real one.
+    SourceManager scratch;
+    flat_hash_set<std::string> extSet(exts.begin(), exts.end());
+
+    std::error_code ec;
+    for (auto& entry : fs::directory_iterator(dir, fs::directory_options::skip_permission_denied,
+                                              ec)) {
+        if (!entry.is_regular_file(ec))
+            continue;
+
+        auto& path = entry.path();
+        if (extSet.find(path.extension().string()) == extSet.end())
+            continue;
+
+        SourceBuffer buffer = scratch.readSource(path);
+        if (!buffer)
+            continue;
+
+        SmallVector<std::string_view> names;
+        scanElementNames(buffer, names);
+
+        auto fileName = path.filename().string();
+        for (auto name : names)
+            index.emplace(std::string(name), fileName);
+    }
+
+    // Best effort save; a read-only directory just means we rescan next run.
+    // Creating the index file bumps the directory mtime, so open it before
+    // computing the stamp that goes in the header.
+    std::ofstream file(indexPath, std::ios::trunc);
+    header = makeHeader();
+    if (file && !header.empty()) {
+        file << header << '\n';
+        for (auto& [name, fileName] : index)
+            file << name << ' ' << fileName << '\n';
+    }
+
+    return index;
+}
+
+} // namespace
+
 bool Driver::parseAllSources() {
     bool singleUnit = options.singleUnit == true;
     bool onlyLint = options.onlyLint == true;
 
     auto optionBag = createOptionBag();
+
+    // Warm the source buffers in filelist order on a background thread so
+    // that cold-cache first-touch faults (network reads for memory mapped
+    // files) overlap with parsing instead of serializing in front of it.
+    // The pages it touches are exactly the ones the parser is about to
+    // read, in the same order, so the prefetcher naturally runs just ahead
+    // of the parser and never does wasted work.
+    std::thread prefetcher;
+    if (options.prefetchSources == true && !buffers.empty()) {
+        prefetcher = std::thread([this] {
+            for (const SourceBuffer& buffer : buffers)
+                OS::prefetchMemory(buffer.data.data(), buffer.data.size());
+        });
+    }
+    auto prefetchGuard = ScopeGuard([&] {
+        if (prefetcher.joinable())
+            prefetcher.join();
+    });
+
     if (singleUnit) {
         auto tree = SyntaxTree::fromBuffers(buffers, sourceManager, optionBag);
         if (onlyLint)
@@ -529,15 +1028,69 @@ bool Driver::parseAllSources() {
         syntaxTrees.emplace_back(std::move(tree));
     }
     else {
-        for (const SourceBuffer& buffer : buffers) {
-            auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, optionBag);
-            if (onlyLint)
-                tree->isLibrary = true;
+        uint32_t threadCount = options.numThreads.value_or(1);
+        if (threadCount == 0)
+            threadCount = std::thread::hardware_concurrency();
+        threadCount = (uint32_t)std::min<size_t>(threadCount, buffers.size());
+
+        if (threadCount > 1) {
+            // Each file is an independent compilation unit before elaboration, so
+            // workers can parse concurrently; every SyntaxTree carries its own
+            // bump allocator and diagnostics, and the SourceManager is thread
+            // safe. Results land in buffer order so that diagnostic reporting
+            // stays deterministic regardless of scheduling.
+            std::vector<std::shared_ptr<SyntaxTree>> trees(buffers.size());
+            std::atomic<size_t> nextIndex = 0;
+
+            std::vector<std::thread> workers;
+            workers.reserve(threadCount);
+            for (uint32_t i = 0; i < threadCount; i++) {
+                workers.emplace_back([&] {
+                    while (true) {
+                        size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+                        if (index >= buffers.size())
+                            break;
+
+                        auto tree = SyntaxTree::fromBuffer(buffers[index], sourceManager,
+                                                           optionBag);
+                        if (onlyLint)
+                            tree->isLibrary = true;
+
+                        trees[index] = std::move(tree);
+                    }
+                });
+            }
 
-            syntaxTrees.emplace_back(std::move(tree));
+            for (auto& worker : workers)
+                worker.join();
+
+            syntaxTrees.insert(syntaxTrees.end(), std::make_move_iterator(trees.begin()),
+                               std::make_move_iterator(trees.end()));
+        }
+        else {
+            for (const SourceBuffer& buffer : buffers) {
+                auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, optionBag);
+                if (onlyLint)
+                    tree->isLibrary = true;
+
+                syntaxTrees.emplace_back(std::move(tree));
+            }
         }
     }
 
+    return finishParsing(optionBag);
+}
+
+bool Driver::finishParsing(const Bag& optionBag) {
+    // Library files get their own option bag so that body deferral (if
+    // requested) applies only to them and not to the user's design files.
+    Bag libraryBag = optionBag;
+    if (options.deferModuleBodies == true) {
+        auto poptions = libraryBag.getOrDefault<ParserOptions>();
+        poptions.deferModuleBodies = true;
+        libraryBag.set(poptions);
+    }
+
     std::span<const DefineDirectiveSyntax* const> inheritedMacros;
     if (options.librariesInheritMacros == true)
         inheritedMacros = syntaxTrees.back()->getDefinedMacros();
@@ -550,7 +1103,7 @@ bool Driver::parseAllSources() {
             continue;
         }
 
-        auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, optionBag, inheritedMacros);
+        auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, libraryBag, inheritedMacros);
         tree->isLibrary = true;
         syntaxTrees.emplace_back(std::move(tree));
     }
@@ -571,16 +1124,51 @@ bool Driver::parseAllSources() {
         for (auto ext : uniqueExtensions)
             extensions.emplace_back(widen(ext));
 
+        // With --lib-index, each directory gets a persistent name -> file index
+        // so the search below opens only the file that declares a missing name,
+        // including files not named after the modules they contain. Indexes are
+        // loaded (or built) lazily on the first missing name, so compiles that
+        // resolve everything up front don't touch them at all.
+        std::vector<std::optional<flat_hash_map<std::string, std::string>>> indexes;
+        if (options.libraryIndex == true)
+            indexes.resize(directories.size());
+
+        auto searchIndexes = [&](std::string_view name) {
+            SourceBuffer buffer;
+            for (size_t i = 0; i < indexes.size() && !buffer; i++) {
+                auto& index = indexes[i];
+                if (!index)
+                    index = loadOrBuildLibraryIndex(directories[i], extensions);
+
+                if (auto it = index->find(std::string(name)); it != index->end()) {
+                    fs::path path = directories[i] / it->second;
+                    if (!sourceManager.isCached(path))
+                        buffer = sourceManager.readSource(path);
+                }
+            }
+            return buffer;
+        };
+
         // If library directories are specified, see if we have any unknown instantiations
         // or package names for which we should search for additional source files to load.
+        // Declarations whose bodies are deferred are tracked separately; if one of them is
+        // actually instantiated we expand its body so that instantiations inside it can
+        // drive further file loading.
         flat_hash_set<std::string_view> knownNames;
+        flat_hash_map<std::string_view,
+                      std::pair<std::shared_ptr<SyntaxTree>, const ModuleDeclarationSyntax*>>
+            deferredDecls;
+
         auto addKnownNames = [&](const std::shared_ptr<SyntaxTree>& tree) {
             auto& meta = tree->getMetadata();
             for (auto& [n, _] : meta.nodeMap) {
                 auto decl = &n->as<ModuleDeclarationSyntax>();
                 std::string_view name = decl->header->name.valueText();
-                if (!name.empty())
+                if (!name.empty()) {
                     knownNames.emplace(name);
+                    if (tree->isModuleBodyDeferred(*decl))
+                        deferredDecls[name] = {tree, decl};
+                }
             }
 
             for (auto classDecl : meta.classDecls) {
@@ -594,8 +1182,10 @@ bool Driver::parseAllSources() {
                                     flat_hash_set<std::string_view>& missing) {
             auto& meta = tree->getMetadata();
             for (auto name : meta.globalInstances) {
-                if (knownNames.find(name) == knownNames.end())
+                if (knownNames.find(name) == knownNames.end() ||
+                    deferredDecls.find(name) != deferredDecls.end()) {
                     missing.emplace(name);
+                }
             }
 
             for (auto idName : meta.classPackageNames) {
@@ -621,11 +1211,40 @@ bool Driver::parseAllSources() {
             findMissingNames(tree, missingNames);
 
         // Keep loading new files as long as we are making forward progress.
+        flat_hash_set<std::string_view> requestedNames;
         flat_hash_set<std::string_view> nextMissingNames;
+
+        // Expands the deferred body of the declaration with the given name,
+        // if there is one, making instantiations inside it visible to the
+        // search. Returns false if no such declaration exists.
+        auto expandDeferred = [&](std::string_view name) {
+            auto dit = deferredDecls.find(name);
+            if (dit == deferredDecls.end())
+                return false;
+
+            auto [declTree, decl] = dit->second;
+            deferredDecls.erase(dit);
+
+            declTree->expandDeferredBody(*decl);
+            addKnownNames(declTree);
+            findMissingNames(declTree, nextMissingNames);
+            return true;
+        };
+
         while (true) {
             for (auto name : missingNames) {
-                SourceBuffer buffer;
+                requestedNames.emplace(name);
+
+                // If the name refers to an already loaded declaration whose body
+                // is deferred, expand that body instead of searching for a file.
+                if (expandDeferred(name))
+                    continue;
+
+                SourceBuffer buffer = searchIndexes(name);
                 for (auto& dir : directories) {
+                    if (buffer)
+                        break;
+
                     fs::path path(dir);
                     path /= name;
 
@@ -637,18 +1256,26 @@ bool Driver::parseAllSources() {
                                 break;
                         }
                     }
-
-                    if (buffer)
-                        break;
                 }
 
                 if (buffer) {
-                    auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, optionBag,
+                    auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, libraryBag,
                                                        inheritedMacros);
                     tree->isLibrary = true;
                     syntaxTrees.emplace_back(tree);
 
                     addKnownNames(tree);
+
+                    // The file may define deferred declarations that were
+                    // requested earlier in this pass; expand those now.
+                    SmallVector<std::string_view> pending;
+                    for (auto& [n, entry] : deferredDecls) {
+                        if (entry.first == tree && requestedNames.find(n) != requestedNames.end())
+                            pending.push_back(n);
+                    }
+                    for (auto n : pending)
+                        expandDeferred(n);
+
                     findMissingNames(tree, nextMissingNames);
                 }
             }
@@ -670,6 +1297,79 @@ bool Driver::parseAllSources() {
     return ok;
 }
 
+std::unique_ptr<Compilation> Driver::parseAndCreateCompilation(bool& ok) {
+    uint32_t threadCount = options.numThreads.value_or(1);
+    if (threadCount == 0)
+        threadCount = std::thread::hardware_concurrency();
+    threadCount = (uint32_t)std::min<size_t>(threadCount, buffers.size());
+
+    if (options.pipelinedCompilation != true || options.singleUnit == true || threadCount <= 1) {
+        ok = parseAllSources();
+        return createCompilation();
+    }
+
+    bool onlyLint = options.onlyLint == true;
+    auto optionBag = createOptionBag();
+
+    // Same parallel parse as parseAllSources, except that each completed tree
+    // is handed to the main thread, which ingests it into the compilation (in
+    // buffer order, for deterministic diagnostics) while the workers keep
+    // parsing later files. That hides per-tree definition and metadata
+    // registration behind parsing; elaboration itself still has to wait for
+    // the last tree, since a compilation can't accept new syntax trees once
+    // symbol binding starts.
+    std::vector<std::shared_ptr<SyntaxTree>> trees(buffers.size());
+    std::atomic<size_t> nextIndex = 0;
+    std::mutex mutex;
+    std::condition_variable doneVar;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++) {
+        workers.emplace_back([&] {
+            while (true) {
+                size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+                if (index >= buffers.size())
+                    break;
+
+                auto tree = SyntaxTree::fromBuffer(buffers[index], sourceManager, optionBag);
+                if (onlyLint)
+                    tree->isLibrary = true;
+
+                {
+                    std::lock_guard lock(mutex);
+                    trees[index] = std::move(tree);
+                }
+                doneVar.notify_all();
+            }
+        });
+    }
+
+    auto compilation = std::make_unique<Compilation>(optionBag);
+    for (size_t i = 0; i < trees.size(); i++) {
+        std::shared_ptr<SyntaxTree> tree;
+        {
+            std::unique_lock lock(mutex);
+            doneVar.wait(lock, [&] { return trees[i] != nullptr; });
+            tree = std::move(trees[i]);
+        }
+
+        syntaxTrees.emplace_back(tree);
+        compilation->addSyntaxTree(std::move(tree));
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    ok = finishParsing(optionBag);
+
+    // Library trees discovered while finishing still need to be ingested.
+    for (size_t i = compilation->getSyntaxTrees().size(); i < syntaxTrees.size(); i++)
+        compilation->addSyntaxTree(syntaxTrees[i]);
+
+    return compilation;
+}
+
 Bag Driver::createOptionBag() const {
     PreprocessorOptions ppoptions;
     ppoptions.predefines = options.defines;
@@ -679,14 +1379,33 @@ Bag Driver::createOptionBag() const {
         ppoptions.maxIncludeDepth = *options.maxIncludeDepth;
     for (const auto& d : options.ignoreDirectives)
         ppoptions.ignoreDirectives.emplace(d);
+    if (options.rawDisabledTextScan.has_value())
+        ppoptions.rawDisabledTextScan = *options.rawDisabledTextScan;
 
     LexerOptions loptions;
     if (options.maxLexerErrors.has_value())
         loptions.maxErrors = *options.maxLexerErrors;
+    if (options.minimalTrivia.has_value())
+        loptions.minimalTrivia = *options.minimalTrivia;
+    if (options.collapseTrivia.has_value())
+        loptions.collapseTrivia = *options.collapseTrivia;
+    if (options.dedupStringLiterals == true)
+        loptions.literalInterner = &literalInterner;
 
     ParserOptions poptions;
     if (options.maxParseDepth.has_value())
         poptions.maxRecursionDepth = *options.maxParseDepth;
+    if (options.pipelinedPreprocessing.has_value())
+        poptions.pipelinedPreprocessing = *options.pipelinedPreprocessing;
+    if (options.stopOnFirstError.has_value())
+        poptions.stopOnFirstError = *options.stopOnFirstError;
+
+    // The parser shares the driver's error limit so that a hopelessly broken
+    // file is abandoned instead of being error-recovered to the end. Double
+    // it (as for elaboration below) so the per-unit budget only kicks in well
+    // past the point where the diagnostic engine would have stopped
+    // displaying errors anyway.
+    poptions.errorLimit = options.errorLimit.value_or(20) * 2;
 
     CompilationOptions coptions;
     coptions.suppressUnused = false;
@@ -708,6 +1427,7 @@ Bag Driver::createOptionBag() const {
     if (options.onlyLint == true) {
         coptions.suppressUnused = true;
         coptions.lintMode = true;
+        coptions.skipCoverageChecks = true;
     }
     if (options.allowHierarchicalConst == true)
         coptions.allowHierarchicalConst = true;
@@ -739,6 +1459,12 @@ Bag Driver::createOptionBag() const {
     if (options.timeScale.has_value())
         coptions.defaultTimeScale = TimeScale::fromString(*options.timeScale);
 
+    if (options.elabCacheFile.has_value()) {
+        if (!elabCache)
+            elabCache = ElabCache::open(*options.elabCacheFile);
+        coptions.elabCache = elabCache;
+    }
+
     Bag bag;
     bag.set(ppoptions);
     bag.set(loptions);
@@ -756,6 +1482,28 @@ std::unique_ptr<Compilation> Driver::createCompilation() const {
     return compilation;
 }
 
+std::unique_ptr<Compilation> Driver::createCompilation(
+    std::span<const std::string> topModules) const {
+    auto optionBag = createOptionBag();
+    auto coptions = optionBag.getOrDefault<CompilationOptions>();
+    coptions.topModules.clear();
+    for (auto& name : topModules)
+        coptions.topModules.emplace(name);
+    optionBag.set(coptions);
+
+    // Deferred module bodies are parsed in place on first use, which would
+    // mutate trees shared between compilations; expand them all up front so
+    // that every tree is immutable from here on.
+    for (auto& tree : syntaxTrees)
+        tree->expandAllDeferredBodies();
+
+    auto compilation = std::make_unique<Compilation>(optionBag);
+    for (auto& tree : syntaxTrees)
+        compilation->addSyntaxTree(tree);
+
+    return compilation;
+}
+
 bool Driver::reportParseDiags() {
     auto compilation = createCompilation();
     for (auto& diag : compilation->getParseDiagnostics())
@@ -776,12 +1524,26 @@ bool Driver::reportCompilation(Compilation& compilation, bool quiet) {
         }
     }
 
-    for (auto& diag : compilation.getAllDiagnostics())
-        diagEngine.issue(diag);
+    // These sub-phases are traced separately so that time trace output can
+    // attribute time and memory growth to semantic analysis as opposed to
+    // diagnostic formatting and reporting.
+    const Diagnostics* diags;
+    {
+        TimeTraceScope timeScope("semanticAnalysis"sv, ""sv);
+        diags = &compilation.getAllDiagnostics();
+    }
 
-    bool succeeded = diagEngine.getNumErrors() == 0;
+    bool succeeded;
+    std::string diagStr;
+    {
+        TimeTraceScope timeScope("reportDiagnostics"sv, ""sv);
+        for (auto& diag : *diags)
+            diagEngine.issue(diag);
+
+        succeeded = diagEngine.getNumErrors() == 0;
+        diagStr = diagClient->getString();
+    }
 
-    std::string diagStr = diagClient->getString();
     OS::printE(fmt::format("{}", diagStr));
 
     if (!quiet) {
@@ -799,7 +1561,113 @@ bool Driver::reportCompilation(Compilation& compilation, bool quiet) {
                               diagEngine.getNumWarnings() == 1 ? "" : "s"));
     }
 
+    // Bodies recorded as clean stay valid facts even if other parts of the
+    // design had errors, so the elaboration cache is written back regardless
+    // of whether the build succeeded.
+    if (elabCache)
+        elabCache->save();
+
     return succeeded;
 }
 
+namespace {
+
+// Counts the syntax nodes and tokens in a tree for the statistics report.
+class SyntaxCounter : public SyntaxVisitor<SyntaxCounter> {
+public:
+    size_t nodes = 0;
+    size_t tokens = 0;
+
+    template<typename T>
+    void handle(const T& node) {
+        nodes++;
+        visitDefault(node);
+    }
+
+    void visitToken(Token) { tokens++; }
+};
+
+// Counts the symbols created during elaboration.
+class SymbolCounter : public ASTVisitor<SymbolCounter, false, false> {
+public:
+    size_t symbols = 0;
+
+    template<typename T>
+    void handle(const T& node) {
+        if constexpr (std::is_base_of_v<Symbol, T>)
+            symbols++;
+        visitDefault(node);
+    }
+};
+
+} // namespace
+
+void Driver::reportStats(Compilation& compilation) {
+    struct FileStats {
+        std::string path;
+        size_t tokens = 0;
+        size_t nodes = 0;
+        size_t arenaBytes = 0;
+    };
+
+    std::vector<FileStats> files;
+    size_t totalTokens = 0;
+    size_t totalNodes = 0;
+    BumpAllocator::MemoryStats parseArena;
+    for (auto& tree : syntaxTrees) {
+        FileStats stats;
+        if (auto loc = tree->root().getFirstToken().location()) {
+            auto& path = sourceManager.getFullPath(loc.buffer());
+            stats.path = path.empty() ? std::string(sourceManager.getRawFileName(loc.buffer()))
+                                      : path.string();
+        }
+
+        SyntaxCounter counter;
+        tree->root().visit(counter);
+        stats.tokens = counter.tokens;
+        stats.nodes = counter.nodes;
+        stats.arenaBytes = tree->allocator().getStats().usedBytes;
+
+        totalTokens += stats.tokens;
+        totalNodes += stats.nodes;
+        parseArena += tree->allocator().getStats();
+        files.emplace_back(std::move(stats));
+    }
+
+    // Each macro expansion gets its own buffer entry in the source manager,
+    // so counting those gives the number of expansions performed.
+    size_t macroExpansions = 0;
+    for (auto buffer : sourceManager.getAllBuffers()) {
+        if (sourceManager.isMacroLoc(SourceLocation(buffer, 0)))
+            macroExpansions++;
+    }
+
+    SymbolCounter symbolCounter;
+    compilation.getRoot().visit(symbolCounter);
+    auto elabArena = compilation.getStats();
+
+    // Most expensive files first so hot spots are at the top of the report.
+    std::ranges::sort(files, [](auto& a, auto& b) { return a.arenaBytes > b.arenaBytes; });
+
+    OS::print(fg(diagClient->highlightColor), "Parse statistics by file:\n");
+    for (auto& stats : files) {
+        OS::print(fmt::format("  {}: {} tokens, {} nodes, {} bytes\n", stats.path, stats.tokens,
+                              stats.nodes, stats.arenaBytes));
+    }
+
+    OS::print(fg(diagClient->highlightColor), "\nTotals:\n");
+    OS::print(fmt::format("  files: {}\n", files.size()));
+    OS::print(fmt::format("  tokens: {}\n", totalTokens));
+    OS::print(fmt::format("  syntax nodes: {}\n", totalNodes));
+    OS::print(fmt::format("  macro expansions: {}\n", macroExpansions));
+    OS::print(fmt::format("  symbols: {}\n", symbolCounter.symbols));
+    OS::print(fmt::format("  parse memory: {} bytes in {} segments ({} used)\n",
+                          parseArena.allocatedBytes, parseArena.segmentCount,
+                          parseArena.usedBytes));
+    OS::print(fmt::format("  elaboration memory: {} bytes in {} segments ({} used)\n",
+                          elabArena.allocatedBytes, elabArena.segmentCount, elabArena.usedBytes));
+    OS::print(fmt::format("  process memory: {} bytes resident ({} peak)\n", OS::getCurrentRSS(),
+                          OS::getPeakRSS()));
+}
+
 } // namespace slang::driver
@@ -8,6 +8,7 @@
 #include "slang/numeric/ConstantValue.h"
 
 #include "../text/FormatBuffer.h"
+#include <algorithm>
 #include <ostream>
 
 #include "slang/util/Hash.h"
@@ -766,6 +767,66 @@ CVConstIterator end(const ConstantValue& cv) {
         cv.getVariant());
 }
 
+AssociativeArray::iterator AssociativeArray::find(const ConstantValue& key) {
+    auto it = storage.find(key);
+    if (it == storage.end())
+        return end();
+    return iterator(this, &*it, NoSortedIndex);
+}
+
+AssociativeArray::const_iterator AssociativeArray::find(const ConstantValue& key) const {
+    auto it = storage.find(key);
+    if (it == storage.end())
+        return end();
+    return const_iterator(this, &*it, NoSortedIndex);
+}
+
+bool AssociativeArray::operator==(const AssociativeArray& rhs) const {
+    if (storage.size() != rhs.storage.size())
+        return false;
+
+    for (auto& entry : storage) {
+        auto it = rhs.storage.find(entry.first);
+        if (it == rhs.storage.end() || it->second != entry.second)
+            return false;
+    }
+    return true;
+}
+
+bool AssociativeArray::operator<(const AssociativeArray& rhs) const {
+    auto& lhsView = sortedView();
+    auto& rhsView = rhs.sortedView();
+    return std::lexicographical_compare(lhsView.begin(), lhsView.end(), rhsView.begin(),
+                                        rhsView.end(), [](value_type* a, value_type* b) {
+                                            if (a->first < b->first)
+                                                return true;
+                                            if (b->first < a->first)
+                                                return false;
+                                            return a->second < b->second;
+                                        });
+}
+
+std::vector<AssociativeArray::value_type*>& AssociativeArray::sortedView() const {
+    if (!sortedValid) {
+        auto& self = const_cast<AssociativeArray&>(*this);
+        sorted.clear();
+        sorted.reserve(storage.size());
+        for (auto& entry : self.storage)
+            sorted.push_back(&entry);
+
+        std::ranges::sort(sorted, [](value_type* a, value_type* b) { return a->first < b->first; });
+        sortedValid = true;
+    }
+    return sorted;
+}
+
+size_t AssociativeArray::sortedIndexOf(const ConstantValue& key) const {
+    auto& view = sortedView();
+    auto it = std::lower_bound(view.begin(), view.end(), key,
+                               [](value_type* a, const ConstantValue& k) { return a->first < k; });
+    return size_t(it - view.begin());
+}
+
 ConstantRange ConstantRange::subrange(ConstantRange select) const {
     int32_t l = lower();
     ConstantRange result;
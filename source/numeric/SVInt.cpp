@@ -628,10 +628,6 @@ SVInt SVInt::replicate(const SVInt& times) const {
     return concat(std::span<SVInt const>(buffer.begin(), buffer.end()));
 }
 
-size_t SVInt::hash() const {
-    return ankerl::unordered_dense::detail::wyhash::hash(getRawData(), getNumWords() * WORD_SIZE);
-}
-
 std::ostream& operator<<(std::ostream& os, const SVInt& rhs) {
     os << rhs.toString();
     return os;
@@ -771,17 +767,41 @@ void SVInt::writeTo(SmallVectorBase<char>& buffer, LiteralBase base, bool includ
                 tmp = quotient;
             }
 
-            // repeatedly divide by 10 to get each digit
-            SVInt divisor(4, 10, false);
+            // Divide by the largest power of 10 that fits in a 64-bit word and
+            // then peel digits out of the remainder natively, so that the
+            // expensive wide division runs once per 19 digits instead of once
+            // per digit. The digits are written least significant first and
+            // reversed along with the rest of the buffer below.
+            constexpr uint64_t chunkDivisor = 10000000000000000000ull;
+            constexpr uint32_t chunkDigits = 19;
+            SVInt divisor(64, chunkDivisor, false);
             while (tmp != 0) {
-                SVInt remainder;
-                SVInt quotient;
-                divide(tmp, tmp.getNumWords(), divisor, divisor.getNumWords(), &quotient,
-                       &remainder);
-                uint64_t digit = remainder.as<uint64_t>().value();
-                ASSERT(digit < 10);
-                buffer.push_back(Digits[digit]);
-                tmp = quotient;
+                uint64_t word;
+                bool lastChunk = tmp.getActiveBits() <= 64;
+                if (lastChunk) {
+                    word = tmp.getRawData()[0];
+                }
+                else {
+                    SVInt remainder;
+                    SVInt quotient;
+                    divide(tmp, tmp.getNumWords(), divisor, divisor.getNumWords(), &quotient,
+                           &remainder);
+                    word = remainder.getRawData()[0];
+                    tmp = quotient;
+                }
+
+                uint32_t count = 0;
+                for (; word != 0; count++) {
+                    buffer.push_back(Digits[word % 10]);
+                    word /= 10;
+                }
+
+                if (lastChunk)
+                    break;
+
+                // Interior chunks must pad out their leading zeros.
+                for (; count < chunkDigits; count++)
+                    buffer.push_back('0');
             }
         }
     }
@@ -911,13 +931,16 @@ logic_t SVInt::reductionAnd() const {
     bitwidth_t bitsInMsw;
     getTopWordMask(bitsInMsw, mask);
 
+    // The loops below accumulate across all words instead of exiting early on
+    // the first failing word; the straight-line form vectorizes well and wide
+    // values are short enough that the wasted work doesn't matter.
     if (unknownFlag) {
         uint32_t words = getNumWords(bitWidth, false);
-        for (uint32_t i = 0; i < words - 1; i++) {
-            if ((pVal[i] | pVal[i + words]) != UINT64_MAX)
-                return logic_t(false);
-        }
-        if ((pVal[words - 1] | pVal[words * 2 - 1]) != mask)
+        uint64_t acc = UINT64_MAX;
+        for (uint32_t i = 0; i < words - 1; i++)
+            acc &= pVal[i] | pVal[i + words];
+
+        if (acc != UINT64_MAX || (pVal[words - 1] | pVal[words * 2 - 1]) != mask)
             return logic_t(false);
         return logic_t::x;
     }
@@ -925,33 +948,33 @@ logic_t SVInt::reductionAnd() const {
     if (isSingleWord())
         return logic_t(val == mask);
     else {
-        for (uint32_t i = 0; i < getNumWords() - 1; i++) {
-            if (pVal[i] != UINT64_MAX)
-                return logic_t(false);
-        }
-        return logic_t(pVal[getNumWords() - 1] == mask);
+        uint64_t acc = UINT64_MAX;
+        for (uint32_t i = 0; i < getNumWords() - 1; i++)
+            acc &= pVal[i];
+        return logic_t(acc == UINT64_MAX && pVal[getNumWords() - 1] == mask);
     }
 }
 
 logic_t SVInt::reductionOr() const {
     if (unknownFlag) {
         uint32_t words = getNumWords(bitWidth, false);
-        for (uint32_t i = 0; i < words; i++) {
-            if (pVal[i] & ~pVal[i + words])
-                return logic_t(true);
-        }
+        uint64_t acc = 0;
+        for (uint32_t i = 0; i < words; i++)
+            acc |= pVal[i] & ~pVal[i + words];
+
+        if (acc)
+            return logic_t(true);
         return logic_t::x;
     }
 
     if (isSingleWord())
         return logic_t(val != 0);
     else {
-        for (uint32_t i = 0; i < getNumWords(); i++) {
-            if (pVal[i] != 0)
-                return logic_t(true);
-        }
+        uint64_t acc = 0;
+        for (uint32_t i = 0; i < getNumWords(); i++)
+            acc |= pVal[i];
+        return logic_t(acc != 0);
     }
-    return logic_t(false);
 }
 
 logic_t SVInt::reductionXor() const {
@@ -1133,20 +1156,25 @@ SVInt& SVInt::operator&=(const SVInt& rhs) {
                 pVal[0] = ~pVal[1] & pVal[0] & rhs.val;
             }
             else {
+                // Compute both planes in a single pass over the arrays; these
+                // loops are simple enough for the compiler to vectorize as long
+                // as each iteration stays independent.
                 if (rhs.hasUnknown()) {
                     for (uint32_t i = 0; i < words; i++) {
-                        pVal[i + words] = (pVal[i + words] | rhs.pVal[i + words]) &
-                                          (pVal[i + words] | pVal[i]) &
-                                          (rhs.pVal[i + words] | rhs.pVal[i]);
+                        uint64_t unk = (pVal[i + words] | rhs.pVal[i + words]) &
+                                       (pVal[i + words] | pVal[i]) &
+                                       (rhs.pVal[i + words] | rhs.pVal[i]);
+                        pVal[i + words] = unk;
+                        pVal[i] = ~unk & pVal[i] & rhs.pVal[i];
                     }
                 }
                 else {
-                    for (uint32_t i = 0; i < words; i++)
-                        pVal[i + words] &= rhs.pVal[i];
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unk = pVal[i + words] & rhs.pVal[i];
+                        pVal[i + words] = unk;
+                        pVal[i] = ~unk & pVal[i] & rhs.pVal[i];
+                    }
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    pVal[i] = ~pVal[i + words] & pVal[i] & rhs.pVal[i];
             }
         }
         else {
@@ -1181,19 +1209,23 @@ SVInt& SVInt::operator|=(const SVInt& rhs) {
                 pVal[0] = ~pVal[1] & (pVal[0] | rhs.val);
             }
             else {
+                // As in operator&=, fuse the unknown and value plane updates
+                // into one vectorizable pass.
                 if (rhs.hasUnknown()) {
                     for (uint32_t i = 0; i < words; i++) {
-                        pVal[i + words] = (pVal[i + words] & (rhs.pVal[i + words] | ~rhs.pVal[i])) |
-                                          (~pVal[i] & rhs.pVal[i + words]);
+                        uint64_t unk = (pVal[i + words] & (rhs.pVal[i + words] | ~rhs.pVal[i])) |
+                                       (~pVal[i] & rhs.pVal[i + words]);
+                        pVal[i + words] = unk;
+                        pVal[i] = ~unk & (pVal[i] | rhs.pVal[i]);
                     }
                 }
                 else {
-                    for (uint32_t i = 0; i < words; i++)
-                        pVal[i + words] &= ~rhs.pVal[i];
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unk = pVal[i + words] & ~rhs.pVal[i];
+                        pVal[i + words] = unk;
+                        pVal[i] = ~unk & (pVal[i] | rhs.pVal[i]);
+                    }
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    pVal[i] = ~pVal[i + words] & (pVal[i] | rhs.pVal[i]);
             }
         }
         else {
@@ -1227,12 +1259,16 @@ SVInt& SVInt::operator^=(const SVInt& rhs) {
                 pVal[0] = ~pVal[1] & (pVal[0] ^ rhs.val);
             else {
                 if (rhs.hasUnknown()) {
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unk = pVal[i + words] | rhs.pVal[i + words];
+                        pVal[i + words] = unk;
+                        pVal[i] = ~unk & (pVal[i] ^ rhs.pVal[i]);
+                    }
+                }
+                else {
                     for (uint32_t i = 0; i < words; i++)
-                        pVal[i + words] |= rhs.pVal[i + words];
+                        pVal[i] = ~pVal[i + words] & (pVal[i] ^ rhs.pVal[i]);
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    pVal[i] = ~pVal[i + words] & (pVal[i] ^ rhs.pVal[i]);
             }
         }
         else {
@@ -1266,12 +1302,18 @@ SVInt SVInt::xnor(const SVInt& rhs) const {
                 result.pVal[0] = ~result.pVal[1] & ~(result.pVal[0] ^ rhs.val);
             else {
                 if (rhs.hasUnknown()) {
-                    for (uint32_t i = 0; i < words; i++)
-                        result.pVal[i + words] |= rhs.pVal[i + words];
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unk = result.pVal[i + words] | rhs.pVal[i + words];
+                        result.pVal[i + words] = unk;
+                        result.pVal[i] = ~unk & ~(result.pVal[i] ^ rhs.pVal[i]);
+                    }
+                }
+                else {
+                    for (uint32_t i = 0; i < words; i++) {
+                        result.pVal[i] = ~result.pVal[i + words] &
+                                         ~(result.pVal[i] ^ rhs.pVal[i]);
+                    }
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    result.pVal[i] = ~result.pVal[i + words] & ~(result.pVal[i] ^ rhs.pVal[i]);
             }
         }
         else {
@@ -1775,6 +1817,12 @@ SVInt SVInt::concat(std::span<SVInt const> operands) {
     return result;
 }
 
+// Word storage always comes from plain new[] rather than a pool. SVInt is a
+// freestanding value type that can outlive any particular evaluation (constant
+// values are stored in the AST indefinitely), so there's no owner whose arena
+// could back the words, and a process-wide pool would be global mutable state,
+// which this library doesn't allow. Callers that churn short-lived wide
+// temporaries should prefer the in-place operator forms to reuse storage.
 SVInt SVInt::allocUninitialized(bitwidth_t bits, bool signFlag, bool unknownFlag) {
     ASSERT(bits && (bits > 64 || unknownFlag));
     return SVInt(new uint64_t[getNumWords(bits, unknownFlag)], bits, signFlag, unknownFlag);
@@ -1850,8 +1898,29 @@ SVInt& SVInt::assignSlowCase(const SVInt& rhs) {
 logic_t SVInt::equalsSlowCase(const SVInt& rhs) const {
     if (unknownFlag || rhs.unknownFlag) {
         // We can't know whether the numbers are definitely equal, but if there is a 0/1 pair, it is
-        // definitely not equal. xor detects 0/1 pairs for each bit and !reductionOr collects all
-        // pairs.
+        // definitely not equal. When the widths match we can find such pairs directly by diffing
+        // the value planes and masking off positions that are unknown on either side, without
+        // materializing the xor as a temporary.
+        if (bitWidth == rhs.bitWidth) {
+            uint32_t words = getNumWords(bitWidth, false);
+            const uint64_t* lval = getRawData();
+            const uint64_t* rval = rhs.getRawData();
+            uint64_t mismatch = 0;
+            for (uint32_t i = 0; i < words; i++) {
+                uint64_t unknowns = 0;
+                if (unknownFlag)
+                    unknowns |= pVal[i + words];
+                if (rhs.unknownFlag)
+                    unknowns |= rhs.pVal[i + words];
+                mismatch |= (lval[i] ^ rval[i]) & ~unknowns;
+            }
+
+            if (mismatch)
+                return logic_t(false);
+            return logic_t::x;
+        }
+
+        // Otherwise fall back to the xor, which handles extension.
         return !(*this ^ rhs).reductionOr();
     }
 
@@ -1884,12 +1953,11 @@ logic_t SVInt::equalsSlowCase(const SVInt& rhs) const {
 
     // compare each word
     uint32_t limit = whichWord(a1 - 1);
-    for (uint32_t i = 0; i <= limit; i++) {
-        if (lval[i] != rval[i])
-            return logic_t(false);
-    }
+    uint64_t diff = 0;
+    for (uint32_t i = 0; i <= limit; i++)
+        diff |= lval[i] ^ rval[i];
 
-    return logic_t(true);
+    return logic_t(diff == 0);
 }
 
 void SVInt::getTopWordMask(bitwidth_t& bitsInMsw, uint64_t& mask) const {
@@ -1949,6 +2017,10 @@ bitwidth_t SVInt::countLeadingOnesSlowCase() const {
     return count;
 }
 
+// The bit counting functions below (and countLeadingZerosSlowCase above) all
+// work a word at a time through std::popcount / std::countl_zero, which lower
+// to the hardware popcnt / lzcnt instructions where available. Callers like
+// $countbits should use these rather than testing bits individually.
 bitwidth_t SVInt::countOnes() const {
     if (isSingleWord())
         return (bitwidth_t)std::popcount(val);
@@ -2344,16 +2416,25 @@ logic_t condWildcardEqual(const SVInt& lhs, const SVInt& rhs) {
     }
 
     uint32_t words = SVInt::getNumWords(rhs.bitWidth, false);
+    uint64_t unknowns = 0;
+    uint64_t mismatch = 0;
     for (uint32_t i = 0; i < words; ++i) {
         // bitmask to avoid comparing the bits unknown on the rhs
         uint64_t mask = ~rhs.pVal[i + words];
-        if (lhs.unknownFlag && (lhs.getRawData()[i + words] & mask) != 0)
-            return logic_t::x;
+        uint64_t lunk = 0;
+        if (lhs.unknownFlag)
+            lunk = lhs.getRawData()[i + words] & mask;
 
-        if ((lhs.getRawData()[i] & mask) != (rhs.pVal[i] & mask))
-            return logic_t(false);
+        unknowns |= lunk;
+        mismatch |= (lhs.getRawData()[i] ^ rhs.pVal[i]) & mask & ~lunk;
     }
 
+    // A bit pair that definitely differs dominates any unknown pairs,
+    // the same way a 0 bit dominates x when folding equality results.
+    if (mismatch)
+        return logic_t(false);
+    if (unknowns)
+        return logic_t::x;
     return logic_t(true);
 }
 
@@ -2372,6 +2453,7 @@ bool caseXWildcardEqual(const SVInt& lhs, const SVInt& rhs) {
     }
 
     uint32_t words = SVInt::getNumWords(rhs.bitWidth, false);
+    uint64_t mismatch = 0;
     for (uint32_t i = 0; i < words; ++i) {
         // bitmask to avoid comparing the unknown bits on either side
         uint64_t mask = UINT64_MAX;
@@ -2380,11 +2462,10 @@ bool caseXWildcardEqual(const SVInt& lhs, const SVInt& rhs) {
         if (rhs.unknownFlag)
             mask &= ~rhs.pVal[i + words];
 
-        if ((lhs.getRawData()[i] & mask) != (rhs.getRawData()[i] & mask))
-            return false;
+        mismatch |= (lhs.getRawData()[i] ^ rhs.getRawData()[i]) & mask;
     }
 
-    return true;
+    return mismatch == 0;
 }
 
 bool caseZWildcardEqual(const SVInt& lhs, const SVInt& rhs) {
@@ -2402,6 +2483,7 @@ bool caseZWildcardEqual(const SVInt& lhs, const SVInt& rhs) {
     }
 
     uint32_t words = SVInt::getNumWords(rhs.bitWidth, false);
+    uint64_t mismatch = 0;
     for (uint32_t i = 0; i < words; ++i) {
         // bitmask to avoid comparing the Z bits on either side
         uint64_t mask = UINT64_MAX;
@@ -2418,13 +2500,10 @@ bool caseZWildcardEqual(const SVInt& lhs, const SVInt& rhs) {
             mask &= ~(rhs.pVal[i + words] & rhs.pVal[i]);
         }
 
-        if ((lhs.getRawData()[i] & mask) != (rhs.getRawData()[i] & mask) ||
-            (lunknown & mask) != (runknown & mask)) {
-            return false;
-        }
+        mismatch |= ((lhs.getRawData()[i] ^ rhs.getRawData()[i]) | (lunknown ^ runknown)) & mask;
     }
 
-    return true;
+    return mismatch == 0;
 }
 
 } // namespace slang
@@ -291,7 +291,9 @@ static uint64_t mulOne(uint64_t* dst, const uint64_t* x, uint32_t len, uint64_t
 static void mulKaratsuba(uint64_t* dst, const uint64_t* x, uint32_t xlen, const uint64_t* y,
                          uint32_t ylen);
 
-// Generalized multiplier
+// Generalized multiplier. Inputs below the threshold use the schoolbook
+// algorithm, which wins at small sizes thanks to its simple inner loop;
+// anything wider recurses through Karatsuba for subquadratic growth.
 NO_SANITIZE("unsigned-integer-overflow")
 static void mul(uint64_t* dst, const uint64_t* x, uint32_t xlen, const uint64_t* y, uint32_t ylen) {
     if (xlen > 7 && ylen > 7) {
@@ -0,0 +1,426 @@
+//------------------------------------------------------------------------------
+// CharScan.h
+// Vectorized character run scanning kernels for the lexer
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    define SLANG_CHARSCAN_X86 1
+#    include <emmintrin.h>
+#    if defined(__GNUC__)
+#        include <immintrin.h>
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define SLANG_CHARSCAN_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace slang::parsing {
+
+// Each of the scan*Run functions below advances @a cur over a run of characters
+// belonging to a particular class, one vector register at a time, and returns a
+// pointer to the first character that the caller's scalar loop needs to look at.
+// They never consume a character the scalar loop would have stopped on, and they
+// stop early once fewer than a full vector of bytes remains before @a end, so
+// loads never touch memory outside [cur, end). The scalar loops remain the
+// source of truth for edge cases (embedded nulls, UTF-8, buffer tails).
+
+#if SLANG_CHARSCAN_X86
+
+namespace charscan_detail {
+
+// Returns a bitmask with a 1 for each byte that is *not* an identifier
+// character (A-Z, a-z, 0-9, '_', '$'). Bytes >= 0x80 are always stop bytes;
+// signed comparisons reject them from every range below.
+inline uint32_t identStopMask(__m128i v) {
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                   _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), lower));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), v));
+    __m128i other = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')),
+                                 _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+    __m128i ok = _mm_or_si128(_mm_or_si128(letter, digit), other);
+    return 0xFFFFu & ~(uint32_t)_mm_movemask_epi8(ok);
+}
+
+// Stop at anything that isn't a space, tab, vertical tab, or form feed.
+inline uint32_t whitespaceStopMask(__m128i v) {
+    __m128i ok = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                           _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                              _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\v')),
+                                           _mm_cmpeq_epi8(v, _mm_set1_epi8('\f'))));
+    return 0xFFFFu & ~(uint32_t)_mm_movemask_epi8(ok);
+}
+
+// Stop at newlines, nulls, and non-ASCII bytes; the movemask of the raw
+// vector conveniently gives us the high (non-ASCII) bits directly.
+inline uint32_t lineCommentStopMask(__m128i v) {
+    __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))),
+                                _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(stop, v));
+}
+
+// Stop at '*' and '/' (for terminators and nested comments) as well as
+// nulls and non-ASCII bytes.
+inline uint32_t blockCommentStopMask(__m128i v) {
+    __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('*')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('/'))),
+                                _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(stop, v));
+}
+
+// Stop at bytes a disabled-text scan has to inspect: backticks (which may
+// start a directive), comment and string openers, escapes, and nulls.
+// Newlines and non-ASCII bytes are plain skippable text here.
+inline uint32_t disabledTextStopMask(__m128i v) {
+    __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('`')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('/'))),
+                                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))));
+    stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    return (uint32_t)_mm_movemask_epi8(stop);
+}
+
+// Stop at the closing quote, escapes, newlines, nulls, and non-ASCII bytes;
+// everything in between is literal text that can be copied wholesale.
+inline uint32_t stringLiteralStopMask(__m128i v) {
+    __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+                                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+    stop = _mm_or_si128(stop, _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(stop, v));
+}
+
+// Escaped identifiers run until the first character outside the printable
+// non-whitespace range '!'..'~'; signed comparisons also reject non-ASCII.
+inline uint32_t escapedIdentStopMask(__m128i v) {
+    __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(' ')),
+                               _mm_cmpgt_epi8(_mm_set1_epi8(127), v));
+    return 0xFFFFu & ~(uint32_t)_mm_movemask_epi8(ok);
+}
+
+#    if defined(__GNUC__)
+
+// AVX2 variants of the above, compiled unconditionally via the target
+// attribute and selected at runtime so that a baseline x86-64 build still
+// benefits on newer hardware.
+inline bool hasAvx2() {
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+}
+
+__attribute__((target("avx2"))) inline uint32_t identStopMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                      _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    __m256i other = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')),
+                                    _mm256_cmpeq_epi8(v, _mm256_set1_epi8('$')));
+    __m256i ok = _mm256_or_si256(_mm256_or_si256(letter, digit), other);
+    return ~(uint32_t)_mm256_movemask_epi8(ok);
+}
+
+__attribute__((target("avx2"))) inline uint32_t blockCommentStopMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i stop = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('*')),
+                                                   _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'))),
+                                   _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(stop, v));
+}
+
+__attribute__((target("avx2"))) inline uint32_t lineCommentStopMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i stop = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')),
+                                                   _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))),
+                                   _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(stop, v));
+}
+
+__attribute__((target("avx2"))) inline uint32_t disabledTextStopMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i stop = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('`')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))));
+    stop = _mm256_or_si256(stop, _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+    return (uint32_t)_mm256_movemask_epi8(stop);
+}
+
+__attribute__((target("avx2"))) inline uint32_t stringLiteralStopMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i stop = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+    stop = _mm256_or_si256(stop, _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(stop, v));
+}
+
+__attribute__((target("avx2"))) inline uint32_t escapedIdentStopMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i ok = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(' ')),
+                                  _mm256_cmpgt_epi8(_mm256_set1_epi8(127), v));
+    return ~(uint32_t)_mm256_movemask_epi8(ok);
+}
+
+#    endif
+
+} // namespace charscan_detail
+
+inline const char* scanIdentifierRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+#    if defined(__GNUC__)
+    if (hasAvx2()) {
+        while (end - cur >= 32) {
+            uint32_t mask = identStopMask32(cur);
+            if (mask)
+                return cur + std::countr_zero(mask);
+            cur += 32;
+        }
+    }
+#    endif
+    while (end - cur >= 16) {
+        uint32_t mask = identStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+inline const char* scanWhitespaceRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+    while (end - cur >= 16) {
+        uint32_t mask = whitespaceStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+inline const char* scanLineCommentRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+#    if defined(__GNUC__)
+    if (hasAvx2()) {
+        while (end - cur >= 32) {
+            uint32_t mask = lineCommentStopMask32(cur);
+            if (mask)
+                return cur + std::countr_zero(mask);
+            cur += 32;
+        }
+    }
+#    endif
+    while (end - cur >= 16) {
+        uint32_t mask = lineCommentStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+inline const char* scanBlockCommentRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+#    if defined(__GNUC__)
+    if (hasAvx2()) {
+        while (end - cur >= 32) {
+            uint32_t mask = blockCommentStopMask32(cur);
+            if (mask)
+                return cur + std::countr_zero(mask);
+            cur += 32;
+        }
+    }
+#    endif
+    while (end - cur >= 16) {
+        uint32_t mask = blockCommentStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+inline const char* scanDisabledTextRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+#    if defined(__GNUC__)
+    if (hasAvx2()) {
+        while (end - cur >= 32) {
+            uint32_t mask = disabledTextStopMask32(cur);
+            if (mask)
+                return cur + std::countr_zero(mask);
+            cur += 32;
+        }
+    }
+#    endif
+    while (end - cur >= 16) {
+        uint32_t mask = disabledTextStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+inline const char* scanStringLiteralRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+#    if defined(__GNUC__)
+    if (hasAvx2()) {
+        while (end - cur >= 32) {
+            uint32_t mask = stringLiteralStopMask32(cur);
+            if (mask)
+                return cur + std::countr_zero(mask);
+            cur += 32;
+        }
+    }
+#    endif
+    while (end - cur >= 16) {
+        uint32_t mask = stringLiteralStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+inline const char* scanEscapedIdentRun(const char* cur, const char* end) {
+    using namespace charscan_detail;
+#    if defined(__GNUC__)
+    if (hasAvx2()) {
+        while (end - cur >= 32) {
+            uint32_t mask = escapedIdentStopMask32(cur);
+            if (mask)
+                return cur + std::countr_zero(mask);
+            cur += 32;
+        }
+    }
+#    endif
+    while (end - cur >= 16) {
+        uint32_t mask = escapedIdentStopMask(_mm_loadu_si128((const __m128i*)cur));
+        if (mask)
+            return cur + std::countr_zero(mask);
+        cur += 16;
+    }
+    return cur;
+}
+
+#elif SLANG_CHARSCAN_NEON
+
+namespace charscan_detail {
+
+// NEON has no movemask; narrowing each comparison lane to a nibble gives a
+// 64-bit mask with 4 bits per byte, so the first stop byte is ctz(mask) / 4.
+inline uint64_t nibbleMask(uint8x16_t m) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+}
+
+inline uint64_t identStopMask(uint8x16_t v) {
+    uint8x16_t lower = vorrq_u8(v, vdupq_n_u8(0x20));
+    uint8x16_t letter = vcleq_u8(vsubq_u8(lower, vdupq_n_u8('a')), vdupq_n_u8(25));
+    uint8x16_t digit = vcleq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(9));
+    uint8x16_t other = vorrq_u8(vceqq_u8(v, vdupq_n_u8('_')), vceqq_u8(v, vdupq_n_u8('$')));
+    return nibbleMask(vmvnq_u8(vorrq_u8(vorrq_u8(letter, digit), other)));
+}
+
+inline uint64_t whitespaceStopMask(uint8x16_t v) {
+    uint8x16_t ok = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t'))),
+                             vorrq_u8(vceqq_u8(v, vdupq_n_u8('\v')), vceqq_u8(v, vdupq_n_u8('\f'))));
+    return nibbleMask(vmvnq_u8(ok));
+}
+
+inline uint64_t lineCommentStopMask(uint8x16_t v) {
+    uint8x16_t stop = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('\r')),
+                                        vceqq_u8(v, vdupq_n_u8('\n'))),
+                               vorrq_u8(vceqq_u8(v, vdupq_n_u8(0)), vcgeq_u8(v, vdupq_n_u8(0x80))));
+    return nibbleMask(stop);
+}
+
+inline uint64_t blockCommentStopMask(uint8x16_t v) {
+    uint8x16_t stop = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('*')), vceqq_u8(v, vdupq_n_u8('/'))),
+                               vorrq_u8(vceqq_u8(v, vdupq_n_u8(0)), vcgeq_u8(v, vdupq_n_u8(0x80))));
+    return nibbleMask(stop);
+}
+
+inline uint64_t disabledTextStopMask(uint8x16_t v) {
+    uint8x16_t stop = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('`')), vceqq_u8(v, vdupq_n_u8('/'))),
+                               vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\\'))));
+    return nibbleMask(vorrq_u8(stop, vceqq_u8(v, vdupq_n_u8(0))));
+}
+
+inline uint64_t stringLiteralStopMask(uint8x16_t v) {
+    uint8x16_t stop = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')), vceqq_u8(v, vdupq_n_u8('\\'))),
+                               vorrq_u8(vceqq_u8(v, vdupq_n_u8('\r')),
+                                        vceqq_u8(v, vdupq_n_u8('\n'))));
+    stop = vorrq_u8(stop, vorrq_u8(vceqq_u8(v, vdupq_n_u8(0)), vcgeq_u8(v, vdupq_n_u8(0x80))));
+    return nibbleMask(stop);
+}
+
+inline uint64_t escapedIdentStopMask(uint8x16_t v) {
+    uint8x16_t ok = vcleq_u8(vsubq_u8(v, vdupq_n_u8('!')), vdupq_n_u8('~' - '!'));
+    return nibbleMask(vmvnq_u8(ok));
+}
+
+} // namespace charscan_detail
+
+#    define SLANG_CHARSCAN_DEFINE_RUN(name, maskFunc)                          \
+        inline const char* name(const char* cur, const char* end) {            \
+            while (end - cur >= 16) {                                          \
+                uint64_t mask = charscan_detail::maskFunc(                     \
+                    vld1q_u8(reinterpret_cast<const uint8_t*>(cur)));          \
+                if (mask)                                                      \
+                    return cur + (std::countr_zero(mask) >> 2);                \
+                cur += 16;                                                     \
+            }                                                                  \
+            return cur;                                                        \
+        }
+
+SLANG_CHARSCAN_DEFINE_RUN(scanIdentifierRun, identStopMask)
+SLANG_CHARSCAN_DEFINE_RUN(scanWhitespaceRun, whitespaceStopMask)
+SLANG_CHARSCAN_DEFINE_RUN(scanLineCommentRun, lineCommentStopMask)
+SLANG_CHARSCAN_DEFINE_RUN(scanBlockCommentRun, blockCommentStopMask)
+SLANG_CHARSCAN_DEFINE_RUN(scanDisabledTextRun, disabledTextStopMask)
+SLANG_CHARSCAN_DEFINE_RUN(scanStringLiteralRun, stringLiteralStopMask)
+SLANG_CHARSCAN_DEFINE_RUN(scanEscapedIdentRun, escapedIdentStopMask)
+#    undef SLANG_CHARSCAN_DEFINE_RUN
+
+#else
+
+// Scalar fallback; the callers' byte-at-a-time loops do all of the work.
+inline const char* scanIdentifierRun(const char* cur, const char*) {
+    return cur;
+}
+inline const char* scanWhitespaceRun(const char* cur, const char*) {
+    return cur;
+}
+inline const char* scanLineCommentRun(const char* cur, const char*) {
+    return cur;
+}
+inline const char* scanBlockCommentRun(const char* cur, const char*) {
+    return cur;
+}
+inline const char* scanDisabledTextRun(const char* cur, const char*) {
+    return cur;
+}
+inline const char* scanStringLiteralRun(const char* cur, const char*) {
+    return cur;
+}
+inline const char* scanEscapedIdentRun(const char* cur, const char*) {
+    return cur;
+}
+
+#endif
+
+} // namespace slang::parsing
@@ -11,6 +11,8 @@
 #include <cmath>
 #include <fmt/core.h>
 
+#include "CharScan.h"
+
 #include "slang/diagnostics/LexerDiags.h"
 #include "slang/diagnostics/NumericDiags.h"
 #include "slang/syntax/SyntaxNode.h"
@@ -19,6 +21,7 @@
 #include "slang/util/BumpAllocator.h"
 #include "slang/util/ScopeGuard.h"
 #include "slang/util/String.h"
+#include "slang/util/StringTable.h"
 
 static_assert(std::numeric_limits<double>::is_iec559, "SystemVerilog requires IEEE 754");
 
@@ -31,8 +34,9 @@ using namespace syntax;
 using LF = LexerFacts;
 
 Lexer::Lexer(SourceBuffer buffer, BumpAllocator& alloc, Diagnostics& diagnostics,
-             LexerOptions options) :
-    Lexer(buffer.id, buffer.data, buffer.data.data(), alloc, diagnostics, options) {
+             LexerOptions options, size_t startOffset) :
+    Lexer(buffer.id, buffer.data, buffer.data.data() + startOffset, alloc, diagnostics, options) {
+    ASSERT(startOffset < buffer.data.size());
 }
 
 Lexer::Lexer(BufferID bufferId, std::string_view source, const char* startPtr, BumpAllocator& alloc,
@@ -200,6 +204,8 @@ Token Lexer::lex(KeywordVersion keywordVersion) {
     // lex the next token
     mark();
     Token token = lexToken(keywordVersion);
+    if (token.kind != TokenKind::EndOfFile)
+        tokenCount++;
 
     if (token.kind != TokenKind::EndOfFile && errorCount > options.maxErrors) {
         // Stop any further lexing by claiming to be at the end of the buffer.
@@ -255,6 +261,15 @@ Token Lexer::lexEncodedText(ProtectEncoding encoding, uint32_t expectedBytes, bo
     return create(TokenKind::Unknown);
 }
 
+Token Lexer::lexDisabledText() {
+    triviaBuffer.clear();
+    mark();
+    scanDisabledText();
+    if (lexemeLength() == 0)
+        return Token();
+    return create(TokenKind::Unknown);
+}
+
 Token Lexer::lexToken(KeywordVersion keywordVersion) {
     char c = peek();
     advance();
@@ -636,6 +651,15 @@ Token Lexer::lexStringLiteral() {
     stringBuffer.clear();
     bool sawUTF8Error = false;
     while (true) {
+        // Copy over whole runs of plain literal text at once; the scalar code
+        // below only needs to look at quotes, escapes, newlines, nulls, and
+        // non-ASCII bytes.
+        if (auto p = scanStringLiteralRun(sourceBuffer, sourceEnd); p != sourceBuffer) {
+            stringBuffer.append(sourceBuffer, p);
+            sourceBuffer = p;
+            sawUTF8Error = false;
+        }
+
         size_t offset = currentOffset();
         char c = peek();
 
@@ -760,7 +784,16 @@ Token Lexer::lexStringLiteral() {
         }
     }
 
-    return create(TokenKind::StringLiteral, toStringView(stringBuffer.copy(alloc)));
+    std::string_view value;
+    if (options.literalInterner && stringBuffer.size() >= options.literalInternThreshold) {
+        value = options.literalInterner->intern(
+            std::string_view(stringBuffer.data(), stringBuffer.size()));
+    }
+    else {
+        value = toStringView(stringBuffer.copy(alloc));
+    }
+
+    return create(TokenKind::StringLiteral, value);
 }
 
 Token Lexer::lexEscapeSequence(bool isMacroName) {
@@ -779,7 +812,13 @@ Token Lexer::lexEscapeSequence(bool isMacroName) {
     }
 
     while (isPrintableASCII(c)) {
-        advance();
+        // Skip over runs of plain identifier characters at once; the run
+        // scanner accepts exactly the printable non-whitespace ASCII range.
+        if (auto p = scanEscapedIdentRun(sourceBuffer, sourceEnd); p != sourceBuffer)
+            sourceBuffer = p;
+        else
+            advance();
+
         c = peek();
         if (isWhitespace(c))
             break;
@@ -1122,6 +1161,7 @@ void Lexer::lexTrivia() {
 }
 
 void Lexer::scanIdentifier() {
+    sourceBuffer = scanIdentifierRun(sourceBuffer, sourceEnd);
     while (true) {
         char c = peek();
         if (isAlphaNumeric(c) || c == '_' || c == '$')
@@ -1132,6 +1172,7 @@ void Lexer::scanIdentifier() {
 }
 
 void Lexer::scanWhitespace() {
+    sourceBuffer = scanWhitespaceRun(sourceBuffer, sourceEnd);
     bool done = false;
     while (!done) {
         switch (peek()) {
@@ -1152,6 +1193,12 @@ void Lexer::scanWhitespace() {
 void Lexer::scanLineComment() {
     bool sawUTF8Error = false;
     while (true) {
+        // Skip over a run of plain comment characters; the code below only
+        // needs to handle newlines, embedded nulls, and non-ASCII bytes.
+        if (auto p = scanLineCommentRun(sourceBuffer, sourceEnd); p != sourceBuffer) {
+            sourceBuffer = p;
+            sawUTF8Error = false;
+        }
         char c = peek();
         if (isASCII(c)) {
             if (isNewline(c))
@@ -1179,6 +1226,10 @@ void Lexer::scanLineComment() {
 void Lexer::scanBlockComment() {
     bool sawUTF8Error = false;
     while (true) {
+        if (auto p = scanBlockCommentRun(sourceBuffer, sourceEnd); p != sourceBuffer) {
+            sourceBuffer = p;
+            sawUTF8Error = false;
+        }
         char c = peek();
         if (isASCII(c)) {
             sawUTF8Error = false;
@@ -1215,6 +1266,90 @@ void Lexer::scanBlockComment() {
     addTrivia(TriviaKind::BlockComment);
 }
 
+void Lexer::scanDisabledText() {
+    while (true) {
+        // Skip over everything that can't affect where the next directive
+        // starts; the code below only needs to look at backticks, comment and
+        // string openers, escapes, and nulls.
+        if (auto p = scanDisabledTextRun(sourceBuffer, sourceEnd); p != sourceBuffer)
+            sourceBuffer = p;
+
+        char c = peek();
+        switch (c) {
+            case '`':
+                return;
+            case '\0':
+                if (reallyAtEnd())
+                    return;
+                advance();
+                break;
+            case '/':
+                if (peek(1) == '/') {
+                    // Line comment; consume it through to the end of the line.
+                    advance(2);
+                    while (true) {
+                        sourceBuffer = scanLineCommentRun(sourceBuffer, sourceEnd);
+                        c = peek();
+                        if (isNewline(c) || (c == '\0' && reallyAtEnd()))
+                            break;
+                        advance();
+                    }
+                }
+                else if (peek(1) == '*') {
+                    // Block comment; consume it through to the terminator.
+                    advance(2);
+                    while (true) {
+                        sourceBuffer = scanBlockCommentRun(sourceBuffer, sourceEnd);
+                        c = peek();
+                        if (c == '*' && peek(1) == '/') {
+                            advance(2);
+                            break;
+                        }
+                        if (c == '\0' && reallyAtEnd())
+                            return;
+                        advance();
+                    }
+                }
+                else {
+                    advance();
+                }
+                break;
+            case '"':
+                // Pass over the string literal so that a backtick inside it
+                // doesn't look like a directive. Escape handling only needs to
+                // be good enough to not mistake \" for the terminator.
+                advance();
+                while (true) {
+                    c = peek();
+                    if (c == '"') {
+                        advance();
+                        break;
+                    }
+                    if (isNewline(c) || (c == '\0' && reallyAtEnd()))
+                        break;
+
+                    advance();
+                    if (c == '\\' && !(peek() == '\0' && reallyAtEnd())) {
+                        if (peek() == '\r' && peek(1) == '\n')
+                            advance();
+                        advance();
+                    }
+                }
+                break;
+            case '\\':
+                // Escaped identifier (or line continuation); consume up to the
+                // next whitespace so an embedded backtick stays part of it.
+                advance();
+                while (!isWhitespace(peek()) && peek() != '\0')
+                    advance();
+                break;
+            default:
+                advance();
+                break;
+        }
+    }
+}
+
 bool Lexer::scanUTF8Char(bool alreadyErrored, uint32_t* code) {
     int error;
     auto curr = sourceBuffer;
@@ -1347,21 +1482,50 @@ void Lexer::scanEncodedText(ProtectEncoding encoding, uint32_t expectedBytes, bo
                 }
                 break;
             }
-            case ProtectEncoding::Base64:
-                byteCount += 3;
-                for (int i = 0; i < 4; i++) {
-                    c = peek();
-                    if (i > 1 && c == '=') {
-                        byteCount--;
-                    }
-                    else if (!isBase64Char(c)) {
-                        invalidByte(c, "base64"sv);
-                        return;
-                    }
+            case ProtectEncoding::Base64: {
+                // Encrypted vendor IP regions routinely run to many megabytes,
+                // so scan maximal runs of base64 characters in bulk instead of
+                // validating them one peek / advance at a time. Quads never
+                // span line boundaries; the outer loop handles the newlines
+                // (and the NUL sentinel at the end stops the scan).
+                const char* start = sourceBuffer;
+                const char* limit = sourceEnd - 1;
+                if (expectedBytes && !singleLine) {
+                    // Don't consume quads past the declared region size; the
+                    // check at the top of the loop ends the region there.
+                    uint64_t remainingQuads = (uint64_t(expectedBytes) - byteCount + 2) / 3;
+                    if (remainingQuads * 4 < uint64_t(limit - start))
+                        limit = start + remainingQuads * 4;
+                }
 
-                    advance();
+                const char* p = start;
+                while (p < limit && isBase64Char(*p))
+                    p++;
+
+                size_t quads = size_t(p - start) / 4;
+                byteCount += uint32_t(quads * 3);
+                advance(int(quads * 4));
+
+                // Any leftover characters get the careful treatment so that
+                // '=' padding and invalid bytes are diagnosed exactly as the
+                // data is encountered.
+                if (quads == 0 || (p - start) % 4 != 0 || peek() == '=') {
+                    byteCount += 3;
+                    for (int i = 0; i < 4; i++) {
+                        c = peek();
+                        if (i > 1 && c == '=') {
+                            byteCount--;
+                        }
+                        else if (!isBase64Char(c)) {
+                            invalidByte(c, "base64"sv);
+                            return;
+                        }
+
+                        advance();
+                    }
                 }
                 break;
+            }
             case ProtectEncoding::QuotedPrintable:
                 if (!isPrintableASCII(c) && c != '\t') {
                     invalidByte(c, "quoted-printable"sv);
@@ -1390,15 +1554,37 @@ void Lexer::scanEncodedText(ProtectEncoding encoding, uint32_t expectedBytes, bo
                 }
                 byteCount++;
                 break;
-            case ProtectEncoding::Raw:
+            case ProtectEncoding::Raw: {
                 if (c == '\0' && reallyAtEnd()) {
                     addDiag(diag::RawProtectEOF, currentOffset() - 1);
                     return;
                 }
 
-                advance();
-                byteCount++;
+                // Raw data counts byte for byte (newlines excepted, which the
+                // outer loop consumes), so skip to the next newline or the end
+                // of the declared region in one step. Embedded NUL bytes are
+                // data; only the sentinel at the very end terminates.
+                const char* start = sourceBuffer;
+                const char* limit = sourceEnd - 1;
+                if (expectedBytes && !singleLine &&
+                    uint64_t(expectedBytes) - byteCount < uint64_t(limit - start)) {
+                    limit = start + (expectedBytes - byteCount);
+                }
+
+                const char* p = start;
+                while (p < limit && *p != '\r' && *p != '\n')
+                    p++;
+
+                if (p == start) {
+                    advance();
+                    byteCount++;
+                }
+                else {
+                    byteCount += uint32_t(p - start);
+                    advance(int(p - start));
+                }
                 break;
+            }
             default:
                 ASSUME_UNREACHABLE;
         }
@@ -1413,9 +1599,91 @@ Token Lexer::create(TokenKind kind, Args&&... args) {
 }
 
 void Lexer::addTrivia(TriviaKind kind) {
+    if (options.minimalTrivia) {
+        // Formatting-only trivia is dropped in this mode, but anything that
+        // implies a line break (or hides a line continuation) still needs to
+        // be recorded because directive parsing is line sensitive.
+        auto text = lexeme();
+        switch (kind) {
+            case TriviaKind::Whitespace:
+                return;
+            case TriviaKind::LineComment:
+                if ((peek() == '\r' || peek() == '\n') && text.back() != '\\')
+                    return;
+                break;
+            case TriviaKind::BlockComment:
+                if (text.find_first_of("\r\n") == std::string_view::npos)
+                    return;
+                break;
+            default:
+                break;
+        }
+    }
+    if (options.collapseTrivia) {
+        switch (kind) {
+            case TriviaKind::Whitespace:
+            case TriviaKind::EndOfLine:
+            case TriviaKind::BlockComment:
+                // Merge with the previous piece when it's adjacent in the
+                // source text, so that a whole run of formatting trivia is
+                // recorded as one piece referencing the original buffer.
+                if (!triviaBuffer.empty()) {
+                    auto& prev = triviaBuffer.back();
+                    switch (prev.kind) {
+                        case TriviaKind::Whitespace:
+                        case TriviaKind::EndOfLine:
+                        case TriviaKind::BlockComment:
+                        case TriviaKind::CollapsedText: {
+                            auto prevText = prev.getRawText();
+                            if (prevText.data() + prevText.size() == marker) {
+                                prev = Trivia(TriviaKind::CollapsedText,
+                                              std::string_view(prevText.data(),
+                                                               prevText.size() + lexemeLength()));
+                                return;
+                            }
+                            break;
+                        }
+                        default:
+                            break;
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
     triviaBuffer.emplace_back(kind, lexeme());
 }
 
+void Lexer::expandTrivia(Trivia trivia, SmallVectorBase<Trivia>& results) {
+    if (trivia.kind != TriviaKind::CollapsedText) {
+        results.push_back(trivia);
+        return;
+    }
+
+    // Re-lex the collapsed text to recover the individual pieces. The lexer
+    // requires a null terminated buffer so the text is copied into scratch
+    // storage first; the resulting trivia is rebased onto the original source
+    // text so that nothing allocated here escapes.
+    auto text = trivia.getRawText();
+    SmallVector<char> scratch;
+    scratch.append(text.begin(), text.end());
+    scratch.push_back('\0');
+
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    Lexer lexer(BufferID(), std::string_view(scratch.data(), scratch.size()), scratch.data(), alloc,
+                diagnostics, LexerOptions{});
+    lexer.lexTrivia<false>();
+
+    for (const Trivia& piece : lexer.triviaBuffer) {
+        auto raw = piece.getRawText();
+        results.push_back(
+            Trivia(piece.kind, text.substr(size_t(raw.data() - scratch.data()), raw.size())));
+    }
+}
+
 Diagnostic& Lexer::addDiag(DiagCode code, size_t offset) {
     return diagnostics.add(code, SourceLocation(bufferId, offset));
 }
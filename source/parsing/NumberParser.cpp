@@ -41,6 +41,26 @@ void NumberParser::startVector(Token baseToken, Token sizeToken) {
     literalBase = baseFlags.base();
     signFlag = baseFlags.isSigned();
 
+    quickValue = 0;
+    quickDigitCount = 0;
+    quickLeadingZero = false;
+    switch (literalBase) {
+        case LiteralBase::Binary:
+            quickShift = 1;
+            break;
+        case LiteralBase::Octal:
+            quickShift = 3;
+            break;
+        case LiteralBase::Hex:
+            quickShift = 4;
+            break;
+        default:
+            quickShift = 0;
+            break;
+    }
+    quickCapacity = quickShift ? 64 / quickShift : 0;
+    usingQuick = quickShift != 0;
+
     sizeBits = 0;
     if (sizeToken) {
         const SVInt& sizeVal = sizeToken.intValue();
@@ -210,6 +230,26 @@ Token NumberParser::finishValue(Token firstToken, bool singleToken) {
         }
     }
 
+    if (usingQuick) {
+        // All of the significant digits fit in one 64-bit word; size the
+        // literal from it and build the value directly, without ever having
+        // gone through the digit vector.
+        bitwidth_t bits = (bitwidth_t)std::bit_width(quickValue);
+        if (bits > sizeBits) {
+            if (sizeBits == 0) {
+                sizeBits = std::max(32u, bits);
+            }
+            else {
+                // We should warn about overflow here, but the spec says it is valid and
+                // the literal gets truncated. Definitely a warning though.
+                addDiag(diag::VectorLiteralOverflow, firstLocation);
+            }
+        }
+
+        SVInt result(sizeBits ? sizeBits : 32, quickValue, signFlag);
+        return createResult(std::move(result));
+    }
+
     if (digits.empty()) {
         digits.push_back(logic_t(0));
     }
@@ -262,6 +302,26 @@ Token NumberParser::finishValue(Token firstToken, bool singleToken) {
 }
 
 void NumberParser::addDigit(logic_t digit, int maxValue) {
+    if (usingQuick) {
+        if (!digit.isUnknown()) {
+            ASSERT(digit.value < maxValue);
+            if (!quickDigitCount && !digit.value) {
+                // Leading zeros collapse; remember that we saw one in case
+                // an unknown digit needs it for msb extension later.
+                quickLeadingZero = true;
+                return;
+            }
+
+            if (quickDigitCount < quickCapacity) {
+                quickValue = (quickValue << quickShift) | digit.value;
+                quickDigitCount++;
+                return;
+            }
+        }
+
+        spillQuickDigits();
+    }
+
     // Leading zeros obviously don't count towards our bit limit, so
     // only count them if we've seen other non-zero digits
     if (digit.isUnknown()) {
@@ -281,6 +341,22 @@ void NumberParser::addDigit(logic_t digit, int maxValue) {
     digits.push_back(digit);
 }
 
+void NumberParser::spillQuickDigits() {
+    // Unpack the accumulated word into the digit vector so that the general
+    // path can take over; the invariants match what addDigit maintains
+    // (leading zeros collapsed to at most one retained zero).
+    usingQuick = false;
+    if (!quickDigitCount) {
+        if (quickLeadingZero)
+            digits.push_back(logic_t(0));
+        return;
+    }
+
+    const uint32_t mask = (1u << quickShift) - 1;
+    for (uint32_t i = quickDigitCount; i > 0; i--)
+        digits.push_back(logic_t(uint8_t((quickValue >> ((i - 1) * quickShift)) & mask)));
+}
+
 Diagnostic& NumberParser::addDiag(DiagCode code, SourceLocation location) {
     return diagnostics.add(code, location);
 }
@@ -19,6 +19,11 @@ Parser::Parser(Preprocessor& preprocessor, const Bag& options) :
     parseOptions(options.getOrDefault<ParserOptions>()), numberParser(getDiagnostics(), alloc) {
 }
 
+Parser::Parser(TokenPipeline& pipeline, const Bag& options) :
+    ParserBase::ParserBase(pipeline), factory(alloc),
+    parseOptions(options.getOrDefault<ParserOptions>()), numberParser(getDiagnostics(), alloc) {
+}
+
 SyntaxNode& Parser::parseGuess() {
     // First try to parse as some kind of declaration.
     if (isMember()) {
@@ -68,6 +73,24 @@ ParserMetadata&& Parser::getMetadata() {
     return std::move(meta);
 }
 
+void Parser::reset() {
+    ParserBase::reset();
+    meta = ParserMetadata();
+    moduleDeclStack.clear();
+    recursionDepth = 0;
+    errorScanIndex = 0;
+    unitErrorCount = 0;
+    currentDefinitionKind = SyntaxKind::Unknown;
+    scanVerdicts.clear();
+}
+
+void Parser::pushTokens(std::span<const Token> tokens) {
+    // Rewriting the stream can change scan answers at the affected
+    // locations, so drop all memoized verdicts.
+    scanVerdicts.clear();
+    ParserBase::pushTokens(tokens);
+}
+
 Token Parser::parseLifetime() {
     auto kind = peek().kind;
     if (kind == TokenKind::StaticKeyword || kind == TokenKind::AutomaticKeyword)
@@ -296,6 +319,10 @@ PortDeclarationSyntax& Parser::parsePortDeclaration(AttrList attributes) {
 }
 
 bool Parser::isPlainPortName() {
+    return memoizeScan(ScanQuestion::PlainPortName, [&] { return isPlainPortNameImpl(); });
+}
+
+bool Parser::isPlainPortNameImpl() {
     uint32_t index = 1;
     while (peek(index).kind == TokenKind::OpenBracket) {
         index++;
@@ -318,6 +345,10 @@ bool Parser::isPlainPortName() {
 }
 
 bool Parser::isNonAnsiPort() {
+    return memoizeScan(ScanQuestion::NonAnsiPort, [&] { return isNonAnsiPortImpl(); });
+}
+
+bool Parser::isNonAnsiPortImpl() {
     auto kind = peek().kind;
     if (kind == TokenKind::Dot || kind == TokenKind::OpenBrace || kind == TokenKind::Comma)
         return true;
@@ -1174,6 +1205,10 @@ bool Parser::isNetDeclaration() {
 }
 
 bool Parser::isVariableDeclaration() {
+    return memoizeScan(ScanQuestion::VariableDeclaration, [&] { return isVariableDeclarationImpl(); });
+}
+
+bool Parser::isVariableDeclarationImpl() {
     uint32_t index = 0;
     if (!scanAttributes(index))
         return false;
@@ -1271,6 +1306,10 @@ bool Parser::isVariableDeclaration() {
 }
 
 bool Parser::isLocalVariableDeclaration() {
+    return memoizeScan(ScanQuestion::LocalVariableDeclaration, [&] { return isLocalVariableDeclarationImpl(); });
+}
+
+bool Parser::isLocalVariableDeclarationImpl() {
     uint32_t index = 0;
     auto kind = peek(index).kind;
     switch (kind) {
@@ -1332,6 +1371,12 @@ bool Parser::isLocalVariableDeclaration() {
 }
 
 bool Parser::isHierarchyInstantiation(bool requireName) {
+    return memoizeScan(requireName ? ScanQuestion::NamedHierarchyInstantiation
+                                   : ScanQuestion::HierarchyInstantiation,
+                       [&] { return isHierarchyInstantiationImpl(requireName); });
+}
+
+bool Parser::isHierarchyInstantiationImpl(bool requireName) {
     uint32_t index = 0;
     if (peek(index++).kind != TokenKind::Identifier)
         return false;
@@ -1474,4 +1519,23 @@ void Parser::handleTooDeep() {
     throw RecursionException("");
 }
 
+void Parser::checkAbortOnError() {
+    if (!parseOptions.stopOnFirstError && parseOptions.errorLimit == 0)
+        return;
+
+    auto& diags = getDiagnostics();
+    for (; errorScanIndex < diags.size(); errorScanIndex++) {
+        if (diags[errorScanIndex].isError()) {
+            if (parseOptions.stopOnFirstError)
+                throw ParseAbortException("");
+            unitErrorCount++;
+        }
+    }
+
+    if (parseOptions.errorLimit && unitErrorCount >= parseOptions.errorLimit) {
+        addDiag(diag::TooManyParseErrors, peek().location());
+        throw ParseAbortException("");
+    }
+}
+
 } // namespace slang::parsing
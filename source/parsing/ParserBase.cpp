@@ -9,6 +9,7 @@
 
 #include "slang/diagnostics/ParserDiags.h"
 #include "slang/parsing/Preprocessor.h"
+#include "slang/parsing/TokenPipeline.h"
 #include "slang/util/BumpAllocator.h"
 
 namespace slang::parsing {
@@ -21,6 +22,17 @@ ParserBase::ParserBase(Preprocessor& preprocessor) :
     alloc(preprocessor.getAllocator()), window(preprocessor) {
 }
 
+ParserBase::ParserBase(TokenPipeline& pipeline) :
+    alloc(pipeline.getAllocator()), window(pipeline.getPreprocessor()) {
+    window.pipeline = &pipeline;
+}
+
+void ParserBase::reset() {
+    window.reset();
+    skippedTokens.clear();
+    openDelims.clear();
+}
+
 void ParserBase::prependSkippedTokens(Token& token) {
     SmallVector<Trivia, 8> buffer;
     buffer.push_back(Trivia{TriviaKind::SkippedTokens, skippedTokens.copy(alloc)});
@@ -31,9 +43,37 @@ void ParserBase::prependSkippedTokens(Token& token) {
 }
 
 Diagnostics& ParserBase::getDiagnostics() {
+    if (window.pipeline)
+        return window.pipeline->getDiagnostics();
     return window.tokenSource.getDiagnostics();
 }
 
+KeywordVersion ParserBase::getKeywordVersion() const {
+    // When pipelined the preprocessor is running ahead of us on another
+    // thread, so use the version snapshotted when the pipeline started.
+    if (window.pipeline)
+        return window.pipeline->getKeywordVersion();
+    return window.tokenSource.getCurrentKeywordVersion();
+}
+
+TokenKind ParserBase::getDefaultNetType() const {
+    if (window.pipeline)
+        return window.pipeline->getDefaultNetType();
+    return window.tokenSource.getDefaultNetType();
+}
+
+TokenKind ParserBase::getUnconnectedDrive() const {
+    if (window.pipeline)
+        return window.pipeline->getUnconnectedDrive();
+    return window.tokenSource.getUnconnectedDrive();
+}
+
+std::optional<TimeScale> ParserBase::getTimeScale() const {
+    if (window.pipeline)
+        return window.pipeline->getTimeScale();
+    return window.tokenSource.getTimeScale();
+}
+
 Diagnostic& ParserBase::addDiag(DiagCode code, SourceLocation location) {
     // If we issued this error in response to seeing an EOF token, back up and put
     // the error on the last consumed token instead.
@@ -236,7 +276,7 @@ void ParserBase::Window::addNew() {
         currentOffset = 0;
     }
 
-    buffer[count] = tokenSource.next();
+    buffer[count] = pipeline ? pipeline->next() : tokenSource.next();
     count++;
 }
 
@@ -254,13 +294,31 @@ void ParserBase::Window::insertHead(std::span<const Token> tokens) {
     }
 
     size_t existing = count - currentOffset;
-    ASSERT(tokens.size() + existing < capacity);
+    if (tokens.size() + existing >= capacity) {
+        // Deferred module bodies can push arbitrarily large token spans.
+        while (tokens.size() + existing >= capacity)
+            capacity *= 2;
+
+        Token* newBuffer = new Token[capacity];
+        memcpy(newBuffer + tokens.size(), buffer + currentOffset, existing * sizeof(Token));
+        delete[] buffer;
+        buffer = newBuffer;
+    }
+    else {
+        memmove(buffer + tokens.size(), buffer + currentOffset, existing * sizeof(Token));
+    }
 
-    memmove(buffer + tokens.size(), buffer + currentOffset, existing * sizeof(Token));
     memcpy(buffer, tokens.data(), tokens.size() * sizeof(Token));
 
     currentOffset = 0;
     count = tokens.size() + existing;
 }
 
+void ParserBase::Window::reset() {
+    currentToken = Token();
+    lastConsumed = Token();
+    currentOffset = 0;
+    count = 0;
+}
+
 } // namespace slang::parsing
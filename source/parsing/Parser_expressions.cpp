@@ -150,7 +150,8 @@ ExpressionSyntax& Parser::parseBinaryExpression(ExpressionSyntax* left,
         else {
             auto opToken = consume();
             auto attributes = parseAttributes();
-            auto& rightOperand = parseSubExpression(options, newPrecedence);
+            auto& rightOperand = parseSubExpression(
+                options & ~ExpressionOptions::DisallowConditional, newPrecedence);
             left = &factory.binaryExpression(opKind, *left, opToken, attributes, rightOperand);
 
             if (!attributes.empty() && isAssignmentOperator(opKind))
@@ -170,14 +171,48 @@ ExpressionSyntax& Parser::parseBinaryExpression(ExpressionSyntax* left,
         if (current.kind == TokenKind::MatchesKeyword || current.kind == TokenKind::TripleAnd)
             takeConditional = isConditionalExpression();
 
-        if (takeConditional) {
-            Token question;
-            auto& predicate = parseConditionalPredicate(*left, TokenKind::Question, question);
-            auto attributes = parseAttributes();
-            auto& lhs = parseSubExpression(options, logicalOrPrecedence - 1);
-            auto colon = expect(TokenKind::Colon);
-            auto& rhs = parseSubExpression(options, logicalOrPrecedence - 1);
-            left = &factory.conditionalExpression(predicate, question, attributes, lhs, colon, rhs);
+        if (takeConditional && options.has(ExpressionOptions::DisallowConditional)) {
+            // Stop in front of the conditional and let the enclosing chain
+            // loop below consume it.
+            deferredConditional = true;
+        }
+        else if (takeConditional) {
+            // The false arm of a conditional is itself a conditional in long
+            // chains, which machine-generated code can nest thousands deep.
+            // Parse each link iteratively and build the tree at the end so
+            // stack depth stays bounded; the DisallowConditional option stops
+            // the false arm's subexpression just before any nested question
+            // mark so that this loop gets to consume it instead.
+            struct ConditionalHead {
+                ConditionalPredicateSyntax* predicate;
+                Token question;
+                AttrList attributes;
+                ExpressionSyntax* lhs;
+                Token colon;
+            };
+            SmallVector<ConditionalHead, 4> chain;
+
+            while (true) {
+                Token question;
+                auto& predicate = parseConditionalPredicate(*left, TokenKind::Question, question);
+                auto attributes = parseAttributes();
+                auto& lhs = parseSubExpression(options, logicalOrPrecedence - 1);
+                auto colon = expect(TokenKind::Colon);
+                chain.push_back({&predicate, question, attributes, &lhs, colon});
+
+                deferredConditional = false;
+                left = &parseSubExpression(options | ExpressionOptions::DisallowConditional,
+                                           logicalOrPrecedence - 1);
+                if (!deferredConditional)
+                    break;
+            }
+            deferredConditional = false;
+
+            for (auto& head : make_reverse_range(chain)) {
+                left = &factory.conditionalExpression(*head.predicate, head.question,
+                                                      head.attributes, *head.lhs, head.colon,
+                                                      *left);
+            }
         }
     }
 
@@ -204,16 +239,46 @@ ExpressionSyntax& Parser::parsePrimaryExpression(bitmask<ExpressionOptions> opti
         case TokenKind::IntegerBase:
             return parseIntegerExpression(options.has(ExpressionOptions::DisallowVectors));
         case TokenKind::OpenParenthesis: {
-            auto openParen = consume();
-            auto expr = &parseMinTypMaxExpression(options & ExpressionOptions::AllowDist);
-            auto closeParen = expect(TokenKind::CloseParenthesis);
+            // Consume the whole run of opening parentheses up front and unwind
+            // it iteratively afterwards; machine-generated code nests
+            // parentheses deeply enough that one recursion per level would
+            // exhaust the stack.
+            SmallVector<Token, 4> openParens;
+            do {
+                openParens.push_back(consume());
+            } while (peek(TokenKind::OpenParenthesis));
+
+            auto innerOptions = options & ExpressionOptions::AllowDist;
+            auto expr = &parseMinTypMaxExpression(innerOptions);
+
+            ExpressionSyntax* result;
+            while (true) {
+                auto openParen = openParens.back();
+                openParens.pop_back();
+                auto closeParen = expect(TokenKind::CloseParenthesis);
 
-            if (expr->kind == SyntaxKind::ExpressionOrDist &&
-                options.has(ExpressionOptions::AllowDist)) {
-                addDiag(diag::NonstandardDist, openParen.location()) << closeParen.range();
-            }
+                if (expr->kind == SyntaxKind::ExpressionOrDist &&
+                    options.has(ExpressionOptions::AllowDist)) {
+                    addDiag(diag::NonstandardDist, openParen.location()) << closeParen.range();
+                }
 
-            return factory.parenthesizedExpression(openParen, *expr, closeParen);
+                result = &factory.parenthesizedExpression(openParen, *expr, closeParen);
+                if (openParens.empty())
+                    break;
+
+                // Each enclosing level continues as a normal subexpression with
+                // the just-built parenthesized expression as its primary.
+                expr = &parsePostfixExpression(*result, innerOptions);
+                expr = &parseBinaryExpression(expr, innerOptions, 0);
+                if (peek(TokenKind::Colon)) {
+                    auto colon1 = consume();
+                    auto& typ = parseExpression();
+                    auto colon2 = expect(TokenKind::Colon);
+                    auto& max = parseExpression();
+                    expr = &factory.minTypMaxExpression(*expr, colon1, typ, colon2, max);
+                }
+            }
+            return *result;
         }
         case TokenKind::ApostropheOpenBrace:
             return parseAssignmentPatternExpression(nullptr);
@@ -304,7 +369,7 @@ ExpressionSyntax& Parser::parseIntegerExpression(bool disallowVector) {
 void Parser::handleExponentSplit(Token token, size_t offset) {
     SmallVector<Token, 4> split;
     Lexer::splitTokens(alloc, getDiagnostics(), getPP().getSourceManager(), token, offset,
-                       getPP().getCurrentKeywordVersion(), split);
+                       getKeywordVersion(), split);
 
     pushTokens(split);
 }
@@ -1198,6 +1263,11 @@ ExpressionSyntax& Parser::parseArrayOrRandomizeMethod(ExpressionSyntax& expr) {
 }
 
 bool Parser::isConditionalExpression() {
+    return memoizeScan(ScanQuestion::ConditionalExpression,
+                       [&] { return isConditionalExpressionImpl(); });
+}
+
+bool Parser::isConditionalExpressionImpl() {
     uint32_t index = 1;
     while (true) {
         TokenKind kind = peek(index++).kind;
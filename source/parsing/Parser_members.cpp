@@ -26,6 +26,9 @@ CompilationUnitSyntax& Parser::parseCompilationUnit() {
     catch (const RecursionException&) {
         return factory.compilationUnit(nullptr, meta.eofToken);
     }
+    catch (const ParseAbortException&) {
+        return factory.compilationUnit(nullptr, meta.eofToken);
+    }
 }
 
 MemberSyntax& Parser::parseModule() {
@@ -38,9 +41,11 @@ MemberSyntax& Parser::parseModule(AttrList attributes, SyntaxKind parentKind,
     if (peek(TokenKind::ProgramKeyword) && peek(1).kind == TokenKind::Semicolon)
         return parseAnonymousProgram(attributes);
 
-    // Tell the preprocessor that we're inside a design element for the duration of this function.
-    auto& pp = getPP();
-    pp.pushDesignElementStack();
+    // Tell the preprocessor that we're inside a design element for the duration
+    // of this function. If it's running ahead of us on a pipeline there's no
+    // one to tell; the directive-in-design-element warning is lost in that mode.
+    if (!isPipelined())
+        getPP().pushDesignElementStack();
 
     auto& header = parseModuleHeader();
     auto endKind = getModuleEndKind(header.moduleKeyword.kind);
@@ -60,19 +65,35 @@ MemberSyntax& Parser::parseModule(AttrList attributes, SyntaxKind parentKind,
     }
 
     SyntaxKind declKind = getModuleDeclarationKind(header.moduleKeyword.kind);
-    ParserMetadata::Node node{pp.getDefaultNetType(), pp.getUnconnectedDrive(), pp.getTimeScale()};
+    ParserMetadata::Node node{getDefaultNetType(), getUnconnectedDrive(), getTimeScale()};
 
     auto savedDefinitionKind = currentDefinitionKind;
     currentDefinitionKind = declKind;
 
+    // In deferred mode, definitions at unit scope get their body tokens
+    // recorded instead of parsed; packages are excluded since their members
+    // are always needed as soon as the package is referenced.
+    bool deferBody = parseOptions.deferModuleBodies &&
+                     parentKind == SyntaxKind::CompilationUnit &&
+                     declKind != SyntaxKind::PackageDeclaration;
+
     Token endmodule;
-    auto members = parseMemberList<MemberSyntax>(
-        endKind, endmodule, declKind, [this](SyntaxKind parentKind, bool& anyLocalModules) {
-            return parseMember(parentKind, anyLocalModules);
-        });
+    std::span<MemberSyntax*> members;
+    std::span<Token> deferredTokens;
+    if (deferBody) {
+        deferredTokens = captureDeferredBody(endKind);
+        endmodule = expect(endKind);
+    }
+    else {
+        members = parseMemberList<MemberSyntax>(
+            endKind, endmodule, declKind, [this](SyntaxKind parentKind, bool& anyLocalModules) {
+                return parseMember(parentKind, anyLocalModules);
+            });
+    }
 
     currentDefinitionKind = savedDefinitionKind;
-    pp.popDesignElementStack();
+    if (!isPipelined())
+        getPP().popDesignElementStack();
 
     auto endName = parseNamedBlockClause();
     checkBlockNames(header.name, endName);
@@ -81,12 +102,106 @@ MemberSyntax& Parser::parseModule(AttrList attributes, SyntaxKind parentKind,
                                              endName);
 
     meta.nodeMap[&result] = node;
+    if (deferBody)
+        meta.deferredBodies[&result] = deferredTokens;
+
     return result;
 }
 
+std::span<Token> Parser::captureDeferredBody(TokenKind endKind) {
+    // Consume the body's tokens without building any syntax for them.
+    // Nested declarations of the same flavor (rare but legal, e.g. nested
+    // modules) bump a depth count so that we stop at our own end keyword;
+    // a begin keyword directly behind 'extern' doesn't count since extern
+    // declarations are header-only, and one behind 'virtual' doesn't
+    // either since that's a virtual interface type reference (a variable
+    // declaration or typedef), not a nested declaration.
+    TokenKind beginKind = TokenKind::Unknown;
+    TokenKind altBeginKind = TokenKind::Unknown;
+    switch (endKind) {
+        case TokenKind::EndModuleKeyword:
+            beginKind = TokenKind::ModuleKeyword;
+            altBeginKind = TokenKind::MacromoduleKeyword;
+            break;
+        case TokenKind::EndInterfaceKeyword:
+            beginKind = TokenKind::InterfaceKeyword;
+            break;
+        case TokenKind::EndProgramKeyword:
+            beginKind = TokenKind::ProgramKeyword;
+            break;
+        default:
+            break;
+    }
+
+    SmallVector<Token> tokens;
+    TokenKind prevKind = TokenKind::Unknown;
+    int depth = 0;
+    while (true) {
+        auto kind = peek().kind;
+        if (kind == TokenKind::EndOfFile)
+            break;
+
+        if (kind == endKind) {
+            if (depth == 0)
+                break;
+            depth--;
+        }
+        else if ((kind == beginKind || kind == altBeginKind) &&
+                 prevKind != TokenKind::ExternKeyword && prevKind != TokenKind::VirtualKeyword) {
+            // 'interface class' declarations end with endclass instead.
+            if (kind != TokenKind::InterfaceKeyword || peek(1).kind != TokenKind::ClassKeyword)
+                depth++;
+        }
+        else if (kind == TokenKind::DefParamKeyword) {
+            // These flags normally get set while parsing the corresponding
+            // members; compilation needs them up front, before any deferred
+            // body is expanded.
+            meta.hasDefparams = true;
+        }
+        else if (kind == TokenKind::BindKeyword) {
+            meta.hasBindDirectives = true;
+        }
+
+        prevKind = kind;
+        tokens.push_back(consume());
+    }
+
+    // Terminate with an EndOfFile token so that the deferred parse later
+    // sees a stream that ends the same way a normal one does.
+    tokens.push_back(Token(alloc, TokenKind::EndOfFile, {}, {}, peek().location()));
+    return tokens.copy(alloc);
+}
+
+std::span<MemberSyntax*> Parser::parseDeferredMembers(std::span<const Token> tokens,
+                                                      SyntaxKind parentKind) {
+    pushTokens(tokens);
+
+    Token eof;
+    std::span<MemberSyntax*> members;
+    try {
+        members = parseMemberList<MemberSyntax>(TokenKind::EndOfFile, eof, parentKind,
+                                                [this](SyntaxKind parentKind,
+                                                       bool& anyLocalModules) {
+                                                    return parseMember(parentKind, anyLocalModules);
+                                                });
+    }
+    catch (const RecursionException&) {
+        // The members parsed before the abort are dropped; the parser is
+        // only ever used for this one body so there's no stream state to
+        // repair.
+    }
+    catch (const ParseAbortException&) {
+    }
+
+    // Record that we consumed the terminating token so that getMetadata
+    // doesn't try to pull past the end of the pushed stream.
+    meta.eofToken = eof;
+    return members;
+}
+
 AnonymousProgramSyntax& Parser::parseAnonymousProgram(AttrList attributes) {
-    auto& pp = getPP();
-    pp.pushDesignElementStack();
+    if (!isPipelined())
+        getPP().pushDesignElementStack();
 
     auto keyword = consume();
     auto semi = expect(TokenKind::Semicolon);
@@ -98,7 +213,8 @@ AnonymousProgramSyntax& Parser::parseAnonymousProgram(AttrList attributes) {
             return parseMember(parentKind, anyLocalModules);
         });
 
-    pp.popDesignElementStack();
+    if (!isPipelined())
+        getPP().popDesignElementStack();
 
     return factory.anonymousProgram(attributes, keyword, semi, members, endkeyword);
 }
@@ -410,7 +526,7 @@ MemberSyntax* Parser::parseSingleMember(SyntaxKind parentKind) {
 template<typename TMember, typename TParseFunc>
 std::span<TMember*> Parser::parseMemberList(TokenKind endKind, Token& endToken,
                                             SyntaxKind parentKind, TParseFunc&& parseFunc) {
-    SmallVector<TMember*, 8> members;
+    SmallVector<TMember*, 8> members(alloc);
     bool errored = false;
     bool anyLocalModules = false;
 
@@ -429,13 +545,16 @@ std::span<TMember*> Parser::parseMemberList(TokenKind endKind, Token& endToken,
             skipToken(errored ? std::nullopt : std::make_optional(diag::ExpectedMember));
             errored = true;
         }
+
+        parseOptions.cancellationToken.throwIfCancelled();
+        checkAbortOnError();
     }
 
     if (anyLocalModules)
         moduleDeclStack.pop_back();
 
     endToken = expect(endKind);
-    return members.copy(alloc);
+    return members.finalize(alloc);
 }
 
 TimeUnitsDeclarationSyntax& Parser::parseTimeUnitsDeclaration(AttrList attributes) {
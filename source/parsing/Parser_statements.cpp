@@ -14,6 +14,12 @@ namespace slang::parsing {
 using namespace syntax;
 
 StatementSyntax& Parser::parseStatement(bool allowEmpty, bool allowSuperNew) {
+    // Checking here as well as on member loops bounds cancellation latency
+    // and error budget overrun even inside procedural blocks with very long
+    // statement lists.
+    parseOptions.cancellationToken.throwIfCancelled();
+    checkAbortOnError();
+
     auto dg = setDepthGuard();
 
     NamedLabelSyntax* label = nullptr;
@@ -634,13 +640,17 @@ NamedBlockClauseSyntax* Parser::parseNamedBlockClause() {
     return nullptr;
 }
 
-std::span<SyntaxNode*> Parser::parseBlockItems(TokenKind endKind, Token& end, bool inConstructor) {
+std::span<SyntaxNode*> Parser::parseBlockItems(TokenKind endKind, Token& end, bool inConstructor,
+                                               SyntaxNode* initialItem) {
     SmallVector<SyntaxNode*, 16> buffer;
     auto kind = peek().kind;
     bool errored = false;
-    bool sawStatement = false;
+    bool sawStatement = initialItem != nullptr;
     bool erroredAboutDecls = false;
 
+    if (initialItem)
+        buffer.push_back(initialItem);
+
     while (!isEndKeyword(kind) && kind != endKind && kind != TokenKind::EndOfFile) {
         SourceLocation loc = peek().location();
         SyntaxNode* newNode = nullptr;
@@ -702,15 +712,67 @@ std::span<SyntaxNode*> Parser::parseBlockItems(TokenKind endKind, Token& end, bo
 
 BlockStatementSyntax& Parser::parseBlock(SyntaxKind blockKind, TokenKind endKind,
                                          NamedLabelSyntax* label, AttrList attributes) {
-    auto begin = consume();
-    auto name = parseNamedBlockClause();
+    // Runs of directly nested blocks are parsed with an explicit stack instead
+    // of recursing once per level; machine-generated code can nest begin/end
+    // thousands deep. First descend through the nested block headers.
+    struct BlockHead {
+        SyntaxKind blockKind;
+        TokenKind endKind;
+        NamedLabelSyntax* label;
+        AttrList attributes;
+        Token begin;
+        NamedBlockClauseSyntax* name;
+    };
+    SmallVector<BlockHead, 4> stack;
 
-    Token end;
-    auto items = parseBlockItems(endKind, end, /* inConstructor */ false);
-    auto endName = parseNamedBlockClause();
+    while (true) {
+        auto begin = consume();
+        auto name = parseNamedBlockClause();
+        stack.push_back({blockKind, endKind, label, attributes, begin, name});
+
+        // Peek for a directly nested block, with an optional statement label;
+        // anything else, including attributes, takes the normal statement path
+        // through parseBlockItems below.
+        label = nullptr;
+        attributes = {};
+        auto kind = peek().kind;
+        if (kind == TokenKind::Identifier && peek(1).kind == TokenKind::Colon &&
+            (peek(2).kind == TokenKind::BeginKeyword || peek(2).kind == TokenKind::ForkKeyword)) {
+            auto name1 = consume();
+            label = &factory.namedLabel(name1, consume());
+            kind = peek().kind;
+        }
 
-    checkBlockNames(name, endName, label);
-    return factory.blockStatement(blockKind, label, attributes, begin, name, items, end, endName);
+        if (kind == TokenKind::BeginKeyword) {
+            blockKind = SyntaxKind::SequentialBlockStatement;
+            endKind = TokenKind::EndKeyword;
+        }
+        else if (kind == TokenKind::ForkKeyword) {
+            blockKind = SyntaxKind::ParallelBlockStatement;
+            endKind = TokenKind::JoinKeyword;
+        }
+        else {
+            break;
+        }
+    }
+
+    // Now unwind; each finished block becomes the first item of the
+    // enclosing one.
+    BlockStatementSyntax* result = nullptr;
+    while (true) {
+        auto& head = stack.back();
+        Token end;
+        auto items = parseBlockItems(head.endKind, end, /* inConstructor */ false, result);
+        auto endName = parseNamedBlockClause();
+
+        checkBlockNames(head.name, endName, head.label);
+        result = &factory.blockStatement(head.blockKind, head.label, head.attributes, head.begin,
+                                         head.name, items, end, endName);
+        stack.pop_back();
+        if (stack.empty())
+            break;
+    }
+    return *result;
 }
 
 StatementSyntax& Parser::parseWaitStatement(NamedLabelSyntax* label, AttrList attributes) {
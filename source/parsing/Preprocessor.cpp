@@ -27,16 +27,7 @@ Preprocessor::Preprocessor(SourceManager& sourceManager, BumpAllocator& alloc,
     alloc(alloc), diagnostics(diagnostics), options(options_.getOrDefault<PreprocessorOptions>()),
     lexerOptions(options_.getOrDefault<LexerOptions>()), numberParser(diagnostics, alloc) {
 
-    keywordVersionStack.push_back(LF::getDefaultKeywordVersion());
-    resetAllDirectives();
-    undefineAll();
-
-    // Add in any inherited macros that aren't already set in our map.
-    for (auto define : inheritedMacros) {
-        auto name = define->name.valueText();
-        if (!name.empty())
-            macros.emplace(name, define);
-    }
+    reset(inheritedMacros);
 
     // clang-format off
     pragmaProtectHandlers = {
@@ -83,6 +74,38 @@ Preprocessor::Preprocessor(const Preprocessor& other) :
     keywordVersionStack.push_back(LF::getDefaultKeywordVersion());
 }
 
+void Preprocessor::reset(std::span<const DefineDirectiveSyntax* const> inheritedMacros) {
+    lexerStack.clear();
+    branchStack.clear();
+    macroBodyFlags.clear();
+    expandedTokens.clear();
+    currentMacroToken = nullptr;
+    currentToken = Token();
+    lastConsumed = Token();
+    inMacroBody = false;
+    scratchTokenBuffer.clear();
+    includeOnceHeaders.clear();
+    guardDetectStack.clear();
+    designElementDepth = 0;
+    includeDepth = 0;
+
+    // Note that includeGuardHeaders is deliberately retained: it's a pure
+    // cache keyed by source buffer contents, and a remembered guard only takes
+    // effect while its macro is actually defined.
+
+    keywordVersionStack.clear();
+    keywordVersionStack.push_back(LF::getDefaultKeywordVersion());
+    resetAllDirectives();
+    undefineAll();
+
+    // Add in any inherited macros that aren't already set in our map.
+    for (auto define : inheritedMacros) {
+        auto name = define->name.valueText();
+        if (!name.empty())
+            macros.emplace(name, define);
+    }
+}
+
 void Preprocessor::pushSource(std::string_view source, std::string_view name) {
     auto buffer = sourceManager.assignText(source);
     pushSource(buffer);
@@ -91,18 +114,36 @@ void Preprocessor::pushSource(std::string_view source, std::string_view name) {
         sourceManager.addLineDirective(SourceLocation(buffer.id, 0), 2, name, 0);
 }
 
-void Preprocessor::pushSource(SourceBuffer buffer) {
+void Preprocessor::pushSource(SourceBuffer buffer, size_t startOffset) {
     ASSERT(buffer.id);
 
-    lexerStack.emplace_back(std::make_unique<Lexer>(buffer, alloc, diagnostics, lexerOptions));
+    lexerStack.emplace_back(
+        std::make_unique<Lexer>(buffer, alloc, diagnostics, lexerOptions, startOffset));
 }
 
 void Preprocessor::popSource() {
+    if (!guardDetectStack.empty() && guardDetectStack.back().lexerDepth == lexerStack.size()) {
+        // The include file is done; if a guard candidate survived with no tokens
+        // lexed after its `endif, remember it for later `include directives.
+        auto& guard = guardDetectStack.back();
+        if (guard.phase == GuardDetectEntry::Closed &&
+            lexerStack.back()->lexedTokenCount() == guard.closeCount) {
+            includeGuardHeaders.emplace(guard.fileKey, guard.candidate);
+        }
+        guardDetectStack.pop_back();
+    }
+
     if (includeDepth)
         includeDepth--;
     lexerStack.pop_back();
 }
 
+Preprocessor::GuardDetectEntry* Preprocessor::activeGuardDetect() {
+    if (!guardDetectStack.empty() && guardDetectStack.back().lexerDepth == lexerStack.size())
+        return &guardDetectStack.back();
+    return nullptr;
+}
+
 void Preprocessor::predefine(const std::string& definition, std::string_view name) {
     Preprocessor pp(*this);
     pp.pushSource("`define " + definition + "\n", name);
@@ -469,8 +510,17 @@ Trivia Preprocessor::handleIncludeDirective(Token directive) {
             addDiag(diag::ExceededMaxIncludeDepth, fileName.range());
         }
         else if (includeOnceHeaders.find(buffer.data.data()) == includeOnceHeaders.end()) {
-            includeDepth++;
-            pushSource(buffer);
+            // If the file has been observed to follow the include guard idiom and
+            // its guard macro is currently defined, including it again can't
+            // produce any tokens; skip it entirely, like a `pragma once header.
+            auto guardIt = includeGuardHeaders.find(buffer.data.data());
+            if (guardIt == includeGuardHeaders.end() ||
+                macros.find(guardIt->second) == macros.end()) {
+                includeDepth++;
+                pushSource(buffer);
+                if (guardIt == includeGuardHeaders.end())
+                    guardDetectStack.push_back({buffer.data.data(), lexerStack.size()});
+            }
         }
     }
 
@@ -536,6 +586,19 @@ Trivia Preprocessor::handleDefineDirective(Token directive) {
         bool done = false;
         auto triviaList = t.trivia();
 
+        // Collapsed trivia can hide newlines and split block comments, both of
+        // which this scan is sensitive to, so materialize the individual
+        // pieces before looking through them.
+        SmallVector<Trivia, 8> expandedTrivia;
+        for (const Trivia& tr : triviaList) {
+            if (tr.kind == TriviaKind::CollapsedText) {
+                for (const Trivia& other : triviaList)
+                    Lexer::expandTrivia(other, expandedTrivia);
+                triviaList = std::span<const Trivia>(expandedTrivia.data(), expandedTrivia.size());
+                break;
+            }
+        }
+
         for (const Trivia& trivia : triviaList) {
             switch (trivia.kind) {
                 case TriviaKind::EndOfLine:
@@ -624,6 +687,17 @@ Trivia Preprocessor::handleIfDefDirective(Token directive, bool inverted) {
             take = !take;
     }
 
+    // An `ifndef at the very start of an include file (the directive and its macro
+    // name being the first two tokens lexed) begins a candidate include guard.
+    if (auto guard = activeGuardDetect()) {
+        if (guard->phase == GuardDetectEntry::Detecting && inverted && !name.isMissing() &&
+            lexerStack.back()->lexedTokenCount() == 2) {
+            guard->candidate = name.valueText();
+            guard->branchDepth = branchStack.size();
+            guard->phase = GuardDetectEntry::InGuard;
+        }
+    }
+
     branchStack.emplace_back(BranchEntry(take));
 
     return parseBranchDirective(directive, name, take);
@@ -643,6 +717,15 @@ Trivia Preprocessor::handleElseDirective(Token directive) {
 
 bool Preprocessor::shouldTakeElseBranch(SourceLocation location, bool isElseIf,
                                         std::string_view macroName) {
+    // An `elsif or `else on the guard's own branch means the file can produce
+    // tokens even when the guard macro is defined, so it isn't really a guard.
+    if (auto guard = activeGuardDetect()) {
+        if (guard->phase == GuardDetectEntry::InGuard &&
+            branchStack.size() == guard->branchDepth + 1) {
+            guard->phase = GuardDetectEntry::Invalid;
+        }
+    }
+
     // empty stack is an error
     if (branchStack.empty()) {
         addDiag(diag::UnexpectedConditionalDirective, location);
@@ -677,6 +760,14 @@ Trivia Preprocessor::parseBranchDirective(Token directive, Token condition, bool
     if (!taken) {
         // skip over everything until we find another conditional compilation directive
         while (true) {
+            // In raw scan mode, have the active lexer blast through the disabled
+            // text in bulk instead of lexing it piece by piece.
+            if (options.rawDisabledTextScan && !currentToken && !currentMacroToken &&
+                !lexerStack.empty()) {
+                if (Token skipped = lexerStack.back()->lexDisabledText())
+                    scratchTokenBuffer.push_back(skipped);
+            }
+
             auto token = nextRaw();
 
             // EoF or conditional directive stops the skipping process
@@ -732,6 +823,18 @@ Trivia Preprocessor::handleEndIfDirective(Token directive) {
         if (!branchStack.empty() && !branchStack.back().currentActive)
             taken = false;
     }
+
+    // If this closes the candidate include guard's branch, remember how many
+    // tokens the file's lexer has produced so far; the guard only holds if no
+    // more are lexed before the end of the file.
+    if (auto guard = activeGuardDetect()) {
+        if (guard->phase == GuardDetectEntry::InGuard &&
+            branchStack.size() == guard->branchDepth) {
+            guard->phase = GuardDetectEntry::Closed;
+            guard->closeCount = lexerStack.back()->lexedTokenCount();
+        }
+    }
+
     return parseBranchDirective(directive, Token(), taken);
 }
 
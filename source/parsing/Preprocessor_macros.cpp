@@ -30,6 +30,29 @@ Preprocessor::MacroDef Preprocessor::findMacro(Token directive) {
     return it->second;
 }
 
+const Preprocessor::MacroBodyFlags& Preprocessor::getMacroBodyFlags(
+    const DefineDirectiveSyntax& macro) {
+
+    auto [it, inserted] = macroBodyFlags.emplace(&macro, MacroBodyFlags{});
+    if (inserted) {
+        for (Token token : macro.body) {
+            switch (token.kind) {
+                case TokenKind::Directive:
+                    it->second.hasNestedUsages = true;
+                    break;
+                case TokenKind::MacroQuote:
+                case TokenKind::MacroEscapedQuote:
+                case TokenKind::MacroPaste:
+                    it->second.hasMacroOps = true;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return it->second;
+}
+
 void Preprocessor::createBuiltInMacro(std::string_view name, int value, std::string_view valueStr) {
 #define NL SourceLocation::NoLocation
 
@@ -97,6 +120,63 @@ std::pair<MacroActualArgumentListSyntax*, Trivia> Preprocessor::handleTopLevelMa
     if (!expandMacro(macro, expansion, actualArgs))
         return {actualArgs, Trivia()};
 
+    // Fast path: if the macro body contains no nested macro usages and no
+    // stringification / concatenation operators, and neither do the actual
+    // arguments, then the expansion is already fully formed and the rescan
+    // loop below has nothing to do. The body analysis is location independent
+    // so it's memoized per definition; UVM-style utility macros that expand
+    // thousands of times hit this on nearly every invocation.
+    if (!macro.isIntrinsic()) {
+        auto& bodyFlags = getMacroBodyFlags(*macro.syntax);
+        if (!bodyFlags.hasNestedUsages && !bodyFlags.hasMacroOps) {
+            auto argsAreSimple = [&] {
+                if (!actualArgs)
+                    return true;
+
+                for (auto arg : actualArgs->args) {
+                    for (Token token : arg->tokens) {
+                        switch (token.kind) {
+                            case TokenKind::Directive:
+                            case TokenKind::MacroQuote:
+                            case TokenKind::MacroEscapedQuote:
+                            case TokenKind::MacroPaste:
+                                return false;
+                            default:
+                                break;
+                        }
+                    }
+                }
+                return true;
+            };
+
+            if (argsAreSimple()) {
+                // Stripped line continuations leave empty placeholder tokens
+                // behind; fold their trivia into the next real token, exactly
+                // as applyMacroOps would have.
+                expandedTokens.clear();
+                SmallVector<Trivia, 8> pendingTrivia;
+                for (Token token : buffer) {
+                    if (token.kind == TokenKind::EmptyMacroArgument) {
+                        pendingTrivia.append(token.trivia());
+                        continue;
+                    }
+
+                    if (!pendingTrivia.empty()) {
+                        pendingTrivia.append(token.trivia());
+                        token = token.withTrivia(alloc, pendingTrivia.copy(alloc));
+                        pendingTrivia.clear();
+                    }
+                    expandedTokens.push_back(token);
+                }
+
+                if (!expandedTokens.empty())
+                    currentMacroToken = expandedTokens.begin();
+
+                return {actualArgs, Trivia()};
+            }
+        }
+    }
+
     // The macro is now expanded out into tokens, but some of those tokens might
     // be more macros that need to be expanded, or special characters that
     // perform stringification or concatenation of tokens. It's possible that
@@ -364,6 +364,12 @@ bool Token::isOnSameLine() const {
                 if (t.syntax()->kind != SyntaxKind::MacroUsage)
                     return false;
                 break;
+            case TriviaKind::CollapsedText:
+                // Only whitespace, newlines, and block comments get collapsed,
+                // so scanning for newline characters is exact here.
+                if (t.getRawText().find_first_of("\r\n") != std::string_view::npos)
+                    return false;
+                break;
             case TriviaKind::BlockComment:
                 if (size_t offset = t.getRawText().find_first_of("\r\n");
                     offset != std::string_view::npos) {
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// TokenPipeline.cpp
+// Runs preprocessing ahead of parsing on a worker thread
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/parsing/TokenPipeline.h"
+
+#include "slang/parsing/Preprocessor.h"
+
+namespace slang::parsing {
+
+TokenPipeline::TokenPipeline(Preprocessor& preprocessor, BumpAllocator& parseAlloc,
+                             Diagnostics& parseDiags) :
+    preprocessor(preprocessor),
+    parseAlloc(parseAlloc), parseDiags(parseDiags),
+    keywordVersion(preprocessor.getCurrentKeywordVersion()), state(snapshotState()) {
+    ASSERT(&parseAlloc != &preprocessor.getAllocator());
+    ASSERT(&parseDiags != &preprocessor.getDiagnostics());
+}
+
+TokenPipeline::~TokenPipeline() {
+    finish();
+}
+
+void TokenPipeline::start() {
+    ASSERT(!worker.joinable());
+    worker = std::thread([this] { run(); });
+}
+
+void TokenPipeline::finish() {
+    if (worker.joinable())
+        worker.join();
+}
+
+TokenPipeline::DirectiveState TokenPipeline::snapshotState() const {
+    return {preprocessor.getDefaultNetType(), preprocessor.getUnconnectedDrive(),
+            preprocessor.getTimeScale()};
+}
+
+void TokenPipeline::run() {
+    DirectiveState lastState = state;
+    Chunk chunk;
+    chunk.tokens.reserve(ChunkSize);
+
+    while (true) {
+        Token token = preprocessor.next();
+        chunk.tokens.push_back(token);
+
+        // Directives are handled as part of producing the token that
+        // follows them, so the state as of this token is what the
+        // preprocessor reports right now.
+        auto newState = snapshotState();
+        if (newState != lastState) {
+            chunk.stateChanges.push_back({chunk.tokens.size() - 1, newState});
+            lastState = std::move(newState);
+        }
+
+        bool atEnd = token.kind == TokenKind::EndOfFile;
+        if (chunk.tokens.size() >= ChunkSize || atEnd) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                chunks.emplace_back(std::move(chunk));
+                if (atEnd)
+                    producerDone = true;
+            }
+            condition.notify_one();
+
+            if (atEnd)
+                return;
+
+            chunk = {};
+            chunk.tokens.reserve(ChunkSize);
+        }
+    }
+}
+
+Token TokenPipeline::next() {
+    if (currentIndex < current.tokens.size()) {
+        while (stateIndex < current.stateChanges.size() &&
+               current.stateChanges[stateIndex].tokenIndex <= currentIndex) {
+            state = current.stateChanges[stateIndex++].state;
+        }
+
+        Token token = current.tokens[currentIndex++];
+        if (token.kind == TokenKind::EndOfFile)
+            eofToken = token;
+        return token;
+    }
+
+    // Ran off the end of the last chunk we grabbed; the final chunk always
+    // ends with an EndOfFile token, so if we've seen one just keep
+    // returning it, matching the preprocessor's behavior at end of stream.
+    if (eofToken)
+        return eofToken;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return nextChunk < chunks.size() || producerDone; });
+
+        ASSERT(nextChunk < chunks.size());
+        current = std::move(chunks[nextChunk++]);
+    }
+
+    currentIndex = 0;
+    stateIndex = 0;
+    return next();
+}
+
+} // namespace slang::parsing
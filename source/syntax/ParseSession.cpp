@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// ParseSession.cpp
+// Reusable parsing pipeline for batch processing of files
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/syntax/ParseSession.h"
+
+#include "slang/text/SourceManager.h"
+#include "slang/util/TimeTrace.h"
+
+namespace slang::syntax {
+
+using namespace parsing;
+
+ParseSession::ParseSession(SourceManager& sourceManager, const Bag& options) :
+    sourceManager(sourceManager), options(options),
+    preprocessor(sourceManager, alloc, diagnostics, options), parser(preprocessor, options) {
+}
+
+std::shared_ptr<SyntaxTree> ParseSession::parse(const SourceBuffer& buffer,
+                                                SyntaxTree::MacroList inheritedMacros) {
+    return parse(std::span(&buffer, 1), inheritedMacros);
+}
+
+std::shared_ptr<SyntaxTree> ParseSession::parse(std::span<const SourceBuffer> buffers,
+                                                SyntaxTree::MacroList inheritedMacros) {
+    TimeTraceScope timeScope("parseFile"sv, [&] {
+        if (buffers.size() == 1)
+            return std::string(sourceManager.getRawFileName(buffers[0].id));
+        else
+            return "<multi-buffer>"s;
+    });
+
+    // Note that resetting here (rather than after handing off the previous
+    // tree) matters: the macros predefined during the preprocessor reset are
+    // allocated from our arena and must go into the allocator that the new
+    // tree will eventually own.
+    diagnostics.clear();
+    preprocessor.reset(inheritedMacros);
+    parser.reset();
+
+    for (auto it = buffers.rbegin(); it != buffers.rend(); it++)
+        preprocessor.pushSource(*it);
+
+    auto root = &parser.parseCompilationUnit();
+
+    auto result = std::shared_ptr<SyntaxTree>(
+        new SyntaxTree(root, sourceManager, std::move(alloc), std::move(diagnostics),
+                       parser.getMetadata(), preprocessor.getDefinedMacros(), options));
+
+    // The new tree took ownership of our arena segments, leaving the allocator
+    // in a moved-from state; give it a fresh segment so that the next parse
+    // can allocate from it again.
+    alloc = BumpAllocator();
+    return result;
+}
+
+} // namespace slang::syntax
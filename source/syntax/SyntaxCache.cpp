@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// SyntaxCache.cpp
+// Cache of parsed syntax trees keyed by source content hash
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/syntax/SyntaxCache.h"
+
+#include <ankerl/unordered_dense.h>
+#include <mutex>
+
+#include "slang/parsing/Lexer.h"
+#include "slang/parsing/Parser.h"
+#include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceLocation.h"
+
+namespace slang::syntax {
+
+using namespace parsing;
+
+std::shared_ptr<SyntaxTree> SyntaxCache::find(const SourceBuffer& buffer,
+                                              const Bag& options) const {
+    uint64_t key = hashKey(buffer, options);
+
+    std::shared_lock lock(mut);
+    if (auto it = entries.find(key); it != entries.end())
+        return it->second;
+    return nullptr;
+}
+
+void SyntaxCache::insert(const SourceBuffer& buffer, const Bag& options,
+                         std::shared_ptr<SyntaxTree> tree) {
+    uint64_t key = hashKey(buffer, options);
+
+    std::unique_lock lock(mut);
+    entries.emplace(key, std::move(tree));
+}
+
+size_t SyntaxCache::size() const {
+    std::shared_lock lock(mut);
+    return entries.size();
+}
+
+uint64_t SyntaxCache::hashKey(const SourceBuffer& buffer, const Bag& options) {
+    uint64_t contentHash = ankerl::unordered_dense::detail::wyhash::hash(buffer.data.data(),
+                                                                         buffer.data.size());
+
+    // Fold in every option that can change the shape of the parsed tree.
+    size_t seed = (size_t)contentHash;
+    auto ppOptions = options.getOrDefault<PreprocessorOptions>();
+    hash_combine(seed, ppOptions.maxIncludeDepth, ppOptions.predefineSource);
+    for (auto& predef : ppOptions.predefines)
+        hash_combine(seed, predef);
+    for (auto& undef : ppOptions.undefines)
+        hash_combine(seed, undef);
+
+    // Directive sets have no defined iteration order, so combine the
+    // element hashes in an order-independent way.
+    size_t directives = 0;
+    for (auto& directive : ppOptions.ignoreDirectives)
+        directives ^= std::hash<std::string_view>()(directive);
+    hash_combine(seed, directives);
+    hash_combine(seed, ppOptions.rawDisabledTextScan);
+
+    auto lexerOptions = options.getOrDefault<LexerOptions>();
+    hash_combine(seed, lexerOptions.maxErrors, lexerOptions.minimalTrivia,
+                 lexerOptions.collapseTrivia);
+
+    // deferModuleBodies changes what the tree even contains, and the error
+    // limiting / pipelining options change which diagnostics get attached,
+    // so a tree parsed under one setting must not be returned to a consumer
+    // using another.
+    auto parserOptions = options.getOrDefault<ParserOptions>();
+    hash_combine(seed, parserOptions.maxRecursionDepth, parserOptions.errorLimit,
+                 parserOptions.pipelinedPreprocessing, parserOptions.deferModuleBodies,
+                 parserOptions.stopOnFirstError);
+
+    return seed;
+}
+
+} // namespace slang::syntax
@@ -21,7 +21,21 @@ std::string_view SyntaxFacts::getSimpleTypeName(const DataTypeSyntax& syntax) {
 }
 
 // clang-format off
-SyntaxKind SyntaxFacts::getUnaryPrefixExpression(TokenKind kind) {
+namespace {
+
+using parsing::TokenKind;
+
+// The "is possible X" predicates below are consulted at essentially every
+// token the parser consumes while deciding whether a list has ended, and
+// several of them chain through two or three other predicates per query.
+// To keep them cheap, the classification switches live here as constexpr
+// helpers and are baked into bitmap tables at compile time, so that each
+// public SyntaxFacts query is a single bit test. The switches remain the
+// only source of truth; the tables are just their precomputed form.
+// Predicates that are a single dense switch already compile well and are
+// left alone.
+
+constexpr SyntaxKind unaryPrefixExpressionKind(TokenKind kind) {
     switch (kind) {
         case TokenKind::Plus: return SyntaxKind::UnaryPlusExpression;
         case TokenKind::Minus: return SyntaxKind::UnaryMinusExpression;
@@ -42,28 +56,7 @@ SyntaxKind SyntaxFacts::getUnaryPrefixExpression(TokenKind kind) {
     }
 }
 
-SyntaxKind SyntaxFacts::getUnaryPostfixExpression(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::DoublePlus: return SyntaxKind::PostincrementExpression;
-        case TokenKind::DoubleMinus: return SyntaxKind::PostdecrementExpression;
-        default: return SyntaxKind::Unknown;
-    }
-}
-
-SyntaxKind SyntaxFacts::getLiteralExpression(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::StringLiteral: return SyntaxKind::StringLiteralExpression;
-        case TokenKind::IntegerLiteral: return SyntaxKind::IntegerLiteralExpression;
-        case TokenKind::UnbasedUnsizedLiteral: return SyntaxKind::UnbasedUnsizedLiteralExpression;
-        case TokenKind::RealLiteral: return SyntaxKind::RealLiteralExpression;
-        case TokenKind::TimeLiteral: return SyntaxKind::TimeLiteralExpression;
-        case TokenKind::NullKeyword: return SyntaxKind::NullLiteralExpression;
-        case TokenKind::Dollar: return SyntaxKind::WildcardLiteralExpression;
-        default: return SyntaxKind::Unknown;
-    }
-}
-
-SyntaxKind SyntaxFacts::getBinaryExpression(TokenKind kind) {
+constexpr SyntaxKind binaryExpressionKind(TokenKind kind) {
     switch (kind) {
         case TokenKind::Plus: return SyntaxKind::AddExpression;
         case TokenKind::Minus: return SyntaxKind::SubtractExpression;
@@ -113,6 +106,416 @@ SyntaxKind SyntaxFacts::getBinaryExpression(TokenKind kind) {
     }
 }
 
+constexpr bool possibleDataType(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::BitKeyword:
+        case TokenKind::LogicKeyword:
+        case TokenKind::RegKeyword:
+        case TokenKind::ByteKeyword:
+        case TokenKind::ShortIntKeyword:
+        case TokenKind::IntKeyword:
+        case TokenKind::LongIntKeyword:
+        case TokenKind::IntegerKeyword:
+        case TokenKind::TimeKeyword:
+        case TokenKind::ShortRealKeyword:
+        case TokenKind::RealKeyword:
+        case TokenKind::RealTimeKeyword:
+        case TokenKind::StringKeyword:
+        case TokenKind::ConstKeyword:
+        case TokenKind::SignedKeyword:
+        case TokenKind::UnsignedKeyword:
+        case TokenKind::StructKeyword:
+        case TokenKind::UnionKeyword:
+        case TokenKind::EnumKeyword:
+        case TokenKind::CHandleKeyword:
+        case TokenKind::VirtualKeyword:
+        case TokenKind::EventKeyword:
+        case TokenKind::TypeKeyword:
+        case TokenKind::VoidKeyword:
+        case TokenKind::Identifier:
+        case TokenKind::UnitSystemName:
+        case TokenKind::OpenBracket:
+            return true;
+        default:
+            return false;
+    }
+}
+
+constexpr bool possibleExpression(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::TaggedKeyword:
+        case TokenKind::StringLiteral:
+        case TokenKind::IntegerLiteral:
+        case TokenKind::UnbasedUnsizedLiteral:
+        case TokenKind::IntegerBase:
+        case TokenKind::RealLiteral:
+        case TokenKind::TimeLiteral:
+        case TokenKind::NullKeyword:
+        case TokenKind::Dollar:
+        case TokenKind::LocalKeyword:
+        case TokenKind::OpenParenthesis:
+        case TokenKind::OpenBrace:
+        case TokenKind::OpenBracket:
+        case TokenKind::UnitSystemName:
+        case TokenKind::ThisKeyword:
+        case TokenKind::SuperKeyword:
+        case TokenKind::Identifier:
+        case TokenKind::SystemIdentifier:
+        case TokenKind::RootSystemName:
+        case TokenKind::Hash:
+        case TokenKind::DoubleHash:
+        case TokenKind::At:
+        case TokenKind::RepeatKeyword:
+        case TokenKind::TypeKeyword:
+        case TokenKind::ApostropheOpenBrace:
+            // expressions can't actually start with these, but we'll allow it
+            // to provide good error handling
+        case TokenKind::DoubleColon:
+        case TokenKind::Question:
+        case TokenKind::MatchesKeyword:
+        case TokenKind::TripleAnd:
+        case TokenKind::InsideKeyword:
+        case TokenKind::DistKeyword:
+            return true;
+        default:
+            break;
+    }
+
+    if (possibleDataType(kind))
+        return true;
+
+    if (unaryPrefixExpressionKind(kind) != SyntaxKind::Unknown)
+        return true;
+
+    if (binaryExpressionKind(kind) != SyntaxKind::Unknown)
+        return true;
+
+    return false;
+}
+
+constexpr bool possibleStatement(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::Identifier:
+        case TokenKind::SystemIdentifier:
+        case TokenKind::ThisKeyword:
+        case TokenKind::SuperKeyword:
+        case TokenKind::UnitSystemName:
+        case TokenKind::RootSystemName:
+        case TokenKind::OpenBrace:
+        case TokenKind::ApostropheOpenBrace:
+        case TokenKind::AssignKeyword:
+        case TokenKind::DeassignKeyword:
+        case TokenKind::ForceKeyword:
+        case TokenKind::ReleaseKeyword:
+        case TokenKind::UniqueKeyword:
+        case TokenKind::Unique0Keyword:
+        case TokenKind::PriorityKeyword:
+        case TokenKind::CaseKeyword:
+        case TokenKind::CaseXKeyword:
+        case TokenKind::CaseZKeyword:
+        case TokenKind::IfKeyword:
+        case TokenKind::DoublePlus:
+        case TokenKind::DoubleMinus:
+        case TokenKind::VoidKeyword:
+        case TokenKind::TypeKeyword:
+        case TokenKind::DisableKeyword:
+        case TokenKind::MinusArrow:
+        case TokenKind::MinusDoubleArrow:
+        case TokenKind::ForeverKeyword:
+        case TokenKind::RepeatKeyword:
+        case TokenKind::WhileKeyword:
+        case TokenKind::ForKeyword:
+        case TokenKind::DoKeyword:
+        case TokenKind::ForeachKeyword:
+        case TokenKind::ReturnKeyword:
+        case TokenKind::BreakKeyword:
+        case TokenKind::ContinueKeyword:
+        case TokenKind::ForkKeyword:
+        case TokenKind::Hash:
+        case TokenKind::DoubleHash:
+        case TokenKind::At:
+        case TokenKind::BeginKeyword:
+        case TokenKind::WaitKeyword:
+        case TokenKind::WaitOrderKeyword:
+        case TokenKind::AssertKeyword:
+        case TokenKind::AssumeKeyword:
+        case TokenKind::CoverKeyword:
+        case TokenKind::RestrictKeyword:
+        case TokenKind::RandSequenceKeyword:
+        case TokenKind::RandCaseKeyword:
+        case TokenKind::ExpectKeyword:
+        case TokenKind::OpenParenthesisStar:
+        case TokenKind::Semicolon:
+            return true;
+        default:
+            return false;
+    }
+}
+
+constexpr bool netType(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::Supply0Keyword:
+        case TokenKind::Supply1Keyword:
+        case TokenKind::TriKeyword:
+        case TokenKind::TriAndKeyword:
+        case TokenKind::TriOrKeyword:
+        case TokenKind::TriRegKeyword:
+        case TokenKind::Tri0Keyword:
+        case TokenKind::Tri1Keyword:
+        case TokenKind::UWireKeyword:
+        case TokenKind::WireKeyword:
+        case TokenKind::WAndKeyword:
+        case TokenKind::WOrKeyword:
+        case TokenKind::InterconnectKeyword:
+            return true;
+        default:
+            return false;
+    }
+}
+
+constexpr bool possibleArgument(TokenKind kind) {
+    // allow a comma here to handle cases like:  foo(, 3);
+    switch (kind) {
+        case TokenKind::Dot:
+        case TokenKind::Comma:
+        case TokenKind::FirstMatchKeyword:
+        case TokenKind::StrongKeyword:
+        case TokenKind::WeakKeyword:
+        case TokenKind::NotKeyword:
+        case TokenKind::IfKeyword:
+        case TokenKind::CaseKeyword:
+        case TokenKind::NextTimeKeyword:
+        case TokenKind::SNextTimeKeyword:
+        case TokenKind::AlwaysKeyword:
+        case TokenKind::SAlwaysKeyword:
+        case TokenKind::EventuallyKeyword:
+        case TokenKind::SEventuallyKeyword:
+        case TokenKind::AcceptOnKeyword:
+        case TokenKind::SyncAcceptOnKeyword:
+        case TokenKind::RejectOnKeyword:
+        case TokenKind::SyncRejectOnKeyword:
+        case TokenKind::EdgeKeyword:
+        case TokenKind::PosEdgeKeyword:
+        case TokenKind::NegEdgeKeyword:
+            return true;
+        default:
+            return possibleExpression(kind);
+    }
+}
+
+constexpr bool possibleParamAssignment(TokenKind kind) {
+    // allow a comma here to handle cases like:  foo #(, 3);
+    switch (kind) {
+        case TokenKind::Dot:
+        case TokenKind::Comma:
+            return true;
+        default:
+            return possibleExpression(kind);
+    }
+}
+
+constexpr bool possibleAnsiPort(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::InterfaceKeyword:
+        case TokenKind::Identifier:
+        case TokenKind::Dot:
+        case TokenKind::Comma:
+        case TokenKind::InputKeyword:
+        case TokenKind::OutputKeyword:
+        case TokenKind::InOutKeyword:
+        case TokenKind::RefKeyword:
+        case TokenKind::VarKeyword:
+        case TokenKind::OpenParenthesisStar:
+            return true;
+        default:
+            return netType(kind) || possibleDataType(kind);
+    }
+}
+
+constexpr bool possibleFunctionPort(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::Identifier:
+        case TokenKind::Comma:
+        case TokenKind::InputKeyword:
+        case TokenKind::OutputKeyword:
+        case TokenKind::InOutKeyword:
+        case TokenKind::RefKeyword:
+        case TokenKind::VarKeyword:
+        case TokenKind::ConstKeyword:
+        case TokenKind::OpenParenthesisStar:
+            return true;
+        default:
+            return possibleDataType(kind);
+    }
+}
+
+constexpr bool possibleOpenRangeElement(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::OpenBracket:
+        case TokenKind::Comma:
+            return true;
+        default:
+            return possibleExpression(kind);
+    }
+}
+
+constexpr bool possiblePattern(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::Dot:
+        case TokenKind::DotStar:
+        case TokenKind::ApostropheOpenBrace:
+            return true;
+        default:
+            return possibleExpression(kind);
+    }
+}
+
+constexpr bool possibleParameter(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::ParameterKeyword:
+        case TokenKind::LocalParamKeyword:
+        case TokenKind::TypeKeyword:
+        case TokenKind::Comma:
+            return true;
+        default:
+            return possibleDataType(kind);
+    }
+}
+
+constexpr bool possiblePortConnection(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::OpenParenthesisStar:
+        case TokenKind::DotStar:
+        case TokenKind::Dot:
+        case TokenKind::Comma:
+            return true;
+        default:
+            return possibleArgument(kind);
+    }
+}
+
+constexpr bool endKeyword(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::EndKeyword:
+        case TokenKind::EndCaseKeyword:
+        case TokenKind::EndCheckerKeyword:
+        case TokenKind::EndClassKeyword:
+        case TokenKind::EndClockingKeyword:
+        case TokenKind::EndConfigKeyword:
+        case TokenKind::EndFunctionKeyword:
+        case TokenKind::EndGenerateKeyword:
+        case TokenKind::EndGroupKeyword:
+        case TokenKind::EndInterfaceKeyword:
+        case TokenKind::EndModuleKeyword:
+        case TokenKind::EndPackageKeyword:
+        case TokenKind::EndPrimitiveKeyword:
+        case TokenKind::EndProgramKeyword:
+        case TokenKind::EndPropertyKeyword:
+        case TokenKind::EndSpecifyKeyword:
+        case TokenKind::EndSequenceKeyword:
+        case TokenKind::EndTableKeyword:
+        case TokenKind::EndTaskKeyword:
+        case TokenKind::JoinAnyKeyword:
+        case TokenKind::JoinKeyword:
+        case TokenKind::JoinNoneKeyword:
+            return true;
+        default:
+            return false;
+    }
+}
+
+constexpr bool closeDelimOrKeyword(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::CloseBrace:
+        case TokenKind::CloseBracket:
+        case TokenKind::CloseParenthesis:
+        case TokenKind::StarCloseParenthesis:
+            return true;
+        default:
+            return endKeyword(kind);
+    }
+}
+
+// A bitmap with one bit per TokenKind, filled in at compile time from one
+// of the classifier functions above.
+class TokenKindBitmap {
+public:
+    template<typename TClassify>
+    constexpr explicit TokenKindBitmap(TClassify&& classify) {
+        for (size_t i = 0; i < KindCount; i++) {
+            if (classify(TokenKind(i)))
+                words[i / 64] |= uint64_t(1) << (i % 64);
+        }
+    }
+
+    constexpr bool contains(TokenKind kind) const {
+        size_t i = size_t(kind);
+        return (words[i / 64] >> (i % 64)) & 1;
+    }
+
+private:
+    static constexpr size_t KindCount = parsing::TokenKind_traits::values.size();
+    uint64_t words[(KindCount + 63) / 64] = {};
+};
+
+constexpr TokenKindBitmap possibleDataTypeMap(&possibleDataType);
+constexpr TokenKindBitmap possibleExpressionMap(&possibleExpression);
+constexpr TokenKindBitmap possibleStatementMap(&possibleStatement);
+constexpr TokenKindBitmap netTypeMap(&netType);
+constexpr TokenKindBitmap possibleArgumentMap(&possibleArgument);
+constexpr TokenKindBitmap possibleParamAssignmentMap(&possibleParamAssignment);
+constexpr TokenKindBitmap possibleAnsiPortMap(&possibleAnsiPort);
+constexpr TokenKindBitmap possibleFunctionPortMap(&possibleFunctionPort);
+constexpr TokenKindBitmap possibleOpenRangeElementMap(&possibleOpenRangeElement);
+constexpr TokenKindBitmap possiblePatternMap(&possiblePattern);
+constexpr TokenKindBitmap possibleParameterMap(&possibleParameter);
+constexpr TokenKindBitmap possiblePortConnectionMap(&possiblePortConnection);
+constexpr TokenKindBitmap endKeywordMap(&endKeyword);
+constexpr TokenKindBitmap closeDelimOrKeywordMap(&closeDelimOrKeyword);
+constexpr TokenKindBitmap possibleExpressionOrCommaMap(
+    [](TokenKind kind) { return kind == TokenKind::Comma || possibleExpression(kind); });
+constexpr TokenKindBitmap possibleExpressionOrCommaOrDefaultMap(
+    [](TokenKind kind) { return kind == TokenKind::Comma || kind == TokenKind::DefaultKeyword || possibleExpression(kind); });
+constexpr TokenKindBitmap possibleExpressionOrTripleAndMap(
+    [](TokenKind kind) { return kind == TokenKind::TripleAnd || possibleExpression(kind); });
+constexpr TokenKindBitmap possibleExpressionOrEqualsMap(
+    [](TokenKind kind) { return kind == TokenKind::Equals || possibleExpression(kind); });
+constexpr TokenKindBitmap possibleForInitializerMap(
+    [](TokenKind kind) { return kind == TokenKind::Comma || kind == TokenKind::VarKeyword || possibleExpression(kind); });
+constexpr TokenKindBitmap possiblePatternOrCommaMap(
+    [](TokenKind kind) { return kind == TokenKind::Comma || possiblePattern(kind); });
+
+} // namespace
+
+SyntaxKind SyntaxFacts::getUnaryPrefixExpression(TokenKind kind) {
+    return unaryPrefixExpressionKind(kind);
+}
+
+SyntaxKind SyntaxFacts::getUnaryPostfixExpression(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::DoublePlus: return SyntaxKind::PostincrementExpression;
+        case TokenKind::DoubleMinus: return SyntaxKind::PostdecrementExpression;
+        default: return SyntaxKind::Unknown;
+    }
+}
+
+SyntaxKind SyntaxFacts::getLiteralExpression(TokenKind kind) {
+    switch (kind) {
+        case TokenKind::StringLiteral: return SyntaxKind::StringLiteralExpression;
+        case TokenKind::IntegerLiteral: return SyntaxKind::IntegerLiteralExpression;
+        case TokenKind::UnbasedUnsizedLiteral: return SyntaxKind::UnbasedUnsizedLiteralExpression;
+        case TokenKind::RealLiteral: return SyntaxKind::RealLiteralExpression;
+        case TokenKind::TimeLiteral: return SyntaxKind::TimeLiteralExpression;
+        case TokenKind::NullKeyword: return SyntaxKind::NullLiteralExpression;
+        case TokenKind::Dollar: return SyntaxKind::WildcardLiteralExpression;
+        default: return SyntaxKind::Unknown;
+    }
+}
+
+SyntaxKind SyntaxFacts::getBinaryExpression(TokenKind kind) {
+    return binaryExpressionKind(kind);
+}
+
 SyntaxKind SyntaxFacts::getBinarySequenceExpr(TokenKind kind) {
     switch (kind) {
         case TokenKind::AndKeyword: return SyntaxKind::AndSequenceExpr;
@@ -273,160 +676,24 @@ bool SyntaxFacts::isRightAssociative(SyntaxKind kind) {
         case SyntaxKind::UntilWithPropertyExpr:
         case SyntaxKind::SUntilWithPropertyExpr:
         case SyntaxKind::ImpliesPropertyExpr:
-        case SyntaxKind::ImplicationPropertyExpr:
-        case SyntaxKind::FollowedByPropertyExpr:
-            return true;
-        default:
-            return false;
-    }
-}
-
-bool SyntaxFacts::isPossibleDataType(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::BitKeyword:
-        case TokenKind::LogicKeyword:
-        case TokenKind::RegKeyword:
-        case TokenKind::ByteKeyword:
-        case TokenKind::ShortIntKeyword:
-        case TokenKind::IntKeyword:
-        case TokenKind::LongIntKeyword:
-        case TokenKind::IntegerKeyword:
-        case TokenKind::TimeKeyword:
-        case TokenKind::ShortRealKeyword:
-        case TokenKind::RealKeyword:
-        case TokenKind::RealTimeKeyword:
-        case TokenKind::StringKeyword:
-        case TokenKind::ConstKeyword:
-        case TokenKind::SignedKeyword:
-        case TokenKind::UnsignedKeyword:
-        case TokenKind::StructKeyword:
-        case TokenKind::UnionKeyword:
-        case TokenKind::EnumKeyword:
-        case TokenKind::CHandleKeyword:
-        case TokenKind::VirtualKeyword:
-        case TokenKind::EventKeyword:
-        case TokenKind::TypeKeyword:
-        case TokenKind::VoidKeyword:
-        case TokenKind::Identifier:
-        case TokenKind::UnitSystemName:
-        case TokenKind::OpenBracket:
+        case SyntaxKind::ImplicationPropertyExpr:
+        case SyntaxKind::FollowedByPropertyExpr:
             return true;
         default:
             return false;
     }
 }
 
-bool SyntaxFacts::isPossibleExpression(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::TaggedKeyword:
-        case TokenKind::StringLiteral:
-        case TokenKind::IntegerLiteral:
-        case TokenKind::UnbasedUnsizedLiteral:
-        case TokenKind::IntegerBase:
-        case TokenKind::RealLiteral:
-        case TokenKind::TimeLiteral:
-        case TokenKind::NullKeyword:
-        case TokenKind::Dollar:
-        case TokenKind::LocalKeyword:
-        case TokenKind::OpenParenthesis:
-        case TokenKind::OpenBrace:
-        case TokenKind::OpenBracket:
-        case TokenKind::UnitSystemName:
-        case TokenKind::ThisKeyword:
-        case TokenKind::SuperKeyword:
-        case TokenKind::Identifier:
-        case TokenKind::SystemIdentifier:
-        case TokenKind::RootSystemName:
-        case TokenKind::Hash:
-        case TokenKind::DoubleHash:
-        case TokenKind::At:
-        case TokenKind::RepeatKeyword:
-        case TokenKind::TypeKeyword:
-        case TokenKind::ApostropheOpenBrace:
-            // expressions can't actually start with these, but we'll allow it
-            // to provide good error handling
-        case TokenKind::DoubleColon:
-        case TokenKind::Question:
-        case TokenKind::MatchesKeyword:
-        case TokenKind::TripleAnd:
-        case TokenKind::InsideKeyword:
-        case TokenKind::DistKeyword:
-            return true;
-        default:
-            break;
-    }
-
-    if (isPossibleDataType(kind))
-        return true;
-
-    SyntaxKind opKind = getUnaryPrefixExpression(kind);
-    if (opKind != SyntaxKind::Unknown)
-        return true;
-
-    opKind = getBinaryExpression(kind);
-    if (opKind != SyntaxKind::Unknown)
-        return true;
+bool SyntaxFacts::isPossibleDataType(TokenKind kind) {
+    return possibleDataTypeMap.contains(kind);
+}
 
-    return false;
+bool SyntaxFacts::isPossibleExpression(TokenKind kind) {
+    return possibleExpressionMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleStatement(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::Identifier:
-        case TokenKind::SystemIdentifier:
-        case TokenKind::ThisKeyword:
-        case TokenKind::SuperKeyword:
-        case TokenKind::UnitSystemName:
-        case TokenKind::RootSystemName:
-        case TokenKind::OpenBrace:
-        case TokenKind::ApostropheOpenBrace:
-        case TokenKind::AssignKeyword:
-        case TokenKind::DeassignKeyword:
-        case TokenKind::ForceKeyword:
-        case TokenKind::ReleaseKeyword:
-        case TokenKind::UniqueKeyword:
-        case TokenKind::Unique0Keyword:
-        case TokenKind::PriorityKeyword:
-        case TokenKind::CaseKeyword:
-        case TokenKind::CaseXKeyword:
-        case TokenKind::CaseZKeyword:
-        case TokenKind::IfKeyword:
-        case TokenKind::DoublePlus:
-        case TokenKind::DoubleMinus:
-        case TokenKind::VoidKeyword:
-        case TokenKind::TypeKeyword:
-        case TokenKind::DisableKeyword:
-        case TokenKind::MinusArrow:
-        case TokenKind::MinusDoubleArrow:
-        case TokenKind::ForeverKeyword:
-        case TokenKind::RepeatKeyword:
-        case TokenKind::WhileKeyword:
-        case TokenKind::ForKeyword:
-        case TokenKind::DoKeyword:
-        case TokenKind::ForeachKeyword:
-        case TokenKind::ReturnKeyword:
-        case TokenKind::BreakKeyword:
-        case TokenKind::ContinueKeyword:
-        case TokenKind::ForkKeyword:
-        case TokenKind::Hash:
-        case TokenKind::DoubleHash:
-        case TokenKind::At:
-        case TokenKind::BeginKeyword:
-        case TokenKind::WaitKeyword:
-        case TokenKind::WaitOrderKeyword:
-        case TokenKind::AssertKeyword:
-        case TokenKind::AssumeKeyword:
-        case TokenKind::CoverKeyword:
-        case TokenKind::RestrictKeyword:
-        case TokenKind::RandSequenceKeyword:
-        case TokenKind::RandCaseKeyword:
-        case TokenKind::ExpectKeyword:
-        case TokenKind::OpenParenthesisStar:
-        case TokenKind::Semicolon:
-            return true;
-        default:
-            return false;
-    }
+    return possibleStatementMap.contains(kind);
 }
 
 SyntaxKind SyntaxFacts::getIntegerType(TokenKind kind) {
@@ -547,24 +814,7 @@ parsing::TokenKind SyntaxFacts::getSkipToKind(TokenKind kind) {
 }
 
 bool SyntaxFacts::isNetType(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::Supply0Keyword:
-        case TokenKind::Supply1Keyword:
-        case TokenKind::TriKeyword:
-        case TokenKind::TriAndKeyword:
-        case TokenKind::TriOrKeyword:
-        case TokenKind::TriRegKeyword:
-        case TokenKind::Tri0Keyword:
-        case TokenKind::Tri1Keyword:
-        case TokenKind::UWireKeyword:
-        case TokenKind::WireKeyword:
-        case TokenKind::WAndKeyword:
-        case TokenKind::WOrKeyword:
-        case TokenKind::InterconnectKeyword:
-            return true;
-        default:
-            return false;
-    }
+    return netTypeMap.contains(kind);
 }
 
 bool SyntaxFacts::isPortDirection(TokenKind kind) {
@@ -580,44 +830,11 @@ bool SyntaxFacts::isPortDirection(TokenKind kind) {
 }
 
 bool SyntaxFacts::isPossibleArgument(TokenKind kind) {
-    // allow a comma here to handle cases like:  foo(, 3);
-    switch (kind) {
-        case TokenKind::Dot:
-        case TokenKind::Comma:
-        case TokenKind::FirstMatchKeyword:
-        case TokenKind::StrongKeyword:
-        case TokenKind::WeakKeyword:
-        case TokenKind::NotKeyword:
-        case TokenKind::IfKeyword:
-        case TokenKind::CaseKeyword:
-        case TokenKind::NextTimeKeyword:
-        case TokenKind::SNextTimeKeyword:
-        case TokenKind::AlwaysKeyword:
-        case TokenKind::SAlwaysKeyword:
-        case TokenKind::EventuallyKeyword:
-        case TokenKind::SEventuallyKeyword:
-        case TokenKind::AcceptOnKeyword:
-        case TokenKind::SyncAcceptOnKeyword:
-        case TokenKind::RejectOnKeyword:
-        case TokenKind::SyncRejectOnKeyword:
-        case TokenKind::EdgeKeyword:
-        case TokenKind::PosEdgeKeyword:
-        case TokenKind::NegEdgeKeyword:
-            return true;
-        default:
-            return isPossibleExpression(kind);
-    }
+    return possibleArgumentMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleParamAssignment(TokenKind kind) {
-    // allow a comma here to handle cases like:  foo #(, 3);
-    switch (kind) {
-        case TokenKind::Dot:
-        case TokenKind::Comma:
-            return true;
-        default:
-            return isPossibleExpression(kind);
-    }
+    return possibleParamAssignmentMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleNonAnsiPort(TokenKind kind) {
@@ -633,21 +850,7 @@ bool SyntaxFacts::isPossibleNonAnsiPort(TokenKind kind) {
 }
 
 bool SyntaxFacts::isPossibleAnsiPort(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::InterfaceKeyword:
-        case TokenKind::Identifier:
-        case TokenKind::Dot:
-        case TokenKind::Comma:
-        case TokenKind::InputKeyword:
-        case TokenKind::OutputKeyword:
-        case TokenKind::InOutKeyword:
-        case TokenKind::RefKeyword:
-        case TokenKind::VarKeyword:
-        case TokenKind::OpenParenthesisStar:
-            return true;
-        default:
-            return isNetType(kind) || isPossibleDataType(kind);
-    }
+    return possibleAnsiPortMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleUdpPort(TokenKind kind) {
@@ -682,20 +885,7 @@ bool SyntaxFacts::isPossibleModportPort(TokenKind kind) {
 }
 
 bool SyntaxFacts::isPossibleFunctionPort(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::Identifier:
-        case TokenKind::Comma:
-        case TokenKind::InputKeyword:
-        case TokenKind::OutputKeyword:
-        case TokenKind::InOutKeyword:
-        case TokenKind::RefKeyword:
-        case TokenKind::VarKeyword:
-        case TokenKind::ConstKeyword:
-        case TokenKind::OpenParenthesisStar:
-            return true;
-        default:
-            return isPossibleDataType(kind);
-    }
+    return possibleFunctionPortMap.contains(kind);
 }
 
 bool SyntaxFacts::isComma(TokenKind kind) {
@@ -719,48 +909,35 @@ bool SyntaxFacts::isNotIdOrComma(TokenKind kind) {
 }
 
 bool SyntaxFacts::isPossibleExpressionOrComma(TokenKind kind) {
-    return kind == TokenKind::Comma || isPossibleExpression(kind);
+    return possibleExpressionOrCommaMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleExpressionOrCommaOrDefault(TokenKind kind) {
-    return kind == TokenKind::Comma || kind == TokenKind::DefaultKeyword || isPossibleExpression(kind);
+    return possibleExpressionOrCommaOrDefaultMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleExpressionOrTripleAnd(TokenKind kind) {
-    return kind == TokenKind::TripleAnd || isPossibleExpression(kind);
+    return possibleExpressionOrTripleAndMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleExpressionOrEquals(TokenKind kind) {
-    return kind == TokenKind::Equals || isPossibleExpression(kind);
+    return possibleExpressionOrEqualsMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleForInitializer(TokenKind kind) {
-    return kind == TokenKind::Comma || kind == TokenKind::VarKeyword || isPossibleExpression(kind);
+    return possibleForInitializerMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleOpenRangeElement(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::OpenBracket:
-        case TokenKind::Comma:
-            return true;
-        default:
-            return isPossibleExpression(kind);
-    }
+    return possibleOpenRangeElementMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossiblePattern(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::Dot:
-        case TokenKind::DotStar:
-        case TokenKind::ApostropheOpenBrace:
-            return true;
-        default:
-            return isPossibleExpression(kind);
-    }
+    return possiblePatternMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossiblePatternOrComma(TokenKind kind) {
-    return kind == TokenKind::Comma || isPossiblePattern(kind);
+    return possiblePatternOrCommaMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleDelayOrEventControl(TokenKind kind) {
@@ -819,27 +996,11 @@ bool SyntaxFacts::isPossibleRsRule(TokenKind kind) {
 }
 
 bool SyntaxFacts::isPossibleParameter(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::ParameterKeyword:
-        case TokenKind::LocalParamKeyword:
-        case TokenKind::TypeKeyword:
-        case TokenKind::Comma:
-            return true;
-        default:
-            return isPossibleDataType(kind);
-    }
+    return possibleParameterMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossiblePortConnection(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::OpenParenthesisStar:
-        case TokenKind::DotStar:
-        case TokenKind::Dot:
-        case TokenKind::Comma:
-            return true;
-        default:
-            return isPossibleArgument(kind);
-    }
+    return possiblePortConnectionMap.contains(kind);
 }
 
 bool SyntaxFacts::isPossibleVectorDigit(TokenKind kind) {
@@ -855,33 +1016,7 @@ bool SyntaxFacts::isPossibleVectorDigit(TokenKind kind) {
 }
 
 bool SyntaxFacts::isEndKeyword(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::EndKeyword:
-        case TokenKind::EndCaseKeyword:
-        case TokenKind::EndCheckerKeyword:
-        case TokenKind::EndClassKeyword:
-        case TokenKind::EndClockingKeyword:
-        case TokenKind::EndConfigKeyword:
-        case TokenKind::EndFunctionKeyword:
-        case TokenKind::EndGenerateKeyword:
-        case TokenKind::EndGroupKeyword:
-        case TokenKind::EndInterfaceKeyword:
-        case TokenKind::EndModuleKeyword:
-        case TokenKind::EndPackageKeyword:
-        case TokenKind::EndPrimitiveKeyword:
-        case TokenKind::EndProgramKeyword:
-        case TokenKind::EndPropertyKeyword:
-        case TokenKind::EndSpecifyKeyword:
-        case TokenKind::EndSequenceKeyword:
-        case TokenKind::EndTableKeyword:
-        case TokenKind::EndTaskKeyword:
-        case TokenKind::JoinAnyKeyword:
-        case TokenKind::JoinKeyword:
-        case TokenKind::JoinNoneKeyword:
-            return true;
-        default:
-            return false;
-    }
+    return endKeywordMap.contains(kind);
 }
 
 bool SyntaxFacts::isOpenDelimOrKeyword(TokenKind kind) {
@@ -889,15 +1024,7 @@ bool SyntaxFacts::isOpenDelimOrKeyword(TokenKind kind) {
 }
 
 bool SyntaxFacts::isCloseDelimOrKeyword(TokenKind kind) {
-    switch (kind) {
-        case TokenKind::CloseBrace:
-        case TokenKind::CloseBracket:
-        case TokenKind::CloseParenthesis:
-        case TokenKind::StarCloseParenthesis:
-            return true;
-        default:
-            return isEndKeyword(kind);
-    }
+    return closeDelimOrKeywordMap.contains(kind);
 }
 
 bool SyntaxFacts::isMatchingDelims(TokenKind openKind, TokenKind closeKind) {
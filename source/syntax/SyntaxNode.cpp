@@ -10,31 +10,6 @@
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxPrinter.h"
 
-namespace {
-
-using namespace slang;
-using namespace slang::syntax;
-
-struct ConstGetChildVisitor {
-    template<typename T>
-    ConstTokenOrSyntax visit(const T& node, size_t index) {
-        return node.getChild(index);
-    }
-
-    ConstTokenOrSyntax visitInvalid(const SyntaxNode&, size_t) { return nullptr; }
-};
-
-struct GetChildVisitor {
-    template<typename T>
-    TokenOrSyntax visit(T& node, size_t index) {
-        return node.getChild(index);
-    }
-
-    TokenOrSyntax visitInvalid(SyntaxNode&, size_t) { return nullptr; }
-};
-
-} // namespace
-
 namespace slang::syntax {
 
 std::string SyntaxNode::toString() const {
@@ -81,16 +56,6 @@ SourceRange SyntaxNode::sourceRange() const {
     return SourceRange(firstToken.location(), lastToken.location() + lastToken.rawText().length());
 }
 
-ConstTokenOrSyntax SyntaxNode::getChild(size_t index) const {
-    ConstGetChildVisitor visitor;
-    return visit(visitor, index);
-}
-
-TokenOrSyntax SyntaxNode::getChild(size_t index) {
-    GetChildVisitor visitor;
-    return visit(visitor, index);
-}
-
 const SyntaxNode* SyntaxNode::childNode(size_t index) const {
     auto child = getChild(index);
     if (child.isToken())
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #include "slang/syntax/SyntaxPrinter.h"
 
+#include <cstring>
+
 #include "slang/parsing/Parser.h"
 #include "slang/syntax/SyntaxTree.h"
 #include "slang/text/SourceManager.h"
@@ -15,6 +17,42 @@ namespace slang::syntax {
 
 using namespace parsing;
 
+void SyntaxRope::append(std::string_view text) {
+    if (text.empty())
+        return;
+
+    totalLength += text.size();
+
+    // Tokens lexed from the same buffer reference contiguous memory, so
+    // most appends just extend the previous piece in place.
+    if (!pieceList.empty()) {
+        auto& last = pieceList.back();
+        if (last.data() + last.size() == text.data()) {
+            last = std::string_view(last.data(), last.size() + text.size());
+            return;
+        }
+    }
+
+    pieceList.push_back(text);
+}
+
+void SyntaxRope::appendCopy(std::string_view text) {
+    if (text.empty())
+        return;
+
+    auto mem = (char*)alloc.allocate(text.size(), 1);
+    memcpy(mem, text.data(), text.size());
+    append(std::string_view(mem, text.size()));
+}
+
+std::string SyntaxRope::str() const {
+    std::string result;
+    result.reserve(totalLength);
+    for (auto piece : pieceList)
+        result.append(piece);
+    return result;
+}
+
 SyntaxPrinter::SyntaxPrinter(const SourceManager& sourceManager) : sourceManager(&sourceManager) {
 }
 
@@ -44,7 +82,7 @@ SyntaxPrinter& SyntaxPrinter::print(Trivia trivia) {
                 break;
             [[fallthrough]];
         default:
-            append(trivia.getRawText());
+            append(trivia.getRawText(), zeroCopySources);
             break;
     }
     return *this;
@@ -84,8 +122,22 @@ SyntaxPrinter& SyntaxPrinter::print(Token token) {
         }
     }
 
-    if (!excluded && (includeMissing || !token.isMissing()))
-        append(token.rawText());
+    if (!excluded && (includeMissing || !token.isMissing())) {
+        auto raw = token.rawText();
+        if (zeroCopySources && sourceManager && !raw.empty() && token.location().valid()) {
+            // Tokens with fixed text (keywords, punctuation) carry a canonical
+            // string from static storage rather than a view into their source
+            // buffer. Remap them onto the buffer when the bytes match so that
+            // unmodified regions coalesce into single pieces.
+            auto loc = token.location();
+            auto source = sourceManager->getSourceText(loc.buffer());
+            if (loc.offset() + raw.size() <= source.size() &&
+                source.compare(loc.offset(), raw.size(), raw) == 0) {
+                raw = source.substr(loc.offset(), raw.size());
+            }
+        }
+        append(raw, zeroCopySources);
+    }
 
     return *this;
 }
@@ -109,19 +161,29 @@ SyntaxPrinter& SyntaxPrinter::print(const SyntaxTree& tree) {
 }
 
 std::string SyntaxPrinter::printFile(const SyntaxTree& tree) {
+    // The tree outlives the printer here, so referencing its text in
+    // place is safe; the output is copied only once, in str().
     return SyntaxPrinter(tree.sourceManager())
         .setIncludeDirectives(true)
         .setIncludeSkipped(true)
         .setIncludeTrivia(true)
         .setIncludePreprocessed(false)
         .setSquashNewlines(false)
+        .setZeroCopySources(true)
         .print(tree)
         .str();
 }
 
-SyntaxPrinter& SyntaxPrinter::append(std::string_view text) {
+SyntaxPrinter& SyntaxPrinter::append(std::string_view text, bool stable) {
+    auto push = [&](std::string_view piece) {
+        if (stable)
+            buffer.append(piece);
+        else
+            buffer.appendCopy(piece);
+    };
+
     if (!squashNewlines) {
-        buffer.append(text);
+        push(text);
         return *this;
     }
 
@@ -140,22 +202,23 @@ SyntaxPrinter& SyntaxPrinter::append(std::string_view text) {
             i++;
         }
 
-        for (; i < text.length(); i++) {
-            if (text[i] == '\r' || text[i] == '\n')
-                i++;
-        }
+        // Skip the rest of the leading newline run; anything after it
+        // (such as the remainder of a collapsed trivia piece) is kept.
+        while (i < text.length() && (text[i] == '\r' || text[i] == '\n'))
+            i++;
 
         text = text.substr(i);
     }
 
     if (buffer.empty() || buffer.back() != '\n') {
+        // String literals have static storage, so these can always go in by reference.
         if (carriage)
-            buffer.push_back('\r');
+            buffer.append("\r"sv);
         if (newline)
-            buffer.push_back('\n');
+            buffer.append("\n"sv);
     }
 
-    buffer.append(text);
+    push(text);
     return *this;
 }
 
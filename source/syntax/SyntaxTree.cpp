@@ -9,6 +9,9 @@
 
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
+#include "slang/parsing/TokenPipeline.h"
+#include "slang/syntax/SyntaxCache.h"
+#include "slang/syntax/SyntaxVisitor.h"
 #include "slang/text/SourceManager.h"
 #include "slang/util/TimeTrace.h"
 
@@ -36,7 +39,20 @@ std::shared_ptr<SyntaxTree> SyntaxTree::fromFile(std::string_view path,
     SourceBuffer buffer = sourceManager.readSource(path);
     if (!buffer)
         return nullptr;
-    return create(sourceManager, std::span(&buffer, 1), options, {}, false);
+
+    // If the caller provided a syntax cache, see whether we've already parsed
+    // identical source text with identical options and can skip the reparse.
+    auto cache = options.getOrDefault<std::shared_ptr<SyntaxCache>>();
+    if (cache) {
+        if (auto cached = cache->find(buffer, options))
+            return cached;
+    }
+
+    auto tree = create(sourceManager, std::span(&buffer, 1), options, {}, false);
+    if (cache && tree)
+        cache->insert(buffer, options, tree);
+
+    return tree;
 }
 
 std::shared_ptr<SyntaxTree> SyntaxTree::fromFiles(std::span<const std::string_view> paths) {
@@ -104,6 +120,191 @@ std::shared_ptr<SyntaxTree> SyntaxTree::fromBuffers(std::span<const SourceBuffer
     return create(sourceManager, buffers, options, inheritedMacros, false);
 }
 
+std::shared_ptr<SyntaxTree> SyntaxTree::fromEdit(const std::shared_ptr<SyntaxTree>& oldTree,
+                                                 std::string_view newText, std::string_view name) {
+    ASSERT(oldTree);
+    auto& sourceManager = oldTree->sourceMan;
+
+    SourceBuffer buffer = sourceManager.assignText("", newText);
+    if (!buffer)
+        return nullptr;
+
+    // If the caller didn't name the new buffer, inherit the old buffer's name.
+    if (name.empty() && oldTree->root().kind == SyntaxKind::CompilationUnit) {
+        if (Token oldEof = oldTree->root().as<CompilationUnitSyntax>().endOfFile)
+            name = sourceManager.getRawFileName(oldEof.location().buffer());
+    }
+
+    if (!name.empty())
+        sourceManager.addLineDirective(SourceLocation(buffer.id, 0), 2, name, 0);
+
+    return fromEdit(oldTree, buffer);
+}
+
+std::shared_ptr<SyntaxTree> SyntaxTree::fromEdit(const std::shared_ptr<SyntaxTree>& oldTree,
+                                                 const SourceBuffer& newBuffer) {
+    ASSERT(oldTree);
+    auto& sourceManager = oldTree->sourceMan;
+    const Bag& options = oldTree->options_;
+
+    auto fullReparse = [&]() -> std::shared_ptr<SyntaxTree> {
+        return fromBuffer(newBuffer, sourceManager, options);
+    };
+
+    if (oldTree->root().kind != SyntaxKind::CompilationUnit)
+        return fullReparse();
+
+    auto& oldUnit = oldTree->root().as<CompilationUnitSyntax>();
+    Token oldEof = oldUnit.endOfFile;
+    if (!oldEof)
+        return fullReparse();
+
+    BufferID oldBuffer = oldEof.location().buffer();
+    std::string_view oldText = sourceManager.getSourceText(oldBuffer);
+    if (!oldText.empty() && oldText.back() == '\0')
+        oldText = oldText.substr(0, oldText.size() - 1);
+
+    std::string_view newText = newBuffer.data;
+    if (!newText.empty() && newText.back() == '\0')
+        newText = newText.substr(0, newText.size() - 1);
+
+    size_t maxPrefix = std::min(oldText.size(), newText.size());
+    size_t prefixLen = 0;
+    while (prefixLen < maxPrefix && oldText[prefixLen] == newText[prefixLen])
+        prefixLen++;
+
+    // Collect the run of leading members that end before the first changed
+    // character. Members that came from macro expansions or included files
+    // can't be reasoned about positionally, so reuse stops there too.
+    SmallVector<MemberSyntax*> members;
+    size_t cutOffset = 0;
+    for (auto member : oldUnit.members) {
+        Token first = member->getFirstToken();
+        Token last = member->getLastToken();
+        if (!first || !last || first.location().buffer() != oldBuffer ||
+            last.location().buffer() != oldBuffer) {
+            break;
+        }
+
+        size_t endOffset = last.location().offset() + last.rawText().size();
+        if (endOffset >= prefixLen)
+            break;
+
+        members.push_back(member);
+        cutOffset = endOffset;
+    }
+
+    if (members.empty())
+        return fullReparse();
+
+    // Preprocessor state established in the reused region (macro definitions,
+    // default nettype, keyword version, ...) would need to be replayed for the
+    // reparse to be correct, so give up if any directives might be present.
+    if (oldText.substr(0, cutOffset).find('`') != std::string_view::npos)
+        return fullReparse();
+
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+
+    // Diagnostics attached to the reused members have to move with them;
+    // consumers only look at the newest tree's diagnostics, never the parent
+    // tree's. With no directives ahead of the cut, every reused-region
+    // diagnostic is located in the old buffer before the cut offset, and
+    // anything at or past it gets regenerated by the reparse below.
+    for (auto& diag : oldTree->diagnosticsBuffer) {
+        if (diag.location.buffer() == oldBuffer && diag.location.offset() < cutOffset)
+            diagnostics.push_back(diag);
+    }
+
+    Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
+    preprocessor.pushSource(newBuffer, cutOffset);
+
+    Parser parser(preprocessor, options);
+    auto& newUnit = parser.parseCompilationUnit();
+    for (auto member : newUnit.members)
+        members.push_back(member);
+
+    auto root = alloc.emplace<CompilationUnitSyntax>(SyntaxList<MemberSyntax>(members.copy(alloc)),
+                                                     newUnit.endOfFile);
+
+    auto result = std::shared_ptr<SyntaxTree>(
+        new SyntaxTree(root, sourceManager, std::move(alloc), std::move(diagnostics),
+                       ParserMetadata::fromSyntax(*root), preprocessor.getDefinedMacros(),
+                       options));
+    result->parentTree = oldTree;
+    return result;
+}
+
+bool SyntaxTree::isModuleBodyDeferred(const ModuleDeclarationSyntax& syntax) const {
+    return metadata->deferredBodies.find(&syntax) != metadata->deferredBodies.end();
+}
+
+void SyntaxTree::expandDeferredBody(const ModuleDeclarationSyntax& syntax) {
+    auto it = metadata->deferredBodies.find(&syntax);
+    if (it == metadata->deferredBodies.end())
+        return;
+
+    auto tokens = it->second;
+    metadata->deferredBodies.erase(it);
+
+    Preprocessor preprocessor(sourceMan, alloc, diagnosticsBuffer, options_);
+    Parser parser(preprocessor, options_);
+    auto members = parser.parseDeferredMembers(tokens, syntax.kind);
+
+    // This tree owns the node, so patch the member list in place the same
+    // way the generated constructor would have wired it up.
+    auto& node = const_cast<ModuleDeclarationSyntax&>(syntax);
+    node.members = SyntaxList<MemberSyntax>(members);
+    node.members.parent = &node;
+    for (auto child : node.members)
+        child->parent = &node;
+
+    // Merge metadata discovered while parsing the body. The defparam and
+    // bind flags were already set during token capture, and the body can't
+    // contain further deferred declarations since it isn't at unit scope.
+    auto bodyMeta = parser.getMetadata();
+    for (auto& [n, info] : bodyMeta.nodeMap)
+        metadata->nodeMap[n] = info;
+    for (auto name : bodyMeta.globalInstances)
+        metadata->globalInstances.emplace(name);
+
+    auto appendTo = [](auto& dest, const auto& src) {
+        dest.insert(dest.end(), src.begin(), src.end());
+    };
+    appendTo(metadata->classPackageNames, bodyMeta.classPackageNames);
+    appendTo(metadata->packageImports, bodyMeta.packageImports);
+    appendTo(metadata->classDecls, bodyMeta.classDecls);
+}
+
+bool SyntaxTree::hasDeferredBodies() const {
+    return !metadata->deferredBodies.empty();
+}
+
+void SyntaxTree::expandAllDeferredBodies() {
+    while (!metadata->deferredBodies.empty())
+        expandDeferredBody(metadata->deferredBodies.begin()->first->as<ModuleDeclarationSyntax>());
+}
+
+namespace {
+
+class ContentHasher : public SyntaxVisitor<ContentHasher> {
+public:
+    size_t hash = 0;
+
+    void visitToken(parsing::Token token) { hash_combine(hash, token.kind, token.rawText()); }
+};
+
+} // namespace
+
+uint64_t SyntaxTree::getContentHash() const {
+    if (!contentHash) {
+        ContentHasher hasher;
+        rootNode->visit(hasher);
+        contentHash = hasher.hash;
+    }
+    return *contentHash;
+}
+
 SourceManager& SyntaxTree::getDefaultSourceManager() {
     static SourceManager instance;
     return instance;
@@ -129,6 +330,38 @@ std::shared_ptr<SyntaxTree> SyntaxTree::create(SourceManager& sourceManager,
             return "<multi-buffer>"s;
     });
 
+    // In guess mode the stream may need to be re-parsed from the top, so
+    // running the preprocessor ahead of the parser doesn't apply there.
+    if (options.getOrDefault<ParserOptions>().pipelinedPreprocessing && !guess) {
+        // The preprocessor runs on a worker thread, so it gets its own arena
+        // and diagnostics; both get merged into the parser's at the end.
+        BumpAllocator ppAlloc;
+        Diagnostics ppDiagnostics;
+        Preprocessor preprocessor(sourceManager, ppAlloc, ppDiagnostics, options, inheritedMacros);
+
+        for (auto it = sources.rbegin(); it != sources.rend(); it++)
+            preprocessor.pushSource(*it);
+
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        TokenPipeline pipeline(preprocessor, alloc, diagnostics);
+        Parser parser(pipeline, options);
+
+        pipeline.start();
+        auto root = &parser.parseCompilationUnit();
+        pipeline.finish();
+
+        alloc.steal(std::move(ppAlloc));
+
+        Diagnostics merged = std::move(ppDiagnostics);
+        merged.append(diagnostics);
+
+        return std::shared_ptr<SyntaxTree>(new SyntaxTree(root, sourceManager, std::move(alloc),
+                                                          std::move(merged), parser.getMetadata(),
+                                                          preprocessor.getDefinedMacros(),
+                                                          options));
+    }
+
     BumpAllocator alloc;
     Diagnostics diagnostics;
     Preprocessor preprocessor(sourceManager, alloc, diagnostics, options, inheritedMacros);
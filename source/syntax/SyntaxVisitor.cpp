@@ -13,12 +13,43 @@ using namespace slang;
 using namespace slang::syntax;
 using namespace slang::syntax::detail;
 
+// Collects every node that needs to be cloned in order to apply the requested
+// set of changes: each changed node's ancestor chain, walked bottom-up. Any
+// subtree that contains no changes can be shared with the original tree, so a
+// batch of N edits clones each ancestor at most once instead of rebuilding
+// the entire tree.
+flat_hash_set<const SyntaxNode*> findDirtyNodes(const ChangeCollection& commits) {
+    flat_hash_set<const SyntaxNode*> dirty;
+    auto markAncestors = [&dirty](const SyntaxNode* node) {
+        while (node && dirty.insert(node).second)
+            node = node->parent;
+    };
+
+    // Inserts and removals / replacements are applied while visiting the
+    // parent of the target node, so the chain starts there. List insertions
+    // are applied while visiting the list node itself.
+    for (auto& [key, _] : commits.insertBefore)
+        markAncestors(key->parent);
+    for (auto& [key, _] : commits.insertAfter)
+        markAncestors(key->parent);
+    for (auto& [key, _] : commits.removeOrReplace)
+        markAncestors(key->parent);
+    for (auto& [key, _] : commits.listInsertAtFront)
+        markAncestors(key);
+    for (auto& [key, _] : commits.listInsertAtBack)
+        markAncestors(key);
+
+    return dirty;
+}
+
 struct CloneVisitor {
     BumpAllocator& alloc;
     const ChangeCollection& commits;
+    const flat_hash_set<const SyntaxNode*>& dirtyNodes;
 
-    CloneVisitor(BumpAllocator& alloc, const ChangeCollection& commits) :
-        alloc(alloc), commits(commits) {}
+    CloneVisitor(BumpAllocator& alloc, const ChangeCollection& commits,
+                 const flat_hash_set<const SyntaxNode*>& dirtyNodes) :
+        alloc(alloc), commits(commits), dirtyNodes(dirtyNodes) {}
 
 #ifdef _MSC_VER
 #    pragma warning(push)
@@ -82,12 +113,15 @@ struct CloneVisitor {
                 }
             }
             else {
-                if constexpr (IsList) {
-                    listBuffer.push_back(child->visit(*this));
-                }
-                else {
-                    cloned->setChild(i, child->visit(*this));
-                }
+                // Subtrees with no changes in them are shared with the
+                // original tree rather than cloned; the new tree keeps the
+                // old one alive so the nodes remain valid.
+                SyntaxNode* newChild = dirtyNodes.count(child) ? child->visit(*this)
+                                                               : const_cast<SyntaxNode*>(child);
+                if constexpr (IsList)
+                    listBuffer.push_back(newChild);
+                else
+                    cloned->setChild(i, newChild);
             }
 
             if (auto it = commits.insertAfter.find(child); it != commits.insertAfter.end()) {
@@ -132,7 +166,8 @@ std::shared_ptr<SyntaxTree> transformTree(
     BumpAllocator&& alloc, const std::shared_ptr<SyntaxTree>& tree, const ChangeCollection& commits,
     const std::vector<std::shared_ptr<SyntaxTree>>& tempTrees) {
 
-    CloneVisitor visitor(alloc, commits);
+    auto dirtyNodes = findDirtyNodes(commits);
+    CloneVisitor visitor(alloc, commits, dirtyNodes);
     SyntaxNode* root = tree->root().visit(visitor);
 
     // Steal ownership of any temporary syntax trees that the user created; once we return the
@@ -8,7 +8,6 @@
 #include "slang/text/Json.h"
 
 #include "FormatBuffer.h"
-#include <climits>
 
 #include "slang/util/SmallVector.h"
 #include "slang/util/String.h"
@@ -77,12 +76,20 @@ void JsonWriter::writeValue(std::string_view value) {
 }
 
 void JsonWriter::writeValue(int64_t value) {
-    buffer->format("{}", value);
+    SmallVector<char, 24> vec;
+    if (value < 0)
+        vec.push_back('-');
+
+    // Two's complement negation handles INT64_MIN correctly.
+    uintToStr(vec, value < 0 ? ~uint64_t(value) + 1 : uint64_t(value));
+    buffer->append(toStringView(vec));
     endValue();
 }
 
 void JsonWriter::writeValue(uint64_t value) {
-    buffer->format("{}", value);
+    SmallVector<char, 24> vec;
+    uintToStr(vec, value);
+    buffer->append(toStringView(vec));
     endValue();
 }
 
@@ -96,62 +103,59 @@ void JsonWriter::writeValue(bool value) {
     endValue();
 }
 
+void JsonWriter::writePreformatted(std::string_view json) {
+    buffer->append(json);
+    endValue();
+}
+
 void JsonWriter::writeQuoted(std::string_view str) {
-    SmallVector<char> vec(str.size() + 2, UninitializedTag());
-    vec.push_back('"');
-    for (char c : str) {
+    buffer->append("\"");
+
+    // Copy runs of characters that don't need escaping straight through in
+    // one shot; most strings have nothing to escape at all.
+    size_t start = 0;
+    for (size_t i = 0; i < str.size(); i++) {
+        char c = str[i];
+        if (c != '"' && c != '\\' && (unsigned char)c > 0x1f)
+            continue;
+
+        buffer->append(str.substr(start, i - start));
+        start = i + 1;
+
         switch (c) {
             case '"':
-                vec.push_back('\\');
-                vec.push_back('"');
+                buffer->append("\\\"");
                 break;
             case '\\':
-                vec.push_back('\\');
-                vec.push_back('\\');
+                buffer->append("\\\\");
                 break;
             case '\b':
-                vec.push_back('\\');
-                vec.push_back('b');
+                buffer->append("\\b");
                 break;
             case '\f':
-                vec.push_back('\\');
-                vec.push_back('f');
+                buffer->append("\\f");
                 break;
             case '\n':
-                vec.push_back('\\');
-                vec.push_back('n');
+                buffer->append("\\n");
                 break;
             case '\r':
-                vec.push_back('\\');
-                vec.push_back('r');
+                buffer->append("\\r");
                 break;
             case '\t':
-                vec.push_back('\\');
-                vec.push_back('t');
+                buffer->append("\\t");
                 break;
-            default:
-#if CHAR_MIN < 0
-                if (c >= 0x00 and c <= 0x1f) {
-#else
-                if (c <= 0x1f) {
-#endif
-                    // print character c as \uxxxx
-                    char buf[5];
-                    snprintf(buf, sizeof(buf), "%04x", int(c));
-                    vec.push_back('\\');
-                    vec.push_back('u');
-                    vec.append(buf, buf + 4);
-                }
-                else {
-                    // all other characters are added as-is
-                    vec.push_back(c);
-                }
+            default: {
+                // print character c as \uxxxx
+                char buf[7];
+                snprintf(buf, sizeof(buf), "\\u%04x", int(c));
+                buffer->append(std::string_view(buf, 6));
                 break;
+            }
         }
     }
 
-    vec.push_back('"');
-    buffer->append(toStringView(vec));
+    buffer->append(str.substr(start));
+    buffer->append("\"");
 }
 
 void JsonWriter::endValue() {
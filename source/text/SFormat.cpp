@@ -30,25 +30,33 @@ static std::optional<uint32_t> parseUInt(const char*& ptr, const char* end) {
 bool parse(std::string_view str, function_ref<void(std::string_view)> onText,
            function_ref<void(char, size_t, size_t, const FormatOptions&)> onArg,
            function_ref<void(DiagCode, size_t, size_t, std::optional<char>)> onError) {
-    SmallVector<char> text;
     const char* ptr = str.data();
     const char* end = str.data() + str.length();
 
+    // Literal text is passed through as slices of the input string instead of
+    // being copied into a scratch buffer; runStart tracks the beginning of the
+    // current unflushed run.
+    const char* runStart = ptr;
+    auto flushText = [&](const char* runEnd) {
+        if (runEnd != runStart)
+            onText(std::string_view(runStart, size_t(runEnd - runStart)));
+    };
+
     auto err = [&](DiagCode code, const char* curr, std::optional<char> spec = {}) {
         onError(code, size_t(curr - str.data()), size_t(ptr - curr), spec);
     };
 
     while (ptr != end) {
         const char* start = ptr;
-        if (char c = *ptr++; c != '%') {
-            text.push_back(c);
+        if (*ptr++ != '%')
             continue;
-        }
 
-        // %% collapses to a single %
+        // %% collapses to a single %; emit the run up to and including the
+        // first percent and resume after the second.
         if (ptr != end && *ptr == '%') {
+            flushText(ptr);
             ptr++;
-            text.push_back('%');
+            runStart = ptr;
             continue;
         }
 
@@ -91,8 +99,11 @@ bool parse(std::string_view str, function_ref<void(std::string_view)> onText,
         }
 
         if (ptr == end) {
+            // Emit the run up to and including the percent; any flag or width
+            // characters that followed it are dropped, as before.
             err(diag::MissingFormatSpecifier, start);
-            text.push_back('%');
+            flushText(start + 1);
+            runStart = end;
             break;
         }
 
@@ -152,17 +163,13 @@ bool parse(std::string_view str, function_ref<void(std::string_view)> onText,
             return false;
         }
 
-        if (!text.empty()) {
-            onText(toStringView(text));
-            text.clear();
-        }
+        flushText(start);
+        runStart = ptr;
 
         onArg(c, size_t(start - str.data()), size_t(ptr - start), options);
     }
 
-    if (!text.empty())
-        onText(toStringView(text));
-
+    flushText(end);
     return true;
 }
 
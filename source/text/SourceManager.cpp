@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include "slang/text/SourceManager.h"
 
+#include <cstring>
 #include <string>
 
 #include "slang/util/OS.h"
@@ -21,8 +22,12 @@ static const fs::path emptyPath;
 
 SourceManager::SourceManager() {
     // add a dummy entry to the start of the directory list so that our file IDs line up
-    FileInfo file;
-    bufferEntries.emplace_back(file);
+    appendBufferEntry(FileInfo());
+}
+
+SourceManager::~SourceManager() {
+    for (auto& seg : bufferSegments)
+        delete[] seg.load(std::memory_order_relaxed);
 }
 
 std::string SourceManager::makeAbsolutePath(std::string_view path) const {
@@ -63,10 +68,10 @@ size_t SourceManager::getColumnNumber(SourceLocation location) const {
         return 0;
 
     // walk backward to find start of line
-    auto fd = info->data;
+    auto text = info->data->text();
     size_t lineStart = location.offset();
-    ASSERT(lineStart < fd->mem.size());
-    while (lineStart > 0 && fd->mem[lineStart - 1] != '\n' && fd->mem[lineStart - 1] != '\r')
+    ASSERT(lineStart < text.size());
+    while (lineStart > 0 && text[lineStart - 1] != '\n' && text[lineStart - 1] != '\r')
         lineStart--;
 
     return location.offset() - lineStart + 1;
@@ -133,10 +138,10 @@ std::string_view SourceManager::getMacroName(SourceLocation location) const {
     if (!buffer)
         return {};
 
-    std::shared_lock lock(mut);
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
 
-    ASSERT(buffer.getId() < bufferEntries.size());
-    auto info = std::get_if<ExpansionInfo>(&bufferEntries[buffer.getId()]);
+    auto info = std::get_if<ExpansionInfo>(entry);
     if (!info)
         return {};
 
@@ -158,10 +163,9 @@ bool SourceManager::isMacroLoc(SourceLocation location) const {
     if (!buffer)
         return false;
 
-    std::shared_lock lock(mut);
-
-    ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get_if<ExpansionInfo>(&bufferEntries[buffer.getId()]) != nullptr;
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
+    return std::get_if<ExpansionInfo>(entry) != nullptr;
 }
 
 bool SourceManager::isMacroArgLoc(SourceLocation location) const {
@@ -172,10 +176,10 @@ bool SourceManager::isMacroArgLoc(SourceLocation location) const {
     if (!buffer)
         return false;
 
-    std::shared_lock lock(mut);
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
 
-    ASSERT(buffer.getId() < bufferEntries.size());
-    auto info = std::get_if<ExpansionInfo>(&bufferEntries[buffer.getId()]);
+    auto info = std::get_if<ExpansionInfo>(entry);
     return info && info->isMacroArg;
 }
 
@@ -230,10 +234,9 @@ SourceLocation SourceManager::getExpansionLoc(SourceLocation location) const {
     if (!buffer)
         return SourceLocation();
 
-    std::shared_lock lock(mut);
-
-    ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get<ExpansionInfo>(bufferEntries[buffer.getId()]).expansionRange.start();
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
+    return std::get<ExpansionInfo>(*entry).expansionRange.start();
 }
 
 SourceRange SourceManager::getExpansionRange(SourceLocation location) const {
@@ -241,11 +244,9 @@ SourceRange SourceManager::getExpansionRange(SourceLocation location) const {
     if (!buffer)
         return SourceRange();
 
-    std::shared_lock lock(mut);
-
-    ASSERT(buffer.getId() < bufferEntries.size());
-    const ExpansionInfo& info = std::get<ExpansionInfo>(bufferEntries[buffer.getId()]);
-    return info.expansionRange;
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
+    return std::get<ExpansionInfo>(*entry).expansionRange;
 }
 
 SourceLocation SourceManager::getOriginalLoc(SourceLocation location) const {
@@ -253,10 +254,9 @@ SourceLocation SourceManager::getOriginalLoc(SourceLocation location) const {
     if (!buffer)
         return SourceLocation();
 
-    std::shared_lock lock(mut);
-
-    ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get<ExpansionInfo>(bufferEntries[buffer.getId()]).originalLoc + location.offset();
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
+    return std::get<ExpansionInfo>(*entry).originalLoc + location.offset();
 }
 
 SourceLocation SourceManager::getFullyOriginalLoc(SourceLocation location) const {
@@ -266,12 +266,45 @@ SourceLocation SourceManager::getFullyOriginalLoc(SourceLocation location) const
 }
 
 SourceLocation SourceManager::getFullyExpandedLoc(SourceLocation location) const {
-    while (isMacroLoc(location)) {
-        if (isMacroArgLoc(location))
-            location = getOriginalLoc(location);
-        else
-            location = getExpansionLoc(location);
+    // Diagnostic rendering hits this for every location it prints, and deeply
+    // nested macro expansions would otherwise be re-walked link by link each
+    // time. Walk the whole chain under one lock and remember the answer for
+    // every non-argument expansion buffer we pass through; from such a buffer
+    // the result doesn't depend on the queried offset, so all of them resolve
+    // to the same final location.
+    SmallVector<uint32_t, 8> visited;
+    {
+        std::shared_lock lock(mut);
+        while (location.buffer()) {
+            auto id = location.buffer().getId();
+            auto entry = getBufferEntry(location.buffer());
+            ASSERT(entry);
+
+            auto info = std::get_if<ExpansionInfo>(entry);
+            if (!info)
+                break;
+
+            if (info->isMacroArg) {
+                location = info->originalLoc + location.offset();
+            }
+            else {
+                if (auto it = expandedLocCache.find(id); it != expandedLocCache.end()) {
+                    location = it->second;
+                    break;
+                }
+
+                visited.push_back(id);
+                location = info->expansionRange.start();
+            }
+        }
+    }
+
+    if (!visited.empty()) {
+        std::unique_lock lock(mut);
+        for (auto id : visited)
+            expandedLocCache.emplace(id, location);
     }
+
     return location;
 }
 
@@ -281,25 +314,20 @@ std::string_view SourceManager::getSourceText(BufferID buffer) const {
         return "";
 
     // LOCKING: not required here, data is immutable after creation
-    auto fd = info->data;
-    return std::string_view(fd->mem.data(), fd->mem.size());
+    return info->data->text();
 }
 
 SourceLocation SourceManager::createExpansionLoc(SourceLocation originalLoc,
                                                  SourceRange expansionRange, bool isMacroArg) {
-    std::unique_lock lock(mut);
-
-    bufferEntries.emplace_back(ExpansionInfo(originalLoc, expansionRange, isMacroArg));
-    return SourceLocation(BufferID((uint32_t)(bufferEntries.size() - 1), ""sv), 0);
+    auto index = appendBufferEntry(ExpansionInfo(originalLoc, expansionRange, isMacroArg));
+    return SourceLocation(BufferID((uint32_t)index, ""sv), 0);
 }
 
 SourceLocation SourceManager::createExpansionLoc(SourceLocation originalLoc,
                                                  SourceRange expansionRange,
                                                  std::string_view macroName) {
-    std::unique_lock lock(mut);
-
-    bufferEntries.emplace_back(ExpansionInfo(originalLoc, expansionRange, macroName));
-    return SourceLocation(BufferID((uint32_t)(bufferEntries.size() - 1), macroName), 0);
+    auto index = appendBufferEntry(ExpansionInfo(originalLoc, expansionRange, macroName));
+    return SourceLocation(BufferID((uint32_t)index, macroName), 0);
 }
 
 SourceBuffer SourceManager::assignText(std::string_view text, SourceLocation includedFrom) {
@@ -444,71 +472,150 @@ std::span<const SourceManager::DiagnosticDirectiveInfo> SourceManager::getDiagno
 }
 
 std::vector<BufferID> SourceManager::getAllBuffers() const {
-    std::shared_lock lock(mut);
     std::vector<BufferID> result;
-    for (size_t i = 1; i < bufferEntries.size(); i++)
+    size_t count = bufferCount.load(std::memory_order_acquire);
+    for (size_t i = 1; i < count; i++)
         result.push_back(BufferID((uint32_t)i, ""sv));
 
     return result;
 }
 
+const SourceManager::BufferEntry* SourceManager::getBufferEntry(BufferID buffer) const {
+    size_t id = buffer.getId();
+    if (id >= bufferCount.load(std::memory_order_acquire))
+        return nullptr;
+
+    // The acquire load above pairs with the release store in appendBufferEntry,
+    // so both the segment pointer and the entry itself are visible by now.
+    size_t adjusted = id + (size_t(1) << BufferSegmentBase);
+    size_t seg = std::bit_width(adjusted) - 1;
+    auto segPtr = bufferSegments[seg - BufferSegmentBase].load(std::memory_order_relaxed);
+    return &segPtr[adjusted - (size_t(1) << seg)];
+}
+
+SourceManager::BufferEntry* SourceManager::getBufferEntry(BufferID buffer) {
+    return const_cast<BufferEntry*>(std::as_const(*this).getBufferEntry(buffer));
+}
+
+size_t SourceManager::appendBufferEntry(BufferEntry&& entry) {
+    std::scoped_lock lock(bufferMutex);
+
+    size_t index = bufferCount.load(std::memory_order_relaxed);
+    size_t adjusted = index + (size_t(1) << BufferSegmentBase);
+    size_t seg = std::bit_width(adjusted) - 1;
+    size_t segSize = size_t(1) << seg;
+
+    auto segPtr = bufferSegments[seg - BufferSegmentBase].load(std::memory_order_relaxed);
+    if (!segPtr) {
+        segPtr = new BufferEntry[segSize];
+        bufferSegments[seg - BufferSegmentBase].store(segPtr, std::memory_order_relaxed);
+    }
+
+    segPtr[adjusted - segSize] = std::move(entry);
+
+    // Publish the entry; this pairs with the acquire load in getBufferEntry.
+    bufferCount.store(index + 1, std::memory_order_release);
+    return index;
+}
+
 SourceManager::FileInfo* SourceManager::getFileInfo(BufferID buffer) {
     if (!buffer)
         return nullptr;
 
-    std::shared_lock lock(mut);
-    ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get_if<FileInfo>(&bufferEntries[buffer.getId()]);
+    auto entry = getBufferEntry(buffer);
+    ASSERT(entry);
+    return std::get_if<FileInfo>(entry);
 }
 
 const SourceManager::FileInfo* SourceManager::getFileInfo(BufferID buffer) const {
     if (!buffer)
         return nullptr;
 
-    std::shared_lock lock(mut);
-    if (buffer.getId() >= bufferEntries.size())
+    auto entry = getBufferEntry(buffer);
+    if (!entry)
         return nullptr;
 
-    return std::get_if<FileInfo>(&bufferEntries[buffer.getId()]);
+    return std::get_if<FileInfo>(entry);
 }
 
-SourceBuffer SourceManager::createBufferEntry(FileData* fd, SourceLocation includedFrom,
-                                              std::unique_lock<std::shared_mutex>&) {
+SourceBuffer SourceManager::createBufferEntry(FileData* fd, SourceLocation includedFrom) {
     ASSERT(fd);
-    bufferEntries.emplace_back(FileInfo(fd, includedFrom));
-    return SourceBuffer{std::string_view(fd->mem.data(), fd->mem.size()),
-                        BufferID((uint32_t)(bufferEntries.size() - 1), fd->name)};
+    auto index = appendBufferEntry(FileInfo(fd, includedFrom));
+    return SourceBuffer{fd->text(), BufferID((uint32_t)index, fd->name)};
 }
 
-bool SourceManager::isCached(const fs::path& path) const {
-    fs::path absPath;
-    if (!disableProximatePaths) {
-        std::error_code ec;
-        absPath = fs::weakly_canonical(path, ec);
-        if (ec)
-            return false;
+std::optional<fs::path> SourceManager::canonicalize(const fs::path& path) const {
+    if (disableProximatePaths)
+        return path;
+
+    std::string key;
+    if (!disablePathCaching) {
+        key = getU8Str(path);
+        std::shared_lock lock(mut);
+        if (auto it = canonicalPathCache.find(key); it != canonicalPathCache.end()) {
+            if (it->second.empty())
+                return std::nullopt;
+            return it->second;
+        }
     }
-    else {
-        absPath = path;
+
+    std::error_code ec;
+    fs::path absPath = fs::weakly_canonical(path, ec);
+    if (!disablePathCaching) {
+        // Failures are cached too (as an empty path) so that repeated probes
+        // of a bad path don't keep hitting the filesystem.
+        std::unique_lock lock(mut);
+        canonicalPathCache.emplace(std::move(key), ec ? fs::path() : absPath);
     }
 
+    if (ec)
+        return std::nullopt;
+    return absPath;
+}
+
+bool SourceManager::isCached(const fs::path& path) const {
+    auto absPath = canonicalize(path);
+    if (!absPath)
+        return false;
+
     std::shared_lock lock(mut);
-    auto it = lookupCache.find(getU8Str(absPath));
+    auto it = lookupCache.find(getU8Str(*absPath));
     return it != lookupCache.end();
 }
 
-SourceBuffer SourceManager::openCached(const fs::path& fullPath, SourceLocation includedFrom) {
-    fs::path absPath;
-    if (!disableProximatePaths) {
-        std::error_code ec;
-        absPath = fs::weakly_canonical(fullPath, ec);
-        if (ec)
-            return SourceBuffer();
-    }
-    else {
-        absPath = fullPath;
+bool SourceManager::invalidateCachedFile(const fs::path& path) {
+    {
+        // Fresh content can also mean fresh path resolution (a symlink may
+        // have been repointed), so drop any cached result for this path.
+        std::unique_lock lock(mut);
+        canonicalPathCache.erase(getU8Str(path));
     }
 
+    auto absPath = canonicalize(path);
+    if (!absPath)
+        return false;
+
+    std::unique_lock lock(mut);
+    auto it = lookupCache.find(getU8Str(*absPath));
+    if (it == lookupCache.end())
+        return false;
+
+    // Existing buffer entries still point into the old file data,
+    // so retire it rather than deleting it.
+    if (it->second)
+        retiredFiles.emplace_back(std::move(it->second));
+
+    lookupCache.erase(it);
+    return true;
+}
+
+SourceBuffer SourceManager::openCached(const fs::path& fullPath, SourceLocation includedFrom) {
+    auto canonical = canonicalize(fullPath);
+    if (!canonical)
+        return SourceBuffer();
+
+    fs::path absPath = std::move(*canonical);
+
     // first see if we have this file cached
     std::string pathStr = getU8Str(absPath);
     {
@@ -518,7 +625,16 @@ SourceBuffer SourceManager::openCached(const fs::path& fullPath, SourceLocation
             FileData* fd = it->second.get();
             if (!fd)
                 return SourceBuffer();
-            return createBufferEntry(fd, includedFrom, lock);
+            return createBufferEntry(fd, includedFrom);
+        }
+    }
+
+    // Try to memory map the file if that's been requested; otherwise (or if
+    // mapping fails, e.g. for non-seekable inputs) fall back to a normal read.
+    if (enableMemoryMapping) {
+        if (auto mapping = MappedFile::open(absPath)) {
+            return cacheBuffer(std::move(absPath), std::move(pathStr), includedFrom, {},
+                               std::move(mapping));
         }
     }
 
@@ -534,7 +650,8 @@ SourceBuffer SourceManager::openCached(const fs::path& fullPath, SourceLocation
 }
 
 SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
-                                        SourceLocation includedFrom, std::vector<char>&& buffer) {
+                                        SourceLocation includedFrom, std::vector<char>&& buffer,
+                                        std::optional<MappedFile>&& mapping) {
     std::string name;
     if (!disableProximatePaths) {
         std::error_code ec;
@@ -550,33 +667,53 @@ SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
 
     auto directory = &*directories.insert(path.parent_path()).first;
     auto fd = std::make_unique<FileData>(directory, std::move(name), std::move(buffer),
-                                         std::move(path));
+                                         std::move(path), std::move(mapping));
 
     auto [it, inserted] = lookupCache.emplace(pathStr, std::move(fd));
     ASSERT(inserted);
 
     FileData* fdPtr = it->second.get();
-    return createBufferEntry(fdPtr, includedFrom, lock);
+    return createBufferEntry(fdPtr, includedFrom);
 }
 
-void SourceManager::computeLineOffsets(const std::vector<char>& buffer,
-                                       std::vector<size_t>& offsets) noexcept {
+size_t SourceManager::computeLineOffsets(std::string_view text, size_t start, size_t stop,
+                                         std::vector<size_t>& offsets) noexcept {
     // first line always starts at offset 0
-    offsets.push_back(0);
-
-    const char* ptr = buffer.data();
-    const char* end = buffer.data() + buffer.size();
-    while (ptr != end) {
-        if (ptr[0] == '\n' || ptr[0] == '\r') {
-            // if we see \r\n or \n\r skip both chars
-            if ((ptr[1] == '\n' || ptr[1] == '\r') && ptr[0] != ptr[1])
-                ptr++;
-            ptr++;
-            offsets.push_back((size_t)(ptr - buffer.data()));
-        }
-        else {
+    if (start == 0)
+        offsets.push_back(0);
+
+    const char* base = text.data();
+    const char* ptr = base + start;
+    const char* limit = base + stop;
+    const char* end = base + text.size();
+
+    // Let memchr do the heavy lifting of finding newline characters; each search
+    // resumes from wherever the scan has advanced to so far.
+    auto find = [&](char c) {
+        return static_cast<const char*>(memchr(ptr, c, size_t(limit - ptr)));
+    };
+
+    const char* lf = find('\n');
+    const char* cr = find('\r');
+    while (true) {
+        const char* nl = lf && (!cr || lf < cr) ? lf : cr;
+        if (!nl)
+            return size_t(limit - base);
+
+        // if we see \r\n or \n\r skip both chars; the second character of the
+        // pair may sit one byte past the requested stop position
+        ptr = nl + 1;
+        if (ptr != end && (*ptr == '\n' || *ptr == '\r') && *ptr != *nl)
             ptr++;
-        }
+        offsets.push_back(size_t(ptr - base));
+
+        if (ptr >= limit)
+            return size_t(ptr - base);
+
+        if (lf && lf < ptr)
+            lf = find('\n');
+        if (cr && cr < ptr)
+            cr = find('\r');
     }
 }
 
@@ -613,31 +750,58 @@ size_t SourceManager::getRawLineNumber(SourceLocation location) const {
     if (!info || !info->data)
         return 0;
 
-    std::shared_lock readLock(mut);
     auto fd = info->data;
 
-    if (fd->lineOffsets.empty()) {
-        // This is annoying; we have to give up our read lock, compute the line
-        // offsets, and then re-engage the read lock.
-        readLock.unlock();
+    // Find the first line offset that is greater than the given location offset. That iterator
+    // then tells us how many lines away from the beginning we are. We want to ensure the line
+    // we return is strictly greater than the given location offset, so if it is equal, add one
+    // to the lower bound we got.
+    auto countLines = [&] {
+        auto it = std::lower_bound(fd->lineOffsets.begin(), fd->lineOffsets.end(),
+                                   location.offset());
+        size_t line = size_t(it - fd->lineOffsets.begin());
+        if (it != fd->lineOffsets.end() && *it == location.offset())
+            line++;
+        return line;
+    };
+
+    // Fast path: once the entire buffer has been indexed the offsets vector can
+    // never change again, so it's safe to search it without taking the lock.
+    // The acquire load pairs with the release store made when indexing finishes.
+    if (fd->lineOffsetsScanned.load(std::memory_order_acquire) >= fd->text().size())
+        return countLines();
+
+    std::shared_lock readLock(mut);
 
-        std::unique_lock writeLock(mut);
-        computeLineOffsets(fd->mem, fd->lineOffsets);
+    // The line offset index is built lazily, one chunk at a time, so that the
+    // first query against a huge buffer doesn't have to scan all of it. All
+    // line starts at or before the queried offset must be indexed for the
+    // lower_bound below to count them correctly.
+    constexpr size_t ChunkSize = 1 << 20;
+    auto indexed = [&] {
+        size_t scanned = fd->lineOffsetsScanned.load(std::memory_order_relaxed);
+        return scanned > location.offset() || scanned >= fd->text().size();
+    };
 
-        writeLock.unlock();
+    if (!indexed()) {
+        // This is annoying; we have to give up our read lock, extend the line
+        // offset index, and then re-engage the read lock.
+        readLock.unlock();
+        {
+            std::unique_lock writeLock(mut);
+            auto text = fd->text();
+            while (!indexed()) {
+                size_t scanned = fd->lineOffsetsScanned.load(std::memory_order_relaxed);
+                size_t stop = std::min(scanned + ChunkSize, text.size());
+                fd->lineOffsetsScanned.store(computeLineOffsets(text, scanned, stop,
+                                                                fd->lineOffsets),
+                                             std::memory_order_release);
+            }
+        }
         readLock.lock();
     }
 
-    // Find the first line offset that is greater than the given location offset. That iterator
-    // then tells us how many lines away from the beginning we are.
-    auto it = std::lower_bound(fd->lineOffsets.begin(), fd->lineOffsets.end(), location.offset());
-
-    // We want to ensure the line we return is strictly greater than the given location offset.
-    // So if it is equal, add one to the lower bound we got.
-    size_t line = size_t(it - fd->lineOffsets.begin());
-    if (it != fd->lineOffsets.end() && *it == location.offset())
-        line++;
-    return line;
+    return countLines();
 }
 
 } // namespace slang
@@ -9,6 +9,8 @@
 
 #include <cstdlib>
 
+#include "slang/util/OS.h"
+
 namespace slang {
 
 BumpAllocator::BumpAllocator() {
@@ -20,13 +22,17 @@ BumpAllocator::~BumpAllocator() {
     Segment* seg = head;
     while (seg) {
         Segment* prev = seg->prev;
-        free(seg);
+        if (seg->fromArena)
+            OS::freeArenaMemory(seg, seg->size);
+        else
+            free(seg);
         seg = prev;
     }
 }
 
 BumpAllocator::BumpAllocator(BumpAllocator&& other) noexcept :
-    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr) {
+    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr),
+    nextSegmentSize(other.nextSegmentSize) {
 }
 
 BumpAllocator& BumpAllocator::operator=(BumpAllocator&& other) noexcept {
@@ -49,24 +55,58 @@ void BumpAllocator::steal(BumpAllocator&& other) {
     head->prev = std::exchange(other.head, nullptr);
 }
 
+BumpAllocator::MemoryStats BumpAllocator::getStats() const {
+    MemoryStats stats;
+    for (Segment* seg = head; seg; seg = seg->prev) {
+        stats.segmentCount++;
+        stats.allocatedBytes += seg->size;
+        stats.usedBytes += size_t(seg->current - (byte*)(seg + 1));
+    }
+    return stats;
+}
+
 byte* BumpAllocator::allocateSlow(size_t size, size_t alignment) {
     // for really large allocations, give them their own segment
-    if (size > (SEGMENT_SIZE >> 1)) {
+    if (size > (nextSegmentSize >> 1)) {
         size = (size + alignment - 1) & ~(alignment - 1);
-        head->prev = allocSegment(head->prev, size + sizeof(Segment));
-        return alignPtr(head->prev->current, alignment);
+
+        // Include alignment slack in case the alignment request is larger
+        // than that of the segment header itself.
+        head->prev = allocSegment(head->prev, size + alignment + sizeof(Segment));
+
+        // Mark the whole segment as consumed so that memory statistics
+        // account for it; nothing else will ever allocate from it.
+        byte* base = alignPtr(head->prev->current, alignment);
+        head->prev->current = base + size;
+        return base;
     }
 
-    // otherwise, start a new block
-    head = allocSegment(head, SEGMENT_SIZE);
-    endPtr = (byte*)head + SEGMENT_SIZE;
+    // otherwise, start a new block; sizes double as the allocator grows so
+    // that small allocators stay small while big compilations quickly move
+    // to huge-page-backed segments
+    head = allocSegment(head, nextSegmentSize);
+    endPtr = (byte*)head + head->size;
+    if (nextSegmentSize < MAX_SEGMENT_SIZE)
+        nextSegmentSize <<= 1;
+
     return allocate(size, alignment);
 }
 
 BumpAllocator::Segment* BumpAllocator::allocSegment(Segment* prev, size_t size) {
-    auto seg = (Segment*)malloc(size);
+    Segment* seg = nullptr;
+    bool fromArena = false;
+    if (size >= MAX_SEGMENT_SIZE) {
+        seg = (Segment*)OS::allocateArenaMemory(size);
+        fromArena = seg != nullptr;
+    }
+
+    if (!seg)
+        seg = (Segment*)malloc(size);
+
     seg->prev = prev;
     seg->current = (byte*)seg + sizeof(Segment);
+    seg->size = size;
+    seg->fromArena = fromArena;
     return seg;
 }
 
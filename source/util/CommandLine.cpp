@@ -301,8 +301,17 @@ void CommandLine::parseStr(std::string_view argList, ParseOptions options, bool&
             continue;
         }
 
-        // Otherwise we just have a normal character.
-        current += c;
+        // Otherwise we have a normal character; take the whole run of normal
+        // characters that follows it in one append instead of going byte by
+        // byte. Note that a slash can't start a comment once we're inside an
+        // argument, so it doesn't end the run.
+        auto start = ptr - 1;
+        while (ptr != end && !isWhitespace(*ptr) && *ptr != '\\' && *ptr != '\'' && *ptr != '"' &&
+               !(*ptr == '$' && options.expandEnvVars) &&
+               !(*ptr == '#' && options.supportComments)) {
+            ptr++;
+        }
+        current.append(start, ptr);
     }
 }
 
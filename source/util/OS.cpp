@@ -11,11 +11,19 @@
 #    include <Windows.h>
 #    include <fcntl.h>
 #    include <io.h>
+#    include <Psapi.h>
 #else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/resource.h>
 #    include <sys/stat.h>
 #    include <unistd.h>
+#    if defined(__APPLE__)
+#        include <mach/mach.h>
+#    endif
 #endif
 
+#include <cstdio>
 #include <fmt/color.h>
 #include <fstream>
 
@@ -80,6 +88,109 @@ bool OS::fileSupportsColors(FILE* file) {
 
 #endif
 
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    ptr(other.ptr), len(other.len), osHandle(other.osHandle) {
+    other.ptr = nullptr;
+    other.len = 0;
+    other.osHandle = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        detach();
+        ptr = std::exchange(other.ptr, nullptr);
+        len = std::exchange(other.len, 0);
+        osHandle = std::exchange(other.osHandle, nullptr);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    detach();
+}
+
+#if defined(_MSC_VER)
+
+std::optional<MappedFile> MappedFile::open(const fs::path& path) {
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return std::nullopt;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 ||
+        (uint64_t)size.QuadPart > SIZE_MAX - 1 || size.QuadPart % 4096 == 0) {
+        // Reject sizes that are a multiple of the page size; in that case there
+        // is no zero-filled tail in the last page to serve as a null terminator
+        // and the caller must fall back to a copying read.
+        CloseHandle(file);
+        return std::nullopt;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return std::nullopt;
+
+    void* ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!ptr) {
+        CloseHandle(mapping);
+        return std::nullopt;
+    }
+
+    // The view length includes the null terminator, matching OS::readFile.
+    return MappedFile(ptr, (size_t)size.QuadPart + 1, mapping);
+}
+
+void MappedFile::detach() {
+    if (ptr) {
+        UnmapViewOfFile(ptr);
+        CloseHandle(osHandle);
+        ptr = nullptr;
+        len = 0;
+        osHandle = nullptr;
+    }
+}
+
+#else
+
+std::optional<MappedFile> MappedFile::open(const fs::path& path) {
+    int fd = ::open(path.string().c_str(), O_RDONLY);
+    if (fd < 0)
+        return std::nullopt;
+
+    struct stat s;
+    const long pageSize = ::sysconf(_SC_PAGESIZE);
+    if (::fstat(fd, &s) != 0 || !S_ISREG(s.st_mode) || s.st_size <= 0 || pageSize <= 0 ||
+        s.st_size % pageSize == 0) {
+        // Reject sizes that are a multiple of the page size; in that case there
+        // is no zero-filled tail in the last page to serve as a null terminator
+        // and the caller must fall back to a copying read.
+        ::close(fd);
+        return std::nullopt;
+    }
+
+    void* ptr = ::mmap(nullptr, (size_t)s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED)
+        return std::nullopt;
+
+    // The view length includes the null terminator, matching OS::readFile.
+    // The terminator lives in the zero-filled remainder of the final page.
+    return MappedFile(ptr, (size_t)s.st_size + 1, nullptr);
+}
+
+void MappedFile::detach() {
+    if (ptr) {
+        // Round the unmap length back up to the size we actually mapped.
+        ::munmap(ptr, len - 1);
+        ptr = nullptr;
+        len = 0;
+    }
+}
+
+#endif
+
 bool OS::readFile(const fs::path& path, std::vector<char>& buffer) {
 #if defined(_MSC_VER)
     std::error_code ec;
@@ -109,38 +220,214 @@ bool OS::readFile(const fs::path& path, std::vector<char>& buffer) {
     return true;
 }
 
+void OS::prefetchMemory(const void* ptr, size_t length) {
+    if (!ptr || !length)
+        return;
+
+    constexpr uintptr_t PageSize = 4096;
+    uintptr_t addr = (uintptr_t)ptr;
+    uintptr_t base = addr & ~(PageSize - 1);
+
+#if defined(_WIN32)
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = (PVOID)base;
+    range.NumberOfBytes = (SIZE_T)(length + (addr - base));
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    posix_madvise((void*)base, length + (addr - base), POSIX_MADV_WILLNEED);
+#endif
+
+    // The advice above is asynchronous (and possibly unsupported), so touch
+    // one byte per page to guarantee the range is resident when we return.
+    auto p = (const volatile char*)ptr;
+    for (size_t i = 0; i < length; i += PageSize)
+        (void)p[i];
+    (void)p[length - 1];
+}
+
+static constexpr size_t OutputBufferLimit = 64 * 1024;
+static bool bufferedOutput = false;
+static std::string stdoutBuffer;
+static std::string stderrBuffer;
+
+static void writeOut(FILE* file, std::string_view text) {
+    fmt::detail::print(file, fmt::detail::to_string_view(text));
+}
+
+static void appendBuffered(FILE* file, std::string& buffer, std::string_view text) {
+    buffer += text;
+    if (buffer.size() >= OutputBufferLimit) {
+        writeOut(file, buffer);
+        buffer.clear();
+    }
+}
+
+void OS::setBufferedOutputEnabled(bool enabled) {
+    if (bufferedOutput && !enabled)
+        flushOutput();
+    bufferedOutput = enabled;
+}
+
+void OS::flushOutput() {
+    if (!stdoutBuffer.empty()) {
+        writeOut(stdout, stdoutBuffer);
+        stdoutBuffer.clear();
+    }
+    if (!stderrBuffer.empty()) {
+        writeOut(stderr, stderrBuffer);
+        stderrBuffer.clear();
+    }
+    std::fflush(stdout);
+    std::fflush(stderr);
+}
+
 void OS::print(std::string_view text) {
     if (capturingOutput)
         capturedStdout += text;
+    else if (bufferedOutput)
+        appendBuffered(stdout, stdoutBuffer, text);
     else
-        fmt::detail::print(stdout, fmt::detail::to_string_view(text));
+        writeOut(stdout, text);
 }
 
 void OS::print(const fmt::text_style& style, std::string_view text) {
     if (capturingOutput)
         capturedStdout += text;
+    else if (bufferedOutput) {
+        // The escape sequences go into the buffer along with the text, so
+        // styled output doesn't force a write either.
+        if (showColorsStdout)
+            appendBuffered(stdout, stdoutBuffer, fmt::format(style, "{}"sv, text));
+        else
+            appendBuffered(stdout, stdoutBuffer, text);
+    }
     else if (showColorsStdout)
         fmt::print(stdout, style, "{}"sv, text);
     else
-        fmt::detail::print(stdout, fmt::detail::to_string_view(text));
+        writeOut(stdout, text);
 }
 
 void OS::printE(std::string_view text) {
     if (capturingOutput)
         capturedStderr += text;
+    else if (bufferedOutput)
+        appendBuffered(stderr, stderrBuffer, text);
     else
-        fmt::detail::print(stderr, fmt::detail::to_string_view(text));
+        writeOut(stderr, text);
 }
 
 void OS::printE(const fmt::text_style& style, std::string_view text) {
     if (capturingOutput)
         capturedStderr += text;
+    else if (bufferedOutput) {
+        if (showColorsStderr)
+            appendBuffered(stderr, stderrBuffer, fmt::format(style, "{}"sv, text));
+        else
+            appendBuffered(stderr, stderrBuffer, text);
+    }
     else if (showColorsStderr)
         fmt::print(stderr, style, "{}"sv, text);
     else
-        fmt::detail::print(stderr, fmt::detail::to_string_view(text));
+        writeOut(stderr, text);
+}
+
+#if defined(_MSC_VER)
+
+uint64_t OS::getCurrentRSS() {
+    PROCESS_MEMORY_COUNTERS info;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info)))
+        return 0;
+    return info.WorkingSetSize;
+}
+
+uint64_t OS::getPeakRSS() {
+    PROCESS_MEMORY_COUNTERS info;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &info, sizeof(info)))
+        return 0;
+    return info.PeakWorkingSetSize;
+}
+
+#else
+
+uint64_t OS::getCurrentRSS() {
+#    if defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, task_info_t(&info), &count) !=
+        KERN_SUCCESS) {
+        return 0;
+    }
+    return info.resident_size;
+#    else
+    // The second field of /proc/self/statm is the resident set size in pages.
+    FILE* fp = fopen("/proc/self/statm", "r");
+    if (!fp)
+        return 0;
+
+    long rss = 0;
+    if (fscanf(fp, "%*s%ld", &rss) != 1)
+        rss = 0;
+    fclose(fp);
+
+    return uint64_t(rss) * uint64_t(sysconf(_SC_PAGESIZE));
+#    endif
+}
+
+uint64_t OS::getPeakRSS() {
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+#    if defined(__APPLE__)
+    // ru_maxrss is reported in bytes on macOS and in kilobytes elsewhere.
+    return uint64_t(usage.ru_maxrss);
+#    else
+    return uint64_t(usage.ru_maxrss) * 1024;
+#    endif
 }
 
+#endif
+
+#if defined(_MSC_VER)
+
+void* OS::allocateArenaMemory(size_t size) {
+    // Large page support on Windows requires the SeLockMemoryPrivilege,
+    // which processes don't normally hold, so just reserve and commit
+    // regular pages directly from the OS.
+    return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void OS::freeArenaMemory(void* ptr, size_t) {
+    if (ptr)
+        VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
+#else
+
+void* OS::allocateArenaMemory(size_t size) {
+    void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+
+#    if defined(MADV_HUGEPAGE)
+    // Ask for transparent huge page backing; large arena segments are hot
+    // enough that 4KB pages show up as dTLB misses. This is advisory and
+    // harmless if the kernel declines. Pages are physically placed on
+    // first touch, which happens on the thread bump-allocating from the
+    // segment, so per-thread arenas naturally end up NUMA-local.
+    ::madvise(ptr, size, MADV_HUGEPAGE);
+#    endif
+
+    return ptr;
+}
+
+void OS::freeArenaMemory(void* ptr, size_t size) {
+    if (ptr)
+        ::munmap(ptr, size);
+}
+
+#endif
+
 std::string OS::getEnv(const std::string& name) {
     char* result = getenv(name.c_str());
     if (result)
@@ -24,4 +24,12 @@ void* allocArray(size_t capacity, size_t typeSize) {
     return result;
 }
 
+void* reallocArray(void* ptr, size_t capacity, size_t typeSize) {
+    void* result = std::realloc(ptr, capacity * typeSize);
+    if (!result)
+        throw std::bad_alloc();
+
+    return result;
+}
+
 } // namespace slang::detail
@@ -14,6 +14,7 @@
 
 #include "slang/text/CharInfo.h"
 #include "slang/util/Hash.h"
+#include "slang/util/OS.h"
 
 using namespace std::chrono;
 
@@ -52,11 +53,19 @@ struct Entry {
     DurationType duration;
     std::string name;
     std::string detail;
+    uint64_t startRSS = 0;
+    uint64_t endRSS = 0;
+};
+
+struct Aggregate {
+    uint64_t count = 0;
+    DurationType total{};
 };
 
 struct TimeTrace::Profiler {
     std::vector<Entry> stack;
     std::vector<Entry> entries;
+    flat_hash_map<std::string, Aggregate> aggregates;
     time_point<steady_clock> startTime;
 
     Profiler() {
@@ -66,7 +75,8 @@ struct TimeTrace::Profiler {
     }
 
     void begin(std::string name, function_ref<std::string()> detail) {
-        stack.push_back(Entry{steady_clock::now(), {}, std::move(name), detail()});
+        stack.push_back(
+            Entry{steady_clock::now(), {}, std::move(name), detail(), OS::getCurrentRSS(), 0});
     }
 
     void end() {
@@ -74,6 +84,13 @@ struct TimeTrace::Profiler {
 
         auto& entry = stack.back();
         entry.duration = steady_clock::now() - entry.start;
+        entry.endRSS = OS::getCurrentRSS();
+
+        // Aggregated counters include every section, even the ones too short
+        // to be worth an individual trace event.
+        auto& agg = aggregates[entry.name];
+        agg.count++;
+        agg.total += entry.duration;
 
         // Only include sections longer than 500us.
         if (duration_cast<microseconds>(entry.duration).count() > 500)
@@ -91,15 +108,35 @@ struct TimeTrace::Profiler {
             auto startUs = duration_cast<microseconds>(entry.start - startTime).count();
             auto durationUs = duration_cast<microseconds>(entry.duration).count();
             os << fmt::format("{{ \"pid\":1, \"tid\":0, \"ph\":\"X\", \"ts\":{}, "
-                              "\"dur\":{}, \"name\":\"{}\", \"args\":{{ \"detail\":\"{}\" }} }},\n",
+                              "\"dur\":{}, \"name\":\"{}\", \"args\":{{ \"detail\":\"{}\", "
+                              "\"rssStartBytes\":{}, \"rssEndBytes\":{} }} }},\n",
                               startUs, durationUs, escapeString(entry.name),
-                              escapeString(entry.detail));
+                              escapeString(entry.detail), entry.startRSS, entry.endRSS);
         }
 
         // Emit metadata event with process name.
         os << "{ \"cat\":\"\", \"pid\":1, \"tid\":0, \"ts\":0, \"ph\":\"M\", "
               "\"name\":\"process_name\", \"args\":{ \"name\":\"slang\" } }\n";
-        os << "] }\n";
+        os << "],\n";
+
+        // Emit the aggregated per-section counters as a sibling of the trace
+        // events; viewers ignore unknown top-level keys so the file remains a
+        // valid Chrome trace while the totals stay easy to diff across runs.
+        os << "\"counters\": {\n";
+        bool first = true;
+        for (auto& [name, agg] : aggregates) {
+            if (!first)
+                os << ",\n";
+            first = false;
+            os << fmt::format("\"{}\": {{ \"count\":{}, \"totalUs\":{} }}", escapeString(name),
+                              agg.count, duration_cast<microseconds>(agg.total).count());
+        }
+        os << "\n},\n";
+
+        // Process-wide memory figures taken at write time so the trace can
+        // answer where peak usage landed relative to the recorded sections.
+        os << fmt::format("\"memory\": {{ \"peakRSSBytes\":{}, \"finalRSSBytes\":{} }} }}\n",
+                          OS::getPeakRSS(), OS::getCurrentRSS());
     }
 };
 
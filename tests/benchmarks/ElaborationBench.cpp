@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// ElaborationBench.cpp
+// Full elaboration benchmarks over synthetic hierarchical designs
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include "SourceGen.h"
+
+#include "slang/ast/Compilation.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+
+using namespace slang;
+using namespace slang::ast;
+using namespace slang::syntax;
+
+static void BM_Elaborate(benchmark::State& state) {
+    auto text = makeHierarchySource(size_t(state.range(0)));
+    for (auto _ : state) {
+        SourceManager sourceManager;
+        auto tree = SyntaxTree::fromText(text, sourceManager);
+
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        benchmark::DoNotOptimize(compilation.getAllDiagnostics().size());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_Elaborate)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
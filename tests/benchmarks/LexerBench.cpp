@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// LexerBench.cpp
+// Token throughput benchmarks for the lexer and preprocessor
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include "SourceGen.h"
+
+#include "slang/diagnostics/Diagnostics.h"
+#include "slang/parsing/Preprocessor.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/BumpAllocator.h"
+
+using namespace slang;
+using namespace slang::parsing;
+
+static void lexFully(benchmark::State& state, const std::string& text) {
+    for (auto _ : state) {
+        SourceManager sourceManager;
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Preprocessor preprocessor(sourceManager, alloc, diagnostics);
+        preprocessor.pushSource(text);
+
+        Token token;
+        do {
+            token = preprocessor.next();
+            benchmark::DoNotOptimize(token);
+        } while (token.kind != TokenKind::EndOfFile);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+
+static void BM_LexClasses(benchmark::State& state) {
+    lexFully(state, makeClassSource(500));
+}
+BENCHMARK(BM_LexClasses);
+
+static void BM_LexNetlist(benchmark::State& state) {
+    lexFully(state, makeNetlistSource(20000));
+}
+BENCHMARK(BM_LexNetlist);
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// LookupBench.cpp
+// Name lookup microbenchmarks for scopes and hierarchical paths
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <vector>
+
+#include "slang/ast/Compilation.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+
+using namespace slang;
+using namespace slang::ast;
+using namespace slang::syntax;
+
+static void BM_ScopeFind(benchmark::State& state) {
+    size_t count = size_t(state.range(0));
+    std::string text = "package p;\n";
+    for (size_t i = 0; i < count; i++)
+        fmt::format_to(std::back_inserter(text), "    localparam int param{0} = {0};\n", i);
+    text += "endpackage\n";
+
+    SourceManager sourceManager;
+    Compilation compilation;
+    compilation.addSyntaxTree(SyntaxTree::fromText(text, sourceManager));
+
+    auto pkg = compilation.getPackage("p");
+    std::vector<std::string> names;
+    for (size_t i = 0; i < count; i++)
+        names.push_back(fmt::format("param{}", i));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pkg->find(names[i]));
+        if (++i == names.size())
+            i = 0;
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_ScopeFind)->Arg(100)->Arg(10000);
+
+static void BM_HierarchicalLookup(benchmark::State& state) {
+    constexpr int depth = 20;
+    std::string text = fmt::format("module m{}; localparam int p = 1; endmodule\n", depth);
+    for (int i = depth - 1; i >= 1; i--)
+        fmt::format_to(std::back_inserter(text), "module m{}; m{} u(); endmodule\n", i, i + 1);
+    text += "module top; m1 u(); endmodule\n";
+
+    SourceManager sourceManager;
+    Compilation compilation;
+    compilation.addSyntaxTree(SyntaxTree::fromText(text, sourceManager));
+
+    std::string path = "top";
+    for (int i = 0; i < depth; i++)
+        path += ".u";
+    path += ".p";
+
+    auto& root = compilation.getRoot();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(root.lookupName(path));
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_HierarchicalLookup);
@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+// NumericBench.cpp
+// Arithmetic kernel benchmarks for SVInt
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include "slang/numeric/SVInt.h"
+
+using namespace slang;
+
+static void BM_SVIntAdd(benchmark::State& state) {
+    bitwidth_t bits = bitwidth_t(state.range(0));
+    SVInt a(bits, 0x12345678u, false);
+    SVInt b(bits, 0x9abcdef1u, false);
+    for (auto _ : state) {
+        a += b;
+        benchmark::DoNotOptimize(a.getRawPtr());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntAdd)->Arg(32)->Arg(128)->Arg(512);
+
+static void BM_SVIntMul(benchmark::State& state) {
+    bitwidth_t bits = bitwidth_t(state.range(0));
+    SVInt a(bits, 0x12345678u, false);
+    SVInt b(bits, 0x9abcdef1u, false);
+    for (auto _ : state) {
+        a = a * b;
+        benchmark::DoNotOptimize(a.getRawPtr());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntMul)->Arg(32)->Arg(128)->Arg(512);
+
+static void BM_SVIntDiv(benchmark::State& state) {
+    bitwidth_t bits = bitwidth_t(state.range(0));
+    SVInt a = SVInt::createFillX(bits, false);
+    a.setAllOnes();
+    SVInt b(bits, 0x9abcdef1u, false);
+    for (auto _ : state) {
+        SVInt q = a / b;
+        benchmark::DoNotOptimize(q.getRawPtr());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntDiv)->Arg(32)->Arg(128)->Arg(512);
+
+static void BM_SVIntShift(benchmark::State& state) {
+    bitwidth_t bits = bitwidth_t(state.range(0));
+    SVInt a(bits, 0x12345678u, false);
+    SVInt amount(32, bits / 3, false);
+    for (auto _ : state) {
+        SVInt r = a.shl(amount);
+        benchmark::DoNotOptimize(r.getRawPtr());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntShift)->Arg(32)->Arg(128)->Arg(512);
@@ -0,0 +1,36 @@
+//------------------------------------------------------------------------------
+// ParserBench.cpp
+// Parse throughput benchmarks over synthetic sources
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include "SourceGen.h"
+
+#include "slang/syntax/SyntaxNode.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+
+using namespace slang;
+using namespace slang::syntax;
+
+static void parseFully(benchmark::State& state, const std::string& text) {
+    for (auto _ : state) {
+        SourceManager sourceManager;
+        auto tree = SyntaxTree::fromText(text, sourceManager);
+        benchmark::DoNotOptimize(tree->root().kind);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+
+static void BM_ParseClasses(benchmark::State& state) {
+    parseFully(state, makeClassSource(500));
+}
+BENCHMARK(BM_ParseClasses);
+
+static void BM_ParseNetlist(benchmark::State& state) {
+    parseFully(state, makeNetlistSource(size_t(state.range(0))));
+}
+BENCHMARK(BM_ParseNetlist)->Arg(1000)->Arg(10000)->Arg(100000);
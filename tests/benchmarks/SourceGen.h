@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+// SourceGen.h
+// Synthetic SystemVerilog source generators for the benchmark suite
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <fmt/format.h>
+#include <string>
+
+/// Builds a testbench-flavored source file with @a numClasses class
+/// declarations full of random members, constraints, and method bodies,
+/// approximating the shape of UVM-style verification code.
+inline std::string makeClassSource(size_t numClasses) {
+    std::string result;
+    for (size_t i = 0; i < numClasses; i++) {
+        fmt::format_to(std::back_inserter(result), R"(
+class Packet{0};
+    rand bit [31:0] addr;
+    rand bit [31:0] data;
+    rand bit [3:0] kind;
+    bit [7:0] payload[$];
+    string name = "packet{0}";
+
+    constraint c_addr {{ addr inside {{[32'h0 : 32'h7fff]}}; }}
+    constraint c_kind {{ kind dist {{ 0 := 4, [1:14] := 1 }}; }}
+
+    function new(string n = "packet{0}");
+        name = n;
+    endfunction
+
+    function bit [31:0] checksum();
+        bit [31:0] sum = addr ^ data;
+        foreach (payload[j])
+            sum ^= {{24'b0, payload[j]}};
+        return sum;
+    endfunction
+
+    task automatic send(ref bit [7:0] bus[$]);
+        foreach (payload[j])
+            bus.push_back(payload[j]);
+    endtask
+endclass
+)",
+                       i);
+    }
+    return result;
+}
+
+/// Builds a flat gate-level netlist module containing @a numCells primitive
+/// instances chained through intermediate nets, approximating generated
+/// synthesis output.
+inline std::string makeNetlistSource(size_t numCells) {
+    std::string result = "module netlist(input logic a, input logic b, output logic y);\n";
+    fmt::format_to(std::back_inserter(result), "    wire [{}:0] n;\n", numCells + 1);
+    result += "    assign n[0] = a;\n"
+              "    assign n[1] = b;\n";
+
+    static constexpr const char* gates[] = {"nand", "nor", "and", "xor"};
+    for (size_t i = 0; i < numCells; i++) {
+        fmt::format_to(std::back_inserter(result), "    {} g{} (n[{}], n[{}], n[{}]);\n",
+                       gates[i % 4], i, i + 2, i, i + 1);
+    }
+
+    fmt::format_to(std::back_inserter(result), "    assign y = n[{}];\nendmodule\n", numCells + 1);
+    return result;
+}
+
+/// Builds a hierarchical RTL design that elaborates to roughly
+/// @a numInstances module instances, organized as blocks of one hundred
+/// leaves per mid-level module.
+inline std::string makeHierarchySource(size_t numInstances) {
+    size_t numMids = std::max<size_t>(numInstances / 100, 1);
+    return fmt::format(R"(
+module Leaf #(parameter int P = 0)(input logic clk, output logic q);
+    logic [7:0] counter;
+    always_ff @(posedge clk)
+        counter <= counter + 8'(P);
+    assign q = counter[0];
+endmodule
+
+module Mid #(parameter int BASE = 0)(input logic clk, output logic q);
+    logic [99:0] qs;
+    for (genvar i = 0; i < 100; i++) begin : g
+        Leaf #(BASE + i) leaf(clk, qs[i]);
+    end
+    assign q = ^qs;
+endmodule
+
+module top(input logic clk, output logic q);
+    localparam int N = {0};
+    logic [N-1:0] qs;
+    for (genvar i = 0; i < N; i++) begin : g
+        Mid #(i) mid(clk, qs[i]);
+    end
+    assign q = ^qs;
+endmodule
+)",
+                       numMids);
+}
@@ -1302,3 +1302,41 @@ endmodule
     CHECK(diags[1].code == diag::AssertionArgTypeMismatch);
     CHECK(diags[2].code == diag::InferredValDefArg);
 }
+
+TEST_CASE("Argument-less sequence instances are shared") {
+    auto tree = SyntaxTree::fromText(R"(
+module m(input logic clk, a, b);
+    sequence s;
+        a ##1 b;
+    endsequence
+
+    assert property (@(posedge clk) s);
+    assert property (@(posedge clk) a |-> s);
+    assert property (@(posedge clk) s |=> s);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+}
+
+TEST_CASE("Argument-less sequence sharing still diagnoses errors") {
+    auto tree = SyntaxTree::fromText(R"(
+module m(input logic clk, a);
+    sequence s;
+        a ##1 bad_name;
+    endsequence
+
+    assert property (@(posedge clk) s);
+    assert property (@(posedge clk) a |-> s);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::UndeclaredIdentifier);
+}
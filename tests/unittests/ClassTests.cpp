@@ -3,6 +3,7 @@
 
 #include "Test.h"
 
+#include "slang/ast/Constraints.h"
 #include "slang/ast/Expression.h"
 #include "slang/ast/symbols/ClassSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
@@ -1952,6 +1953,104 @@ endclass
     CHECK(diags[17].code == diag::RandCInSoft);
 }
 
+TEST_CASE("Constraint normalization") {
+    auto tree = SyntaxTree::fromText(R"(
+class base;
+    rand int q;
+    constraint cq { q > 100; }
+endclass
+
+class A extends base;
+    rand int x, y;
+    rand int z;
+    rand byte w;
+
+    constraint c1 {
+        x > 1 && x <= 50;
+        soft y == 7;
+        x inside {3, [10:20]};
+    }
+
+    constraint c2 {
+        (y == 0) -> z < 5;
+        if (y == 1)
+            z == 9;
+        else
+            z != 9;
+    }
+
+    constraint c3 { unique { w }; }
+    constraint c4 { solve x before y; }
+    constraint cq { q > 200; }
+endclass
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& A = compilation.getRoot().compilationUnits[0]->lookupName<ClassType>("A");
+    auto& norm = compilation.getNormalizedConstraints(A);
+
+    // x > 1, x <= 50, soft y == 7, x inside, implication on z,
+    // if/else on z (two terms), unique w, overridden q constraint.
+    REQUIRE(norm.terms.size() == 9);
+    REQUIRE(norm.solveBefore.size() == 1);
+    CHECK(norm.disableSoft.empty());
+
+    // x > 1 is rewritten to 1 < x.
+    auto& gt = norm.terms[0];
+    CHECK(gt.kind == NormalizedConstraint::Relation);
+    CHECK(gt.relOp == NormalizedRelOp::LessThan);
+    REQUIRE(gt.right);
+    CHECK(gt.right->kind == ExpressionKind::NamedValue);
+    CHECK(!gt.isSoft);
+    REQUIRE(gt.support.size() == 1);
+    CHECK(gt.support[0]->name == "x");
+
+    CHECK(norm.terms[1].relOp == NormalizedRelOp::LessThanEqual);
+    CHECK(norm.terms[2].isSoft);
+
+    auto& inside = norm.terms[3];
+    CHECK(inside.kind == NormalizedConstraint::Membership);
+    REQUIRE(inside.intervals.size() == 2);
+    CHECK(inside.intervals[0].low->integer() == 3);
+    CHECK(inside.intervals[0].high->integer() == 3);
+    CHECK(inside.intervals[1].low->integer() == 10);
+    CHECK(inside.intervals[1].high->integer() == 20);
+
+    // The implication and both conditional branches carry guards.
+    auto& impl = norm.terms[4];
+    REQUIRE(impl.guards.size() == 1);
+    CHECK(!impl.guards[0].negated);
+
+    CHECK(!norm.terms[5].guards[0].negated);
+    CHECK(norm.terms[6].guards[0].negated);
+
+    CHECK(norm.terms[7].kind == NormalizedConstraint::Unique);
+
+    // The derived cq overrides the base block, so only q > 200 shows up
+    // (normalized to 200 < q).
+    auto& qTerm = norm.terms[8];
+    CHECK(qTerm.kind == NormalizedConstraint::Relation);
+    REQUIRE(qTerm.support.size() == 1);
+    CHECK(qTerm.support[0]->name == "q");
+
+    // Partitions: {x} and {y, z} are linked through the guards; w and q
+    // are independent.
+    CHECK(norm.partitionCount == 4);
+    CHECK(norm.terms[0].partition == norm.terms[1].partition);
+    CHECK(norm.terms[0].partition == norm.terms[3].partition);
+    CHECK(norm.terms[2].partition == norm.terms[4].partition);
+    CHECK(norm.terms[4].partition == norm.terms[5].partition);
+    CHECK(norm.terms[0].partition != norm.terms[2].partition);
+    CHECK(norm.terms[7].partition != norm.terms[0].partition);
+    CHECK(norm.terms[8].partition != norm.terms[7].partition);
+
+    // Cached: same object comes back.
+    CHECK(&compilation.getNormalizedConstraints(A) == &norm);
+}
+
 TEST_CASE("Constraint qualifiers") {
     auto tree = SyntaxTree::fromText(R"(
 class A;
@@ -2678,3 +2777,47 @@ endmodule
     REQUIRE(diags.size() == 1);
     CHECK(diags[0].code == diag::MultipleContAssigns);
 }
+
+TEST_CASE("Deferring class method bodies") {
+    auto tree = SyntaxTree::fromText(R"(
+class C;
+    function int f();
+        return undeclared_name;
+    endfunction
+
+    static function int g();
+        return 2;
+    endfunction
+endclass
+
+module m;
+    localparam int p = C::g();
+endmodule
+)");
+
+    CompilationOptions options;
+    options.deferClassMethodBodies = true;
+
+    // The unreferenced method's bad body is never bound, but the one used
+    // in a constant expression still binds and evaluates on demand.
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& m = compilation.getRoot().lookupName<InstanceSymbol>("m").body;
+    CHECK(m.find<ParameterSymbol>("p").getValue().integer() == 2);
+
+    // By default the body is checked along with everything else.
+    Compilation defaultCompilation;
+    defaultCompilation.addSyntaxTree(SyntaxTree::fromText(R"(
+class C;
+    function int f();
+        return undeclared_name;
+    endfunction
+endclass
+)"));
+
+    auto& diags = defaultCompilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::UndeclaredIdentifier);
+}
@@ -606,3 +606,25 @@ endmodule
     compilation.addSyntaxTree(tree);
     NO_COMPILATION_ERRORS;
 }
+
+TEST_CASE("Skipping coverage checks") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    int a;
+    covergroup cg;
+        coverpoint a {
+            bins b = {undeclared_name};
+        }
+    endgroup
+
+    cg cg_inst = new;
+endmodule
+)");
+
+    CompilationOptions options;
+    options.skipCoverageChecks = true;
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+}
@@ -3,7 +3,10 @@
 
 #include "Test.h"
 
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/diagnostics/DiagnosticClient.h"
+#include "slang/diagnostics/JsonDiagnosticClient.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/text/SourceManager.h"
 
@@ -576,3 +579,95 @@ source:3:33: error: use of undeclared identifier 'a'
                                         ^
 )");
 }
+
+TEST_CASE("JSON diagnostic output") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    ; // warn
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    DiagnosticEngine engine(tree->sourceManager());
+    auto client = std::make_shared<JsonDiagnosticClient>();
+    engine.addClient(client);
+    for (auto& diag : compilation.getAllDiagnostics())
+        engine.issue(diag);
+
+    CHECK(client->getString() ==
+          R"({"diagnostics":[{"severity":"warning","code":"EmptyMember","option":"empty-member",)"
+          R"("file":0,"line":3,"column":5,"offset":15,"message":"extra ';' has no effect"}],)"
+          R"("files":["source"]})");
+}
+
+TEST_CASE("Per-subtree semantic diagnostics") {
+    auto tree = SyntaxTree::fromText(R"(
+module a;
+    logic l = undeclared_a;
+endmodule
+
+module b;
+    logic l = undeclared_b;
+endmodule
+
+module top;
+    a a1();
+    b b1();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& a1 = compilation.getRoot().lookupName<InstanceSymbol>("top.a1");
+    auto& diags = compilation.getSemanticDiagnostics(a1);
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::UndeclaredIdentifier);
+
+    // Memoized; asking again returns the same cached set.
+    CHECK(&compilation.getSemanticDiagnostics(a1) == &diags);
+
+    // The design-wide pass still reports everything exactly once.
+    auto& all = compilation.getAllDiagnostics();
+    REQUIRE(all.size() == 2);
+    CHECK(all[0].code == diag::UndeclaredIdentifier);
+    CHECK(all[1].code == diag::UndeclaredIdentifier);
+}
+
+TEST_CASE("Parse errors over the limit skip semantic binding") {
+    auto text = R"(
+module broken;
+    int i = ;
+    int j = ;
+    int k = ;
+endmodule
+
+module top;
+    logic l = undeclared;
+endmodule
+)";
+
+    auto countUndeclared = [](const Diagnostics& diags) {
+        return std::ranges::count_if(
+            diags, [](auto& d) { return d.code == diag::UndeclaredIdentifier; });
+    };
+
+    // With the parse errors already over the limit, elaboration is
+    // short-circuited and only the parse diagnostics come back.
+    CompilationOptions options;
+    options.errorLimit = 2;
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(SyntaxTree::fromText(text));
+
+    auto& diags = compilation.getAllDiagnostics();
+    CHECK(!diags.empty());
+    CHECK(countUndeclared(diags) == 0);
+
+    // A budget that covers the parse errors still binds the design.
+    Compilation compilation2;
+    compilation2.addSyntaxTree(SyntaxTree::fromText(text));
+    CHECK(countUndeclared(compilation2.getAllDiagnostics()) == 1);
+}
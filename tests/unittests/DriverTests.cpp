@@ -2,9 +2,14 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <filesystem>
 #include <fmt/core.h>
+#include <fstream>
 #include <regex>
+#include <thread>
 
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/driver/Driver.h"
 
 using namespace slang::driver;
@@ -226,6 +231,41 @@ TEST_CASE("Driver single-unit parsing") {
     CHECK(driver.reportParseDiags());
 }
 
+TEST_CASE("Driver multiple compilations sharing parsed trees") {
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test2.sv\" --single-unit", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    // Elaborate two different tops against the same parsed trees, from
+    // separate threads. Catch2 assertions aren't thread safe so the results
+    // are only inspected after joining.
+    std::vector<std::string> topM = {"m"};
+    std::vector<std::string> topN = {"n"};
+    auto c1 = driver.createCompilation(topM);
+    auto c2 = driver.createCompilation(topN);
+
+    std::string name1, name2;
+    std::thread t1([&] {
+        auto& root = c1->getRoot();
+        if (!root.topInstances.empty())
+            name1 = root.topInstances[0]->name;
+    });
+    std::thread t2([&] {
+        auto& root = c2->getRoot();
+        if (!root.topInstances.empty())
+            name2 = root.topInstances[0]->name;
+    });
+    t1.join();
+    t2.join();
+
+    CHECK(name1 == "m");
+    CHECK(name2 == "n");
+}
+
 TEST_CASE("Driver parsing with library modules") {
     auto guard = OS::captureOutput();
 
@@ -243,6 +283,37 @@ TEST_CASE("Driver parsing with library modules") {
     CHECK(stderrContains("foobaz"));
 }
 
+TEST_CASE("Driver library search with persistent index") {
+    auto guard = OS::captureOutput();
+
+    namespace fs = std::filesystem;
+    auto dir = fs::temp_directory_path() / "slang_libindex_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    // The module name doesn't match the file name, so only the index
+    // can find it; the default name-based probing would fail.
+    std::ofstream(dir / "cells.v") << "module not_named_cells; endmodule\n";
+    std::ofstream(dir / "top.sv") << "module top; not_named_cells c(); endmodule\n";
+
+    // The first iteration builds the index, the second loads the saved one.
+    for (int i = 0; i < 2; i++) {
+        Driver driver;
+        driver.addStandardArgs();
+
+        auto args = fmt::format("testfoo \"{0}/top.sv\" --libdir \"{0}\" --lib-index",
+                                dir.string());
+        CHECK(driver.parseCommandLine(args));
+        CHECK(driver.processOptions());
+        CHECK(driver.parseAllSources());
+        CHECK(driver.reportParseDiags());
+        CHECK(driver.syntaxTrees.size() == 2);
+        CHECK(fs::exists(dir / ".slang-libindex"));
+    }
+
+    fs::remove_all(dir);
+}
+
 TEST_CASE("Driver invalid library module file") {
     auto guard = OS::captureOutput();
 
@@ -451,3 +522,48 @@ TEST_CASE("Driver suppress warnings by path") {
     CHECK(stdoutContains("Build succeeded"));
     CHECK(stdoutContains("0 errors, 0 warnings"));
 }
+
+TEST_CASE("Driver pipelined compilation") {
+    auto guard = OS::captureOutput();
+
+    auto dir = fs::temp_directory_path() / "slang_pipelined_test";
+    fs::create_directories(dir);
+    std::ofstream(dir / "a.sv") << "module a; endmodule\n";
+    std::ofstream(dir / "b.sv") << "module b; a a1(); endmodule\n";
+    std::ofstream(dir / "top.sv") << "module top; b b1(); endmodule\n";
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}/a.sv\" \"{0}/b.sv\" \"{0}/top.sv\" --threads 2 "
+                            "--pipelined-compilation",
+                            dir.string());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+
+    bool ok = false;
+    auto compilation = driver.parseAndCreateCompilation(ok);
+    CHECK(ok);
+    CHECK(driver.syntaxTrees.size() == 3);
+    CHECK(compilation->getSyntaxTrees().size() == 3);
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(stdoutContains("Build succeeded"));
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("Driver source prefetch") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" --prefetch-sources", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(stdoutContains("Build succeeded"));
+}
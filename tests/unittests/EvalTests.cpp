@@ -19,6 +19,26 @@ TEST_CASE("Simple eval") {
     NO_SESSION_ERRORS;
 }
 
+TEST_CASE("Batch eval") {
+    ScriptSession session;
+    session.eval(R"(
+function int square(int a);
+    return a * a;
+endfunction
+)");
+
+    std::vector<std::string_view> snippets = {"int j = 2;", "square(3)", "j + 1", "square(j)"};
+    auto results = session.evalBatch(snippets);
+
+    REQUIRE(results.size() == 4);
+    CHECK(!results[0]);
+    CHECK(results[1].integer() == 9);
+    CHECK(results[2].integer() == 3);
+    CHECK(results[3].integer() == 4);
+
+    NO_SESSION_ERRORS;
+}
+
 TEST_CASE("Eval function calls") {
     ScriptSession session;
     session.eval(R"(
@@ -671,6 +691,47 @@ endfunction
     NO_SESSION_ERRORS;
 }
 
+TEST_CASE("Associative array ordered iteration") {
+    ScriptSession session;
+    session.eval("typedef int int_map_t[int];");
+    session.eval(R"(
+function automatic int_map_t mkArr;
+    int_map_t arr;
+    for (int i = 0; i < 100; i++)
+        arr[(i * 19) % 100] = i;
+    return arr;
+endfunction
+)");
+    session.eval(R"(
+function automatic int checkOrder(int_map_t arr);
+    int prev = -1;
+    foreach (arr[i]) begin
+        if (i <= prev) return 0;
+        prev = i;
+    end
+    return 1;
+endfunction
+)");
+
+    session.eval("int_map_t arr = mkArr();");
+    CHECK(session.eval("checkOrder(arr)").integer() == 1);
+
+    // Iteration visits keys in ascending order no matter the insertion order.
+    auto cv = session.eval("arr");
+    auto& map = *cv.map();
+    CHECK(map.size() == 100);
+
+    int expected = 0;
+    for (auto& [key, val] : map)
+        CHECK(key.integer() == expected++);
+
+    CHECK(map.rbegin()->first.integer() == 99);
+    CHECK(map.find(SVInt(32, 42, true)) != map.end());
+    CHECK(map.find(SVInt(32, 123, true)) == map.end());
+
+    NO_SESSION_ERRORS;
+}
+
 TEST_CASE("Queue eval") {
     ScriptSession session;
     session.eval("int arr[$] = '{1, 2, 3, 4};");
@@ -1432,6 +1493,31 @@ TEST_CASE("Eval enum methods") {
     NO_SESSION_ERRORS;
 }
 
+TEST_CASE("Eval wide enum methods") {
+    // Values wider than 64 bits don't fit in the enum's sorted value table,
+    // so lookups take the linear fallback path.
+    ScriptSession session;
+    session.eval("typedef enum bit [79:0] { A = 80'd1, B = 80'h10000000000000000 } w_t;");
+    session.eval("w_t w = B;");
+
+    CHECK(session.eval("w.name").str() == "B");
+    CHECK(session.eval("w.next").integer() == 1);
+    CHECK(session.eval("w.prev.name").str() == "A");
+    CHECK(session.eval("w.num").integer() == 2);
+
+    session.eval("w = w_t'(2)");
+    CHECK(session.eval("w.name").str() == "");
+    CHECK(session.eval("w.next").integer() == 0);
+
+    // A value with unknown bits never compares equal to any enumerand.
+    session.eval("typedef enum logic [1:0] { X0 = 0, X1 = 1 } x_t;");
+    session.eval("x_t x = x_t'(2'b1x);");
+    CHECK(session.eval("x.name").str() == "");
+    CHECK(session.eval("x.next").integer() == 0);
+
+    NO_SESSION_ERRORS;
+}
+
 TEST_CASE("Eval string methods") {
     ScriptSession session;
     session.eval("string asdf = \"BaR1\";");
@@ -2493,6 +2579,63 @@ endfunction
     CHECK(diags[1].code == diag::ConstEvalCaseItemsNotUnique);
 }
 
+TEST_CASE("Pattern matching eval -- tagged dispatch") {
+    // Decoder-shaped matches statements (all arms tagged or wildcard) use
+    // the bind-time discriminant dispatch table; make sure the semantics
+    // are unchanged: priority order, wildcard arms, filters, variable
+    // capture, defaults, and uniqueness checking all still apply.
+    ScriptSession session;
+    session.eval(R"(
+typedef union tagged {
+    bit [7:0] Add;
+    bit [7:0] Sub;
+    bit [7:0] Jmp;
+    void Nop;
+} Op;
+)");
+
+    session.eval(R"(
+function automatic int decode(Op op, int flag);
+    case (op) matches
+        tagged Add 8'd1: return 1;
+        tagged Add .v &&& flag != 0: return 100 + v;
+        tagged Add .v: return 200 + v;
+        tagged Sub .v: return 300 + v;
+        .x &&& flag == 2: return 400;
+        tagged Jmp .v: return 500 + v;
+    endcase
+    return -1;
+endfunction
+)");
+
+    CHECK(session.eval("decode(tagged Add 8'd1, 0);").integer() == 1);
+    CHECK(session.eval("decode(tagged Add 8'd7, 1);").integer() == 107);
+    CHECK(session.eval("decode(tagged Add 8'd7, 0);").integer() == 207);
+    CHECK(session.eval("decode(tagged Sub 8'd9, 0);").integer() == 309);
+    CHECK(session.eval("decode(tagged Jmp 8'd3, 2);").integer() == 400);
+    CHECK(session.eval("decode(tagged Jmp 8'd3, 0);").integer() == 503);
+    CHECK(session.eval("decode(tagged Nop, 0);").integer() == -1);
+
+    session.eval(R"(
+function automatic int dupes(Op op);
+    unique case (op) matches
+        tagged Add .v: return 1;
+        tagged Sub .v: return 2;
+        tagged Jmp .v: return 3;
+        tagged Add .v: return 4;
+    endcase
+    return 0;
+endfunction
+)");
+
+    CHECK(session.eval("dupes(tagged Sub 8'd0);").integer() == 2);
+    CHECK(session.eval("dupes(tagged Add 8'd0);").integer() == 1);
+
+    auto diags = session.getDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::ConstEvalCaseItemsNotUnique);
+}
+
 TEST_CASE("case statement eval regression") {
     ScriptSession session;
     session.eval(R"(
@@ -2513,3 +2656,181 @@ endfunction
     CHECK(session.eval("calc(400);").integer() == 0);
     NO_SESSION_ERRORS;
 }
+
+TEST_CASE("Bytecode-eligible function eval") {
+    // Exercises the constructs handled by the bytecode compiler for constant
+    // functions: loops with break / continue, compound assignment, inc / dec
+    // operators, short circuiting, repeat, and else-if chains. The results
+    // must be identical to the AST walker's.
+    ScriptSession session;
+    session.eval(R"(
+function automatic int sum_odds(int n);
+    int total = 0;
+    for (int i = 0; i < n; i++) begin
+        if (i % 2 == 0)
+            continue;
+        if (i > 20)
+            break;
+        total += i;
+    end
+    return total;
+endfunction
+)");
+
+    CHECK(session.eval("sum_odds(10)").integer() == 25);
+    CHECK(session.eval("sum_odds(100)").integer() == 100);
+
+    session.eval(R"(
+function automatic int classify(int a, int b);
+    if (a > b)
+        return 1;
+    else if (a < b)
+        return -1;
+    else
+        return 0;
+endfunction
+)");
+
+    CHECK(session.eval("classify(3, 2)").integer() == 1);
+    CHECK(session.eval("classify(2, 3)").integer() == -1);
+    CHECK(session.eval("classify(5, 5)").integer() == 0);
+
+    session.eval(R"(
+function automatic int repeat_shift(int n);
+    int result = 1;
+    repeat (n)
+        result = result * 2;
+    return result;
+endfunction
+)");
+
+    CHECK(session.eval("repeat_shift(0)").integer() == 1);
+    CHECK(session.eval("repeat_shift(5)").integer() == 32);
+
+    session.eval(R"(
+function automatic logic [7:0] merge_sides(logic sel);
+    return sel ? 8'hAA : 8'h55;
+endfunction
+)");
+
+    CHECK(session.eval("merge_sides(1)").integer() == 0xAA);
+    CHECK(session.eval("merge_sides(0)").integer() == 0x55);
+    CHECK(session.eval("merge_sides(1'bx)").integer() == "8'bxxxxxxxx"_si);
+
+    session.eval(R"(
+function automatic int shortcirc(int x);
+    int count = 0;
+    if (x > 0 && ++count > 0) begin end
+    if (x > 0 || ++count > 0) begin end
+    return count;
+endfunction
+)");
+
+    CHECK(session.eval("shortcirc(1)").integer() == 1);
+    CHECK(session.eval("shortcirc(0)").integer() == 1);
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Two-state fast path function eval") {
+    // These all route through the bytecode evaluator's two-state fast lane;
+    // results must match the general evaluation path, including wrapping and
+    // signed vs unsigned comparison behavior.
+    ScriptSession session;
+    session.eval(R"(
+function automatic int prod(int a, int b);
+    return a * b;
+endfunction
+)");
+
+    CHECK(session.eval("prod(100000, 100000)").integer() == 1410065408);
+    CHECK(session.eval("prod(-3, 7)").integer() == -21);
+
+    session.eval(R"(
+function automatic bit cmpu(bit [7:0] a, bit [7:0] b);
+    return a > b;
+endfunction
+)");
+
+    CHECK(session.eval("cmpu(8'd200, 8'd100)").integer() == 1);
+    CHECK(session.eval("cmpu(8'd100, 8'd200)").integer() == 0);
+
+    session.eval(R"(
+function automatic bit signed [15:0] wrap16(bit signed [15:0] a, bit signed [15:0] b);
+    bit signed [15:0] r = a + b;
+    if (r < a)
+        r = r - b;
+    return r;
+endfunction
+)");
+
+    CHECK(session.eval("wrap16(16'sd32767, 16'sd1)").integer() == 32767);
+    CHECK(session.eval("wrap16(16'sd5, 16'sd6)").integer() == 11);
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Affine for loop eval") {
+    ScriptSession session;
+    session.eval(R"(
+function automatic int sum_mem(int n);
+    int mem[64];
+    int total = 0;
+    for (int i = 0; i < 64; i++)
+        mem[i] = i;
+    for (int i = 63; i >= 0; i--)
+        total += mem[i];
+    return n < 64 ? mem[n] + total : total;
+endfunction
+
+function automatic int early_out(int n);
+    int mem[16];
+    int i;
+    for (i = 0; i < 16; i++) begin
+        mem[i] = n;
+        if (i == n)
+            break;
+        if (mem[i] > 100)
+            i = 15;
+    end
+    return i;
+endfunction
+)");
+
+    CHECK(session.eval("sum_mem(5)").integer() == 2021);
+    CHECK(session.eval("early_out(3)").integer() == 3);
+    CHECK(session.eval("early_out(200)").integer() == 16);
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Array reduction with unknown values") {
+    ScriptSession session;
+    session.eval("logic [7:0] a[] = {8'd1, 8'hx, 8'd3};");
+    CHECK(session.eval("a.sum").integer() == "8'bxxxxxxxx"_si);
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Case dispatch table eval") {
+    ScriptSession session;
+    session.eval(R"(
+function automatic int decode(logic [7:0] op);
+    case (op)
+        8'd0:   return 100;
+        8'd1:   return 101;
+        8'd2:   return 102;
+        8'd3:   return 103;
+        8'd10:  return 110;
+        8'd20:  return 120;
+        8'd30:  return 130;
+        8'd0:   return 999;
+        8'd255: return 912;
+        default: return -1;
+    endcase
+endfunction
+)");
+
+    CHECK(session.eval("decode(8'd2)").integer() == 102);
+    CHECK(session.eval("decode(8'd255)").integer() == 912);
+    CHECK(session.eval("decode(8'd77)").integer() == -1);
+    CHECK(session.eval("decode(8'd0)").integer() == 100);
+    CHECK(session.eval("decode(8'bx)").integer() == -1);
+    NO_SESSION_ERRORS;
+}
@@ -65,6 +65,30 @@ TEST_CASE("Integer literal expression") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Integer vector literal values") {
+    auto checkValue = [](const std::string& text, const SVInt& expected) {
+        auto& expr = parseExpression(text);
+        REQUIRE(expr.kind == SyntaxKind::IntegerVectorExpression);
+        CHECK(expr.as<IntegerVectorExpressionSyntax>().value.intValue() == expected);
+        CHECK_DIAGNOSTICS_EMPTY;
+    };
+
+    // Small literals take the single-word fast path in NumberParser.
+    checkValue("8'hff", SVInt(8, 255, false));
+    checkValue("'h0", SVInt(32, 0, false));
+    checkValue("'o0017", SVInt(32, 15, false));
+    checkValue("'b0000_0110", SVInt(32, 6, false));
+    checkValue("16'shff", SVInt(16, 255, true));
+
+    // A 17th hex digit overflows the 64-bit accumulator and spills over
+    // to the general digit vector path.
+    checkValue("68'h1_0000_0000_0000_0003", SVInt::fromString("68'h10000000000000003"));
+    checkValue("'h1_0000_0000_0000_0003", SVInt::fromString("65'h10000000000000003"));
+
+    // Unknown digits spill as well.
+    checkValue("8'b0000_1xz0", SVInt::fromString("8'b1xz0"));
+}
+
 TEST_CASE("Integer with question") {
     auto& text = "4'b?10?";
     auto& expr = parseExpression(text);
@@ -385,6 +409,42 @@ TEST_CASE("Conditional expression (pattern matching)") {
           SyntaxKind::ExpressionPattern);
 }
 
+TEST_CASE("Conditional expression chains") {
+    // Chains associate to the right; they are parsed iteratively, so very
+    // long generated chains don't trip the recursion depth limit.
+    auto& text = "a ? b : c ? d : e ? f : g";
+    auto& expr = parseExpression(text);
+
+    CHECK(expr.toString() == text);
+    CHECK_DIAGNOSTICS_EMPTY;
+    REQUIRE(expr.kind == SyntaxKind::ConditionalExpression);
+
+    auto& cond = expr.as<ConditionalExpressionSyntax>();
+    REQUIRE(cond.right->kind == SyntaxKind::ConditionalExpression);
+    CHECK(cond.right->as<ConditionalExpressionSyntax>().right->kind ==
+          SyntaxKind::ConditionalExpression);
+
+    std::string big;
+    for (int i = 0; i < 5000; i++)
+        big += "c ? v : ";
+    big += "x";
+
+    auto& bigExpr = parseExpression(big);
+    CHECK(bigExpr.kind == SyntaxKind::ConditionalExpression);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Deeply nested parentheses") {
+    std::string text(5000, '(');
+    text += "a + b";
+    text.append(5000, ')');
+
+    auto& expr = parseExpression(text);
+    CHECK(expr.kind == SyntaxKind::ParenthesizedExpression);
+    CHECK(expr.toString() == text);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Big expression") {
     auto& text = R"(
 module M; localparam foo = (stackDepth == 100) || ((stackDepth == 200) || ((stackDepth ==
@@ -2904,3 +2904,19 @@ endmodule
     compilation.addSyntaxTree(tree);
     NO_COMPILATION_ERRORS;
 }
+
+TEST_CASE("Deep left-leaning binary operator chain") {
+    // Left-leaning operator chains bind and type-propagate iteratively
+    // instead of recursing per term, so generated expressions like this one
+    // are limited by memory rather than stack depth. 50k terms would blow
+    // the default 8MB stack many times over if any per-term walk recursed.
+    std::string text = "module m;\n    logic a;\n    wire w = a";
+    for (int i = 0; i < 50000; i++)
+        text += " | a";
+    text += ";\nendmodule\n";
+
+    auto tree = SyntaxTree::fromText(text);
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+}
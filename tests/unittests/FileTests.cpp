@@ -2,7 +2,17 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
+#include "slang/parsing/Parser.h"
+#include "slang/syntax/ParseSession.h"
+#include "slang/syntax/SyntaxCache.h"
+#include "slang/syntax/SyntaxPrinter.h"
 #include "slang/text/SourceManager.h"
 
 std::string getTestInclude() {
@@ -74,3 +84,482 @@ TEST_CASE("Read header (include dirs)") {
     buffer = manager.readHeader("../infinite_chain.svh", SourceLocation(buffer.id, 0), false);
     CHECK(buffer);
 }
+
+TEST_CASE("Path canonicalization caching") {
+    namespace fs = std::filesystem;
+    auto dir = fs::temp_directory_path() / "slang_pathcache_test";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    fs::create_directories(dir);
+
+    SourceManager manager;
+    auto missing = dir / "missing.svh";
+
+    // Repeated probes of a nonexistent path keep returning nothing; the
+    // negative result is cached after the first probe.
+    CHECK(!manager.readSource(missing));
+    CHECK(!manager.readSource(missing));
+
+    // Creating the file and invalidating the cache entry picks up the
+    // new content despite path caching being on by default.
+    std::ofstream(missing) << "int i;\n";
+    CHECK(manager.invalidateCachedFile(missing));
+    CHECK(manager.readSource(missing));
+    CHECK(manager.isCached(missing));
+
+    // Caching can be turned off entirely.
+    SourceManager uncached;
+    uncached.setDisablePathCaching(true);
+    CHECK(uncached.readSource(missing));
+
+    fs::remove_all(dir, ec);
+}
+
+TEST_CASE("Line numbers with mixed newlines and out of order queries") {
+    // Mix of \n, \r\n, \n\r, and \r line endings.
+    std::string text = "line1\nline2\r\nline3\n\rline4\rline5\n";
+
+    SourceManager manager;
+    SourceBuffer buffer = manager.assignText(text);
+    REQUIRE(buffer);
+
+    auto lineOf = [&](size_t offset) {
+        return manager.getLineNumber(SourceLocation(buffer.id, offset));
+    };
+
+    // Query out of order; the line offset index is built lazily.
+    CHECK(lineOf(text.find("line5")) == 5);
+    CHECK(lineOf(0) == 1);
+    CHECK(lineOf(text.find("line4")) == 4);
+    CHECK(lineOf(text.find("line2")) == 2);
+    CHECK(lineOf(text.find("line3")) == 3);
+
+    // Offsets inside the two-character newlines still belong to the line they end.
+    CHECK(lineOf(text.find("\r\n")) == 2);
+    CHECK(lineOf(text.find("\n\r") + 1) == 3);
+}
+
+TEST_CASE("Concurrent buffer registration") {
+    SourceManager manager;
+    SourceBuffer base = manager.assignText("some text");
+    REQUIRE(base);
+
+    // Hammer the buffer table from several threads at once; each thread creates
+    // expansion locations while resolving the ones it has made so far. Catch2
+    // assertions aren't thread safe, so failures are just counted and checked
+    // after joining.
+    constexpr int threadCount = 4;
+    constexpr int perThread = 2000;
+
+    std::atomic<int> failures = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < perThread; i++) {
+                SourceRange range(SourceLocation(base.id, 0), SourceLocation(base.id, 5));
+                auto loc = manager.createExpansionLoc(SourceLocation(base.id, 0), range, "M"sv);
+                if (!manager.isMacroLoc(loc) || manager.getExpansionLoc(loc) != range.start() ||
+                    manager.getMacroName(loc) != "M") {
+                    failures++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(failures == 0);
+    CHECK(manager.getAllBuffers().size() == threadCount * perThread + 1);
+}
+
+TEST_CASE("ParseSession reuse across buffers") {
+    SourceManager manager;
+    ParseSession session(manager);
+
+    auto b1 = manager.assignText("`define FOO 1\nmodule m1; int i = `FOO; endmodule\n");
+    auto t1 = session.parse(b1);
+    REQUIRE(t1);
+    CHECK(t1->diagnostics().empty());
+    CHECK(t1->root().kind == SyntaxKind::CompilationUnit);
+
+    // Macro definitions and diagnostics don't leak into the next parse.
+    auto b2 = manager.assignText("module m2; int j = `FOO; endmodule\n");
+    auto t2 = session.parse(b2);
+    REQUIRE(t2);
+    CHECK(!t2->diagnostics().empty());
+
+    // Macros from an earlier tree can still be threaded through explicitly.
+    auto b3 = manager.assignText("module m3; int k = `FOO; endmodule\n");
+    auto t3 = session.parse(b3, t1->getDefinedMacros());
+    REQUIRE(t3);
+    CHECK(t3->diagnostics().empty());
+
+    // Earlier trees remain valid after the session moves on to later files.
+    CHECK(t1->root().as<CompilationUnitSyntax>().members.size() == 1);
+}
+
+TEST_CASE("Pipelined preprocessing matches serial parsing") {
+    std::string text = R"(
+`timescale 1ns / 1ps
+`default_nettype none
+`define ADD(a, b) ((a) + (b))
+module m1;
+  logic [7:0] r = `ADD(1, 2);
+endmodule
+`default_nettype wire
+module m2;
+)";
+    for (int i = 0; i < 500; i++)
+        text += "  logic [15:0] v" + std::to_string(i) + " = `ADD(" + std::to_string(i) + ", 2);\n";
+    text += "endmodule\nmodule bad; assign x = `UNDEFINED; endmodule\n";
+
+    ParserOptions popts;
+    popts.pipelinedPreprocessing = true;
+
+    SourceManager sm1, sm2;
+    auto serial = SyntaxTree::fromFileInMemory(text, sm1, "test.sv", "test.sv");
+    auto pipelined = SyntaxTree::fromFileInMemory(text, sm2, "test.sv", "test.sv", Bag(popts));
+    REQUIRE(serial);
+    REQUIRE(pipelined);
+
+    // Same tree, same diagnostics, same macro table. Note that pipelining
+    // groups all preprocessor diagnostics ahead of parser ones, so the
+    // comparison here is order-insensitive.
+    CHECK(SyntaxPrinter::printFile(*serial) == SyntaxPrinter::printFile(*pipelined));
+    REQUIRE(serial->diagnostics().size() == pipelined->diagnostics().size());
+    for (auto& diag : serial->diagnostics()) {
+        bool found = false;
+        for (auto& other : pipelined->diagnostics()) {
+            if (other.code == diag.code && other.location == diag.location) {
+                found = true;
+                break;
+            }
+        }
+        CHECK(found);
+    }
+    CHECK(serial->getDefinedMacros().size() == pipelined->getDefinedMacros().size());
+
+    // Directive state changes mid-file still land in the right module's metadata.
+    auto& meta = pipelined->getMetadata();
+    for (auto& [node, info] : meta.nodeMap) {
+        auto name = node->as<ModuleDeclarationSyntax>().header->name.valueText();
+        if (name == "m1")
+            CHECK(info.defaultNetType == TokenKind::Unknown);
+        else
+            CHECK(info.defaultNetType == TokenKind::WireKeyword);
+
+        CHECK(info.timeScale.has_value());
+    }
+}
+
+TEST_CASE("Deferred module body parsing") {
+    std::string text = R"(
+module lib1;
+  defparam u1.p = 4;
+  wire w;
+endmodule
+interface libi;
+  logic sig;
+endinterface
+package pkg;
+  int x;
+endpackage
+module bad_mod;
+  assign = 1;
+endmodule
+)";
+
+    ParserOptions popts;
+    popts.deferModuleBodies = true;
+
+    SourceManager sm;
+    auto tree = SyntaxTree::fromFileInMemory(text, sm, "lib.sv", "lib.sv", Bag(popts));
+    REQUIRE(tree);
+
+    // Bodies of modules and interfaces are deferred; packages are not.
+    // No diagnostics should be issued for unexpanded bodies, even erroneous ones.
+    CHECK(tree->diagnostics().empty());
+    CHECK(tree->getMetadata().hasDefparams);
+
+    auto& unit = tree->root().as<CompilationUnitSyntax>();
+    for (auto member : unit.members) {
+        auto& decl = member->as<ModuleDeclarationSyntax>();
+        bool isPackage = decl.kind == SyntaxKind::PackageDeclaration;
+        CHECK(tree->isModuleBodyDeferred(decl) == !isPackage);
+        CHECK(decl.members.empty() == !isPackage);
+    }
+
+    // Expanding every body reproduces the original source exactly and
+    // surfaces the deferred parse error.
+    for (auto member : unit.members)
+        tree->expandDeferredBody(member->as<ModuleDeclarationSyntax>());
+
+    CHECK(SyntaxPrinter::printFile(*tree) == text);
+    CHECK(tree->diagnostics().size() == 1);
+
+    for (auto member : unit.members) {
+        auto& decl = member->as<ModuleDeclarationSyntax>();
+        CHECK(!tree->isModuleBodyDeferred(decl));
+        CHECK(!decl.members.empty());
+        for (auto child : decl.members)
+            CHECK(child->parent == &decl);
+    }
+}
+
+TEST_CASE("Content hash ignores trivia") {
+    SourceManager sm;
+    auto t1 = SyntaxTree::fromFileInMemory("module m; // comment\n  wire w;\nendmodule\n", sm,
+                                           "a.sv", "a.sv");
+    auto t2 = SyntaxTree::fromFileInMemory("/* header */ module m;\n\n\twire w; endmodule\n", sm,
+                                           "b.sv", "b.sv");
+    auto t3 = SyntaxTree::fromFileInMemory("module m; wire x; endmodule\n", sm, "c.sv", "c.sv");
+
+    CHECK(t1->getContentHash() == t2->getContentHash());
+    CHECK(t1->getContentHash() != t3->getContentHash());
+}
+
+TEST_CASE("Compilation checkpoint save and restore") {
+    auto dir = fs::temp_directory_path() / "slang_checkpoint_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    std::ofstream(dir / "inc.svh") << "localparam int FromHeader = 42;\n";
+    std::ofstream(dir / "top.sv") << "module top;\n"
+                                     "`include \"inc.svh\"\n"
+                                     "int i = FromHeader;\n"
+                                     "endmodule\n";
+
+    auto checkpoint = dir / "state.ckpt";
+    {
+        SourceManager sourceManager;
+        Compilation compilation;
+        compilation.addSyntaxTree(SyntaxTree::fromFile((dir / "top.sv").string(), sourceManager));
+        CHECK(compilation.saveCheckpoint(checkpoint));
+    }
+
+    // The original sources are gone, so the restored compilation must work
+    // entirely from the contents embedded in the checkpoint.
+    fs::remove(dir / "top.sv");
+    fs::remove(dir / "inc.svh");
+
+    SourceManager restoredSM;
+    auto restored = Compilation::restoreCheckpoint(checkpoint, restoredSM);
+    REQUIRE(restored);
+    CHECK(restored->getAllDiagnostics().empty());
+    CHECK(restored->getRoot().topInstances.size() == 1);
+    CHECK(restored->getRoot().topInstances[0]->name == "top");
+
+    // Garbage files are rejected rather than half-restored.
+    std::ofstream(checkpoint, std::ios::trunc) << "not a checkpoint\n";
+    SourceManager junkSM;
+    CHECK(!Compilation::restoreCheckpoint(checkpoint, junkSM));
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("Syntax cache distinguishes shape-changing options") {
+    auto dir = fs::temp_directory_path() / "slang_syntaxcache_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto path = (dir / "m.sv").string();
+    {
+        std::ofstream file(path);
+        file << "module m; int i; endmodule\n";
+    }
+
+    SourceManager sourceManager;
+    auto cache = std::make_shared<SyntaxCache>();
+
+    auto load = [&](auto&& setup) {
+        Bag options;
+        options.set(cache);
+        setup(options);
+        return SyntaxTree::fromFile(path, sourceManager, options);
+    };
+
+    auto none = [](Bag&) {};
+    auto base = load(none);
+    REQUIRE(base);
+    CHECK(load(none) == base);
+
+    // A deferred-body parse has a different tree shape, so it must not be
+    // served from the plain entry (and vice versa).
+    auto deferred = load([](Bag& options) {
+        ParserOptions po;
+        po.deferModuleBodies = true;
+        options.set(po);
+    });
+    CHECK(deferred != base);
+
+    auto minimal = load([](Bag& options) {
+        LexerOptions lo;
+        lo.minimalTrivia = true;
+        options.set(lo);
+    });
+    CHECK(minimal != base);
+    CHECK(minimal != deferred);
+    CHECK(cache->size() == 3);
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("Incremental reparse reuses leading members") {
+    SourceManager sm;
+    std::string text = "module m1; wire a; endmodule\n"
+                       "module m2; wire b; endmodule\n"
+                       "module m3; wire c; endmodule\n";
+    auto tree = SyntaxTree::fromFileInMemory(text, sm, "edit.sv", "edit.sv");
+    REQUIRE(tree);
+    CHECK(tree->diagnostics().empty());
+
+    auto& oldUnit = tree->root().as<CompilationUnitSyntax>();
+    REQUIRE(oldUnit.members.size() == 3);
+
+    std::string newText = "module m1; wire a; endmodule\n"
+                          "module m2; wire b; endmodule\n"
+                          "module m3; wire c; logic d; endmodule\n";
+    auto newTree = SyntaxTree::fromEdit(tree, newText);
+    REQUIRE(newTree);
+    CHECK(newTree->getParentTree() == tree.get());
+
+    // Members before the edit come straight from the old tree; only the
+    // edited module is reparsed. The printed result is the new text exactly.
+    auto& newUnit = newTree->root().as<CompilationUnitSyntax>();
+    REQUIRE(newUnit.members.size() == 3);
+    CHECK(newUnit.members[0] == oldUnit.members[0]);
+    CHECK(newUnit.members[1] == oldUnit.members[1]);
+    CHECK(newUnit.members[2] != oldUnit.members[2]);
+    CHECK(newUnit.members[0]->parent == &newUnit);
+    CHECK(SyntaxPrinter::printFile(*newTree) == newText);
+    CHECK(newTree->diagnostics().empty());
+
+    // An error in the reparsed region lands on the new tree.
+    auto badTree = SyntaxTree::fromEdit(tree, "module m1; wire a; endmodule\n"
+                                              "module m2; wire b; endmodule\n"
+                                              "module m3; assign = 1; endmodule\n");
+    REQUIRE(badTree);
+    CHECK(badTree->getParentTree() == tree.get());
+    CHECK(!badTree->diagnostics().empty());
+
+    // An edit inside the first member leaves nothing to reuse.
+    auto frontTree = SyntaxTree::fromEdit(tree, "module m1; wire aa; endmodule\n"
+                                                "module m2; wire b; endmodule\n"
+                                                "module m3; wire c; endmodule\n");
+    REQUIRE(frontTree);
+    CHECK(frontTree->getParentTree() == nullptr);
+    CHECK(frontTree->diagnostics().empty());
+}
+
+TEST_CASE("Incremental reparse is conservative around directives") {
+    SourceManager sm;
+
+    // A macro defined ahead of the edit would have to be replayed for the
+    // reparse to see it, so any directive in the reused region forces a
+    // full reparse -- which must pick up the changed definition.
+    std::string text = "`define WIDTH 4\n"
+                       "module m1; wire [`WIDTH-1:0] a; endmodule\n"
+                       "module m2; wire b; endmodule\n";
+    auto tree = SyntaxTree::fromFileInMemory(text, sm, "macro.sv", "macro.sv");
+    REQUIRE(tree);
+    CHECK(tree->diagnostics().empty());
+
+    std::string newText = "`define WIDTH 4\n"
+                          "module m1; wire [`WIDTH-1:0] a; endmodule\n"
+                          "module m2; wire [`WIDTH-1:0] b; endmodule\n";
+    auto newTree = SyntaxTree::fromEdit(tree, newText);
+    REQUIRE(newTree);
+    CHECK(newTree->getParentTree() == nullptr);
+    CHECK(SyntaxPrinter::printFile(*newTree) == newText);
+    CHECK(newTree->diagnostics().empty());
+
+    // Same for include directives: the edited region may depend on state
+    // established by the included file.
+    sm.assignText("fake-edit-include.svh", "`define FROM_INC 1\n");
+    std::string incText = "`include \"fake-edit-include.svh\"\n"
+                          "module m1; wire a; endmodule\n";
+    auto incTree = SyntaxTree::fromFileInMemory(incText, sm, "inc.sv", "inc.sv");
+    REQUIRE(incTree);
+    CHECK(incTree->diagnostics().empty());
+
+    auto incEdit = SyntaxTree::fromEdit(incTree, "`include \"fake-edit-include.svh\"\n"
+                                                 "module m1; wire a; endmodule\n"
+                                                 "module m2; int i = `FROM_INC; endmodule\n");
+    REQUIRE(incEdit);
+    CHECK(incEdit->getParentTree() == nullptr);
+    CHECK(incEdit->diagnostics().empty());
+
+    // Directives that appear only in the reparsed region don't block reuse.
+    std::string tailText = "module m1; wire a; endmodule\n"
+                           "`define TAIL 2\n"
+                           "module m2; int i = `TAIL; endmodule\n";
+    auto tailBase = SyntaxTree::fromFileInMemory("module m1; wire a; endmodule\n", sm, "tail.sv",
+                                                 "tail.sv");
+    REQUIRE(tailBase);
+
+    auto tailTree = SyntaxTree::fromEdit(tailBase, tailText);
+    REQUIRE(tailTree);
+    CHECK(tailTree->getParentTree() == tailBase.get());
+    CHECK(SyntaxPrinter::printFile(*tailTree) == tailText);
+    CHECK(tailTree->diagnostics().empty());
+}
+
+TEST_CASE("Incremental reparse carries reused members' diagnostics") {
+    SourceManager sm;
+    std::string text = "module e1; assign = 1; endmodule\n"
+                       "module e2; wire b; endmodule\n";
+    auto tree = SyntaxTree::fromFileInMemory(text, sm, "err.sv", "err.sv");
+    REQUIRE(tree);
+    REQUIRE(!tree->diagnostics().empty());
+    size_t oldCount = tree->diagnostics().size();
+    auto oldLoc = tree->diagnostics()[0].location;
+
+    // The parse error lives in the reused first module; editing the second
+    // one must not make it disappear from the new tree's report.
+    auto newTree = SyntaxTree::fromEdit(tree, "module e1; assign = 1; endmodule\n"
+                                              "module e2; wire bb; endmodule\n");
+    REQUIRE(newTree);
+    CHECK(newTree->getParentTree() == tree.get());
+    REQUIRE(newTree->diagnostics().size() == oldCount);
+    CHECK(newTree->diagnostics()[0].location == oldLoc);
+
+    // A new error in the edited region is reported alongside the carried
+    // over one, not instead of it.
+    auto bothTree = SyntaxTree::fromEdit(tree, "module e1; assign = 1; endmodule\n"
+                                               "module e2; assign = 2; endmodule\n");
+    REQUIRE(bothTree);
+    CHECK(bothTree->getParentTree() == tree.get());
+    CHECK(bothTree->diagnostics().size() == oldCount * 2);
+}
+
+TEST_CASE("Deferred body capture of virtual interface declarations") {
+    // 'virtual interface' inside an interface body is a type reference,
+    // not a nested interface declaration; it must not unbalance the token
+    // capture and swallow the declarations that follow.
+    std::string text = R"(
+interface I;
+  virtual interface bus_if v;
+  typedef virtual interface bus_if vb_t;
+endinterface
+module after_mod;
+  wire w;
+endmodule
+)";
+
+    ParserOptions popts;
+    popts.deferModuleBodies = true;
+
+    SourceManager sm;
+    auto tree = SyntaxTree::fromFileInMemory(text, sm, "vi.sv", "vi.sv", Bag(popts));
+    REQUIRE(tree);
+    CHECK(tree->diagnostics().empty());
+
+    auto& unit = tree->root().as<CompilationUnitSyntax>();
+    REQUIRE(unit.members.size() == 2);
+
+    for (auto member : unit.members)
+        tree->expandDeferredBody(member->as<ModuleDeclarationSyntax>());
+
+    CHECK(SyntaxPrinter::printFile(*tree) == text);
+    CHECK(tree->diagnostics().empty());
+}
@@ -3,10 +3,13 @@
 
 #include "Test.h"
 
+#include "slang/ast/ElabCache.h"
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/ast/symbols/ParameterSymbols.h"
+#include "slang/ast/symbols/VariableSymbols.h"
+#include "slang/ast/types/Type.h"
 #include "slang/text/SourceManager.h"
 
 TEST_CASE("Finding top level") {
@@ -71,6 +74,60 @@ endmodule
     CHECK(root.topInstances[0]->name == "Top");
 }
 
+TEST_CASE("Identical parameter values are shared across instances") {
+    auto tree = SyntaxTree::fromText(R"(
+module Leaf #(parameter int unsigned W = 8, parameter int V[3] = '{1,2,3}) ();
+endmodule
+
+module Top;
+    Leaf #(.W(123456), .V('{7,8,9})) l1();
+    Leaf #(.W(123456), .V('{7,8,9})) l2();
+    Leaf #(.W(123456)) l3();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& top = compilation.getRoot().topInstances[0]->body;
+    auto& w1 = top.find<InstanceSymbol>("l1").body.find<ParameterSymbol>("W");
+    auto& w2 = top.find<InstanceSymbol>("l2").body.find<ParameterSymbol>("W");
+    auto& v1 = top.find<InstanceSymbol>("l1").body.find<ParameterSymbol>("V");
+    auto& v2 = top.find<InstanceSymbol>("l2").body.find<ParameterSymbol>("V");
+    auto& v3 = top.find<InstanceSymbol>("l3").body.find<ParameterSymbol>("V");
+
+    CHECK(w1.getValue().integer() == 123456);
+    CHECK(&w1.getValue() == &w2.getValue());
+    CHECK(&v1.getValue() == &v2.getValue());
+    CHECK(&v1.getValue() != &v3.getValue());
+}
+
+TEST_CASE("Parameter interning doesn't merge different representations") {
+    // exactlyEqual considers integers of different widths equal after
+    // extension, so the intern table must compare representations, not
+    // logical values; otherwise B below would share A's 64-bit storage
+    // and {B, B} would fold to a 128-bit value.
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    localparam logic [63:0] A = 64'd200;
+    localparam logic [7:0] B = 8'd200;
+    localparam logic [15:0] C = {B, B};
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& body = compilation.getRoot().topInstances[0]->body;
+    auto& b = body.find<ParameterSymbol>("B");
+    auto& c = body.find<ParameterSymbol>("C");
+    CHECK(b.getValue().integer().getBitWidth() == 8);
+    CHECK(c.getValue().integer().getBitWidth() == 16);
+    CHECK(c.getValue().integer() == 0xC8C8);
+}
+
 TEST_CASE("Duplicate module") {
     auto tree = SyntaxTree::fromText(R"(
 module top #(parameter int foo = 3) ();
@@ -852,6 +909,64 @@ endmodule
     CHECK(diags[0].code == diag::MaxGenerateStepsExceeded);
 }
 
+TEST_CASE("Generate loops -- genvar-independent entry sharing") {
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    for (genvar i = 0; i < 16; i++) begin : g1
+        wire w = 1;
+    end
+    for (genvar i = 0; i < 16; i++) begin : g2
+        wire [i:0] w;
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& top = compilation.getRoot().lookupName<InstanceSymbol>("top").body;
+    CHECK(top.find<GenerateBlockArraySymbol>("g1").genvarIndependent);
+    CHECK(!top.find<GenerateBlockArraySymbol>("g2").genvarIndependent);
+
+    // Errors inside a shared body are still reported.
+    auto tree2 = SyntaxTree::fromText(R"(
+module top;
+    for (genvar i = 0; i < 16; i++) begin : g1
+        assign foo = 1;
+    end
+endmodule
+)");
+
+    Compilation compilation2;
+    compilation2.addSyntaxTree(tree2);
+
+    auto& diags = compilation2.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::UndeclaredIdentifier);
+}
+
+TEST_CASE("Generate loop sharing keeps drivers of outside names") {
+    // The entries are genvar-independent but each one drives the module
+    // variable x, so sharing the first entry's checking pass would drop
+    // the other entries' drivers and hide the multi-driver error.
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    logic x;
+    for (genvar i = 0; i < 4; i++) begin : g
+        always_comb x = 1;
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::MultipleAlwaysAssigns);
+}
+
 TEST_CASE("Single-unit multi-file") {
     SourceManager& sourceManager = SyntaxTree::getDefaultSourceManager();
     std::array<SourceBuffer, 2> buffers;
@@ -1184,6 +1299,66 @@ endmodule
     CHECK(param("top.m1.q.n1.bar.n2.bar.n2.foo") == 6);
 }
 
+TEST_CASE("defparam order independence") {
+    // These defparams can't affect each other, which lets resolution
+    // prove the first set of values is final and skip the fixpoint loop.
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    m m1();
+    m m2();
+
+    defparam m1.a = 10;
+    defparam m2.a = 20;
+endmodule
+
+module m;
+    parameter a = 1;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto param = [&](auto name) {
+        return compilation.getRoot().lookupName<ParameterSymbol>(name).getValue().integer();
+    };
+
+    CHECK(param("top.m1.a") == 10);
+    CHECK(param("top.m2.a") == 20);
+}
+
+TEST_CASE("Instance path trie interning") {
+    InstancePath a, b, c;
+    for (uint32_t i = 0; i < 4; i++)
+        a.entries.push_back(i);
+
+    b.entries = a.entries;
+    b.entries.push_back(7);
+
+    c.entries.push_back(0);
+    c.entries.push_back(9);
+
+    InstancePathTrie trie;
+    auto na = trie.insert(a);
+    auto nb = trie.insert(b);
+    auto nc = trie.insert(c);
+
+    // Handles are stable and compare by pointer.
+    CHECK(trie.insert(a) == na);
+    CHECK(na != nb);
+
+    // Shared prefixes resolve to the same nodes.
+    CHECK(nb->parent == na);
+    CHECK(nc->parent != nullptr);
+    CHECK(InstancePathTrie::isPrefixOf(*nc->parent, *na));
+
+    CHECK(InstancePathTrie::isPrefixOf(*na, *nb));
+    CHECK(!InstancePathTrie::isPrefixOf(*nb, *na));
+    CHECK(!InstancePathTrie::isPrefixOf(*na, *nc));
+    CHECK(InstancePathTrie::isPrefixOf(*na, *na));
+}
+
 TEST_CASE("defparam error cases") {
     auto tree = SyntaxTree::fromText(R"(
 module top;
@@ -2249,3 +2424,270 @@ endmodule
     CHECK(diags[0].code == diag::InfoTask);
     CHECK(diags[1].code == diag::InfoTask);
 }
+
+TEST_CASE("Instance array element dedup") {
+    auto tree = SyntaxTree::fromText(R"(
+module cell #(parameter int W = 4) (input logic clk);
+    logic [W-1:0] data;
+endmodule
+
+module top;
+    logic clk;
+    cell c[0:63] (.clk);
+
+    defparam c[3].W = 8;
+
+    wire [7:0] probe1 = c[3].data;
+    wire [3:0] probe2 = c[5].data;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // Element 3 has a per-element override so it must not share the template
+    // element's checking pass; element 5 does, but hierarchical references
+    // into it still elaborate its body on demand.
+    auto& arr = compilation.getRoot().lookupName<InstanceArraySymbol>("top.c");
+    auto& c3 = arr.elements[3]->as<InstanceSymbol>();
+    auto& c5 = arr.elements[5]->as<InstanceSymbol>();
+    CHECK(c3.body.find<VariableSymbol>("data").getType().getBitWidth() == 8);
+    CHECK(c5.body.find<VariableSymbol>("data").getType().getBitWidth() == 4);
+}
+
+TEST_CASE("Instance array dedup keeps hierarchical drivers") {
+    // Skipping elaboration of elements 1..N-1 must not skip their driver
+    // registration: every element drives top.w here, so the multi-driver
+    // error has to appear just like it would for separately named instances.
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    always_comb top.w = 1;
+endmodule
+
+module top;
+    logic w;
+    m m1[3:0]();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::MultipleAlwaysAssigns);
+}
+
+TEST_CASE("Instance array dedup keeps upward-resolved plain name drivers") {
+    // A nested definition drives an enclosing module's variable through a
+    // plain unqualified name -- no hierarchical syntax involved. Each array
+    // element still contributes its own driver, so dedup must stay out of
+    // the way here too.
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    logic w;
+    module child;
+        always_comb w = 1;
+    endmodule
+    child c[2]();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::MultipleAlwaysAssigns);
+}
+
+TEST_CASE("Instance array dedup keeps $unit drivers") {
+    // Same idea via the other plain-name escape hatch: a $unit variable
+    // driven from inside the arrayed module.
+    auto tree = SyntaxTree::fromText(R"(
+bit g;
+
+module m;
+    always_comb g = 1;
+endmodule
+
+module top;
+    m m1[2]();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::MultipleAlwaysAssigns);
+}
+
+TEST_CASE("Compilation cancellation") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    int i = 1;
+endmodule
+)");
+
+    std::atomic<bool> flag(false);
+    CompilationOptions options;
+    options.cancellationToken = CancellationToken(flag);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    // Cancel only after construction so that the request is observed at an
+    // elaboration boundary rather than during setup.
+    flag.store(true);
+    CHECK_THROWS_AS(compilation.getAllDiagnostics(), CancellationException);
+}
+
+TEST_CASE("Compilation progress callback") {
+    auto tree = SyntaxTree::fromText(R"(
+module Leaf #(parameter int p = 0);
+    int i = p;
+endmodule
+
+module top;
+    for (genvar i = 0; i < 300; i++) begin : g
+        Leaf #(i) l();
+    end
+endmodule
+)");
+
+    size_t calls = 0;
+    CompilationProgress last;
+    CompilationOptions options;
+    options.progressCallback = [&](const CompilationProgress& p) {
+        calls++;
+        CHECK(p.filesAdded >= last.filesAdded);
+        CHECK(p.instancesCreated >= last.instancesCreated);
+        CHECK(p.instancesChecked >= last.instancesChecked);
+        last = p;
+    };
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    CHECK(calls == 1);
+    CHECK(last.filesAdded == 1);
+
+    // Each generate entry has distinct parameter values so the checking pass
+    // can't dedup them; with 300 bodies created and checked we're guaranteed
+    // to cross the rate limiting threshold at least twice.
+    NO_COMPILATION_ERRORS;
+    CHECK(calls > 2);
+    CHECK(last.instancesCreated > 0);
+    CHECK(last.instancesChecked > 0);
+}
+
+TEST_CASE("Persistent elaboration cache across runs") {
+    auto dir = fs::temp_directory_path() / "slang_elabcache_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto cachePath = dir / "elab.cache";
+
+    std::string leafText = R"(
+module Leaf #(parameter int W = 8)(input logic [W-1:0] in, output logic [W-1:0] out);
+    assign out = ~in;
+endmodule
+)";
+    std::string topText = R"(
+module top;
+    logic [15:0] a, b;
+    Leaf #(16) l1(a, b);
+endmodule
+)";
+
+    auto compile = [&](const std::string& leaf) {
+        auto cache = ElabCache::open(cachePath);
+
+        CompilationOptions coptions;
+        coptions.elabCache = cache;
+        Bag options;
+        options.set(coptions);
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(SyntaxTree::fromText(leaf));
+        compilation.addSyntaxTree(SyntaxTree::fromText(topText));
+        NO_COMPILATION_ERRORS;
+
+        CHECK(cache->save());
+        return std::pair{cache->hits(), cache->entryCount()};
+    };
+
+    // Cold run: nothing to hit, clean bodies get recorded.
+    auto [hits1, entries1] = compile(leafText);
+    CHECK(hits1 == 0);
+    CHECK(entries1 > 0);
+
+    // Unchanged design: the top body hits and skips its whole subtree.
+    auto [hits2, entries2] = compile(leafText);
+    CHECK(hits2 > 0);
+    CHECK(entries2 == entries1);
+
+    // Changing a leaf module invalidates its fingerprint and, transitively,
+    // that of everything instantiating it.
+    auto modified = leafText;
+    modified.replace(modified.find("~in"), 3, "in");
+    auto [hits3, entries3] = compile(modified);
+    CHECK(hits3 == 0);
+    CHECK(entries3 > entries1);
+
+    fs::remove_all(dir);
+}
+
+TEST_CASE("Elaboration cache never hides hierarchical driver errors") {
+    auto dir = fs::temp_directory_path() / "slang_elabcache_hier_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    auto cachePath = dir / "elab.cache";
+
+    // child drives a name outside its own body, so it must never be
+    // recorded as clean: its driver isn't covered by the fingerprint, and
+    // a cached skip would hide conflicts added elsewhere later.
+    std::string childText = R"(
+module child;
+    always_comb top.w = 1;
+endmodule
+)";
+
+    auto compile = [&](const std::string& topText) {
+        auto cache = ElabCache::open(cachePath);
+
+        CompilationOptions coptions;
+        coptions.elabCache = cache;
+        Bag options;
+        options.set(coptions);
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(SyntaxTree::fromText(childText));
+        compilation.addSyntaxTree(SyntaxTree::fromText(topText));
+
+        auto count = compilation.getAllDiagnostics().size();
+        CHECK(cache->save());
+        return count;
+    };
+
+    // Run 1: the design is clean.
+    CHECK(compile(R"(
+module top;
+    logic w;
+    child c();
+endmodule
+)") == 0);
+
+    // Run 2: a second driver added in top must be reported even though
+    // child's own source is unchanged from the clean run.
+    CHECK(compile(R"(
+module top;
+    logic w;
+    child c();
+    always_comb w = 0;
+endmodule
+)") == 1);
+
+    fs::remove_all(dir);
+}
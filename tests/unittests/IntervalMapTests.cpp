@@ -227,3 +227,66 @@ TEST_CASE("IntervalMap -- pseudorandom union testing") {
 
     CHECK(std::distance(map.begin(), map.end()) == 34);
 }
+
+TEST_CASE("IntervalMap -- bulk build") {
+    using Map = IntervalMap<int32_t, int32_t>;
+    BumpAllocator ba;
+    Map::allocator_type alloc(ba);
+
+    // Small builds stay in the root leaf.
+    {
+        Map map;
+        std::vector<std::pair<int32_t, int32_t>> intervals = {{1, 10}, {2, 12}, {32, 42}};
+        std::vector<int32_t> values = {1, 2, 3};
+        map.build(intervals, values, alloc);
+        map.verify();
+
+        CHECK(std::distance(map.begin(), map.end()) == 3);
+        CHECK(map.getBounds() == std::pair{1, 42});
+    }
+
+    // Large builds create a branched tree; results should match
+    // the same data added via repeated insertion.
+    Map built, inserted;
+    std::vector<std::pair<int32_t, int32_t>> intervals;
+    std::vector<int32_t> values;
+
+    std::mt19937 mt;
+    for (int32_t i = 0; i < 5000; i++) {
+        int32_t left = getUniformIntDist(mt, 1, 100000);
+        int32_t right = left + getUniformIntDist(mt, 0, 50);
+        intervals.push_back({left, right});
+    }
+
+    std::ranges::sort(intervals);
+    for (size_t i = 0; i < intervals.size(); i++)
+        values.push_back(int32_t(i));
+
+    built.build(intervals, values, alloc);
+    built.verify();
+
+    for (size_t i = 0; i < intervals.size(); i++)
+        inserted.insert(intervals[i], values[i], alloc);
+    inserted.verify();
+
+    CHECK(std::equal(built.begin(), built.end(), inserted.begin(), inserted.end()));
+
+    auto collectOverlaps = [](const Map& map, int32_t left, int32_t right) {
+        std::vector<int32_t> result;
+        for (auto it = map.find(left, right); it.valid(); ++it)
+            result.push_back(*it);
+        std::ranges::sort(result);
+        return result;
+    };
+
+    for (int32_t i = 0; i < 100; i++) {
+        int32_t left = getUniformIntDist(mt, 1, 100000);
+        int32_t right = left + getUniformIntDist(mt, 0, 500);
+        CHECK(collectOverlaps(built, left, right) == collectOverlaps(inserted, left, right));
+    }
+
+    // The map remains usable for further insertion after building.
+    built.insert(5, 100000, -1, alloc);
+    built.verify();
+    CHECK(std::distance(built.begin(), built.end()) == 5001);
+}
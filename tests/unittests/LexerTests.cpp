@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <fmt/format.h>
 
 #include "slang/parsing/Preprocessor.h"
 #include "slang/syntax/AllSyntax.h"
@@ -378,6 +379,29 @@ TEST_CASE("String literal (escapes)") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("String literal (long run with escapes)") {
+    // Long enough to exercise the vectorized run scanner, with escapes
+    // interleaved so it has to fall back to scalar handling in between.
+    std::string prefix(40, 'x');
+    std::string suffix(70, 'y');
+    std::string text = "\"" + prefix + "\\n\\\"" + suffix + "\"";
+    Token token = lexToken(text);
+
+    CHECK(token.kind == TokenKind::StringLiteral);
+    CHECK(token.toString() == text);
+    CHECK(token.valueText() == prefix + "\n\"" + suffix);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Escaped Identifiers (long run)") {
+    std::string text = "\\" + std::string(100, 'q') + "!#$" + std::string(100, 'r');
+    Token token = lexToken(text + " tail");
+
+    CHECK(token.kind == TokenKind::Identifier);
+    CHECK(token.toString() == text);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("String literal (octal escape)") {
     auto& text = "\"literal\\377\"";
     Token token = lexToken(text);
@@ -753,6 +777,116 @@ TEST_CASE("Too many errors") {
     CHECK(diagnostics.back().code == diag::TooManyLexerErrors);
 }
 
+TEST_CASE("Minimal trivia mode") {
+    LexerOptions options;
+    options.minimalTrivia = true;
+
+    diagnostics.clear();
+    auto buffer = getSourceManager().assignText(
+        "  // comment\n  /* block */ foo /* multi\nline */ bar // cont \\\nbaz");
+    Lexer lexer(buffer, alloc, diagnostics, options);
+
+    // Whitespace, the line comment, and the single-line block comment are all
+    // dropped; the newline is still recorded since it's line significant.
+    Token token = lexer.lex();
+    CHECK(token.kind == TokenKind::Identifier);
+    REQUIRE(token.trivia().size() == 1);
+    CHECK(token.trivia()[0].kind == TriviaKind::EndOfLine);
+    CHECK(!token.isOnSameLine());
+
+    // A block comment containing a newline is kept.
+    token = lexer.lex();
+    CHECK(token.kind == TokenKind::Identifier);
+    REQUIRE(token.trivia().size() == 1);
+    CHECK(token.trivia()[0].kind == TriviaKind::BlockComment);
+    CHECK(!token.isOnSameLine());
+
+    // A line comment with a trailing line continuation is kept.
+    token = lexer.lex();
+    CHECK(token.kind == TokenKind::Identifier);
+    REQUIRE(token.trivia().size() == 2);
+    CHECK(token.trivia()[0].kind == TriviaKind::LineComment);
+    CHECK(token.trivia()[1].kind == TriviaKind::EndOfLine);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Collapsed trivia mode") {
+    LexerOptions options;
+    options.collapseTrivia = true;
+
+    diagnostics.clear();
+    auto buffer = getSourceManager().assignText(
+        "  \n  /* block */ foo // line\n/* multi\nline */ bar");
+    Lexer lexer(buffer, alloc, diagnostics, options);
+
+    // The leading whitespace, newline, and block comment collapse into a
+    // single piece referencing the original source text.
+    Token token = lexer.lex();
+    CHECK(token.kind == TokenKind::Identifier);
+    REQUIRE(token.trivia().size() == 1);
+
+    Trivia collapsed = token.trivia()[0];
+    CHECK(collapsed.kind == TriviaKind::CollapsedText);
+    CHECK(collapsed.getRawText() == "  \n  /* block */ ");
+    CHECK(!token.isOnSameLine());
+
+    // Expansion materializes the individual pieces, rebased onto the
+    // original source text.
+    SmallVector<Trivia> expanded;
+    Lexer::expandTrivia(collapsed, expanded);
+    REQUIRE(expanded.size() == 5);
+    CHECK(expanded[0].kind == TriviaKind::Whitespace);
+    CHECK(expanded[1].kind == TriviaKind::EndOfLine);
+    CHECK(expanded[2].kind == TriviaKind::Whitespace);
+    CHECK(expanded[3].kind == TriviaKind::BlockComment);
+    CHECK(expanded[4].kind == TriviaKind::Whitespace);
+    CHECK(expanded[3].getRawText() == "/* block */");
+    CHECK(expanded[3].getRawText().data() == collapsed.getRawText().data() + 5);
+
+    // Line comments are never collapsed since they can carry a trailing
+    // line continuation.
+    token = lexer.lex();
+    CHECK(token.kind == TokenKind::Identifier);
+    REQUIRE(token.trivia().size() == 3);
+    CHECK(token.trivia()[0].kind == TriviaKind::Whitespace);
+    CHECK(token.trivia()[1].kind == TriviaKind::LineComment);
+    CHECK(token.trivia()[2].kind == TriviaKind::CollapsedText);
+    CHECK(token.trivia()[2].getRawText() == "\n/* multi\nline */ ");
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("String literal deduplication") {
+    std::string longText(80, 'q');
+    auto source = fmt::format("\"{0}\" \"{0}\" \"ab\" \"ab\"", longText);
+
+    StringInterner interner;
+    LexerOptions options;
+    options.literalInterner = &interner;
+
+    diagnostics.clear();
+    auto buffer = getSourceManager().assignText(std::string_view(source));
+    Lexer lexer(buffer, alloc, diagnostics, options);
+
+    // Both copies of the long literal share the same canonical storage.
+    Token first = lexer.lex();
+    Token second = lexer.lex();
+    REQUIRE(first.kind == TokenKind::StringLiteral);
+    REQUIRE(second.kind == TokenKind::StringLiteral);
+    CHECK(first.valueText() == longText);
+    CHECK(first.valueText().data() == second.valueText().data());
+    CHECK(interner.size() == 1);
+
+    // Short literals cost less to copy than to deduplicate,
+    // so they still get their own storage per occurrence.
+    Token third = lexer.lex();
+    Token fourth = lexer.lex();
+    CHECK(third.valueText() == "ab");
+    CHECK(fourth.valueText() == "ab");
+    CHECK(third.valueText().data() != fourth.valueText().data());
+    CHECK(interner.size() == 1);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 void testKeyword(TokenKind kind) {
     auto text = LF::getTokenKindText(kind);
     Token token = lexToken(text);
@@ -204,6 +204,44 @@ endmodule
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Wildcard import lookup 5") {
+    // Exercises the per-package import name filter: repeated misses against
+    // the first package, hits on plain members, enum members (which live in
+    // the name map as transparent members), and an exported name.
+    auto tree = SyntaxTree::fromText(R"(
+package p1;
+    parameter int a = 1;
+    typedef enum { RED, GREEN, BLUE } color_t;
+endpackage
+
+package p2;
+    import p1::*;
+    export p1::a;
+    parameter int b = a + 1;
+endpackage
+
+module top;
+    import p1::*;
+    import p2::*;
+
+    localparam int v1 = a;
+    localparam int v2 = b;
+    localparam color_t v3 = GREEN;
+    localparam int v4 = BLUE;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    const auto& top = *compilation.getRoot().topInstances[0];
+    CHECK(top.body.find<ParameterSymbol>("v1").getValue().integer() == 1);
+    CHECK(top.body.find<ParameterSymbol>("v2").getValue().integer() == 2);
+    CHECK(top.body.find<ParameterSymbol>("v4").getValue().integer() == 2);
+
+    NO_COMPILATION_ERRORS;
+}
+
 TEST_CASE("Package references") {
     auto tree = SyntaxTree::fromText(R"(
 package ComplexPkg;
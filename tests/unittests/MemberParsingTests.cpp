@@ -1107,3 +1107,85 @@ endmodule
     REQUIRE(diagnostics.size() == 1);
     CHECK(diagnostics[0].code == diag::BindDirectiveInvalidName);
 }
+
+TEST_CASE("Stop on first parse error") {
+    auto& text = R"(
+module m;
+    assign foo = ;
+endmodule
+
+module n;
+    assign bar = ;
+endmodule
+)";
+
+    BumpAllocator alloc;
+    Diagnostics diags;
+    Preprocessor preprocessor(SyntaxTree::getDefaultSourceManager(), alloc, diags);
+    preprocessor.pushSource(std::string_view(text), "source");
+
+    Bag options;
+    ParserOptions parserOptions;
+    parserOptions.stopOnFirstError = true;
+    options.set(parserOptions);
+
+    Parser parser(preprocessor, options);
+    auto& unit = parser.parseCompilationUnit();
+
+    // Parsing aborted inside the first module, so the second one was never
+    // parsed and its error doesn't appear in the diagnostics.
+    CHECK(unit.members.empty());
+    REQUIRE(!diags.empty());
+    CHECK(diags[0].isError());
+
+    size_t secondModule = std::string_view(text).find("module n");
+    for (auto& diag : diags)
+        CHECK(diag.location.offset() < secondModule);
+}
+
+TEST_CASE("Parse error limit abandons hopeless input") {
+    std::string text = "module m;\n";
+    for (int i = 0; i < 100; i++)
+        text += "    assign = ;\n";
+    text += "endmodule\n";
+
+    BumpAllocator alloc;
+    Diagnostics diags;
+    Preprocessor preprocessor(SyntaxTree::getDefaultSourceManager(), alloc, diags);
+    preprocessor.pushSource(text, "source");
+
+    Bag options;
+    ParserOptions parserOptions;
+    parserOptions.errorLimit = 10;
+    options.set(parserOptions);
+
+    Parser parser(preprocessor, options);
+    auto& unit = parser.parseCompilationUnit();
+
+    // Once the budget was exhausted the rest of the unit was abandoned, so
+    // we see far fewer diagnostics than the hundred errors in the input.
+    CHECK(unit.members.empty());
+    REQUIRE(!diags.empty());
+    CHECK(diags.back().code == diag::TooManyParseErrors);
+    CHECK(diags.size() < 20);
+}
+
+TEST_CASE("Nested ambiguous instantiation parsing") {
+    // Exercises the memoized disambiguation scans: the parameterized names
+    // below get asked the same instantiation-vs-declaration questions from
+    // several enclosing decision points.
+    auto& text = R"(
+module m;
+    foo #(.A(bar #(.B(1))::baz), .C(bar #(.D(2))::baz)) u1 (.*);
+    foo #(bar #(bar #(bar #(1)::V)::V)::V) u2 ();
+    bar #(.B(1))::qux #(.E(3)) v1 [1:0];
+    initial begin
+        automatic bar #(.B(1))::qux #(.E(3)) v2 = w ? x : y;
+        v2 = cond ? bar #(.B(2))::qux #(.E(3))'(z) : v2;
+    end
+endmodule
+)";
+
+    parseCompilationUnit(text);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
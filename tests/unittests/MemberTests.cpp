@@ -6,6 +6,7 @@
 #include "slang/ast/ASTSerializer.h"
 #include "slang/ast/Definition.h"
 #include "slang/ast/Statements.h"
+#include "slang/ast/SymbolNameIndex.h"
 #include "slang/ast/expressions/AssignmentExpressions.h"
 #include "slang/ast/expressions/CallExpression.h"
 #include "slang/ast/expressions/OperatorExpressions.h"
@@ -63,6 +64,40 @@ endmodule
     CHECK(diags[5].code == diag::DelayNotNumeric);
 }
 
+TEST_CASE("Declarator lists share one resolved type") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    wire [7:0] a, b, c [3:0];
+    int x, y, z [2];
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& top = compilation.getRoot().lookupName<InstanceSymbol>("m").body;
+    CHECK(top.find<NetSymbol>("b").getType().toString() == "logic[7:0]");
+    CHECK(top.find<NetSymbol>("c").getType().toString() == "logic[7:0]$[3:0]");
+    CHECK(top.find<VariableSymbol>("y").getType().toString() == "int");
+    CHECK(top.find<VariableSymbol>("z").getType().toString() == "int$[0:1]");
+
+    // Invalid net types are still diagnosed once per declarator.
+    auto tree2 = SyntaxTree::fromText(R"(
+module m;
+    wire real r1, r2;
+endmodule
+)");
+
+    Compilation compilation2;
+    compilation2.addSyntaxTree(tree2);
+
+    auto& diags = compilation2.getAllDiagnostics();
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].code == diag::InvalidNetType);
+    CHECK(diags[1].code == diag::InvalidNetType);
+}
+
 TEST_CASE("Bad signed specifier") {
     auto tree = SyntaxTree::fromText(R"(
 module Top;
@@ -514,6 +549,103 @@ endmodule
 })");
 }
 
+TEST_CASE("JSON dump -- parallel matches single-threaded") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf #(parameter int W = 4) (input logic [W-1:0] in, output logic [W-1:0] out);
+    assign out = ~in;
+endmodule
+
+module top1;
+    logic [7:0] a, b;
+    leaf #(8) l(a, b);
+endmodule
+
+module top2;
+    logic [3:0] c, d;
+    leaf l(c, d);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    JsonWriter writer;
+    writer.setPrettyPrint(true);
+
+    ASTSerializer serializer(compilation, writer);
+    serializer.setIncludeAddresses(false);
+    serializer.serialize(compilation.getRoot());
+
+    auto parallel = ASTSerializer::serializeParallel(compilation, 4, /* prettyPrint */ true,
+                                                     /* includeAddresses */ false);
+    CHECK(parallel == std::string(writer.view()));
+}
+
+TEST_CASE("JSON dump -- parallel elaborates dedup-skipped bodies") {
+    // The diagnostic walk skips the bodies of instance array elements past
+    // the first; the pre-serialization forced elaboration must visit them
+    // anyway so that the workers never race on lazy binding, and the output
+    // must not depend on the thread count.
+    auto text = R"(
+module m(input logic i, output logic o);
+    assign o = ~i;
+endmodule
+
+module top;
+    logic [3:0] a, b;
+    m arr[3:0](a, b);
+endmodule
+)";
+
+    auto serialize = [&](uint32_t threads) {
+        auto tree = SyntaxTree::fromText(text);
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        CHECK(compilation.getAllDiagnostics().empty());
+        return ASTSerializer::serializeParallel(compilation, threads, /* prettyPrint */ true,
+                                                /* includeAddresses */ false);
+    };
+
+    CHECK(serialize(4) == serialize(1));
+}
+
+TEST_CASE("Symbol name index round trip") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf;
+    int count;
+endmodule
+
+module top;
+    logic [3:0] data;
+    leaf l1();
+    leaf l2();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto data = SymbolNameIndex::serialize(compilation);
+    auto index = SymbolNameIndex::fromMemory(data);
+    REQUIRE(index);
+    CHECK(index->size() > 0);
+
+    auto entries = index->lookup("data");
+    REQUIRE(entries.size() == 1);
+    CHECK(entries[0].path == "top.data");
+    CHECK(entries[0].kind == "Variable");
+    CHECK(entries[0].line == 7);
+
+    // Multiply-instantiated bodies are indexed once, under the canonical instance.
+    entries = index->lookup("count");
+    REQUIRE(entries.size() == 1);
+    CHECK(entries[0].path == "top.l1.count");
+
+    CHECK(index->lookup("missing").empty());
+}
+
 TEST_CASE("Attributes") {
     auto tree = SyntaxTree::fromText(R"(
 module m;
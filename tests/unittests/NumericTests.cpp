@@ -819,3 +819,43 @@ value = value >> 1
     compilation.addSyntaxTree(tree);
     compilation.getAllDiagnostics();
 }
+
+TEST_CASE("SVInt hashing and key equality") {
+    // Equal keys must hash equal, across the single-word fast path and the
+    // multiword and four-state slow paths.
+    std::hash<SVInt> hasher;
+    std::equal_to<SVInt> eq;
+
+    SVInt a(32, 12345, false);
+    SVInt b(32, 12345, false);
+    SVInt c(32, 54321, false);
+    CHECK(eq(a, b));
+    CHECK(hasher(a) == hasher(b));
+    CHECK(!eq(a, c));
+
+    SVInt wide1 = SVInt::fromString("128'hdeadbeef_cafef00d_12345678_9abcdef0"sv);
+    SVInt wide2 = SVInt::fromString("128'hdeadbeef_cafef00d_12345678_9abcdef0"sv);
+    CHECK(eq(wide1, wide2));
+    CHECK(hasher(wide1) == hasher(wide2));
+    CHECK(!eq(wide1, a));
+
+    SVInt unknown1 = SVInt::fromString("32'b10xz"sv);
+    SVInt unknown2 = SVInt::fromString("32'b10xz"sv);
+    SVInt unknown3 = SVInt::fromString("32'b10x1"sv);
+    CHECK(eq(unknown1, unknown2));
+    CHECK(hasher(unknown1) == hasher(unknown2));
+    CHECK(!eq(unknown1, unknown3));
+
+    // The equality specialization agrees with exactlyEqual for mixed widths.
+    SVInt small(8, 255, false);
+    SVInt big(16, 255, false);
+    CHECK(eq(small, big) == exactlyEqual(small, big));
+
+    std::hash<ConstantValue> cvHasher;
+    std::equal_to<ConstantValue> cvEq;
+    ConstantValue cv1(a), cv2(b), cv3(c);
+    CHECK(cvEq(cv1, cv2));
+    CHECK(cvHasher(cv1) == cvHasher(cv2));
+    CHECK(!cvEq(cv1, cv3));
+    CHECK(!cvEq(cv1, ConstantValue("12345"s)));
+}
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "Test.h"
+#include <chrono>
+
+// These tests run a curated corpus of pathological inputs, distilled from
+// fuzzing finds that previously triggered quadratic behavior, under loose
+// time and memory budgets. The budgets are an order of magnitude above what
+// the cases take even on a slow debug build, so only algorithmic complexity
+// regressions should trip them, not machine noise.
+namespace {
+
+constexpr double timeBudgetSeconds = 10.0;
+constexpr size_t arenaBytesPerInputByte = 100;
+
+std::shared_ptr<SyntaxTree> parseWithinBudget(const std::string& text) {
+    auto start = std::chrono::steady_clock::now();
+    auto tree = SyntaxTree::fromText(text);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                         .count();
+    CHECK(elapsed < timeBudgetSeconds);
+
+    // The syntax arena should grow linearly with the input; a superlinear
+    // blowup here means something is duplicating tokens or nodes.
+    auto stats = tree->allocator().getStats();
+    CHECK(stats.allocatedBytes < arenaBytesPerInputByte * text.size());
+
+    return tree;
+}
+
+} // namespace
+
+TEST_CASE("Perf regression -- deeply nested parentheses") {
+    // Nesting stays under the parser's recursion limit; the point is the
+    // cost per level, not the depth diagnostic.
+    std::string text = "module m;\n";
+    for (int i = 0; i < 50; i++) {
+        text += "    localparam int p" + std::to_string(i) + " = ";
+        text.append(900, '(');
+        text += "1";
+        text.append(900, ')');
+        text += ";\n";
+    }
+    text += "endmodule\n";
+
+    parseWithinBudget(text);
+}
+
+TEST_CASE("Perf regression -- long macro expansion chains") {
+    std::string text = "`define M0 1\n";
+    for (int i = 1; i <= 500; i++)
+        text += "`define M" + std::to_string(i) + " (`M" + std::to_string(i - 1) + " + 1)\n";
+
+    text += "module m;\n";
+    for (int i = 0; i < 50; i++)
+        text += "    localparam int p" + std::to_string(i) + " = `M500;\n";
+    text += "endmodule\n";
+
+    parseWithinBudget(text);
+}
+
+TEST_CASE("Perf regression -- giant concatenation") {
+    std::string text = "module m;\n    wire [19999:0] w;\n    assign w = {";
+    for (int i = 0; i < 20000; i++) {
+        if (i != 0)
+            text += ", ";
+        text += "1'b1";
+    }
+    text += "};\nendmodule\n";
+
+    parseWithinBudget(text);
+}
+
+TEST_CASE("Perf regression -- long binary operator chain") {
+    // Left-associative chains should iterate, not recurse, and should not
+    // reshuffle already-parsed operands as the chain grows.
+    std::string text = "module m;\n    localparam int p = 1";
+    for (int i = 0; i < 20000; i++)
+        text += " + 1";
+    text += ";\nendmodule\n";
+
+    parseWithinBudget(text);
+}
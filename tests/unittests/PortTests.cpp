@@ -1686,3 +1686,43 @@ endmodule
     compilation.addSyntaxTree(tree);
     NO_COMPILATION_ERRORS;
 }
+
+TEST_CASE("Port connection resolution caching for instance arrays") {
+    auto tree = SyntaxTree::fromText(R"(
+module M(
+    input logic clk,
+    input logic [3:0] d,
+    input int cfg = 7,
+    output logic [3:0] q
+);
+endmodule
+
+module top;
+    logic clk;
+    logic [3:0] d;
+    logic [31:0] q;
+
+    M m [7:0] (.clk, .d, .q(q), .*);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // Rows after the first stamp their connections from the cached shapes;
+    // expressions must still bind per element so the q bus is sliced.
+    auto& array = compilation.getRoot().lookupName<InstanceArraySymbol>("top.m");
+    REQUIRE(array.elements.size() == 8);
+
+    for (auto elem : array.elements) {
+        auto& inst = elem->as<InstanceSymbol>();
+        for (auto conn : inst.getPortConnections()) {
+            if (conn->port.name == "q" || conn->port.name == "cfg") {
+                auto expr = conn->getExpression();
+                REQUIRE(expr);
+                CHECK(expr->type->getBitWidth() == (conn->port.name == "q" ? 4 : 32));
+            }
+        }
+    }
+}
@@ -284,6 +284,25 @@ TEST_CASE("Function macro (keyword as formal argument)") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Macro define with collapsed trivia mode") {
+    auto& text = R"(
+`define FOO(x) x + /* c */ \
+    1
+
+`FOO(2)
+)";
+    std::string baseline = preprocess(text);
+    CHECK_DIAGNOSTICS_EMPTY;
+
+    // Collapsed trivia gets expanded on demand when scanning the macro body,
+    // so the result should be identical to the default mode.
+    LexerOptions lexOptions;
+    lexOptions.collapseTrivia = true;
+    std::string collapsed = preprocess(text, Bag(lexOptions));
+    CHECK(collapsed == baseline);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Macro pasting (identifiers)") {
     auto& text = "`define FOO(x,y) x``_blah``y\n`FOO(   bar,    _BAZ)";
     Token token = lexToken(text);
@@ -2111,6 +2130,21 @@ hello)";
     CHECK(diagnostics[1].code == diag::ProtectedEnvelope);
 }
 
+TEST_CASE("Pragma protect base64 misplaced padding") {
+    auto& text = R"(
+`pragma protect encoding=(enctype="base64"), data_block
+ABCD====
+`pragma protect reset
+hello)";
+
+    auto result = preprocess(text);
+    CHECK(result == "\nhello");
+
+    REQUIRE(diagnostics.size() == 2);
+    CHECK(diagnostics[0].code == diag::InvalidEncodingByte);
+    CHECK(diagnostics[1].code == diag::ProtectedEnvelope);
+}
+
 TEST_CASE("Pragma protect quoted-printable errors") {
     auto& text =
         "`pragma protect encoding=(enctype=\"quoted-printable\", bytes=14), data_public_key\n"
@@ -175,6 +175,35 @@ TEST_CASE("Block statements") {
                   SyntaxKind::SequentialBlockStatement);
 }
 
+TEST_CASE("Nested block statements") {
+    auto& text = "begin : outer foo : begin end x = 1; end : outer";
+    auto& stmt = parseStatement(text);
+
+    REQUIRE(stmt.kind == SyntaxKind::SequentialBlockStatement);
+    CHECK(stmt.toString() == text);
+
+    auto& block = stmt.as<BlockStatementSyntax>();
+    REQUIRE(block.items.size() == 2);
+    CHECK(block.items[0]->kind == SyntaxKind::SequentialBlockStatement);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Deeply nested block statements") {
+    // Directly nested blocks are parsed iteratively, so generated code that
+    // nests begin/end far beyond the recursion limit still parses.
+    std::string text;
+    for (int i = 0; i < 3000; i++)
+        text += "begin ";
+    text += "x = 1;";
+    for (int i = 0; i < 3000; i++)
+        text += " end";
+
+    auto& stmt = parseStatement(text);
+    REQUIRE(stmt.kind == SyntaxKind::SequentialBlockStatement);
+    CHECK(stmt.toString() == text);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 void parseBlockDeclaration(const std::string& text) {
     auto fullText = "begin " + text + " end";
     auto& stmt = parseStatement(fullText);
@@ -448,6 +448,32 @@ endmodule
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Packed array types are uniquified") {
+    auto tree = SyntaxTree::fromText(R"(
+module Top;
+    logic [3:0][7:0] a;
+    logic [3:0][7:0] b;
+    logic [7:0][3:0] c;
+    bit [3:0][7:0] d;
+endmodule
+)");
+
+    Compilation compilation;
+    const auto& instance = evalModule(tree, compilation).body;
+
+    auto typeOf = [&](auto name) -> const Type& {
+        return instance.find<VariableSymbol>(name).getType();
+    };
+
+    // Structurally identical packed arrays share one type object.
+    CHECK(&typeOf("a") == &typeOf("b"));
+    CHECK(&typeOf("a") != &typeOf("c"));
+    CHECK(&typeOf("a") != &typeOf("d"));
+    CHECK(typeOf("a").isMatching(typeOf("b")));
+
+    NO_COMPILATION_ERRORS;
+}
+
 TEST_CASE("Unpacked array ports") {
     auto tree = SyntaxTree::fromText(R"(
 module Top(logic f[3], g, h[0:1]);
@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "Test.h"
+#include <fmt/format.h>
+
+#include "slang/parsing/Lexer.h"
+#include "slang/parsing/Parser.h"
+#include "slang/parsing/Preprocessor.h"
+#include "slang/util/Bag.h"
+#include "slang/util/BumpAllocator.h"
+#include "slang/util/Random.h"
+#include "slang/util/SafeIndexedVector.h"
+#include "slang/util/StringTable.h"
+
+TEST_CASE("StringTable -- perfect hash lookup") {
+    StringTable<int> table = {{"always", 1}, {"and", 2},    {"assign", 3},
+                              {"begin", 4},  {"module", 5}, {"endmodule", 6}};
+
+    int value = -1;
+    CHECK(table.lookup("module", value));
+    CHECK(value == 5);
+    CHECK(table.lookup("always", value));
+    CHECK(value == 1);
+
+    CHECK(!table.lookup("modul", value));
+    CHECK(!table.lookup("modules", value));
+    CHECK(!table.lookup("", value));
+    CHECK(!table.lookup(std::string_view("\0", 1), value));
+}
+
+TEST_CASE("StringInterner -- basic interning") {
+    StringInterner interner;
+
+    auto a = interner.intern("hello");
+    auto b = interner.intern(std::string("hel") + "lo");
+    CHECK(a == "hello");
+    CHECK(a.data() == b.data());
+    CHECK(interner.size() == 1);
+
+    auto c = interner.intern("world");
+    CHECK(c == "world");
+    CHECK(c.data() != a.data());
+    CHECK(interner.size() == 2);
+
+    CHECK(interner.intern("").empty());
+    CHECK(interner.size() == 3);
+}
+
+TEST_CASE("StringInterner -- growth keeps canonical views stable") {
+    StringInterner interner;
+
+    std::vector<std::pair<std::string, std::string_view>> entries;
+    for (int i = 0; i < 1000; i++) {
+        auto str = fmt::format("name{}", i);
+        entries.emplace_back(str, interner.intern(str));
+    }
+
+    CHECK(interner.size() == 1000);
+    for (auto& [str, view] : entries) {
+        auto again = interner.intern(str);
+        CHECK(again == str);
+        CHECK(again.data() == view.data());
+    }
+}
+
+TEST_CASE("BumpAllocator -- memory statistics") {
+    BumpAllocator alloc;
+    auto base = alloc.getStats();
+    CHECK(base.segmentCount >= 1);
+    CHECK(base.allocatedBytes > 0);
+
+    // Spill into several regular segments.
+    for (int i = 0; i < 1000; i++)
+        alloc.allocate(64, 8);
+
+    auto stats = alloc.getStats();
+    CHECK(stats.segmentCount > base.segmentCount);
+    CHECK(stats.usedBytes >= base.usedBytes + 64000);
+    CHECK(stats.allocatedBytes > stats.usedBytes);
+
+    // Oversized allocations get their own fully-used segment.
+    alloc.allocate(3 << 20, 8);
+    auto big = alloc.getStats();
+    CHECK(big.segmentCount == stats.segmentCount + 1);
+    CHECK(big.usedBytes >= stats.usedBytes + (3 << 20));
+
+    // Segment sizes grow geometrically, so even many megabytes of small
+    // allocations only create a handful of segments.
+    BumpAllocator growing;
+    for (int i = 0; i < (5 << 20) / 64; i++)
+        growing.allocate(64, 8);
+    CHECK(growing.getStats().segmentCount < 20);
+
+    // Stolen memory is accounted for in the new owner.
+    BumpAllocator other;
+    other.allocate(128, 8);
+    auto otherStats = other.getStats();
+    alloc.steal(std::move(other));
+
+    auto combined = alloc.getStats();
+    CHECK(combined.segmentCount == big.segmentCount + otherStats.segmentCount);
+    CHECK(combined.allocatedBytes == big.allocatedBytes + otherStats.allocatedBytes);
+}
+
+TEST_CASE("SmallVector -- arena-backed finalization") {
+    BumpAllocator alloc;
+    SmallVector<int, 2> vec(alloc);
+    for (int i = 0; i < 100; i++)
+        vec.push_back(i);
+    CHECK(!vec.isSmall());
+
+    // Finalizing a spilled arena-backed vector hands off the buffer in place
+    // and leaves the vector empty.
+    auto buffer = vec.data();
+    auto result = vec.finalize(alloc);
+    CHECK(result.data() == buffer);
+    CHECK(result.size() == 100);
+    CHECK(result[99] == 99);
+    CHECK(vec.empty());
+
+    // The unused capacity at the end of the buffer went back to the arena,
+    // so the next allocation lands right after the finalized elements.
+    auto next = alloc.allocate(sizeof(int), alignof(int));
+    CHECK(reinterpret_cast<int*>(next) == result.data() + result.size());
+
+    // A vector that never spilled falls back to copying off the stack.
+    SmallVector<int, 8> small(alloc);
+    small.push_back(42);
+    auto copied = small.finalize(alloc);
+    CHECK(copied.size() == 1);
+    CHECK(copied[0] == 42);
+    CHECK(copied.data() != small.data());
+    CHECK(small.empty());
+}
+
+TEST_CASE("Bag -- slotted and generic storage") {
+    parsing::LexerOptions lo;
+    lo.maxErrors = 7;
+
+    ast::CompilationOptions co;
+    co.maxInstanceDepth = 3;
+
+    // Well-known option types occupy fixed slots; anything else goes
+    // through the generic type-keyed map. Both must round trip.
+    Bag bag;
+    bag.set(lo);
+    bag.set(co);
+    bag.set(std::string("extension"));
+
+    REQUIRE(bag.get<parsing::LexerOptions>());
+    CHECK(bag.get<parsing::LexerOptions>()->maxErrors == 7);
+    CHECK(bag.getOrDefault<ast::CompilationOptions>().maxInstanceDepth == 3);
+    REQUIRE(bag.get<std::string>());
+    CHECK(*bag.get<std::string>() == "extension");
+
+    CHECK(!bag.get<parsing::ParserOptions>());
+    CHECK(bag.getOrDefault<parsing::PreprocessorOptions>().maxIncludeDepth > 0);
+    CHECK(!bag.get<int>());
+
+    // Overwriting replaces the stored value in place.
+    lo.maxErrors = 9;
+    bag.set(lo);
+    CHECK(bag.get<parsing::LexerOptions>()->maxErrors == 9);
+}
+
+TEST_CASE("SafeIndexedVector -- freelist reuse and compaction") {
+    enum class Idx : uint32_t { Invalid = 0 };
+    SafeIndexedVector<std::string, Idx> vec;
+    CHECK(vec.empty());
+
+    auto a = vec.add("a");
+    auto b = vec.add("b");
+    auto c = vec.add("c");
+    auto d = vec.add("d");
+    CHECK(vec.size() == 4);
+    CHECK(vec[c] == "c");
+
+    // Freed slots read back as the empty value and are recycled in
+    // LIFO order.
+    vec.remove(b);
+    vec.remove(c);
+    CHECK(vec.size() == 2);
+    CHECK(vec[b].empty());
+    CHECK(vec.add("e") == c);
+    CHECK(vec[c] == "e");
+
+    // Compaction closes the remaining hole; elements past it shift down
+    // and report their new indices through the callback.
+    vec.remove(c);
+    std::vector<std::pair<Idx, Idx>> moves;
+    vec.compact([&](Idx from, Idx to) { moves.push_back({from, to}); });
+
+    REQUIRE(moves.size() == 1);
+    CHECK(moves[0].first == d);
+    CHECK(vec[moves[0].second] == "d");
+    CHECK(vec[a] == "a");
+    CHECK(vec.size() == 3);
+
+    // No holes left, so a second compaction is a no-op.
+    vec.compact([&](Idx, Idx) { CHECK(false); });
+    CHECK(vec.size() == 3);
+}
+
+TEST_CASE("CounterRandom -- bulk generation matches scalar stream") {
+    CounterRandom gen(12345);
+    std::array<uint64_t, 64> scalar;
+    for (auto& val : scalar)
+        val = gen();
+
+    // A bulk fill of the same stream produces identical output, and the
+    // counter advances so that generation can continue seamlessly.
+    CounterRandom gen2(12345);
+    std::array<uint64_t, 64> bulk;
+    gen2.fill(std::span(bulk.data(), 32));
+    gen2.fill(std::span(bulk.data() + 32, 32));
+    CHECK(scalar == bulk);
+    CHECK(gen2() == gen());
+
+    // Any stream position is directly addressable.
+    CHECK(CounterRandom::generate(12345, 17) == scalar[17]);
+
+    // Different seeds give different streams, and outputs actually vary.
+    CounterRandom gen3(54321);
+    std::array<uint64_t, 64> other;
+    gen3.fill(other);
+    CHECK(other != bulk);
+    CHECK(std::ranges::adjacent_find(bulk) == bulk.end());
+
+    // Interops with the seeding helper and the distribution helper.
+    auto gen4 = createRandomGenerator<CounterRandom>();
+    for (int i = 0; i < 100; i++) {
+        auto val = getUniformIntDist(gen4, uint64_t(10), uint64_t(20));
+        CHECK(val >= 10);
+        CHECK(val <= 20);
+    }
+}
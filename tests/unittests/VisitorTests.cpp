@@ -8,6 +8,7 @@
 #include "slang/ast/SemanticModel.h"
 #include "slang/syntax/SyntaxPrinter.h"
 #include "slang/syntax/SyntaxVisitor.h"
+#include "slang/text/SourceManager.h"
 
 class TestRewriter : public SyntaxRewriter<TestRewriter> {
 public:
@@ -101,6 +102,79 @@ endmodule
 )");
 }
 
+TEST_CASE("Zero-copy printing coalesces source pieces") {
+    auto tree = SyntaxTree::fromText(R"(
+module M;
+    typedef enum int { FOO = 1, BAR = 2, BAZ = 3 } test_t;
+endmodule
+)");
+
+    auto print = [](const SyntaxTree& t) {
+        SyntaxPrinter printer(t.sourceManager());
+        printer.setIncludeDirectives(true)
+            .setIncludeSkipped(true)
+            .setIncludeTrivia(true)
+            .setIncludePreprocessed(false)
+            .setSquashNewlines(false)
+            .setZeroCopySources(true)
+            .print(t);
+        return printer;
+    };
+
+    // An unmodified tree prints back as a single piece referencing the
+    // original source buffer, no matter how many tokens it contains.
+    auto original = print(*tree);
+    REQUIRE(original.pieces().size() == 1);
+    CHECK(original.pieces()[0] ==
+          tree->sourceManager().getSourceText(tree->root().getFirstToken().location().buffer()));
+
+    // A single edit only breaks pieces around the changed region; the
+    // surrounding text is still referenced from the original buffer.
+    tree = TestRewriter(tree).transform(tree);
+    auto edited = print(*tree);
+    CHECK(edited.pieces().size() > 1);
+    CHECK(edited.pieces().size() < 10);
+    CHECK(edited.str() == R"(
+module M;
+    typedef enum int { FOO = 1, BAR = 2, BAZ = 3 } test_t;
+    localparam int test_t__count = 3;
+endmodule
+)");
+}
+
+TEST_CASE("Rewriting shares unchanged subtrees") {
+    auto oldTree = SyntaxTree::fromText(R"(
+module M;
+    typedef enum int { FOO = 1, BAR = 2, BAZ = 3 } test_t;
+endmodule
+
+module N;
+    int untouched;
+endmodule
+)");
+
+    auto newTree = TestRewriter(oldTree).transform(oldTree);
+    CHECK(SyntaxPrinter::printFile(*newTree) == R"(
+module M;
+    typedef enum int { FOO = 1, BAR = 2, BAZ = 3 } test_t;
+    localparam int test_t__count = 3;
+endmodule
+
+module N;
+    int untouched;
+endmodule
+)");
+
+    // Only the ancestors of edited nodes are cloned; module N contains no
+    // edits so it's shared by pointer with the original tree.
+    auto& oldMembers = oldTree->root().as<CompilationUnitSyntax>().members;
+    auto& newMembers = newTree->root().as<CompilationUnitSyntax>().members;
+    REQUIRE(oldMembers.size() == 2);
+    REQUIRE(newMembers.size() == 2);
+    CHECK(newMembers[0] != oldMembers[0]);
+    CHECK(newMembers[1] == oldMembers[1]);
+}
+
 TEST_CASE("Remove node from cloned object") {
     auto tree = SyntaxTree::fromText(R"(
 module m #(parameter P = 8)();
@@ -551,3 +625,34 @@ class C; endclass
         }
     }
 }
+
+TEST_CASE("Semantic model preloaded index") {
+    auto tree = SyntaxTree::fromText(R"(
+module M;
+    int foo;
+
+    function void f(int i);
+    endfunction
+
+    initial begin : block
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    SemanticModel model(compilation);
+    model.preload();
+
+    auto& moduleSyntax = *tree->root().as<ModuleDeclarationSyntax>().members[1];
+    auto var = model.getDeclaredSymbol(*moduleSyntax.as<DataDeclarationSyntax>().declarators[0]);
+    REQUIRE(var);
+    CHECK(var->name == "foo");
+
+    auto& funcSyntax = *tree->root().as<ModuleDeclarationSyntax>().members[2];
+    auto func = model.getDeclaredSymbol(funcSyntax.as<FunctionDeclarationSyntax>());
+    REQUIRE(func);
+    CHECK(func->name == "f");
+}
@@ -7,11 +7,14 @@
 //------------------------------------------------------------------------------
 #include "slang/driver/Driver.h"
 
+#include <chrono>
 #include <fmt/color.h>
 #include <fstream>
 #include <iostream>
+#include <thread>
 
 #include "slang/ast/ASTSerializer.h"
+#include "slang/ast/SymbolNameIndex.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/syntax/SyntaxTree.h"
@@ -26,25 +29,50 @@ using namespace slang::driver;
 void writeToFile(std::string_view fileName, std::string_view contents);
 
 void printJson(Compilation& compilation, const std::string& fileName,
-               const std::vector<std::string>& scopes) {
+               const std::vector<std::string>& scopes, uint32_t threadCount) {
+    if (scopes.empty()) {
+        writeToFile(fileName, ASTSerializer::serializeParallel(compilation, threadCount,
+                                                               /* prettyPrint */ true));
+        return;
+    }
+
     JsonWriter writer;
     writer.setPrettyPrint(true);
 
     ASTSerializer serializer(compilation, writer);
-    if (scopes.empty()) {
-        serializer.serialize(compilation.getRoot());
-    }
-    else {
-        for (auto& scopeName : scopes) {
-            auto sym = compilation.getRoot().lookupName(scopeName);
-            if (sym)
-                serializer.serialize(*sym);
-        }
+    for (auto& scopeName : scopes) {
+        auto sym = compilation.getRoot().lookupName(scopeName);
+        if (sym)
+            serializer.serialize(*sym);
     }
 
     writeToFile(fileName, writer.view());
 }
 
+int lookupSymbols(const std::string& indexFile, const std::vector<std::string>& names) {
+    auto index = SymbolNameIndex::open(indexFile);
+    if (!index) {
+        OS::printE(fmt::format("error: unable to open symbol index '{}'\n", indexFile));
+        return 1;
+    }
+
+    bool allFound = true;
+    for (auto& name : names) {
+        auto entries = index->lookup(name);
+        if (entries.empty()) {
+            OS::print(fmt::format("{}: not found\n", name));
+            allFound = false;
+            continue;
+        }
+
+        for (auto& entry : entries) {
+            OS::print(fmt::format("{} {} {}:{}:{}\n", entry.kind, entry.path, entry.file,
+                                  entry.line, entry.column));
+        }
+    }
+    return allFound ? 0 : 1;
+}
+
 template<typename TArgs>
 int driverMain(int argc, TArgs argv) try {
     OS::tryEnableColors();
@@ -69,6 +97,17 @@ int driverMain(int argc, TArgs argv) try {
         "--parse-only", onlyParse,
         "Stop after parsing input files, don't perform elaboration or type checking");
 
+    std::optional<std::string> depGraphFormat;
+    driver.cmdLine.add("--dep-graph", depGraphFormat,
+                       "Print a file-level dependency graph derived from parsing alone, "
+                       "in the given format ('make' or 'json'), and exit",
+                       "<format>");
+
+    std::optional<bool> watchMode;
+    driver.cmdLine.add("--watch", watchMode,
+                       "Stay resident after compiling and watch source files for changes, "
+                       "re-parsing only changed files and recompiling on each change");
+
     std::optional<bool> includeComments;
     std::optional<bool> includeDirectives;
     std::optional<bool> obfuscateIds;
@@ -91,6 +130,24 @@ int driverMain(int argc, TArgs argv) try {
                        "given hierarchical paths",
                        "<path>");
 
+    std::optional<std::string> symbolIndexFile;
+    driver.cmdLine.add("--symbol-index", symbolIndexFile,
+                       "After elaboration, write a compact queryable index of all named "
+                       "symbols (name, hierarchical path, kind, source location) to the "
+                       "given file; query it later with --symbol-lookup",
+                       "<file>", /* isFileName */ true);
+
+    std::vector<std::string> symbolLookups;
+    driver.cmdLine.add("--symbol-lookup", symbolLookups,
+                       "Look up the given symbol name in the index given by --symbol-index "
+                       "and print its matches, without recompiling the design",
+                       "<name>");
+
+    std::optional<bool> showStats;
+    driver.cmdLine.add("--stats", showStats,
+                       "Print compilation statistics after compiling: per-file token, "
+                       "syntax node, and memory figures plus compilation-wide totals");
+
     std::optional<std::string> timeTrace;
     driver.cmdLine.add("--time-trace", timeTrace,
                        "Do performance profiling of the slang compiler and output "
@@ -112,21 +169,49 @@ int driverMain(int argc, TArgs argv) try {
         return 0;
     }
 
+    if (!symbolLookups.empty()) {
+        if (!symbolIndexFile) {
+            OS::printE(fg(driver.diagClient->errorColor), "error: ");
+            OS::printE("--symbol-lookup requires a --symbol-index file to query\n");
+            return 3;
+        }
+        return lookupSymbols(*symbolIndexFile, symbolLookups);
+    }
+
     if (!driver.processOptions())
         return 2;
 
     if (onlyParse.has_value() + onlyPreprocess.has_value() + onlyMacros.has_value() +
-            driver.options.onlyLint.has_value() >
+            depGraphFormat.has_value() + driver.options.onlyLint.has_value() >
         1) {
         OS::printE(fg(driver.diagClient->errorColor), "error: ");
         OS::printE("can only specify one of --preprocess, --macros-only, "
-                   "--parse-only, --lint-only");
+                   "--parse-only, --dep-graph, --lint-only");
+        return 3;
+    }
+
+    if (watchMode == true && (onlyParse.has_value() || onlyPreprocess.has_value() ||
+                              onlyMacros.has_value() || depGraphFormat.has_value())) {
+        OS::printE(fg(driver.diagClient->errorColor), "error: ");
+        OS::printE("--watch can only be used with full compilation or --lint-only");
+        return 3;
+    }
+
+    if (depGraphFormat && depGraphFormat != "make" && depGraphFormat != "json") {
+        OS::printE(fg(driver.diagClient->errorColor), "error: ");
+        OS::printE(fmt::format("invalid format '{}' for --dep-graph, expected 'make' or 'json'\n",
+                               *depGraphFormat));
         return 3;
     }
 
     if (timeTrace)
         TimeTrace::initialize();
 
+    // Everything from here on is bulk reporting; batch terminal writes into
+    // large chunks instead of paying for a write per printed line.
+    OS::setBufferedOutputEnabled(true);
+    auto flushGuard = ScopeGuard([] { OS::flushOutput(); });
+
     bool ok = true;
     try {
         if (onlyPreprocess == true) {
@@ -140,18 +225,56 @@ int driverMain(int argc, TArgs argv) try {
             ok = driver.parseAllSources();
             ok &= driver.reportParseDiags();
         }
+        else if (depGraphFormat) {
+            ok = driver.parseAllSources();
+            driver.reportDependencies(depGraphFormat == "json");
+        }
         else {
+            std::unique_ptr<Compilation> compilation;
             {
                 TimeTraceScope timeScope("parseAllSources"sv, ""sv);
-                ok = driver.parseAllSources();
+                compilation = driver.parseAndCreateCompilation(ok);
+            }
+
+            if (watchMode == true) {
+                // Record baseline timestamps now so that edits made while the
+                // initial compile runs are picked up by the first rescan.
+                driver.reparseChangedSources();
             }
 
             {
                 TimeTraceScope timeScope("elaboration"sv, ""sv);
-                auto compilation = driver.createCompilation();
                 ok &= driver.reportCompilation(*compilation, quiet == true);
-                if (astJsonFile)
-                    printJson(*compilation, *astJsonFile, astJsonScopes);
+                if (showStats == true)
+                    driver.reportStats(*compilation);
+                if (astJsonFile) {
+                    uint32_t threadCount = driver.options.numThreads.value_or(1);
+                    if (threadCount == 0)
+                        threadCount = std::thread::hardware_concurrency();
+                    printJson(*compilation, *astJsonFile, astJsonScopes, threadCount);
+                }
+                if (symbolIndexFile)
+                    writeToFile(*symbolIndexFile, SymbolNameIndex::serialize(*compilation));
+            }
+
+            compilation.reset();
+
+            // The watch loop is interactive, so flush after each message and
+            // at the end of every compile cycle.
+            OS::flushOutput();
+            while (watchMode == true) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                if (!driver.reparseChangedSources())
+                    continue;
+
+                OS::print("[watch] change detected, recompiling...\n");
+                OS::flushOutput();
+                driver.diagEngine.clearCounts();
+
+                auto compilation = driver.createCompilation();
+                ok = driver.reportCompilation(*compilation, quiet == true);
+                OS::print(fmt::format("[watch] {}\n", ok ? "build succeeded" : "build failed"));
+                OS::flushOutput();
             }
         }
     }
@@ -217,7 +340,219 @@ void writeToFile(std::string_view fileName, std::string_view contents) {
 }
 
 #    ifndef FUZZ_TARGET
+
+// A minimal compile-server mode: `slang --daemon <socket>` runs a resident
+// server that accepts jobs over a unix domain socket and forks a worker per
+// job, so repeated invocations (e.g. thousands of per-test lint runs) skip
+// process startup and run against warm OS file caches. `slang --connect
+// <socket> [args...]` is the thin client; it forwards its working directory
+// and arguments, streams back the job's merged output, and exits with the
+// job's exit code.
+//
+// Request framing: the working directory, then each argument, all
+// NUL-terminated, with an empty string ending the list. The response is the
+// job's raw stdout/stderr followed by a final line "\x01slang-exit <code>".
+
+#        include <cerrno>
+#        include <csignal>
+#        include <cstring>
+#        include <sys/socket.h>
+#        include <sys/un.h>
+#        include <sys/wait.h>
+#        include <unistd.h>
+
+static constexpr std::string_view daemonExitPrefix = "\x01slang-exit ";
+
+static bool writeAll(int fd, std::string_view data) {
+    while (!data.empty()) {
+        ssize_t n = ::write(fd, data.data(), data.size());
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR)
+                continue;
+            return false;
+        }
+        data.remove_prefix(size_t(n));
+    }
+    return true;
+}
+
+static bool makeSocketAddr(const char* path, sockaddr_un& addr) {
+    addr = {};
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        OS::printE(fmt::format("error: socket path too long: '{}'\n", path));
+        return false;
+    }
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    return true;
+}
+
+static int runDaemonServer(const char* path) {
+    signal(SIGPIPE, SIG_IGN);
+
+    sockaddr_un addr;
+    if (!makeSocketAddr(path, addr))
+        return 1;
+
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        OS::printE(fmt::format("error: unable to create socket: {}\n", strerror(errno)));
+        return 1;
+    }
+
+    unlink(path);
+    if (bind(listenFd, (const sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd, 16) < 0) {
+        OS::printE(fmt::format("error: unable to listen on '{}': {}\n", path, strerror(errno)));
+        close(listenFd);
+        return 1;
+    }
+
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        // Read the request until the terminating empty field arrives.
+        std::string request;
+        char buf[4096];
+        while (!request.ends_with(std::string_view("\0\0", 2))) {
+            ssize_t n = ::read(fd, buf, sizeof(buf));
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR)
+                    continue;
+                break;
+            }
+            request.append(buf, size_t(n));
+        }
+
+        // Split the NUL-separated fields; the first is the working directory.
+        std::string cwd;
+        std::vector<std::string> args;
+        size_t pos = 0;
+        bool first = true;
+        while (pos < request.size()) {
+            size_t end = request.find('\0', pos);
+            if (end == std::string::npos || end == pos)
+                break;
+
+            if (first)
+                cwd = request.substr(pos, end - pos);
+            else
+                args.push_back(request.substr(pos, end - pos));
+
+            first = false;
+            pos = end + 1;
+        }
+
+        pid_t pid = fork();
+        if (pid == 0) {
+            // Worker: route all output back over the socket and run a
+            // normal driver invocation in the requested directory.
+            dup2(fd, STDOUT_FILENO);
+            dup2(fd, STDERR_FILENO);
+            close(listenFd);
+
+            if (!cwd.empty() && chdir(cwd.c_str()) != 0) {
+                OS::printE(fmt::format("error: unable to change to directory '{}'\n", cwd));
+                fflush(nullptr);
+                _exit(1);
+            }
+
+            std::vector<char*> argv;
+            char name[] = "slang";
+            argv.push_back(name);
+            for (auto& arg : args)
+                argv.push_back(arg.data());
+
+            int code = driverMain(int(argv.size()), argv.data());
+            fflush(nullptr);
+            _exit(code);
+        }
+
+        int code = 1;
+        if (pid > 0) {
+            int status = 0;
+            waitpid(pid, &status, 0);
+            if (WIFEXITED(status))
+                code = WEXITSTATUS(status);
+        }
+
+        writeAll(fd, fmt::format("{}{}\n", daemonExitPrefix, code));
+        close(fd);
+    }
+
+    close(listenFd);
+    return 0;
+}
+
+static int runDaemonClient(const char* path, int argc, char** argv) {
+    sockaddr_un addr;
+    if (!makeSocketAddr(path, addr))
+        return 1;
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (const sockaddr*)&addr, sizeof(addr)) < 0) {
+        OS::printE(
+            fmt::format("error: unable to connect to daemon at '{}': {}\n", path, strerror(errno)));
+        return 1;
+    }
+
+    std::string request;
+    char cwd[4096];
+    if (getcwd(cwd, sizeof(cwd)))
+        request.append(cwd);
+    request.push_back('\0');
+
+    for (int i = 0; i < argc; i++) {
+        request.append(argv[i]);
+        request.push_back('\0');
+    }
+    request.push_back('\0');
+
+    if (!writeAll(fd, request)) {
+        OS::printE("error: unable to send job to daemon\n");
+        return 1;
+    }
+    shutdown(fd, SHUT_WR);
+
+    std::string response;
+    char buf[4096];
+    while (true) {
+        ssize_t n = ::read(fd, buf, sizeof(buf));
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR)
+                continue;
+            break;
+        }
+        response.append(buf, size_t(n));
+    }
+    close(fd);
+
+    // Everything before the final exit marker is the job's own output.
+    int code = 1;
+    size_t markerPos = response.rfind(daemonExitPrefix);
+    if (markerPos != std::string::npos && (markerPos == 0 || response[markerPos - 1] == '\n')) {
+        code = atoi(response.c_str() + markerPos + daemonExitPrefix.size());
+        response.resize(markerPos);
+    }
+    else {
+        OS::printE("error: daemon connection closed unexpectedly\n");
+    }
+
+    fwrite(response.data(), 1, response.size(), stdout);
+    fflush(stdout);
+    return code;
+}
+
 int main(int argc, char** argv) {
+    if (argc >= 3 && std::string_view(argv[1]) == "--daemon")
+        return runDaemonServer(argv[2]);
+    if (argc >= 3 && std::string_view(argv[1]) == "--connect")
+        return runDaemonClient(argv[2], argc - 3, argv + 3);
+
     return driverMain(argc, argv);
 }
 #    endif
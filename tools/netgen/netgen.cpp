@@ -0,0 +1,207 @@
+//------------------------------------------------------------------------------
+// netgen.cpp
+// Tool that emits parameterized synthetic SystemVerilog designs, used for
+// scaling tests and capacity planning. Knobs control hierarchy depth and
+// width, datapath bit widths, macro indirection layers, and package farms
+// so that design size can be swept against compile time and memory.
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include "slang/util/CommandLine.h"
+#include "slang/util/OS.h"
+#include "slang/util/Version.h"
+
+using namespace slang;
+
+namespace {
+
+struct GenOptions {
+    uint32_t depth = 3;
+    uint32_t width = 4;
+    uint32_t datapathBits = 32;
+    uint32_t macroLayers = 0;
+    uint32_t numPackages = 0;
+    uint32_t paramsPerPackage = 100;
+};
+
+// Wraps an expression in the requested number of macro indirection layers.
+std::string wrapMacro(const GenOptions& options, std::string expr) {
+    if (options.macroLayers > 0)
+        return fmt::format("`L{}({})", options.macroLayers - 1, expr);
+    return expr;
+}
+
+void generate(const GenOptions& options, std::string& result) {
+    auto out = std::back_inserter(result);
+
+    // A stack of pass-through macros so that every datapath expression is
+    // filtered through the requested number of preprocessor expansions.
+    if (options.macroLayers > 0) {
+        fmt::format_to(out, "`define L0(x) (x)\n");
+        for (uint32_t i = 1; i < options.macroLayers; i++)
+            fmt::format_to(out, "`define L{}(x) `L{}(x)\n", i, i - 1);
+        result += "\n";
+    }
+
+    // A farm of packages, each full of parameters that reference the
+    // previous package so that lookups cross package boundaries.
+    for (uint32_t i = 0; i < options.numPackages; i++) {
+        fmt::format_to(out, "package pkg{};\n", i);
+        for (uint32_t j = 0; j < options.paramsPerPackage; j++) {
+            if (i > 0) {
+                fmt::format_to(out, "    localparam int P{0} = pkg{1}::P{0} + 1;\n", j, i - 1);
+            }
+            else {
+                fmt::format_to(out, "    localparam int P{0} = {0};\n", j);
+            }
+        }
+        fmt::format_to(out, "endpackage\n\n");
+    }
+
+    // The leaf module does some real datapath work so elaboration has
+    // expressions and types to chew on at every instance.
+    std::string basePath = "BASE";
+    if (options.numPackages > 0) {
+        fmt::format_to(out, "module leaf import pkg{}::*; #(parameter int BASE = 0)(\n",
+                       options.numPackages - 1);
+        basePath = "BASE + P0";
+    }
+    else {
+        fmt::format_to(out, "module leaf #(parameter int BASE = 0)(\n");
+    }
+
+    fmt::format_to(out,
+                   "    input logic clk,\n"
+                   "    input logic [{0}:0] din,\n"
+                   "    output logic [{0}:0] dout);\n\n"
+                   "    logic [{0}:0] acc;\n"
+                   "    always_ff @(posedge clk)\n"
+                   "        acc <= {1};\n"
+                   "    assign dout = {2};\n"
+                   "endmodule\n\n",
+                   options.datapathBits - 1,
+                   wrapMacro(options, fmt::format("acc + din + {}'({})", options.datapathBits,
+                                                  basePath)),
+                   wrapMacro(options, "acc ^ din"));
+
+    // Intermediate levels each instantiate `width` copies of the next level
+    // down and reduce their outputs.
+    for (uint32_t level = options.depth; level > 0; level--) {
+        std::string childName = level == options.depth ? "leaf"
+                                                       : fmt::format("lvl{}", level + 1);
+        fmt::format_to(out,
+                       "module lvl{0} #(parameter int BASE = 0)(\n"
+                       "    input logic clk,\n"
+                       "    input logic [{1}:0] din,\n"
+                       "    output logic [{1}:0] dout);\n\n"
+                       "    logic [{1}:0] douts[{2}];\n",
+                       level, options.datapathBits - 1, options.width);
+
+        for (uint32_t i = 0; i < options.width; i++) {
+            fmt::format_to(out,
+                           "    {0} #(.BASE(BASE * {1} + {2})) u{2}(.clk, .din, "
+                           ".dout(douts[{2}]));\n",
+                           childName, options.width, i);
+        }
+
+        fmt::format_to(out,
+                       "\n    always_comb begin\n"
+                       "        dout = '0;\n"
+                       "        foreach (douts[i])\n"
+                       "            dout ^= douts[i];\n"
+                       "    end\n"
+                       "endmodule\n\n");
+    }
+
+    fmt::format_to(out,
+                   "module top(\n"
+                   "    input logic clk,\n"
+                   "    input logic [{0}:0] din,\n"
+                   "    output logic [{0}:0] dout);\n\n"
+                   "    lvl1 #(.BASE(1)) root(.clk, .din, .dout);\n"
+                   "endmodule\n",
+                   options.datapathBits - 1);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    CommandLine cmdLine;
+
+    std::optional<bool> showHelp;
+    std::optional<bool> showVersion;
+    cmdLine.add("-h,--help", showHelp, "Display available options");
+    cmdLine.add("--version", showVersion, "Display version information and exit");
+
+    std::optional<uint32_t> depth;
+    std::optional<uint32_t> width;
+    std::optional<uint32_t> datapathBits;
+    std::optional<uint32_t> macroLayers;
+    std::optional<uint32_t> numPackages;
+    std::optional<uint32_t> paramsPerPackage;
+    std::optional<std::string> outputPath;
+    cmdLine.add("--depth", depth, "Number of module levels in the hierarchy", "<count>");
+    cmdLine.add("--width", width, "Number of child instances per level", "<count>");
+    cmdLine.add("--datapath", datapathBits, "Bit width of the generated datapath", "<bits>");
+    cmdLine.add("--macro-layers", macroLayers,
+                "Number of pass-through macro layers wrapping each expression", "<count>");
+    cmdLine.add("--packages", numPackages, "Number of packages in the package farm", "<count>");
+    cmdLine.add("--package-params", paramsPerPackage, "Number of parameters per package",
+                "<count>");
+    cmdLine.add("--output", outputPath, "Output file path (defaults to stdout)", "<file>");
+
+    if (!cmdLine.parse(argc, argv)) {
+        for (auto& err : cmdLine.getErrors())
+            OS::printE(fmt::format("{}\n", err));
+        return 1;
+    }
+
+    if (showHelp == true) {
+        OS::print(fmt::format("{}", cmdLine.getHelpText("slang synthetic design generator")));
+        return 0;
+    }
+
+    if (showVersion == true) {
+        OS::print(fmt::format("netgen version {}.{}.{}+{}\n", VersionInfo::getMajor(),
+                              VersionInfo::getMinor(), VersionInfo::getPatch(),
+                              VersionInfo::getHash()));
+        return 0;
+    }
+
+    GenOptions options;
+    options.depth = depth.value_or(options.depth);
+    options.width = width.value_or(options.width);
+    options.datapathBits = datapathBits.value_or(options.datapathBits);
+    options.macroLayers = macroLayers.value_or(options.macroLayers);
+    options.numPackages = numPackages.value_or(options.numPackages);
+    options.paramsPerPackage = paramsPerPackage.value_or(options.paramsPerPackage);
+
+    if (options.depth == 0 || options.width == 0 || options.datapathBits == 0) {
+        OS::printE("error: depth, width, and datapath must all be nonzero\n");
+        return 1;
+    }
+
+    std::string result;
+    generate(options, result);
+
+    if (outputPath) {
+        std::ofstream file(*outputPath);
+        if (!file) {
+            OS::printE(fmt::format("error: unable to open '{}' for writing\n", *outputPath));
+            return 1;
+        }
+        file << result;
+    }
+    else {
+        std::cout << result;
+    }
+
+    return 0;
+}
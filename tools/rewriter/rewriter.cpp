@@ -1,6 +1,6 @@
 //------------------------------------------------------------------------------
 // rewriter.cpp
-// Simple tool that parses an input file and writes it back out; used
+// Simple tool that parses input files and writes them back out; used
 // for verifying the round-trip nature of the parse tree.
 //
 // SPDX-FileCopyrightText: Michael Popoloski
@@ -13,17 +13,221 @@
 #    include <io.h>
 #endif
 
+#include <atomic>
 #include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "slang/syntax/SyntaxPrinter.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
 
 using namespace slang;
 using namespace slang::syntax;
 
+namespace fs = std::filesystem;
+
+// A single byte-range replacement turning the original text into the new one.
+struct Edit {
+    size_t offset;
+    size_t oldLength;
+    std::string_view newText;
+};
+
+// Computes the minimal contiguous byte-range edit between the two texts by
+// trimming their common prefix and suffix. Returns nullopt if they're
+// identical.
+static std::optional<Edit> computeEdit(std::string_view oldText, std::string_view newText) {
+    size_t maxPrefix = std::min(oldText.size(), newText.size());
+    size_t prefix = 0;
+    while (prefix < maxPrefix && oldText[prefix] == newText[prefix])
+        prefix++;
+
+    if (prefix == oldText.size() && prefix == newText.size())
+        return std::nullopt;
+
+    size_t maxSuffix = maxPrefix - prefix;
+    size_t suffix = 0;
+    while (suffix < maxSuffix &&
+           oldText[oldText.size() - 1 - suffix] == newText[newText.size() - 1 - suffix]) {
+        suffix++;
+    }
+
+    return Edit{prefix, oldText.size() - prefix - suffix,
+                newText.substr(prefix, newText.size() - prefix - suffix)};
+}
+
+// The outcome of rewriting one file. Output and errors are buffered here so
+// that they can be emitted in input order no matter how workers were
+// scheduled; in-place writes don't need ordering since each file is
+// independent.
+struct FileResult {
+    std::string output;
+    std::string error;
+    bool failed = false;
+};
+
+static void rewriteFile(const std::string& path, SourceManager& sourceManager, bool diffMode,
+                        bool inPlace, bool multiFile, FileResult& result) {
+    if (!fs::exists(path)) {
+        result.error = "File does not exist: " + path + "\n";
+        result.failed = true;
+        return;
+    }
+
+    if (!fs::is_regular_file(path)) {
+        result.error = path + " is not a file\n";
+        result.failed = true;
+        return;
+    }
+
+    auto tree = SyntaxTree::fromFile(path, sourceManager);
+
+    // Print with zero-copy pieces so unchanged spans reference the original
+    // source text instead of being copied.
+    SyntaxPrinter printer(sourceManager);
+    printer.setIncludeDirectives(true)
+        .setIncludeSkipped(true)
+        .setIncludeTrivia(true)
+        .setIncludePreprocessed(false)
+        .setSquashNewlines(false)
+        .setZeroCopySources(true)
+        .print(*tree);
+
+    if (!diffMode && !inPlace) {
+        for (auto piece : printer.pieces())
+            result.output.append(piece);
+        return;
+    }
+
+    // The edit modes compare against the original bytes on disk, so that
+    // unchanged files cost no writes at all.
+    std::string oldText;
+    {
+        std::ifstream file(path, std::ios::binary);
+        oldText.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::string newText;
+    for (auto piece : printer.pieces())
+        newText.append(piece);
+
+    auto edit = computeEdit(oldText, newText);
+    if (!edit)
+        return;
+
+    if (diffMode) {
+        // Emit the patch as a byte-range header followed by the raw
+        // replacement bytes. With multiple inputs each patch is preceded by
+        // a line naming the file it applies to.
+        if (multiFile) {
+            result.output.append("--- ");
+            result.output.append(path);
+            result.output.push_back('\n');
+        }
+
+        char header[128];
+        snprintf(header, sizeof(header), "@@ %zu -%zu +%zu\n", edit->offset, edit->oldLength,
+                 edit->newText.size());
+        result.output.append(header);
+        result.output.append(edit->newText);
+        result.output.push_back('\n');
+        return;
+    }
+
+    if (edit->oldLength == edit->newText.size()) {
+        // Same length, so patch just the changed bytes in place.
+        FILE* file = fopen(path.c_str(), "r+b");
+        if (!file) {
+            result.error = "Unable to open " + path + " for writing\n";
+            result.failed = true;
+            return;
+        }
+
+        fseek(file, (long)edit->offset, SEEK_SET);
+        fwrite(edit->newText.data(), 1, edit->newText.size(), file);
+        fclose(file);
+        return;
+    }
+
+    // The file changed size; write the new contents to a temporary file next
+    // to the original and rename-swap it into place.
+    fs::path target = path;
+    fs::path tempPath = target;
+    tempPath += ".rewriter-tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            result.error = "Unable to open " + tempPath.string() + " for writing\n";
+            result.failed = true;
+            return;
+        }
+        file.write(newText.data(), (std::streamsize)newText.size());
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, target, ec);
+    if (ec) {
+        result.error = "Unable to replace " + path + ": " + ec.message() + "\n";
+        fs::remove(tempPath, ec);
+        result.failed = true;
+    }
+}
+
 int main(int argc, char** argv) try {
-    if (argc != 2) {
-        fprintf(stderr, "usage: rewriter file\n");
+    bool diffMode = false;
+    bool inPlace = false;
+    uint32_t threadCount = 1;
+    std::vector<std::string> paths;
+    bool badArgs = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--diff")
+            diffMode = true;
+        else if (arg == "--in-place")
+            inPlace = true;
+        else if (arg == "-j") {
+            if (++i >= argc) {
+                badArgs = true;
+                break;
+            }
+            threadCount = (uint32_t)strtoul(argv[i], nullptr, 10);
+        }
+        else if (arg == "-f") {
+            // A filelist names one input file per line; blank lines and lines
+            // starting with '#' are ignored. This is deliberately simpler
+            // than compilation command files since the rewriter takes no
+            // per-file options.
+            if (++i >= argc) {
+                badArgs = true;
+                break;
+            }
+
+            std::ifstream file(argv[i]);
+            if (!file) {
+                fprintf(stderr, "Unable to open filelist: %s\n", argv[i]);
+                return 1;
+            }
+
+            std::string line;
+            while (std::getline(file, line)) {
+                while (!line.empty() && (line.back() == '\r' || line.back() == ' '))
+                    line.pop_back();
+                if (!line.empty() && line[0] != '#')
+                    paths.push_back(line);
+            }
+        }
+        else {
+            paths.push_back(std::string(arg));
+        }
+    }
+
+    if (paths.empty() || badArgs || (diffMode && inPlace)) {
+        fprintf(stderr, "usage: rewriter [--diff | --in-place] [-j num] [-f filelist] files...\n");
         return 1;
     }
 
@@ -32,19 +236,56 @@ int main(int argc, char** argv) try {
     _setmode(_fileno(stdout), _O_BINARY);
 #endif
 
-    if (!std::filesystem::exists(argv[1])) {
-        fprintf(stderr, "File does not exist: %s\n", argv[1]);
-        return 1;
+    if (threadCount == 0)
+        threadCount = std::thread::hardware_concurrency();
+    threadCount = (uint32_t)std::min<size_t>(threadCount, paths.size());
+
+    // Files are independent of each other, so a worker pool pulls them off a
+    // shared index. The SourceManager is shared across workers -- buffer
+    // registration is thread safe and file contents are interned in one
+    // place -- while each SyntaxTree carries its own allocator, matching how
+    // the driver parses compilation units in parallel.
+    SourceManager sourceManager;
+    std::vector<FileResult> results(paths.size());
+    const bool multiFile = paths.size() > 1;
+
+    if (threadCount > 1) {
+        std::atomic<size_t> nextIndex = 0;
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; i++) {
+            workers.emplace_back([&] {
+                while (true) {
+                    size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+                    if (index >= paths.size())
+                        break;
+
+                    rewriteFile(paths[index], sourceManager, diffMode, inPlace, multiFile,
+                                results[index]);
+                }
+            });
+        }
+
+        for (auto& worker : workers)
+            worker.join();
+    }
+    else {
+        for (size_t i = 0; i < paths.size(); i++)
+            rewriteFile(paths[i], sourceManager, diffMode, inPlace, multiFile, results[i]);
     }
 
-    if (!std::filesystem::is_regular_file(argv[1])) {
-        fprintf(stderr, "%s is not a file\n", argv[1]);
-        return 1;
+    // Emit buffered output in input order so runs are deterministic
+    // regardless of worker scheduling.
+    bool anyFailed = false;
+    for (auto& result : results) {
+        if (!result.output.empty())
+            fwrite(result.output.data(), 1, result.output.size(), stdout);
+        if (!result.error.empty())
+            fputs(result.error.c_str(), stderr);
+        anyFailed |= result.failed;
     }
 
-    auto tree = SyntaxTree::fromFile(argv[1]);
-    printf("%s", SyntaxPrinter::printFile(*tree).c_str());
-    return 0;
+    return anyFailed ? 1 : 0;
 }
 catch (const std::exception& e) {
     printf("internal compiler error (exception): %s\n", e.what());
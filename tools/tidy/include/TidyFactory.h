@@ -13,6 +13,7 @@
 #include <string>
 #include <unordered_map>
 
+#include "slang/ast/ASTVisitor.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/util/Util.h"
 
@@ -106,7 +107,12 @@ public:
         config(config), kind(kind) {}
     virtual ~TidyCheck() = default;
 
-    [[nodiscard]] virtual bool check(const slang::ast::RootSymbol& root) = 0;
+    /// Runs this check alone over the whole subtree rooted at the given symbol.
+    [[nodiscard]] virtual bool check(const slang::ast::Symbol& root);
+
+    /// Called once for every symbol visited in the traversal. Checks implement
+    /// their logic here so that any number of them can share a single AST walk.
+    virtual void handleSymbol(const slang::ast::Symbol& symbol) = 0;
 
     virtual std::string_view name() const = 0;
     virtual std::string description() const = 0;
@@ -125,6 +131,31 @@ protected:
     const Registry::RegistryCheckConfig& config;
 };
 
+/// Visits every symbol in a subtree once and forwards each one to all of the
+/// given checks, fusing them into a single AST walk.
+class FusedCheckVisitor : public slang::ast::ASTVisitor<FusedCheckVisitor, false, false> {
+public:
+    explicit FusedCheckVisitor(std::vector<TidyCheck*> checks) : checks(std::move(checks)) {}
+
+    template<typename T>
+    void handle(const T& node) {
+        if constexpr (std::is_base_of_v<slang::ast::Symbol, T>) {
+            for (auto check : checks)
+                check->handleSymbol(node);
+        }
+        visitDefault(node);
+    }
+
+private:
+    std::vector<TidyCheck*> checks;
+};
+
+inline bool TidyCheck::check(const slang::ast::Symbol& root) {
+    FusedCheckVisitor visitor({this});
+    root.visit(visitor);
+    return diagnostics.empty();
+}
+
 #define REGISTER(name, class_name, kind)                                           \
     static auto name##_entry = Registry::add(#name, kind, [](const auto& config) { \
         return std::make_unique<class_name>(config, kind);                         \
@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+//! @file TidyResultCache.h
+//! @brief Persistent cache of per-subtree check results for slang-tidy
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "slang/ast/ASTVisitor.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/Hash.h"
+#include "slang/util/String.h"
+
+/// A persistent cache of slang-tidy results, keyed by a fingerprint of the
+/// sources each design subtree was elaborated from together with the active
+/// check configuration. A subtree whose fingerprint matches a stored entry
+/// reports its previous results without being walked again.
+class TidyResultCache {
+public:
+    /// A rendered failure report from a single check within one subtree.
+    struct CheckFailure {
+        std::string checkName;
+        std::string renderedText;
+    };
+
+    /// The stored results for one subtree. An empty failure list means every
+    /// enabled check passed.
+    struct Entry {
+        std::vector<CheckFailure> failures;
+    };
+
+    explicit TidyResultCache(std::string path) : path(std::move(path)) {}
+
+    /// Computes a fingerprint for the subtree rooted at the given symbol by
+    /// hashing the contents of every source file that contributed symbols to
+    /// it, folded together with the given configuration hash. Changing any of
+    /// those files (or the configuration) changes the fingerprint and thereby
+    /// invalidates the stored entry.
+    static uint64_t fingerprint(const slang::ast::Symbol& root,
+                                const slang::SourceManager& sourceManager, uint64_t configHash) {
+        SourceCollector collector(sourceManager);
+        root.visit(collector);
+
+        std::vector<std::pair<std::string, size_t>> files;
+        files.reserve(collector.buffers.size());
+        for (auto id : collector.buffers) {
+            slang::BufferID buffer(id, std::string_view());
+            files.emplace_back(slang::getU8Str(sourceManager.getFullPath(buffer)),
+                               std::hash<std::string_view>()(sourceManager.getSourceText(buffer)));
+        }
+
+        // Sort by path so that the fingerprint doesn't depend on traversal order.
+        std::sort(files.begin(), files.end());
+
+        size_t hash = size_t(configHash);
+        slang::hash_combine(hash, root.name);
+        for (auto& [filePath, textHash] : files)
+            slang::hash_combine(hash, filePath, textHash);
+
+        return hash;
+    }
+
+    const Entry* find(uint64_t fingerprint) const {
+        auto it = entries.find(fingerprint);
+        return it == entries.end() ? nullptr : &it->second;
+    }
+
+    void insert(uint64_t fingerprint, Entry entry) { entries[fingerprint] = std::move(entry); }
+
+    /// Loads previously saved results from the cache file. A missing or
+    /// malformed file just leaves the cache cold; it never fails the run.
+    void load() {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            return;
+
+        std::string line;
+        if (!std::getline(in, line) || line != FileHeader)
+            return;
+
+        std::unordered_map<uint64_t, Entry> loaded;
+        while (std::getline(in, line)) {
+            if (line.empty())
+                continue;
+
+            std::istringstream entryLine(line);
+            std::string tag;
+            uint64_t fp;
+            size_t failureCount;
+            if (!(entryLine >> tag >> std::hex >> fp >> std::dec >> failureCount) ||
+                tag != "entry") {
+                return;
+            }
+
+            Entry entry;
+            for (size_t i = 0; i < failureCount; i++) {
+                if (!std::getline(in, line))
+                    return;
+
+                std::istringstream checkLine(line);
+                std::string name;
+                size_t textLength;
+                if (!(checkLine >> tag >> name >> textLength) || tag != "check")
+                    return;
+
+                std::string text(textLength, '\0');
+                if (!in.read(text.data(), std::streamsize(textLength)))
+                    return;
+
+                in.get(); // trailing newline
+                entry.failures.push_back({std::move(name), std::move(text)});
+            }
+
+            loaded.emplace(fp, std::move(entry));
+        }
+
+        entries = std::move(loaded);
+    }
+
+    /// Writes all entries, including ones carried over from the loaded file,
+    /// back to disk. Returns false if the file could not be written.
+    bool save() const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        out << FileHeader << '\n';
+        for (auto& [fp, entry] : entries) {
+            out << "entry " << std::hex << fp << std::dec << ' ' << entry.failures.size() << '\n';
+            for (auto& failure : entry.failures) {
+                out << "check " << failure.checkName << ' ' << failure.renderedText.size() << '\n';
+                out.write(failure.renderedText.data(), std::streamsize(failure.renderedText.size()));
+                out << '\n';
+            }
+        }
+        return bool(out);
+    }
+
+private:
+    static constexpr std::string_view FileHeader = "slang-tidy-cache v1";
+
+    // Collects the set of source buffers that contributed symbols to a subtree.
+    struct SourceCollector : slang::ast::ASTVisitor<SourceCollector, false, false> {
+        explicit SourceCollector(const slang::SourceManager& sourceManager) :
+            sourceManager(sourceManager) {}
+
+        template<typename T>
+        void handle(const T& node) {
+            if constexpr (std::is_base_of_v<slang::ast::Symbol, T>) {
+                if (node.location) {
+                    auto loc = sourceManager.getFullyOriginalLoc(node.location);
+                    if (sourceManager.isFileLoc(loc))
+                        buffers.insert(loc.buffer().getId());
+                }
+            }
+            visitDefault(node);
+        }
+
+        const slang::SourceManager& sourceManager;
+        slang::flat_hash_set<uint32_t> buffers;
+    };
+
+    std::string path;
+    std::unordered_map<uint64_t, Entry> entries;
+};
@@ -66,42 +66,31 @@ struct AlwaysFFVisitor : public ASTVisitor<AlwaysFFVisitor, true, true> {
     bool assignedOutsideIfReset = false;
 };
 
-struct MainVisitor : public ASTVisitor<MainVisitor, true, false> {
-    explicit MainVisitor(Diagnostics& diagnostics, const Registry::RegistryCheckConfig& config) :
-        diags(diagnostics), config(config) {}
+} // namespace only_assigned_on_reset
 
-    Diagnostics& diags;
-    const Registry::RegistryCheckConfig& config;
+using namespace only_assigned_on_reset;
+class OnlyAssignedOnReset : public TidyCheck {
+public:
+    explicit OnlyAssignedOnReset(const Registry::RegistryCheckConfig& config, TidyKind kind) :
+        TidyCheck(config, kind) {}
+
+    void handleSymbol(const Symbol& symbol) override {
+        if (!VariableSymbol::isKind(symbol.kind))
+            return;
 
-    void handle(const VariableSymbol& symbol) {
-        if (symbol.drivers().empty())
+        auto& variable = symbol.as<VariableSymbol>();
+        if (variable.drivers().empty())
             return;
 
-        auto firstDriver = *symbol.drivers().begin();
+        auto firstDriver = *variable.drivers().begin();
         if (firstDriver && firstDriver->isInAlwaysFFBlock()) {
-            AlwaysFFVisitor visitor(symbol.name, config.resetName);
+            AlwaysFFVisitor visitor(variable.name, config.resetName);
             firstDriver->containingSymbol->visit(visitor);
             if (visitor.hasError()) {
-                diags.add(diag::OnlyAssignedOnReset, symbol.location) << symbol.name;
+                diagnostics.add(diag::OnlyAssignedOnReset, variable.location) << variable.name;
             }
         }
     }
-};
-} // namespace only_assigned_on_reset
-
-using namespace only_assigned_on_reset;
-class OnlyAssignedOnReset : public TidyCheck {
-public:
-    explicit OnlyAssignedOnReset(const Registry::RegistryCheckConfig& config, TidyKind kind) :
-        TidyCheck(config, kind) {}
-
-    bool check(const RootSymbol& root) override {
-        MainVisitor visitor(diagnostics, config);
-        root.visit(visitor);
-        if (!diagnostics.empty())
-            return false;
-        return true;
-    }
 
     DiagCode diagCode() const override { return diag::OnlyAssignedOnReset; }
 
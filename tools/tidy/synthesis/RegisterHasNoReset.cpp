@@ -66,27 +66,6 @@ struct AlwaysFFVisitor : public ASTVisitor<AlwaysFFVisitor, true, true> {
     bool assignedOutsideIfReset = false;
 };
 
-struct MainVisitor : public ASTVisitor<MainVisitor, true, true> {
-    explicit MainVisitor(Diagnostics& diagnostics, const Registry::RegistryCheckConfig& config) :
-        diags(diagnostics), config(config) {}
-
-    Diagnostics& diags;
-    const Registry::RegistryCheckConfig& config;
-
-    void handle(const VariableSymbol& symbol) {
-        if (symbol.drivers().empty())
-            return;
-
-        auto firstDriver = *symbol.drivers().begin();
-        if (firstDriver && firstDriver->isInAlwaysFFBlock()) {
-            AlwaysFFVisitor visitor(symbol.name, config.resetName);
-            firstDriver->containingSymbol->visit(visitor);
-            if (visitor.hasError()) {
-                diags.add(diag::RegisterNotAssignedOnReset, symbol.location) << symbol.name;
-            }
-        }
-    }
-};
 } // namespace register_has_no_reset
 
 using namespace register_has_no_reset;
@@ -96,12 +75,23 @@ public:
     explicit RegisterHasNoReset(const Registry::RegistryCheckConfig& config, TidyKind kind) :
         TidyCheck(config, kind) {}
 
-    bool check(const RootSymbol& root) override {
-        MainVisitor visitor(diagnostics, config);
-        root.visit(visitor);
-        if (!diagnostics.empty())
-            return false;
-        return true;
+    void handleSymbol(const Symbol& symbol) override {
+        if (!VariableSymbol::isKind(symbol.kind))
+            return;
+
+        auto& variable = symbol.as<VariableSymbol>();
+        if (variable.drivers().empty())
+            return;
+
+        auto firstDriver = *variable.drivers().begin();
+        if (firstDriver && firstDriver->isInAlwaysFFBlock()) {
+            AlwaysFFVisitor visitor(variable.name, config.resetName);
+            firstDriver->containingSymbol->visit(visitor);
+            if (visitor.hasError()) {
+                diagnostics.add(diag::RegisterNotAssignedOnReset, variable.location)
+                    << variable.name;
+            }
+        }
     }
 
     DiagCode diagCode() const override { return diag::RegisterNotAssignedOnReset; }
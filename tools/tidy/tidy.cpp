@@ -8,6 +8,12 @@
 #include "fmt/color.h"
 #include "fmt/format.h"
 #include "include/TidyFactory.h"
+#include "include/TidyResultCache.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "slang/diagnostics/TextDiagnosticClient.h"
@@ -54,6 +60,12 @@ int main(int argc, char** argv) {
     driver.cmdLine.add("--reset-active-high", resetActiveHigh,
                        "Indicates that the reset is active high. By default reset is active low");
 
+    std::optional<std::string> cacheFile;
+    driver.cmdLine.add("--cache-file", cacheFile,
+                       "Caches check results in the given file, keyed by fingerprints of the "
+                       "sources each design subtree was built from, and reuses them for "
+                       "subtrees whose sources have not changed");
+
     if (!driver.parseCommandLine(argc, argv))
         return 1;
 
@@ -147,27 +159,177 @@ int main(int argc, char** argv) {
     if (resetActiveHigh)
         Registry::set_check_config_reset_active_high(true);
 
-    for (const auto& check_name : Registry::get_registered(filter_func)) {
-        const auto check = Registry::create(check_name);
-        OS::print(fmt::format("[{}]", check->name()));
+    const auto checkNames = Registry::get_registered(filter_func);
+
+    // Metadata instances used for reporting; the actual work runs on
+    // per-thread instances created below.
+    std::vector<std::unique_ptr<TidyCheck>> checks;
+    for (const auto& checkName : checkNames) {
+        checks.push_back(Registry::create(checkName));
+        diagEngine.setMessage(checks.back()->diagCode(), checks.back()->diagString());
+        diagEngine.setSeverity(checks.back()->diagCode(), checks.back()->diagSeverity());
+    }
+
+    // Shard the design into independently walkable subtrees; all enabled
+    // checks run fused in a single AST walk per shard, and shards are
+    // distributed across worker threads.
+    std::vector<const ast::Symbol*> shards;
+    auto& root = compilation->getRoot();
+    for (auto instance : root.topInstances)
+        shards.push_back(instance);
+    for (auto unit : root.compilationUnits)
+        shards.push_back(unit);
+
+    auto sourceManager = compilation->getSourceManager();
+
+    std::vector<Diagnostics> mergedDiags(checkNames.size());
+    std::vector<std::string> checkOutputs(checkNames.size());
+    std::vector<bool> checkFailed(checkNames.size(), false);
+    std::atomic<size_t> nextShard = 0;
+    std::mutex mergeMutex;
+
+    // When caching is enabled, resolve cache hits up front so that workers
+    // only ever see shards whose sources actually changed. The fingerprint
+    // folds in the check configuration, so entries written under different
+    // options can never be confused with each other.
+    std::optional<TidyResultCache> cache;
+    std::vector<uint64_t> fingerprints;
+    if (cacheFile) {
+        auto sortedNames = checkNames;
+        std::sort(sortedNames.begin(), sortedNames.end());
+
+        size_t configHash = 0;
+        hash_combine(configHash, VersionInfo::getMajor(), VersionInfo::getMinor(),
+                     VersionInfo::getPatch(), VersionInfo::getHash());
+        for (const auto& name : sortedNames)
+            hash_combine(configHash, name);
+        hash_combine(configHash, clockName.value_or("clk_i"), resetName.value_or("rst_ni"),
+                     resetActiveHigh.has_value());
+
+        cache.emplace(*cacheFile);
+        cache->load();
+
+        std::unordered_map<std::string_view, size_t> checkIndices;
+        for (size_t i = 0; i < checkNames.size(); i++)
+            checkIndices.emplace(checkNames[i], i);
 
-        diagEngine.setMessage(check->diagCode(), check->diagString());
-        diagEngine.setSeverity(check->diagCode(), check->diagSeverity());
+        std::vector<const ast::Symbol*> staleShards;
+        for (auto shard : shards) {
+            uint64_t fp = TidyResultCache::fingerprint(*shard, *sourceManager, configHash);
+            if (auto entry = cache->find(fp)) {
+                for (auto& failure : entry->failures) {
+                    if (auto it = checkIndices.find(failure.checkName); it != checkIndices.end()) {
+                        checkFailed[it->second] = true;
+                        checkOutputs[it->second] += failure.renderedText;
+                    }
+                }
+            }
+            else {
+                staleShards.push_back(shard);
+                fingerprints.push_back(fp);
+            }
+        }
+        shards = std::move(staleShards);
+    }
+
+    auto renderDiags = [&](Diagnostics& diags) {
+        diags.sort(*sourceManager);
+        for (const auto& diag : diags)
+            diagEngine.issue(diag);
+
+        auto result = textDiagClient->getString();
+        textDiagClient->clear();
+        return result;
+    };
+
+    auto worker = [&] {
+        std::vector<std::unique_ptr<TidyCheck>> localChecks;
+        std::vector<TidyCheck*> checkPtrs;
+        for (const auto& checkName : checkNames) {
+            localChecks.push_back(Registry::create(checkName));
+            checkPtrs.push_back(localChecks.back().get());
+        }
 
-        auto checkOk = check->check(compilation->getRoot());
-        if (!checkOk) {
+        FusedCheckVisitor visitor(checkPtrs);
+        std::vector<size_t> seenCounts(checkPtrs.size(), 0);
+        while (true) {
+            size_t index = nextShard.fetch_add(1);
+            if (index >= shards.size())
+                break;
+            shards[index]->visit(visitor);
+
+            if (cache) {
+                // Slice out the diagnostics this shard added, render them, and
+                // record the result so the next run can skip the shard entirely.
+                TidyResultCache::Entry entry;
+                std::scoped_lock lock(mergeMutex);
+                for (size_t i = 0; i < checkPtrs.size(); i++) {
+                    const auto& all = checkPtrs[i]->getDiagnostics();
+                    if (all.size() == seenCounts[i])
+                        continue;
+
+                    Diagnostics fresh;
+                    for (size_t d = seenCounts[i]; d < all.size(); d++)
+                        fresh.push_back(all[d]);
+                    seenCounts[i] = all.size();
+
+                    auto text = renderDiags(fresh);
+                    checkFailed[i] = true;
+                    checkOutputs[i] += text;
+                    entry.failures.push_back({checkNames[i], std::move(text)});
+                }
+                cache->insert(fingerprints[index], std::move(entry));
+            }
+        }
+
+        if (!cache) {
+            std::scoped_lock lock(mergeMutex);
+            for (size_t i = 0; i < localChecks.size(); i++) {
+                for (const auto& diag : localChecks[i]->getDiagnostics())
+                    mergedDiags[i].push_back(diag);
+            }
+        }
+    };
+
+    size_t threadCount = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                          shards.size());
+    if (threadCount <= 1) {
+        worker();
+    }
+    else {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadCount; i++)
+            threads.emplace_back(worker);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    for (size_t i = 0; i < checkNames.size(); i++) {
+        OS::print(fmt::format("[{}]", checks[i]->name()));
+
+        if (cache) {
+            if (checkFailed[i]) {
+                ret_code = 5;
+                OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::red), " FAIL\n");
+                OS::print(fmt::format("{}\n", checkOutputs[i]));
+            }
+            else {
+                OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::green), " PASS\n");
+            }
+        }
+        else if (!mergedDiags[i].empty()) {
             ret_code = 5;
             OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::red), " FAIL\n");
-            const auto& diags = check->getDiagnostics();
-            for (const auto& diag : diags)
-                diagEngine.issue(diag);
-            OS::print(fmt::format("{}\n", textDiagClient->getString()));
-            textDiagClient->clear();
+            auto text = renderDiags(mergedDiags[i]);
+            OS::print(fmt::format("{}\n", text));
         }
         else {
             OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::green), " PASS\n");
         }
     }
 
+    if (cache && !cache->save())
+        OS::printE(fmt::format("slang-tidy: unable to write cache file '{}'\n", *cacheFile));
+
     return ret_code;
 }